@@ -11,6 +11,7 @@
 #include <atta/event/events/windowClose.h>
 
 #include <atta/component/interface.h>
+#include <atta/component/transformInterpolator.h>
 #include <atta/file/interface.h>
 #include <atta/graphics/interface.h>
 #include <atta/memory/interface.h>
@@ -38,6 +39,11 @@ Atta::Atta(const CreateInfo& info) : _shouldFinish(false) {
     _mainAllocator = new memory::StackAllocator(size); // Allocate 1.0GB for the whole system
     memory::registerAllocator(SSID("MainAllocator"), static_cast<memory::Allocator*>(_mainAllocator));
 
+    uint64_t frameSize = 64UL * 1024UL * 1024UL;
+    uint8_t* frameMemory = static_cast<uint8_t*>(_mainAllocator->allocBytes(frameSize, sizeof(uint8_t))); // 64MB for per-step allocations
+    _frameAllocator = new memory::FrameAllocator(frameMemory, frameSize);
+    memory::registerAllocator(SSID("FrameAllocator"), static_cast<memory::Allocator*>(_frameAllocator));
+
     resource::startUp();
     component::startUp();
     graphics::startUp();
@@ -45,6 +51,7 @@ Atta::Atta(const CreateInfo& info) : _shouldFinish(false) {
     physics::startUp();
     sensor::startUp();
     script::startUp();
+    _interpolator = new component::TransformInterpolator();
 
     // Atta is the last one to reveice events
     event::subscribe<event::WindowClose>(BIND_EVENT_FUNC(Atta::onWindowClose));
@@ -67,14 +74,13 @@ Atta::Atta(const CreateInfo& info) : _shouldFinish(false) {
     if (!info.projectFile.empty())
         file::openProject(info.projectFile);
 #endif
-
-    _currStep = _lastStep = std::clock();
 }
 
 Atta::~Atta() {
     // TODO ask user if should close or not
     // file::saveProject();
     file::closeProject();
+    delete _interpolator;
     sensor::shutDown();
     physics::shutDown();
     script::shutDown();
@@ -84,6 +90,7 @@ Atta::~Atta() {
     resource::shutDown();
     file::shutDown();
 
+    delete _frameAllocator;
     delete _mainAllocator;
     LOG_SUCCESS("Atta", "Finished");
 }
@@ -107,43 +114,55 @@ void Atta::run() {
 
 void Atta::loop() {
     PROFILE();
-    _currStep = std::clock();
-    const float timeDiff = float(_currStep - _lastStep) / CLOCKS_PER_SEC;
-
-    if (Config::getState() == Config::State::RUNNING) {
-        if (Config::getDesiredStepSpeed() == 0.0f) {
-            // Step as fast as possible
-            step();
-        } else {
-            // Step with delay to be closer to desired step speed
-            if (timeDiff >= Config::getDt() / Config::getDesiredStepSpeed())
-                step();
-        }
-    } else if (Config::getState() == Config::State::PAUSED && _shouldStep) {
+    StepScheduler& scheduler = Config::getScheduler();
+    const bool running = Config::getState() == Config::State::RUNNING;
+    StepScheduler::Plan plan =
+        scheduler.update(StepScheduler::getWallTime(), running, Config::getDt(), Config::getDesiredStepSpeed(), graphics::getGraphicsFPS());
+
+    // Fixed steps to keep up with the wall time (scaled by the desired step speed)
+    for (unsigned i = 0; i < plan.numSteps && Config::getState() == Config::State::RUNNING; i++)
+        step();
+    if (Config::getState() == Config::State::PAUSED && _shouldStep) {
         _shouldStep = false;
         step();
     }
+    Config::setRealStepSpeed(scheduler.getRealTimeFactor());
 
     script::ProjectScript* project = script::getProjectScript();
     if (project)
         project->onAttaLoop();
 
     file::update();
-    graphics::update();
+    if (plan.render) {
+        // Show the bodies between the last two steps
+        if (Config::getState() == Config::State::RUNNING && Config::getInterpolateTransforms())
+            _interpolator->apply(scheduler.getInterpolationAlpha());
+        graphics::update();
+        _interpolator->restore();
+    }
     resource::update();
+
+    // Wait for the next step or frame instead of spinning
+    scheduler.sleep(StepScheduler::getWallTime());
 }
 
 void Atta::step() {
     PROFILE();
-    const float timeDiff = float(_currStep - _lastStep) / CLOCKS_PER_SEC;
-    Config::setRealStepSpeed(Config::getDt() / timeDiff);
-    _lastStep = _currStep;
+    memory::beginStepHeapStats();
+    const double begin = StepScheduler::getWallTime();
+
+    // Transient allocations from the last step are released
+    _frameAllocator->reset();
+    _interpolator->beginStep();
 
     float dt = Config::getDt(); // Saving dt because project script may change the dt
     physics::update(dt);
     sensor::update(dt);
     script::update(dt);
     Config::getInstance()._time += dt;
+    file::recordStep();
+    memory::endStepHeapStats();
+    Config::getScheduler().addStepTime(float(StepScheduler::getWallTime() - begin));
 }
 
 void Atta::onWindowClose(event::Event& event) { _shouldFinish = true; }
@@ -153,6 +172,7 @@ void Atta::onSimulationStateChange(event::Event& event) {
     switch (event.getType()) {
         case event::SimulationStart::type: {
             Config::getInstance()._state = Config::State::RUNNING;
+            Config::getScheduler().clearHistograms();
             if (project)
                 project->onStart();
             break;
@@ -173,6 +193,7 @@ void Atta::onSimulationStateChange(event::Event& event) {
             Config::getInstance()._state = Config::State::IDLE;
             Config::getInstance()._time = 0.0f;
             Config::getInstance()._realStepSpeed = 0.0f;
+            _interpolator->clear();
             if (project)
                 project->onStop();
             break;
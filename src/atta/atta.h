@@ -2,8 +2,12 @@
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #pragma once
 #include <atta/event/event.h>
+#include <atta/memory/allocators/frameAllocator.h>
 #include <atta/memory/allocators/stackAllocator.h>
-#include <ctime>
+
+namespace atta::component {
+class TransformInterpolator;
+}
 
 namespace atta {
 class Atta {
@@ -26,11 +30,12 @@ class Atta {
 
     // Memory
     memory::StackAllocator* _mainAllocator;
+    memory::FrameAllocator* _frameAllocator; // Transient allocations, reset every step
+
+    component::TransformInterpolator* _interpolator; // Smooth rendering between fixed steps
 
     // State
     bool _shouldFinish;
     bool _shouldStep;
-    clock_t _lastStep;
-    clock_t _currStep;
 };
 } // namespace atta
@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#ifdef ATTA_OS_WEB
+#define ATTA_DIR "/"
+#define ATTA_BUILD_DIR "/"
+#else
+#define ATTA_DIR "/root/repo"
+#define ATTA_BUILD_DIR "/tmp/attab"
+#endif
+
+#define ATTA_VERSION "0.3.10"
+#define ATTA_VERSION_MAJOR 0
+#define ATTA_VERSION_MINOR 3
+#define ATTA_VERSION_PATCH 10
+
+// Directory to look which atta versions are installed
+#define ATTA_INSTALLED_VERSIONS_DIR "/usr/local/"
+
+// Project path when atta is built statically linked to one project
+#ifdef ATTA_STATIC_PROJECT
+
+#ifdef ATTA_OS_WEB
+#define ATTA_STATIC_PROJECT_FILE "/project/project.atta"
+#else
+#define ATTA_STATIC_PROJECT_FILE "OFF"
+#endif
+
+#endif
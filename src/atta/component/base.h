@@ -78,6 +78,7 @@ struct ComponentDescription {
     std::string name;
     std::vector<AttributeDescription> attributeDescriptions;
     unsigned maxInstances = 1024; // Maximum number of component instances
+    unsigned attributesEnd = 0;   // Offset where the attributes end, runtime data after it is not serialized (0 -> sizeof component)
 };
 
 } // namespace atta::component
@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/checkpoint.h>
+#include <atta/component/interface.h>
+#include <atta/event/events/checkpointRestore.h>
+#include <atta/event/events/checkpointSave.h>
+#include <atta/event/events/createComponent.h>
+#include <atta/event/events/createEntity.h>
+#include <atta/event/events/deleteComponent.h>
+#include <atta/event/events/deleteEntity.h>
+#include <atta/utils/config.h>
+
+namespace atta::component {
+
+// Helpers to access the bitmap allocator memory
+static uint8_t* getPoolMemory(memory::BitmapAllocator* pool) { return const_cast<uint8_t*>(pool->getMemory()); }
+static size_t getBitmapSize(memory::BitmapAllocator* pool) { return pool->getSize() - pool->getDataSize(); }
+static size_t getNumBlocks(memory::BitmapAllocator* pool) { return pool->getDataSize() / pool->getBlockSize(); }
+static uint8_t* getBlockMemory(memory::BitmapAllocator* pool, size_t index) {
+    return getPoolMemory(pool) + getBitmapSize(pool) + index * pool->getBlockSize();
+}
+static bool getSnapshotBit(const memory::MemorySnapshot& snapshot, size_t index) { return snapshot.getData()[index / 8] & (1 << (index % 8)); }
+
+Checkpoint::~Checkpoint() { clear(); }
+
+void Checkpoint::save() {
+    PROFILE();
+    clear();
+    Manager& manager = Manager::getInstance();
+
+    // Entity pool
+    Pool entityPool{};
+    entityPool.id = SID("Component_EntityAllocator");
+    entityPool.allocator = memory::getAllocator<memory::BitmapAllocator>(entityPool.id);
+    entityPool.memory = entityPool.allocator->getMemory();
+    entityPool.snapshot.capture(entityPool.allocator->getMemory(), entityPool.allocator->getSize());
+    _pools.push_back(std::move(entityPool));
+
+    // Component pools
+    for (ComponentRegistry* compReg : manager._componentRegistries) {
+        if (!compReg->getPoolCreated())
+            continue;
+        Pool pool{};
+        pool.id = compReg->getId();
+        pool.allocator = memory::getAllocator<memory::BitmapAllocator>(pool.id);
+        pool.memory = pool.allocator->getMemory();
+        pool.registry = compReg;
+        if (compReg->isTriviallyDestructible())
+            pool.snapshot.capture(pool.allocator->getMemory(), pool.allocator->getSize());
+        else {
+            // Only bitmap can be copied, components are deep copied
+            pool.snapshot.capture(pool.allocator->getMemory(), getBitmapSize(pool.allocator));
+            pool.components.resize(pool.allocator->getDataSize());
+            for (size_t i = 0; i < getNumBlocks(pool.allocator); i++)
+                if (pool.allocator->getBlockBit(i))
+                    compReg->copyConstruct(pool.components.data() + i * pool.allocator->getBlockSize(), getBlockMemory(pool.allocator, i));
+        }
+        _pools.push_back(std::move(pool));
+    }
+
+    // Views
+    _entities = manager._entities;
+    _noPrototypeView = manager._noPrototypeView;
+    _cloneView = manager._cloneView;
+    _scriptView = manager._scriptView;
+    _time = Config::getTime();
+    _registryGeneration = manager._registryGeneration;
+
+    // State from other modules
+    event::CheckpointSave e(_moduleState);
+    event::publish(e);
+}
+
+Checkpoint::RestoreInfo Checkpoint::restore() {
+    PROFILE();
+    RestoreInfo info{};
+    if (!isSaved()) {
+        LOG_WARN("component::Checkpoint", "Trying to restore checkpoint that was not saved");
+        return info;
+    }
+    if (!updateRegistries()) {
+        LOG_WARN("component::Checkpoint", "Component layout changed after the checkpoint was saved, the checkpoint was discarded");
+        clear();
+        return info;
+    }
+    Manager& manager = Manager::getInstance();
+
+    // Components that the restore deletes or creates, the owners of deleted components are only known before restoring
+    std::vector<event::DeleteComponent> deletedComponents;
+    std::vector<std::pair<const Pool*, size_t>> createdComponents;
+    for (const Pool& pool : _pools) {
+        if (pool.registry == nullptr)
+            continue;
+        std::vector<EntityId> owners;
+        for (size_t i = 0; i < getNumBlocks(pool.allocator); i++) {
+            bool alive = pool.allocator->getBlockBit(i);
+            if (alive == getSnapshotBit(pool.snapshot, i))
+                continue;
+            if (!alive) {
+                createdComponents.push_back({&pool, i});
+                continue;
+            }
+            if (owners.empty())
+                owners = getOwners(pool);
+            if (owners[i] == -1)
+                continue;
+            event::DeleteComponent e;
+            e.componentId = pool.registry->getId();
+            e.entityId = owners[i];
+            deletedComponents.push_back(e);
+        }
+    }
+    std::vector<EntityId> deletedEntities;
+    std::vector<EntityId> createdEntities;
+    if (manager._entities != _entities) {
+        std::set_difference(manager._entities.begin(), manager._entities.end(), _entities.begin(), _entities.end(),
+                            std::back_inserter(deletedEntities));
+        std::set_difference(_entities.begin(), _entities.end(), manager._entities.begin(), manager._entities.end(),
+                            std::back_inserter(createdEntities));
+    }
+
+    for (Pool& pool : _pools) {
+        info.numPages += pool.snapshot.getNumPages();
+        if (pool.registry == nullptr || pool.registry->isTriviallyDestructible()) {
+            info.numDirtyPages += pool.snapshot.restore(getPoolMemory(pool.allocator));
+            continue;
+        }
+
+        // Components that were alive before restoring the bitmap are already constructed
+        size_t numBlocks = getNumBlocks(pool.allocator);
+        std::vector<bool> constructed(numBlocks);
+        for (size_t i = 0; i < numBlocks; i++)
+            constructed[i] = pool.allocator->getBlockBit(i);
+        info.numDirtyPages += pool.snapshot.restore(getPoolMemory(pool.allocator));
+        for (size_t i = 0; i < numBlocks; i++) {
+            if (!pool.allocator->getBlockBit(i)) {
+                // Component created after the checkpoint
+                if (constructed[i])
+                    pool.registry->destroy(getBlockMemory(pool.allocator, i));
+                continue;
+            }
+            const uint8_t* src = pool.components.data() + i * pool.allocator->getBlockSize();
+            if (constructed[i])
+                pool.registry->copyAssign(getBlockMemory(pool.allocator, i), src);
+            else
+                pool.registry->copyConstruct(getBlockMemory(pool.allocator, i), src);
+        }
+    }
+
+    // Views
+    if (manager._entities != _entities)
+        manager._entities = _entities;
+    if (manager._noPrototypeView != _noPrototypeView)
+        manager._noPrototypeView = _noPrototypeView;
+    if (manager._cloneView != _cloneView)
+        manager._cloneView = _cloneView;
+    if (manager._scriptView != _scriptView)
+        manager._scriptView = _scriptView;
+    if (manager._selectedEntity != -1 && manager._entities.find(manager._selectedEntity) == manager._entities.end())
+        manager._selectedEntity = -1;
+    Config::getInstance()._time = _time;
+
+    // Events are published before the module state is restored, so modules can create/delete the objects first
+    for (event::DeleteComponent& e : deletedComponents)
+        event::publish(e);
+    for (EntityId eid : deletedEntities) {
+        event::DeleteEntity e;
+        e.entityId = eid;
+        event::publish(e);
+    }
+    for (EntityId eid : createdEntities) {
+        event::CreateEntity e;
+        e.entityId = eid;
+        event::publish(e);
+    }
+    std::map<const Pool*, std::vector<EntityId>> owners;
+    for (auto [pool, i] : createdComponents) {
+        if (owners.find(pool) == owners.end())
+            owners[pool] = getOwners(*pool);
+        if (owners[pool][i] == -1)
+            continue;
+        event::CreateComponent e;
+        e.componentId = pool->registry->getId();
+        e.entityId = owners[pool][i];
+        e.component = reinterpret_cast<Component*>(getBlockMemory(pool->allocator, i));
+        event::publish(e);
+    }
+
+    // State from other modules
+    event::CheckpointRestore e(_moduleState);
+    event::publish(e);
+
+    return info;
+}
+
+std::vector<EntityId> Checkpoint::getOwners(const Pool& pool) const {
+    Manager& manager = Manager::getInstance();
+    std::vector<EntityId> owners(getNumBlocks(pool.allocator), -1);
+    for (EntityId eid : manager._entities) {
+        void* component = manager.getEntityBlock(eid)->components[pool.registry->getIndex()];
+        if (component != nullptr)
+            owners[pool.allocator->getIndex(component)] = eid;
+    }
+    return owners;
+}
+
+bool Checkpoint::updateRegistries() {
+    Manager& manager = Manager::getInstance();
+    if (_registryGeneration == manager._registryGeneration)
+        return true;
+
+    // The first pool is the entity pool, it is never reloaded
+    bool sameLayout = true;
+    for (size_t p = 1; p < _pools.size(); p++) {
+        Pool& pool = _pools[p];
+        pool.registry = nullptr;
+        for (ComponentRegistry* compReg : manager._componentRegistries)
+            if (compReg->getId() == pool.id)
+                pool.registry = compReg;
+        pool.allocator = memory::getAllocator<memory::BitmapAllocator>(pool.id);
+        if (pool.registry == nullptr || pool.allocator == nullptr || pool.allocator->getMemory() != pool.memory) {
+            pool.registry = nullptr;
+            pool.allocator = nullptr;
+            sameLayout = false;
+        }
+    }
+    _registryGeneration = manager._registryGeneration;
+    return sameLayout;
+}
+
+void Checkpoint::clear() {
+    updateRegistries();
+    for (Pool& pool : _pools) {
+        // Deep copies of components whose layout changed are not destroyed, the destructor of the old layout was unloaded
+        if (pool.components.empty() || pool.registry == nullptr)
+            continue;
+        // Destroy deep copies
+        const uint8_t* bitmap = pool.snapshot.getData();
+        for (size_t i = 0; i < getNumBlocks(pool.allocator); i++)
+            if (bitmap[i / 8] & (1 << (i % 8)))
+                pool.registry->destroy(pool.components.data() + i * pool.allocator->getBlockSize());
+    }
+    _pools.clear();
+    _moduleState.clear();
+}
+
+} // namespace atta::component
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/base.h>
+#include <atta/component/componentRegistry.h>
+#include <atta/memory/allocators/bitmapAllocator.h>
+#include <atta/memory/memorySnapshot.h>
+
+namespace atta::component {
+
+/// In-memory simulation checkpoint
+/** Saves the entity pool and all component pools so the simulation can be rewound without stopping it (e.g. to reset
+ * episodes). The pools are flat memory, writes to them are tracked per page (memory::MemorySnapshot) and only the
+ * pages written since the checkpoint are copied back. Components that own resources (std::vector members) are deep copied instead.
+ *
+ * Other modules save their state (e.g. physics bodies) when the event::CheckpointSave is published, and restore it when
+ * the event::CheckpointRestore is published. Entities and components that the restore creates or deletes are published
+ * with the usual create/delete events before the event::CheckpointRestore.
+ *
+ * When the script components are reloaded, the registries are looked up again. If the layout of a component changed
+ * (its pool was migrated), the checkpoint can not be restored anymore and is discarded.
+ *
+ * Example:
+ * ```
+ * cmp::Checkpoint checkpoint;
+ * checkpoint.save();
+ * for (int episode = 0; episode < 1000; episode++) {
+ *     runEpisode();
+ *     checkpoint.restore();
+ * }
+ * ```
+ **/
+class Checkpoint final {
+  public:
+    struct RestoreInfo {
+        size_t numPages = 0;      ///< Number of memory pages in the checkpoint
+        size_t numDirtyPages = 0; ///< Number of pages copied back
+    };
+
+    Checkpoint() = default;
+    ~Checkpoint();
+    Checkpoint(const Checkpoint&) = delete;
+    Checkpoint& operator=(const Checkpoint&) = delete;
+
+    void save();
+    RestoreInfo restore();
+    bool isSaved() const { return !_pools.empty(); }
+
+  private:
+    struct Pool {
+        ComponentId id;                  ///< Pool allocator id
+        memory::BitmapAllocator* allocator;
+        const uint8_t* memory;           ///< Pool memory when saved, changes when the pool is migrated to a new layout
+        ComponentRegistry* registry;     ///< Registry of the pool components (nullptr for the entity pool)
+        memory::MemorySnapshot snapshot; ///< Whole pool memory or only the bitmap if the component is not trivially destructible
+        std::vector<uint8_t> components; ///< Deep copies of the components that are not trivially destructible
+    };
+    void clear();
+    /// Look up the registries again if they were reloaded, return false if some component layout changed
+    bool updateRegistries();
+    /// Entity that owns each block of the pool (-1 if free)
+    std::vector<EntityId> getOwners(const Pool& pool) const;
+
+    std::vector<Pool> _pools;
+    std::set<EntityId> _entities;
+    std::set<EntityId> _noPrototypeView;
+    std::set<EntityId> _cloneView;
+    std::set<EntityId> _scriptView;
+    float _time = 0.0f;
+    uint32_t _registryGeneration = 0;
+    std::map<StringHash, std::vector<uint8_t>> _moduleState;
+};
+
+} // namespace atta::component
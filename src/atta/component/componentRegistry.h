@@ -15,10 +15,18 @@ class ComponentRegistry {
 
     virtual ComponentDescription& getDescription() = 0;
     virtual std::vector<uint8_t> getDefault() = 0;
+
+    // Components that own resources (e.g. std::vector members) can not be copied with memcpy
+    virtual bool isTriviallyDestructible() const = 0;
+    virtual void copyConstruct(uint8_t* dst, const uint8_t* src) = 0; ///< Construct copy at uninitialized memory
+    virtual void copyAssign(uint8_t* dst, const uint8_t* src) = 0;    ///< Copy to already constructed component
+    virtual void destroy(uint8_t* ptr) = 0;
     unsigned getSizeof() const { return _sizeof; }
+    unsigned getAttributesEnd() { return getDescription().attributesEnd ? getDescription().attributesEnd : _sizeof; }
+    unsigned getAttributeSize(size_t index);
     std::string getTypeidName() const { return _typeidName; }
     size_t getTypeidHash() const { return _typeidHash; }
-    ComponentId getId() const { return COMPONENT_POOL_SSID_BY_NAME(_typeidName); }
+    ComponentId getId() const { return _id ? _id : COMPONENT_POOL_SSID_BY_NAME(_typeidName); }
     unsigned getIndex() const { return _index; }
     bool getPoolCreated() const { return _poolCreated; }
     void setPoolCreated(bool poolCreated) { _poolCreated = poolCreated; }
@@ -29,6 +37,7 @@ class ComponentRegistry {
     unsigned _sizeof;        // sizeof(T)
     std::string _typeidName; // typeid(T).name()
     size_t _typeidHash;      // typeid(T).hash_code()
+    ComponentId _id = 0;     // Pool id, cached when the pool is created (building the pool name for each lookup is slow)
 
     // Component index starting from 0
     // This index is useful to access the entity component without iterating over the entity block
@@ -41,5 +50,12 @@ class ComponentRegistry {
 };
 
 //---------- Attribute helpers ----------//
+// Each attribute goes until the next attribute, the last one until the end of the attributes
+inline unsigned getAttributeSize(const std::vector<AttributeDescription>& aDescs, unsigned attributesEnd, size_t index) {
+    return (index + 1 < aDescs.size() ? aDescs[index + 1].offset : attributesEnd) - aDescs[index].offset;
+}
+inline unsigned ComponentRegistry::getAttributeSize(size_t index) {
+    return component::getAttributeSize(getDescription().attributeDescriptions, getAttributesEnd(), index);
+}
 inline std::ostream& operator<<(std::ostream& os, ComponentRegistry& c) { return os << c.getDescription().name; }
 } // namespace atta::component
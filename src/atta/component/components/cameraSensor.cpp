@@ -20,10 +20,11 @@ ComponentDescription& TypedComponentRegistry<CameraSensor>::getDescription() {
             {AttributeType::FLOAT32, offsetof(CameraSensor, near), "near", 0.0f, 10000.0f, 0.5f},
             {AttributeType::FLOAT32, offsetof(CameraSensor, fps), "fps", 0.0f, 120.0f},
             {AttributeType::UINT32, offsetof(CameraSensor, cameraType), "cameraType", {}, {}, {}, {"ORTHOGRAPHIC", "PERSPECTIVE"}},
-            {AttributeType::UINT32, offsetof(CameraSensor, rendererType), "rendererType", {}, {}, {}, {"FAST", "PHONG", "PBR"}},
+            {AttributeType::UINT32, offsetof(CameraSensor, rendererType), "rendererType", {}, {}, {}, {"FAST", "PHONG", "PBR", "RAY_TRACED"}},
             {AttributeType::FLOAT32, offsetof(CameraSensor, captureTime), "captureTime"},
         },
-        1024, // Max instances
+        1024,                                 // Max instances
+        offsetof(CameraSensor, sensorHandle), // Attributes end (sensorHandle is managed by sensor::Manager)
     };
 
     return desc;
@@ -33,12 +34,23 @@ const uint8_t* CameraSensor::getImage() {
     if (captureTime < 0.0f)
         return nullptr;
 
-    std::vector<sensor::CameraInfo>& cameraInfos = sensor::getCameraInfos();
-    for (auto& cameraInfo : cameraInfos)
-        if (cameraInfo.component == this)
-            return cameraInfo.data.data();
+    if (sensor::CameraInfo* cameraInfo = sensor::getCameraInfo(this))
+        return cameraInfo->data.data();
     ASSERT(false, "(component::CameraSensor) Could not get camera frame from sensor::Manager.");
     return nullptr;
 }
 
+const float* CameraSensor::getDepth() {
+    if (rendererType != RendererType::RAY_TRACED)
+        return nullptr;
+    return reinterpret_cast<const float*>(getImage());
+}
+
+const EntityId* CameraSensor::getEntityIds() {
+    if (rendererType != RendererType::RAY_TRACED)
+        return nullptr;
+    const uint8_t* image = getImage();
+    return image ? reinterpret_cast<const EntityId*>(image + width * height * sizeof(float)) : nullptr;
+}
+
 } // namespace atta::component
@@ -20,7 +20,9 @@ namespace atta::component {
  */
 struct CameraSensor final : public Component {
     enum class CameraType : uint32_t { ORTHOGRAPHIC = 0, PERSPECTIVE };
-    enum class RendererType : uint32_t { FAST = 0, PHONG, PBR };
+    /// Renderer used to create the camera image
+    /** RAY_TRACED renders depth and entity id images on the CPU, so it does not need a graphics API **/
+    enum class RendererType : uint32_t { FAST = 0, PHONG, PBR, RAY_TRACED };
 
     bool enabled = true;
 
@@ -39,11 +41,22 @@ struct CameraSensor final : public Component {
     /** If negative, the first image was not captured yet **/
     float captureTime = -1.0f;
 
+    uint32_t sensorHandle = UINT32_MAX; ///< Position in the sensor module camera list, managed by sensor::Manager
+
     /// Get image
     /** If captureTime is negative, the first image was not captured
      * yet and a nullptr will be returned
+     *
+     * With the RAY_TRACED renderer, the image is width*height float
+     * depths followed by width*height entity ids (top row first)
      **/
     const uint8_t* getImage();
+    /// Get depth image (distance along the camera front axis, far if nothing was hit)
+    /** Only available with the RAY_TRACED renderer, nullptr otherwise **/
+    const float* getDepth();
+    /// Get entity id image (-1 if nothing was hit)
+    /** Only available with the RAY_TRACED renderer, nullptr otherwise **/
+    const EntityId* getEntityIds();
 };
 ATTA_REGISTER_COMPONENT(CameraSensor);
 template <>
@@ -10,8 +10,10 @@
 #include <atta/component/components/directionalLight.h>
 #include <atta/component/components/environmentLight.h>
 #include <atta/component/components/infraredSensor.h>
+#include <atta/component/components/lidarSensor.h>
 #include <atta/component/components/material.h>
 #include <atta/component/components/mesh.h>
+#include <atta/component/components/meshCollider.h>
 #include <atta/component/components/name.h>
 #include <atta/component/components/pointLight.h>
 #include <atta/component/components/polygonCollider2D.h>
@@ -18,7 +18,8 @@ ComponentDescription& TypedComponentRegistry<InfraredSensor>::getDescription() {
             {AttributeType::FLOAT32, offsetof(InfraredSensor, odr), "odr", 0.01f, 2000.0f, 1.0f},
             {AttributeType::FLOAT32, offsetof(InfraredSensor, gaussianStd), "gaussianStd", 0.0f, 1.0f, 0.001f},
         },
-        1024, // Max instances
+        1024,                                   // Max instances
+        offsetof(InfraredSensor, sensorHandle), // Attributes end (sensorHandle is managed by sensor::Manager)
     };
 
     return desc;
@@ -48,6 +48,8 @@ struct InfraredSensor final : public Component {
     float odr = 2000.0f;
     /// Gaussian standard deviation
     float gaussianStd = 0.0f;
+
+    uint32_t sensorHandle = UINT32_MAX; ///< Position in the sensor module infrared list, managed by sensor::Manager
 };
 ATTA_REGISTER_COMPONENT(InfraredSensor);
 template <>
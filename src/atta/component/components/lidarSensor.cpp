@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/lidarSensor.h>
+#include <atta/sensor/interface.h>
+
+namespace atta::component {
+
+template <>
+ComponentDescription& TypedComponentRegistry<LidarSensor>::getDescription() {
+    static ComponentDescription desc = {
+        "LiDAR Sensor",
+        {
+            {AttributeType::FLOAT32, offsetof(LidarSensor, scanTime), "scanTime"},
+            {AttributeType::BOOL, offsetof(LidarSensor, enabled), "enabled"},
+            {AttributeType::UINT32, offsetof(LidarSensor, horizontalBeams), "horizontalBeams"},
+            {AttributeType::UINT32, offsetof(LidarSensor, verticalBeams), "verticalBeams"},
+            {AttributeType::FLOAT32, offsetof(LidarSensor, horizontalFov), "horizontalFov", 0.0f, 360.0f},
+            {AttributeType::FLOAT32, offsetof(LidarSensor, verticalFov), "verticalFov", 0.0f, 180.0f},
+            {AttributeType::FLOAT32, offsetof(LidarSensor, lowerLimit), "lowerLimit", 0.0f, 1000.0f, 0.01f},
+            {AttributeType::FLOAT32, offsetof(LidarSensor, upperLimit), "upperLimit", 0.0f, 1000.0f, 0.1f},
+            {AttributeType::FLOAT32, offsetof(LidarSensor, rate), "rate", 0.01f, 1000.0f, 1.0f},
+            {AttributeType::FLOAT32, offsetof(LidarSensor, gaussianStd), "gaussianStd", 0.0f, 1.0f, 0.001f},
+        },
+        1024,                                // Max instances
+        offsetof(LidarSensor, sensorHandle), // Attributes end (sensorHandle is managed by sensor::Manager)
+    };
+
+    return desc;
+}
+
+const float* LidarSensor::getRanges() {
+    if (scanTime < 0.0f)
+        return nullptr;
+
+    if (sensor::LidarInfo* lidarInfo = sensor::getLidarInfo(this))
+        return lidarInfo->ranges.data();
+    ASSERT(false, "(component::LidarSensor) Could not get scan from sensor::Manager.");
+    return nullptr;
+}
+
+} // namespace atta::component
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/components/component.h>
+#include <atta/component/interface.h>
+
+namespace atta::component {
+
+/// %Component to create simulated LiDAR sensor
+/** Simulation of a multi-beam range sensor.
+ * The scan is updated automatically by the sensor module with a
+ * frequency close to the scan rate. All beams of all LiDARs are
+ * evaluated with one batched ray cast in the physics system, so the
+ * entities must have a collider component to be detected.
+ *
+ * The beams are distributed uniformly inside the horizontal and
+ * vertical field of view, centered on the entity X axis. With one
+ * vertical beam the LiDAR is planar. When 2D physics is being used,
+ * the beams are projected to the 2D plane.
+ *
+ * The ranges are stored by the sensor module, one row of
+ * horizontalBeams ranges for each vertical beam (from bottom to top).
+ */
+struct LidarSensor final : public Component {
+    /// Time the last scan was generated
+    /** If less than zero, no scan was made yet **/
+    float scanTime = -1.0f;
+    /// Enable sensor scans
+    bool enabled = true;
+    uint32_t horizontalBeams = 360; ///< Number of beams in each row
+    uint32_t verticalBeams = 1;     ///< Number of rows
+    float horizontalFov = 360.0f;   ///< Horizontal field of view in degrees
+    float verticalFov = 30.0f;      ///< Vertical field of view in degrees (ignored with one vertical beam)
+    /// Lower measurement limit
+    /** If the distance is lower than the lower limit, the measurement is clipped to the lower limit **/
+    float lowerLimit = 0.1f;
+    /// Upper measurement limit
+    /** Beams that do not hit anything measure the upper limit **/
+    float upperLimit = 10.0f;
+    /// Scan rate
+    /** Frequency in which the scans are collected, in Hz **/
+    float rate = 10.0f;
+    /// Gaussian standard deviation
+    float gaussianStd = 0.0f;
+
+    uint32_t sensorHandle = UINT32_MAX; ///< Position in the sensor module lidar list, managed by sensor::Manager
+
+    /// Get ranges of the last scan
+    /** If scanTime is negative, the first scan was not made yet
+     * and a nullptr will be returned
+     **/
+    const float* getRanges();
+};
+ATTA_REGISTER_COMPONENT(LidarSensor);
+template <>
+ComponentDescription& TypedComponentRegistry<LidarSensor>::getDescription();
+
+} // namespace atta::component
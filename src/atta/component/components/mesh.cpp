@@ -19,7 +19,12 @@ ComponentDescription& TypedComponentRegistry<Mesh>::getDescription() {
     return desc;
 }
 
-Mesh::Mesh() { sid = *resource::getResources<resource::Mesh>().begin(); }
+Mesh::Mesh() {
+    // Empty sid if no mesh was loaded yet
+    std::vector<StringId> meshes = resource::getResources<resource::Mesh>();
+    if (!meshes.empty())
+        sid = meshes.front();
+}
 
 void Mesh::set(std::string mesh) { sid = StringId(mesh); }
 
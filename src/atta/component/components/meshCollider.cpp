@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/meshCollider.h>
+#include <atta/resource/interface.h>
+#include <atta/resource/resources/mesh.h>
+
+namespace atta::component {
+
+template <>
+ComponentDescription& TypedComponentRegistry<MeshCollider>::getDescription() {
+    static ComponentDescription desc = {
+        "Mesh Collider",
+        {
+            {AttributeType::STRINGID, offsetof(MeshCollider, sid), "sid", {}, {}, {}, {}},
+            {AttributeType::UINT32, offsetof(MeshCollider, type), "type", {}, {}, {}, {"CONVEX_HULL", "TRIANGLE_MESH"}},
+            {AttributeType::VECTOR_FLOAT32, offsetof(MeshCollider, offset), "offset", -2000.0f, 2000.0f, 0.01f},
+        },
+    };
+
+    return desc;
+}
+
+MeshCollider::MeshCollider() {
+    // Empty sid if no mesh was loaded yet
+    std::vector<StringId> meshes = resource::getResources<resource::Mesh>();
+    if (!meshes.empty())
+        sid = meshes.front();
+}
+
+void MeshCollider::set(std::string mesh) { sid = StringId(mesh); }
+
+} // namespace atta::component
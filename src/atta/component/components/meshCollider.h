@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/components/component.h>
+#include <atta/component/interface.h>
+#include <atta/utils/math/vector.h>
+
+namespace atta::component {
+
+/// %Component to create collider from a mesh resource
+/** This collider can be used for 3D physics.
+ *
+ * Transform and RigidBody are necessary for the
+ * entity to be participate in the physics iteration.
+ *
+ * Entities with the same mesh and scale share the same
+ * collision shape, so it is cheap to clone them.
+ */
+struct MeshCollider final : public Component {
+    MeshCollider();
+
+    /// Collision shape type
+    /** There are two types of mesh collider:
+     * - CONVEX_HULL: Convex hull of the mesh vertices, can be used by any rigid body
+     * - TRIANGLE_MESH: Exact mesh triangles, can only be used by STATIC and KINEMATIC rigid
+     *   bodies (a convex hull is used for DYNAMIC rigid bodies)
+     */
+    enum Type : uint32_t { CONVEX_HULL = 0, TRIANGLE_MESH };
+
+    StringId sid;                     ///< Mesh relative path
+    Type type = CONVEX_HULL;          ///< Shape type
+    vec3 offset = {0.0f, 0.0f, 0.0f}; ///< Offset
+
+    void set(std::string mesh);
+};
+ATTA_REGISTER_COMPONENT(MeshCollider)
+template <>
+ComponentDescription& TypedComponentRegistry<MeshCollider>::getDescription();
+
+} // namespace atta::component
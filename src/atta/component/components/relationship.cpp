@@ -3,13 +3,22 @@
 #include <atta/component/components/relationship.h>
 #include <atta/component/components/transform.h>
 #include <atta/component/interface.h>
+#include <atta/event/events/changeParent.h>
+#include <atta/event/interface.h>
 
 namespace atta::component {
 template <>
 ComponentDescription& TypedComponentRegistry<Relationship>::getDescription() {
     static ComponentDescription desc = {
         "Relationship",
-        {{AttributeType::UINT32, offsetof(Relationship, _parent), "parent"}, {AttributeType::CUSTOM, offsetof(Relationship, _children), "children"}},
+        {
+            {AttributeType::UINT32, offsetof(Relationship, _parent), "parent"},
+            {AttributeType::UINT32, offsetof(Relationship, _firstChild), "firstChild"},
+            {AttributeType::UINT32, offsetof(Relationship, _lastChild), "lastChild"},
+            {AttributeType::UINT32, offsetof(Relationship, _prevSibling), "prevSibling"},
+            {AttributeType::UINT32, offsetof(Relationship, _nextSibling), "nextSibling"},
+            {AttributeType::UINT32, offsetof(Relationship, _numChildren), "numChildren"},
+        },
         // Max instances
         1024,
     };
@@ -47,6 +56,7 @@ void Relationship::setParent(Entity parent, Entity child) {
 
     // Update relationship components
     if (canBeParent) {
+        EntityId oldParent = childRel->_parent;
         // Remove old parent
         if (childRel->_parent != -1)
             removeParent(childRel->_parent, child);
@@ -71,8 +81,13 @@ void Relationship::setParent(Entity parent, Entity child) {
         }
 
         // Add new parent
-        parentRel->_children.push_back(child);
-        childRel->_parent = parent;
+        link(parentRel, parent, childRel, child);
+
+        event::ChangeParent event;
+        event.entityId = child;
+        event.oldParent = oldParent;
+        event.newParent = parent;
+        event::publish(event);
     }
 }
 
@@ -91,6 +106,10 @@ void Relationship::removeParent(Entity parent, Entity child) {
         LOG_WARN("component::Relationship", "Trying to remove parent [w]$0[] from child [w]$1[] that does not have a parent", parent, child);
         return;
     }
+    if (childRel->_parent != parent) {
+        LOG_WARN("component::Relationship", "Removed wrong parent [w]$0[] from child [w]$1[]", parent, child);
+        return;
+    }
 
     // If has transform component, change to be relative to the world
     Transform* transform = component::getComponent<Transform>(child);
@@ -105,18 +124,15 @@ void Relationship::removeParent(Entity parent, Entity child) {
         transform->scale = scale;
     }
 
+    if (parentRel)
+        unlink(parentRel, childRel);
     childRel->_parent = -1;
-    if (parentRel) {
-        bool found = false;
-        for (unsigned i = 0; i < parentRel->_children.size(); i++)
-            if (parentRel->_children[i] == child) {
-                parentRel->_children.erase(parentRel->_children.begin() + i);
-                found = true;
-                break;
-            }
-        if (!found)
-            LOG_WARN("component::Relationship", "Removed wrong parent [w]$0[] from child [w]$1[]", parent, child);
-    }
+
+    event::ChangeParent event;
+    event.entityId = child;
+    event.oldParent = parent;
+    event.newParent = -1;
+    event::publish(event);
 }
 
 // Child operations
@@ -124,4 +140,63 @@ void Relationship::addChild(Entity parent, Entity child) { setParent(parent, chi
 
 void Relationship::removeChild(Entity parent, Entity child) { removeParent(parent, child); }
 
+Entity Relationship::get(uint32_t i) const {
+    for (Entity child : getChildren())
+        if (i-- == 0)
+            return child;
+    return -1;
+}
+
+// Iteration
+Relationship::ChildIterator& Relationship::ChildIterator::operator++() {
+    _entity = component::getComponent<Relationship>(_entity)->_nextSibling;
+    return *this;
+}
+
+Relationship::DescendantIterator& Relationship::DescendantIterator::operator++() {
+    Relationship* r = component::getComponent<Relationship>(_entity);
+    if (r->_firstChild != -1) {
+        _entity = r->_firstChild;
+        return *this;
+    }
+    // Go up until finding an entity with next sibling
+    while (_entity != _root) {
+        if (r->_nextSibling != -1) {
+            _entity = r->_nextSibling;
+            return *this;
+        }
+        _entity = r->_parent;
+        r = component::getComponent<Relationship>(_entity);
+    }
+    _entity = -1;
+    return *this;
+}
+
+// Links
+void Relationship::link(Relationship* parentRel, Entity parent, Relationship* childRel, Entity child) {
+    childRel->_parent = parent;
+    childRel->_prevSibling = parentRel->_lastChild;
+    childRel->_nextSibling = -1;
+    if (parentRel->_lastChild != -1)
+        component::getComponent<Relationship>(parentRel->_lastChild)->_nextSibling = child;
+    else
+        parentRel->_firstChild = child;
+    parentRel->_lastChild = child;
+    parentRel->_numChildren++;
+}
+
+void Relationship::unlink(Relationship* parentRel, Relationship* childRel) {
+    if (childRel->_prevSibling != -1)
+        component::getComponent<Relationship>(childRel->_prevSibling)->_nextSibling = childRel->_nextSibling;
+    else
+        parentRel->_firstChild = childRel->_nextSibling;
+    if (childRel->_nextSibling != -1)
+        component::getComponent<Relationship>(childRel->_nextSibling)->_prevSibling = childRel->_prevSibling;
+    else
+        parentRel->_lastChild = childRel->_prevSibling;
+    childRel->_prevSibling = -1;
+    childRel->_nextSibling = -1;
+    parentRel->_numChildren--;
+}
+
 } // namespace atta::component
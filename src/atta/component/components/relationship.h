@@ -7,6 +7,8 @@
 
 namespace atta::component {
 
+class Factory;
+
 /// %Component to define relationship between entitities
 /** Usually relationships are created by making one entity
  * child/parent of another entity using the entity tree.
@@ -15,10 +17,14 @@ namespace atta::component {
  *
  * To keep the hierarchy consistent, the relationship
  * component should only be changed using the available functions.
- * \ref _parent and \ref _children
+ * \ref _parent and the child/sibling links
  * should not be modified directly because this can result in breaking
  * other systems.
  *
+ * The hierarchy is stored as intrusive links (first child, next/previous
+ * sibling), so the component is trivially copyable and walking the
+ * children or descendants does not allocate memory.
+ *
  * The Transform is changed when the relationship component changes
  * so that the entity world transform stays the same
  */
@@ -50,14 +56,69 @@ struct Relationship final : public Component {
      * */
     static void removeChild(Entity parent, Entity child);
 
+    //----- Iteration -----//
+    /// Iterate over the children of an entity, following the sibling links
+    class ChildIterator {
+      public:
+        ChildIterator(Entity entity) : _entity(entity) {}
+        Entity operator*() const { return _entity; }
+        ChildIterator& operator++();
+        bool operator!=(const ChildIterator& other) const { return _entity != other._entity; }
+
+      private:
+        Entity _entity;
+    };
+    /// Iterate over all descendants of an entity in depth-first pre-order
+    /** The iteration goes up using the parent links, so no stack is necessary **/
+    class DescendantIterator {
+      public:
+        DescendantIterator(Entity root, Entity entity) : _root(root), _entity(entity) {}
+        Entity operator*() const { return _entity; }
+        DescendantIterator& operator++();
+        bool operator!=(const DescendantIterator& other) const { return _entity != other._entity; }
+
+      private:
+        Entity _root;
+        Entity _entity;
+    };
+    struct Children {
+        Entity first;
+        uint32_t count;
+        ChildIterator begin() const { return ChildIterator(first); }
+        ChildIterator end() const { return ChildIterator(-1); }
+        uint32_t size() const { return count; }
+    };
+    struct Descendants {
+        Entity root;
+        Entity first;
+        DescendantIterator begin() const { return DescendantIterator(root, first); }
+        DescendantIterator end() const { return DescendantIterator(root, -1); }
+    };
+
     // Get data
-    Entity getParent() { return _parent; }
-    std::vector<Entity> getChildren() { return _children; }
-    Entity get(uint32_t i) { return _children[i]; }
+    Entity getParent() const { return _parent; }
+    Entity getFirstChild() const { return _firstChild; }
+    Entity getNextSibling() const { return _nextSibling; }
+    uint32_t getNumChildren() const { return _numChildren; }
+    Children getChildren() const { return {_firstChild, _numChildren}; }
+    /// Descendants of the entity that owns this component (the entity itself is not included)
+    Descendants getDescendants(Entity self) const { return {self, _firstChild}; }
+    /// Get i-th child, walks the sibling links
+    Entity get(uint32_t i) const;
 
     // Data
     Entity _parent = -1;
-    std::vector<Entity> _children = {};
+    Entity _firstChild = -1;
+    Entity _lastChild = -1;
+    Entity _prevSibling = -1;
+    Entity _nextSibling = -1;
+    uint32_t _numChildren = 0;
+
+  private:
+    friend Factory;
+    /// Link/unlink the child at the end of the parent children list (does not change the transform)
+    static void link(Relationship* parentRel, Entity parent, Relationship* childRel, Entity child);
+    static void unlink(Relationship* parentRel, Relationship* childRel);
 };
 ATTA_REGISTER_COMPONENT(Relationship)
 template <>
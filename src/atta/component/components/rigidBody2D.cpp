@@ -2,6 +2,7 @@
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #include <atta/component/components/rigidBody2D.h>
 #include <atta/physics/engines/box2DEngine.h>
+#include <atta/physics/engines/swarmEngine.h>
 #include <atta/physics/interface.h>
 
 namespace atta::component {
@@ -32,48 +33,60 @@ void RigidBody2D::setTransform(vec2 position, float angle) {
     if (physics::getEngineType() == physics::Engine::BOX2D) {
         std::shared_ptr<physics::Box2DEngine> b2Engine = std::static_pointer_cast<physics::Box2DEngine>(physics::getEngine());
         b2Engine->setTransform(this, position, angle);
+    } else if (physics::getEngineType() == physics::Engine::SWARM) {
+        physics::getEngine<physics::SwarmEngine>()->setTransform(this, position, angle);
     } else
-        LOG_WARN("component::RigidBody2D", "Could not execute [w]setTransform[], box2D is not the current physics engine.");
+        LOG_WARN("component::RigidBody2D", "Could not execute [w]setTransform[], box2D or swarm is not the current physics engine.");
 }
 
 void RigidBody2D::setLinearVelocity(vec2 vel) {
     if (physics::getEngineType() == physics::Engine::BOX2D) {
         std::shared_ptr<physics::Box2DEngine> b2Engine = std::static_pointer_cast<physics::Box2DEngine>(physics::getEngine());
         b2Engine->setLinearVelocity(this, vel);
+    } else if (physics::getEngineType() == physics::Engine::SWARM) {
+        physics::getEngine<physics::SwarmEngine>()->setLinearVelocity(this, vel);
     } else
-        LOG_WARN("component::RigidBody2D", "Could not execute [w]setLinearVelocity[], box2D is not the current physics engine.");
+        LOG_WARN("component::RigidBody2D", "Could not execute [w]setLinearVelocity[], box2D or swarm is not the current physics engine.");
 }
 
 void RigidBody2D::setAngularVelocity(float omega) {
     if (physics::getEngineType() == physics::Engine::BOX2D) {
         std::shared_ptr<physics::Box2DEngine> b2Engine = std::static_pointer_cast<physics::Box2DEngine>(physics::getEngine());
         b2Engine->setAngularVelocity(this, omega);
+    } else if (physics::getEngineType() == physics::Engine::SWARM) {
+        physics::getEngine<physics::SwarmEngine>()->setAngularVelocity(this, omega);
     } else
-        LOG_WARN("component::RigidBody2D", "Could not execute [w]setAngularVelocity[], box2D is not the current physics engine.");
+        LOG_WARN("component::RigidBody2D", "Could not execute [w]setAngularVelocity[], box2D or swarm is not the current physics engine.");
 }
 
 void RigidBody2D::applyForce(vec2 force, vec2 point, bool wake) {
     if (physics::getEngineType() == physics::Engine::BOX2D) {
         std::shared_ptr<physics::Box2DEngine> b2Engine = std::static_pointer_cast<physics::Box2DEngine>(physics::getEngine());
         b2Engine->applyForce(this, force, point, wake);
+    } else if (physics::getEngineType() == physics::Engine::SWARM) {
+        physics::getEngine<physics::SwarmEngine>()->applyForce(this, force, point);
     } else
-        LOG_WARN("component::RigidBody2D", "Could not execute [w]applyForce[], box2D is not the current physics engine.");
+        LOG_WARN("component::RigidBody2D", "Could not execute [w]applyForce[], box2D or swarm is not the current physics engine.");
 }
 
 void RigidBody2D::applyForceToCenter(vec2 force, bool wake) {
     if (physics::getEngineType() == physics::Engine::BOX2D) {
         std::shared_ptr<physics::Box2DEngine> b2Engine = std::static_pointer_cast<physics::Box2DEngine>(physics::getEngine());
         b2Engine->applyForceToCenter(this, force, wake);
+    } else if (physics::getEngineType() == physics::Engine::SWARM) {
+        physics::getEngine<physics::SwarmEngine>()->applyForceToCenter(this, force);
     } else
-        LOG_WARN("component::RigidBody2D", "Could not execute [w]applyForceToCenter[], box2D is not the current physics engine.");
+        LOG_WARN("component::RigidBody2D", "Could not execute [w]applyForceToCenter[], box2D or swarm is not the current physics engine.");
 }
 
 void RigidBody2D::applyTorque(float torque, bool wake) {
     if (physics::getEngineType() == physics::Engine::BOX2D) {
         std::shared_ptr<physics::Box2DEngine> b2Engine = std::static_pointer_cast<physics::Box2DEngine>(physics::getEngine());
         b2Engine->applyTorque(this, torque, wake);
+    } else if (physics::getEngineType() == physics::Engine::SWARM) {
+        physics::getEngine<physics::SwarmEngine>()->applyTorque(this, torque);
     } else
-        LOG_WARN("component::RigidBody2D", "Could not execute [w]applyTorque[], box2D is not the current physics engine.");
+        LOG_WARN("component::RigidBody2D", "Could not execute [w]applyTorque[], box2D or swarm is not the current physics engine.");
 }
 
 } // namespace atta::component
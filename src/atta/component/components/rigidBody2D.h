@@ -17,6 +17,10 @@ namespace atta::component {
  * Rigid bodies has physical properties like density, friction coefficient,
  * and restitution coefficient. The object mass will be dependent on the
  * collider area and material density.
+ *
+ * When the attributes are written during the simulation (e.g. by a
+ * script), component::updateComponent<RigidBody2D> must be called so the
+ * physics engine syncs the body.
  */
 struct RigidBody2D final : public Component {
     /// Rigid body type
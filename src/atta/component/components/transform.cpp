@@ -38,21 +38,26 @@ void Transform::setWorldTransform(EntityId entity, Transform worldTransform) {
     // Convert world transform to local transform by removing all parent transformations.
     // This transformation needs to be applied from the top-most entity to the current entity
 
-    // Build the stack to store hierarchy from top-most entity to the current entity
-    std::stack<EntityId> parentStack;
+    // Count hierarchy depth to store parents from the current entity to the top-most entity
+    size_t depth = 0;
     Relationship* relationship = component::getComponent<Relationship>(entity);
     while (relationship && relationship->getParent() >= 0) {
-        parentStack.push(relationship->getParent());
+        depth++;
         relationship = component::getComponent<Relationship>(relationship->getParent());
     }
 
-    // Apply the transformations from the top-most entity to the current entity
-    while (!parentStack.empty()) {
-        EntityId parent = parentStack.top();
-        parentStack.pop();
+    memory::Scratch scratch;
+    Span<EntityId> parents = scratch.alloc<EntityId>(depth);
+    relationship = component::getComponent<Relationship>(entity);
+    for (size_t i = 0; i < parents.size(); i++) {
+        parents[i] = relationship->getParent();
+        relationship = component::getComponent<Relationship>(parents[i]);
+    }
 
+    // Apply the transformations from the top-most entity to the current entity
+    for (size_t i = parents.size(); i > 0; i--) {
         // Apply the inverse transformation of the parent
-        Transform* ptransform = component::getComponent<Transform>(parent);
+        Transform* ptransform = component::getComponent<Transform>(parents[i - 1]);
         if (ptransform)
             (*this) = (*this) / *ptransform;
     }
@@ -17,6 +17,10 @@ namespace atta::component {
  * coordinate system, if the entity has a parent
  * (Relationship), the local position/orientation/scale
  * can different from the world position/orientation/scale.
+ *
+ * When a rigid body transform is written during the simulation
+ * (e.g. by a script), component::updateComponent<Transform> must
+ * be called so the physics engine moves the body.
  */
 struct Transform final : public Component {
     vec3f position = vec3();     ///< Position
@@ -33,16 +33,20 @@ Entity Entity::getParent() const {
 }
 
 std::vector<Entity> Entity::getChildren() const {
+    std::vector<Entity> children;
     auto r = get<component::Relationship>();
-    if (r)
-        return r->getChildren();
-    return {};
+    if (r) {
+        children.reserve(r->getNumChildren());
+        for (Entity child : r->getChildren())
+            children.push_back(child);
+    }
+    return children;
 }
 
 Entity Entity::getChild(unsigned i) const {
-    std::vector<Entity> children = getChildren();
-    if (i < children.size())
-        return children[i];
+    auto r = get<component::Relationship>();
+    if (r)
+        return r->get(i);
     return -1;
 }
 
@@ -22,6 +22,12 @@ class Entity {
         return component::getComponent<T>(_id);
     }
 
+    /// Notify that the component was written (component::updateComponent)
+    template <typename T>
+    void update() const {
+        component::updateComponent<T>(_id);
+    }
+
     /// Check if entity exists
     bool exists() const;
 
@@ -6,98 +6,138 @@
 #include <atta/component/components/script.h>
 #include <atta/component/factory.h>
 #include <atta/component/interface.h>
+#include <atta/event/events/createClones.h>
+#include <atta/event/interface.h>
 #include <atta/script/interface.h>
 
 namespace atta::component {
-Factory::Factory(Entity prototype) : _prototype(prototype), _numEntitiesCloned(0), _numEntitiesInitialized(0) {
-    _maxClones = _prototype.get<Prototype>()->maxClones;
+Factory::Factory(Entity prototype) : _prototype(prototype), _numEntitiesCloned(0) { _maxClones = _prototype.get<Prototype>()->maxClones; }
+
+void Factory::collectNodes(Entity entity, EntityId parent, Span<Entity> nodes, Span<Relationship> links, size_t& numNodes) {
+    // Nodes are stored in depth-first pre-order, which is also the order of the clone blocks
+    EntityId node = numNodes++;
+    nodes[node] = entity;
+    links[node] = Relationship{};
+    links[node]._parent = parent;
+
+    Relationship* r = entity.get<Relationship>();
+    if (!r)
+        return;
+    for (Entity child : r->getChildren()) {
+        EntityId childNode = numNodes;
+        collectNodes(child, node, nodes, links, numNodes);
+
+        Relationship& l = links[node];
+        links[childNode]._prevSibling = l._lastChild;
+        if (l._lastChild != -1)
+            links[l._lastChild.getId()]._nextSibling = childNode;
+        else
+            l._firstChild = childNode;
+        l._lastChild = childNode;
+        l._numChildren++;
+    }
 }
 
-void Factory::createChildClones(Entity child, Entity parent) {
-    // Create `_maxClones` clones of `child` and set all clones as child of `parent`
+void Factory::createNodeClones(EntityId node, Entity entity, const Relationship& links) {
+    // Create `_maxClones` clones of the prototype node, each component column is allocated and copied at once
     // NOTE EntityId of custom entities/joints not working yet (only relationship being handled)
-
-    Entity firstClone = EntityId(_firstClone) + _numEntitiesInitialized;
-
-    // If the prototype entity has parent, set the parent as parent of clones as well
-    if (parent != -1) {
-        // clang-format off
-        bool parentIsClone =
-            parent.getId() >= _firstClone.getId() &&
-            parent.getId() < EntityId(_firstClone.getId() + _numEntitiesCloned * _maxClones);
-        // clang-format on
-
-        Relationship* r = parent.get<Relationship>();
-        for (unsigned i = 0; i < _maxClones; i++)
-            r->addChild(parentIsClone ? Entity(parent + i) : parent, firstClone + i);
-    }
+    EntityId firstClone = getCloneId(node, 0);
 
     // For every registered component
     for (auto compReg : component::getComponentRegistries()) {
-        // Check if child entity has this component
-        Component* component = component::getComponentById(compReg->getId(), child);
-        if (component) {
-            // Ignore prototype component when clonning
-            // TODO recursive prototypes not supported yet
-            if (compReg->getId() == COMPONENT_POOL_SID_BY_NAME(typeid(Prototype).name()))
-                continue;
-
-            // Get component allocator pool
-            memory::BitmapAllocator* cpool = component::Manager::getInstance().getComponentAllocator(compReg);
-            size_t componentSize = (size_t)compReg->getSizeof();
-
-            // Copy default data from prototype entity component to clone components
-            // TODO components with EntityId variables not handled properly yet
-            if (compReg->getId() != COMPONENT_POOL_SID_BY_NAME(typeid(Relationship).name())) {
-                // Allocate memory for each clone
-                uint8_t* mem = (uint8_t*)cpool->allocBytes(_maxClones * componentSize, componentSize);
-
-                // Initialize component data
-                for (unsigned i = 0; i < _maxClones; i++)
-                    memcpy(mem + componentSize * i, component, componentSize);
-
-                // Add allocated component to clone entities
-                for (unsigned i = 0; i < _maxClones; i++)
-                    component::addComponentPtr(firstClone.getId() + i, compReg->getIndex(), mem + componentSize * i);
-            }
-        }
+        // Check if the prototype node has this component
+        Component* component = component::getComponentById(compReg->getId(), entity);
+        if (!component)
+            continue;
+
+        // Ignore prototype component when clonning
+        // TODO recursive prototypes not supported yet
+        if (compReg->getId() == COMPONENT_POOL_SID_BY_NAME(typeid(Prototype).name()))
+            continue;
+
+        // Allocate memory for all clones
+        memory::BitmapAllocator* cpool = component::Manager::getInstance().getComponentAllocator(compReg);
+        size_t componentSize = (size_t)compReg->getSizeof();
+        uint8_t* mem = (uint8_t*)cpool->allocBytes(_maxClones * componentSize, componentSize);
+        ASSERT(mem != nullptr, "Could not allocate [w]$0[] clones of component [w]$1[]", _maxClones, compReg->getDescription().name);
+
+        // Copy default data from prototype entity component to clone components, doubling the copied range each time
+        // TODO components with EntityId variables not handled properly yet
+        memcpy(mem, component, componentSize);
+        for (uint64_t copied = 1; copied < _maxClones; copied *= 2)
+            memcpy(mem + componentSize * copied, mem, componentSize * std::min(copied, _maxClones - copied));
+
+        // Relationship links point to the prototype hierarchy, map them to the clone hierarchy
+        if (compReg->getId() == COMPONENT_POOL_SID_BY_NAME(typeid(Relationship).name()))
+            for (uint64_t i = 0; i < _maxClones; i++)
+                linkClone(node, i, links, reinterpret_cast<Relationship*>(mem + componentSize * i));
+
+        // Add allocated components to clone entities
+        component::Manager::getInstance().addComponentPtrsImpl(firstClone, _maxClones, compReg->getIndex(), mem);
+    }
+}
+
+void Factory::linkClone(EntityId node, uint64_t i, const Relationship& links, Relationship* r) {
+    auto clone = [&](Entity n) { return n == -1 ? Entity(-1) : Entity(getCloneId(n, i)); };
+    r->_parent = clone(links._parent);
+    r->_firstChild = clone(links._firstChild);
+    r->_lastChild = clone(links._lastChild);
+    r->_prevSibling = clone(links._prevSibling);
+    r->_nextSibling = clone(links._nextSibling);
+    r->_numChildren = links._numChildren;
+
+    // Root clones are siblings appended to the children of the prototype parent
+    if (node == 0 && _prototypeParent != -1) {
+        Relationship* parentRel = _prototypeParent.get<Relationship>();
+        r->_parent = _prototypeParent;
+        r->_prevSibling = i == 0 ? parentRel->_lastChild : Entity(getCloneId(0, i - 1));
+        r->_nextSibling = i + 1 < _maxClones ? Entity(getCloneId(0, i + 1)) : Entity(-1);
     }
-    _numEntitiesInitialized += _maxClones;
-
-    // Recursive clone children
-    Relationship* r = child.get<Relationship>();
-    if (r)
-        for (Entity childToClone : r->getChildren()) // For each child of prototype
-            // Clone prototype child and set as clone child
-            createChildClones(childToClone, firstClone);
 }
 
 void Factory::createClones() {
+    PROFILE();
     // Count number of child entities
     _numEntitiesCloned = 1;
     Relationship* r = _prototype.get<Relationship>();
     if (r) {
-        std::stack<std::vector<Entity>> s;
-        s.push(r->getChildren());
-        while (!s.empty()) {
-            std::vector<Entity> children = s.top();
-            s.pop();
-            _numEntitiesCloned += children.size();
-            for (Entity child : children) {
-                r = child.get<Relationship>();
-                if (r)
-                    s.push(r->getChildren());
-            }
-        }
+        Relationship::Descendants descendants = r->getDescendants(_prototype);
+        for (auto it = descendants.begin(); it != descendants.end(); ++it)
+            _numEntitiesCloned++;
     }
+    _prototypeParent = r ? r->getParent() : Entity(-1);
 
     // Allocate one entity of each clone
     _firstClone = component::Manager::getInstance().createClonesImpl(_maxClones * _numEntitiesCloned);
 
-    // Create and initialize clone components (recursivelly)
-    _numEntitiesInitialized = 0;
-    r = _prototype.get<Relationship>();
-    createChildClones(_prototype, r ? r->getParent() : Entity(-1));
+    // Prototype hierarchy with links as node indices, the clones of node k are [k*_maxClones, (k+1)*_maxClones)
+    memory::Scratch scratch;
+    Span<Entity> nodes = scratch.alloc<Entity>(_numEntitiesCloned);
+    Span<Relationship> links = scratch.alloc<Relationship>(_numEntitiesCloned);
+    ASSERT(nodes.size() == _numEntitiesCloned && links.size() == _numEntitiesCloned, "Prototype [w]$0[] hierarchy is too large", _prototype);
+    size_t numNodes = 0;
+    collectNodes(_prototype, -1, nodes, links, numNodes);
+
+    // Create and initialize clone components
+    for (EntityId node = 0; node < EntityId(numNodes); node++)
+        createNodeClones(node, nodes[node], links[node]);
+
+    // Append root clones to the children of the prototype parent
+    if (_prototypeParent != -1) {
+        Relationship* parentRel = _prototypeParent.get<Relationship>();
+        if (parentRel->_lastChild != -1)
+            parentRel->_lastChild.get<Relationship>()->_nextSibling = _firstClone;
+        else
+            parentRel->_firstChild = _firstClone;
+        parentRel->_lastChild = getCloneId(0, _maxClones - 1);
+        parentRel->_numChildren += _maxClones;
+    }
+
+    // Publish one event for all clones
+    event::CreateClones event;
+    event.firstClone = _firstClone;
+    event.numClones = _maxClones * _numEntitiesCloned;
+    event::publish(event);
 }
 
 void Factory::destroyClones() {
@@ -105,12 +145,11 @@ void Factory::destroyClones() {
     for (int i = _maxClones * _numEntitiesCloned - 1; i >= 0; i--)
         component::deleteEntity(_firstClone.getId() + i);
     _numEntitiesCloned = 0;
-    _numEntitiesInitialized = 0;
 }
 
 void Factory::runScripts(float dt) {
-    unsigned cloneId = 0;
-    for (Entity entity : getClones()) {
+    for (uint64_t i = 0; i < _maxClones; i++) {
+        Entity entity(_firstClone.getId() + i);
         Script* scriptComponent = entity.get<Script>();
         if (scriptComponent) {
             script::Script* script = script::getScript(scriptComponent->sid);
@@ -134,6 +173,13 @@ std::vector<Entity> Factory::getClones(bool includeChildren) const {
     return clones;
 }
 
+Span<Entity> Factory::getClones(memory::Scratch& scratch, bool includeChildren) const {
+    Span<Entity> clones = scratch.alloc<Entity>(includeChildren ? _maxClones * _numEntitiesCloned : _maxClones);
+    for (unsigned i = 0; i < clones.size(); i++)
+        clones[i] = Entity(_firstClone.getId() + i);
+    return clones;
+}
+
 bool Factory::isClone(Entity entity) {
     return entity.getId() >= _firstClone.getId() && entity.getId() < _firstClone.getId() + _maxClones * _numEntitiesCloned;
 }
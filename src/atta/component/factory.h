@@ -3,8 +3,11 @@
 #pragma once
 
 #include <atta/component/entity.h>
+#include <atta/memory/scratch.h>
 
 namespace atta::component {
+struct Relationship;
+
 class Factory {
   public:
     // The entity must be a prototype entity (has prototype component)
@@ -19,17 +22,25 @@ class Factory {
     uint64_t getMaxClones() const;
     uint64_t getNumEntitiesCloned() const;
     std::vector<Entity> getClones(bool includeChildren = false) const;
+    Span<Entity> getClones(memory::Scratch& scratch, bool includeChildren = false) const; ///< Clones in scratch memory
     bool isClone(Entity entity);     ///< Check if entity is clone from this factory
     bool isRootClone(Entity entity); ///< Check if entity is root clone from this factory
 
   private:
-    void createChildClones(Entity child, Entity parent = -1);
+    /// Store the prototype hierarchy in depth-first pre-order, the relationship links are node indices instead of entities
+    void collectNodes(Entity entity, EntityId parent, Span<Entity> nodes, Span<Relationship> links, size_t& numNodes);
+    /// Create the clones of one prototype node, one allocation and copy per component
+    void createNodeClones(EntityId node, Entity entity, const Relationship& links);
+    /// Map the node links to the clone entities
+    void linkClone(EntityId node, uint64_t i, const Relationship& links, Relationship* r);
+    /// Entity of the i-th clone of a prototype node
+    EntityId getCloneId(EntityId node, uint64_t i) const { return _firstClone.getId() + EntityId(node * _maxClones + i); }
 
-    Entity _prototype;   ///< Prototype entity that will be cloned
-    uint64_t _maxClones; ///< Number of clones of each entity to create
-    Entity _firstClone;  ///< First clone created
+    Entity _prototype;       ///< Prototype entity that will be cloned
+    Entity _prototypeParent; ///< Parent of the prototype, the root clones are added as its children
+    uint64_t _maxClones;     ///< Number of clones of each entity to create
+    Entity _firstClone;      ///< First clone created
 
-    uint64_t _numEntitiesCloned;      ///< Number of entities cloned (prototype entity and its children)
-    uint64_t _numEntitiesInitialized; ///< Auxiliary variable to keep track of component creation
+    uint64_t _numEntitiesCloned; ///< Number of entities cloned (prototype entity and its children)
 };
 } // namespace atta::component
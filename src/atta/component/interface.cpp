@@ -1,6 +1,8 @@
 // SPDX-License-Identifier: MIT
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #include <atta/component/interface.h>
+#include <atta/event/events/updateComponent.h>
+#include <atta/event/interface.h>
 
 namespace atta::component {
 
@@ -18,14 +20,24 @@ Component* addComponentById(ComponentId id, Entity entity) { return Manager::get
 Component* addComponentPtr(Entity entity, unsigned index, uint8_t* component) {
     return Manager::getInstance().addComponentPtrImpl(entity, index, component);
 }
+uint8_t* addComponentsById(ComponentId id, Span<const EntityId> entities) { return Manager::getInstance().addComponentsByIdImpl(id, entities); }
 // Get entity component
 Component* getComponentById(ComponentId id, Entity entity) { return Manager::getInstance().getComponentByIdImpl(id, entity); }
 std::vector<Component*> getComponents(Entity entity) { return Manager::getInstance().getComponentsImpl(entity); }
 // Remove entity component
 void removeComponentById(ComponentId id, Entity entity) { Manager::getInstance().removeComponentByIdImpl(id, entity); }
+// Notify component update
+void updateComponentById(ComponentId id, Entity entity) {
+    event::UpdateComponent e;
+    e.componentId = id;
+    e.entityId = entity;
+    e.component = getComponentById(id, entity);
+    event::publish(e);
+}
 
 // Getters
 std::vector<ComponentRegistry*> getComponentRegistries() { return Manager::getInstance().getComponentRegistriesImpl(); }
+uint32_t getRegistryGeneration() { return Manager::getInstance()._registryGeneration; }
 std::vector<Factory>& getFactories() { return Manager::getInstance().getFactoriesImpl(); }
 Factory* getFactory(Entity prototype) { return Manager::getInstance().getFactoryImpl(prototype); }
 
@@ -35,6 +47,10 @@ std::vector<EntityId> getNoPrototypeView() { return Manager::getInstance().getNo
 std::vector<EntityId> getCloneView() { return Manager::getInstance().getCloneViewImpl(); }
 std::vector<EntityId> getNoCloneView() { return Manager::getInstance().getNoCloneViewImpl(); }
 std::vector<EntityId> getScriptView() { return Manager::getInstance().getScriptViewImpl(); }
+Span<EntityId> getEntitiesView(memory::Scratch& scratch) { return Manager::copyView(Manager::getInstance()._entities, scratch); }
+Span<EntityId> getNoPrototypeView(memory::Scratch& scratch) { return Manager::copyView(Manager::getInstance()._noPrototypeView, scratch); }
+Span<EntityId> getCloneView(memory::Scratch& scratch) { return Manager::copyView(Manager::getInstance()._cloneView, scratch); }
+Span<EntityId> getScriptView(memory::Scratch& scratch) { return Manager::copyView(Manager::getInstance()._scriptView, scratch); }
 Entity getSelectedEntity() { return Manager::getInstance()._selectedEntity; }
 void setSelectedEntity(Entity eid) { Manager::getInstance()._selectedEntity = eid; }
 
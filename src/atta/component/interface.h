@@ -5,6 +5,7 @@
 #include <atta/component/base.h>
 #include <atta/component/components/component.h>
 #include <atta/component/typedComponentRegistry.h>
+#include <atta/memory/scratch.h>
 
 namespace atta::component {
 
@@ -25,6 +26,8 @@ template <typename T>
 T* addComponent(Entity entity);
 Component* addComponentById(ComponentId id, Entity entity);
 Component* addComponentPtr(Entity entity, unsigned index, uint8_t* component);
+// Add default components to many entities, the components are contiguous in memory (nullptr if the pool has no contiguous space)
+uint8_t* addComponentsById(ComponentId id, Span<const EntityId> entities);
 
 // Get component
 template <typename T>
@@ -35,8 +38,16 @@ std::vector<Component*> getComponents(Entity entity);
 // Remove component
 void removeComponentById(ComponentId id, Entity entity);
 
+// Notify component update
+// Must be called after writing a component that other modules keep a copy of (e.g. the physics engines only sync the
+// Transform and rigid body components that were updated). Publishes event::UpdateComponent
+template <typename T>
+void updateComponent(Entity entity);
+void updateComponentById(ComponentId id, Entity entity);
+
 // Getters
 std::vector<ComponentRegistry*> getComponentRegistries();
+uint32_t getRegistryGeneration(); // Incremented when the registries are reloaded, cached registries/pools must be looked up again
 std::vector<Factory>& getFactories();
 Factory* getFactory(Entity prototype);
 
@@ -46,6 +57,11 @@ std::vector<EntityId> getNoPrototypeView();
 std::vector<EntityId> getCloneView();
 std::vector<EntityId> getNoCloneView();
 std::vector<EntityId> getScriptView();
+// Views copied to scratch memory, valid until the scratch is destroyed (no heap allocation)
+Span<EntityId> getEntitiesView(memory::Scratch& scratch);
+Span<EntityId> getNoPrototypeView(memory::Scratch& scratch);
+Span<EntityId> getCloneView(memory::Scratch& scratch);
+Span<EntityId> getScriptView(memory::Scratch& scratch);
 Entity getSelectedEntity();
 void setSelectedEntity(Entity entity);
 
@@ -78,4 +94,9 @@ T* getComponent(Entity entity) {
     return Manager::getInstance().getComponentImpl<T>(entity);
 }
 
+template <typename T>
+void updateComponent(Entity entity) {
+    updateComponentById(getId<T>(), entity);
+}
+
 } // namespace atta::component
@@ -118,8 +118,8 @@ Entity Manager::createEntityImpl(EntityId entity, size_t quantity) {
     EntityId eid = static_cast<EntityId>(pool->getIndex(e));
 
     for (EntityId i = eid; i < EntityId(eid + quantity); i++) {
-        _noPrototypeView.insert(i);
-        _entities.insert(i);
+        _noPrototypeView.insert(_noPrototypeView.end(), i);
+        _entities.insert(_entities.end(), i);
     }
 
     // Publish create entity event
@@ -133,10 +133,28 @@ Entity Manager::createEntityImpl(EntityId entity, size_t quantity) {
 EntityId Manager::createClonesImpl(size_t quantity) {
     EntityId eid = createEntityImpl(-1, quantity);
     for (EntityId i = eid; i < eid + EntityId(quantity); i++)
-        _cloneView.insert(i);
+        _cloneView.insert(_cloneView.end(), i);
     return eid;
 }
 
+void Manager::addComponentPtrsImpl(EntityId firstEntity, size_t quantity, unsigned index, uint8_t* components) {
+    DASSERT(firstEntity + quantity <= _maxEntities, "Trying to access entity outside of range");
+    const size_t componentSize = _componentRegistries[index]->getSizeof();
+    const bool isScript = _componentRegistries[index]->getId() == COMPONENT_POOL_SID_BY_NAME(typeid(Script).name());
+
+    EntityBlock* e = getEntityBlock(firstEntity);
+    ASSERT(e != nullptr, "Trying to add component pointers to entity [w]$0[] that was not created", firstEntity);
+    for (size_t i = 0; i < quantity; i++) {
+        DASSERT(e[i].components[index] == nullptr, "Trying to override entity component pointer");
+        e[i].components[index] = components + componentSize * i;
+    }
+
+    // Clones are never prototypes, so only the script view needs to be updated
+    if (isScript)
+        for (EntityId eid = firstEntity; eid < firstEntity + EntityId(quantity); eid++)
+            _scriptView.insert(_scriptView.end(), eid);
+}
+
 void Manager::deleteEntityImpl(Entity entity) {
     EntityId eid = entity.getId();
 
@@ -151,9 +169,9 @@ void Manager::deleteEntityImpl(Entity entity) {
         if (r->getParent() != -1)
             r->removeParent(r->getParent(), eid);
 
-        auto children = r->getChildren();
-        for (auto child : children)
-            deleteEntity(child);
+        // Each deleted child unlinks itself from this entity
+        while (r->getFirstChild() != -1)
+            deleteEntity(r->getFirstChild());
     }
 
     // Delete allocated components
@@ -274,17 +292,11 @@ void Manager::registerComponentImpl(ComponentRegistry* componentRegistry) {
         // registered) Need to keep track of this because registerComponentImpl can be called multiple times for the same component (one time for each
         // translation unit). We need to be sure that will not push the same componentRegistry twice
         _componentRegistriesBackupInfo.push_back(
-            {componentRegistry->getTypeidHash(), ComponentDescription{componentRegistry->getTypeidName()}, false});
+            {componentRegistry->getTypeidHash(), ComponentDescription{componentRegistry->getTypeidName()}, false, componentRegistry->getSizeof()});
     } else {
-        // XXX Not removing old components
-        // LOG_DEBUG("component::Manager", "Reloading component [w]$0[]", componentRegistry->getTypeidName());
-        // If the layout changed: (TODO)
-        //   1. Save entities with old data
-        //   2. Deallocate old memory
-        //   3. Allocate new memory
-        //   4. Change entity component pointer and copy+format component data
-        // If the layout was not changed:
-        //   No nothing
+        // The component was reloaded. The layout is compared after the reload when the description is available (onScriptEvent):
+        //   If the layout was not changed the components are kept in the same pool
+        //   If the layout changed the components are migrated to a new pool (migrateComponentPool)
         if (_componentRegistries[oldIndex] != componentRegistry) {
             // LOG_WARN("component::Manager", "Component registry pointer changed from $0 to $1\n new: $0", _componentRegistries[oldIndex],
             // componentRegistry);
@@ -317,20 +329,201 @@ void Manager::createComponentPool(ComponentRegistry* componentRegistry) {
     // Should not need to calculate this size
     size_t size = ceil(maxCount / 8.0f) + sizeofT * maxCount;
 
-    uint8_t* componentMemory = reinterpret_cast<uint8_t*>(_allocator->allocBytes(size, sizeofT));
+    // Reuse the memory of a pool released by a migration before growing the stack
+    uint8_t* componentMemory = nullptr;
+    for (auto it = _releasedPools.begin(); it != _releasedPools.end(); it++)
+        if (it->size >= size) {
+            componentMemory = it->memory;
+            if (it->size > size)
+                *it = {it->memory + size, it->size - size};
+            else
+                _releasedPools.erase(it);
+            break;
+        }
+    if (!componentMemory)
+        componentMemory = reinterpret_cast<uint8_t*>(_allocator->allocBytes(size, sizeofT));
     DASSERT(componentMemory != nullptr, "Could not allocate component system memory for " + name);
     // LOG_INFO("component::Manager", "Allocated memory for component $0 ($1). $2MB ($5 instances) -> memory space:($3 $4)", name, typeidTName,
     //          maxCount * sizeofT / (1024 * 1024.0f), (void*)(componentMemory), (void*)(componentMemory + maxCount * sizeofT), maxCount);
 
     // Create pool allocator
-    memory::registerAllocator(COMPONENT_POOL_SSID_BY_NAME(typeidTName),
-                              static_cast<memory::Allocator*>(new memory::BitmapAllocator(componentMemory, size, sizeofT)));
+    componentRegistry->_id = COMPONENT_POOL_SSID_BY_NAME(typeidTName);
+    memory::registerAllocator(componentRegistry->_id, static_cast<memory::Allocator*>(new memory::BitmapAllocator(componentMemory, size, sizeofT)));
+}
+
+bool Manager::ComponentRegistryBackupInfo::sameLayout(ComponentRegistry* componentRegistry) const {
+    const ComponentDescription& desc = componentRegistry->getDescription();
+    if (sizeofT != componentRegistry->getSizeof() || description.maxInstances != desc.maxInstances ||
+        description.attributesEnd != desc.attributesEnd || description.attributeDescriptions.size() != desc.attributeDescriptions.size())
+        return false;
+    for (size_t i = 0; i < desc.attributeDescriptions.size(); i++) {
+        const AttributeDescription& oldDesc = description.attributeDescriptions[i];
+        const AttributeDescription& newDesc = desc.attributeDescriptions[i];
+        if (oldDesc.type != newDesc.type || oldDesc.offset != newDesc.offset || oldDesc.name != newDesc.name)
+            return false;
+    }
+    return true;
+}
+
+// The old component code may already be unloaded when a pool is migrated, so the attributes that own memory are destroyed with the engine
+// instantiation of their type. VECTOR_ and MATRIX_ attributes are also used for fixed size vectors (vec3, vec4d), only the attributes that
+// look like a valid atta::vector or atta::matrix are destroyed
+template <typename T>
+static bool isOwningVector(const uint8_t* attribute, size_t size) {
+    if (size < sizeof(vector<T>))
+        return false;
+    const vector<T>* v = reinterpret_cast<const vector<T>*>(attribute);
+    return v->data.size() <= v->data.capacity() && v->n == v->data.size();
+}
+
+template <typename T>
+static void destroyVector(uint8_t* attribute, size_t size) {
+    if (isOwningVector<T>(attribute, size))
+        reinterpret_cast<vector<T>*>(attribute)->~vector<T>();
+}
+
+template <typename T>
+static void destroyMatrix(uint8_t* attribute, size_t size) {
+    if (size < sizeof(matrix<T>))
+        return;
+    matrix<T>* m = reinterpret_cast<matrix<T>*>(attribute);
+    if (m->rows.size() > m->rows.capacity() || m->rows.size() != m->nrows)
+        return;
+    for (const vector<T>& row : m->rows)
+        if (!isOwningVector<T>(reinterpret_cast<const uint8_t*>(&row), sizeof(row)) || row.n != m->ncols)
+            return;
+    m->~matrix<T>();
+}
+
+static void destroyAttribute(AttributeType type, uint8_t* attribute, size_t size) {
+    switch (type) {
+        case AttributeType::VECTOR_BOOL:
+            return destroyVector<bool>(attribute, size);
+        case AttributeType::VECTOR_CHAR:
+            return destroyVector<char>(attribute, size);
+        case AttributeType::VECTOR_INT8:
+            return destroyVector<int8_t>(attribute, size);
+        case AttributeType::VECTOR_INT16:
+            return destroyVector<int16_t>(attribute, size);
+        case AttributeType::VECTOR_INT32:
+            return destroyVector<int>(attribute, size);
+        case AttributeType::VECTOR_INT64:
+            return destroyVector<long>(attribute, size);
+        case AttributeType::VECTOR_UINT8:
+            return destroyVector<uint8_t>(attribute, size);
+        case AttributeType::VECTOR_UINT16:
+            return destroyVector<uint16_t>(attribute, size);
+        case AttributeType::VECTOR_UINT32:
+            return destroyVector<unsigned>(attribute, size);
+        case AttributeType::VECTOR_UINT64:
+            return destroyVector<uint64_t>(attribute, size);
+        case AttributeType::VECTOR_FLOAT32:
+            return destroyVector<float>(attribute, size);
+        case AttributeType::VECTOR_FLOAT64:
+            return destroyVector<double>(attribute, size);
+        case AttributeType::MATRIX_BOOL:
+            return destroyMatrix<bool>(attribute, size);
+        case AttributeType::MATRIX_CHAR:
+            return destroyMatrix<char>(attribute, size);
+        case AttributeType::MATRIX_INT8:
+            return destroyMatrix<int8_t>(attribute, size);
+        case AttributeType::MATRIX_INT16:
+            return destroyMatrix<int16_t>(attribute, size);
+        case AttributeType::MATRIX_INT32:
+            return destroyMatrix<int>(attribute, size);
+        case AttributeType::MATRIX_INT64:
+            return destroyMatrix<long>(attribute, size);
+        case AttributeType::MATRIX_UINT8:
+            return destroyMatrix<uint8_t>(attribute, size);
+        case AttributeType::MATRIX_UINT16:
+            return destroyMatrix<uint16_t>(attribute, size);
+        case AttributeType::MATRIX_UINT32:
+            return destroyMatrix<unsigned>(attribute, size);
+        case AttributeType::MATRIX_UINT64:
+            return destroyMatrix<uint64_t>(attribute, size);
+        case AttributeType::MATRIX_FLOAT32:
+            return destroyMatrix<float>(attribute, size);
+        case AttributeType::MATRIX_FLOAT64:
+            return destroyMatrix<double>(attribute, size);
+        default:
+            return;
+    }
+}
+
+void Manager::migrateComponentPool(ComponentRegistry* componentRegistry, const ComponentRegistryBackupInfo& old) {
+    const std::vector<AttributeDescription>& oldDescs = old.description.attributeDescriptions;
+    const std::vector<AttributeDescription>& newDescs = componentRegistry->getDescription().attributeDescriptions;
+
+    // Attributes with the same name and type are copied to the new layout, the other attributes have the default value.
+    // Attributes that own memory (vectors and matrices) can not be copied byte by byte and also have the default value
+    struct AttributeCopy {
+        unsigned oldOffset;
+        unsigned newOffset;
+        size_t size;
+    };
+    std::vector<AttributeCopy> copies;
+    for (size_t i = 0; i < newDescs.size(); i++) {
+        const AttributeDescription& aDesc = newDescs[i];
+        if (aDesc.type >= AttributeType::VECTOR_BOOL && aDesc.type < AttributeType::QUAT)
+            continue;
+        for (size_t j = 0; j < oldDescs.size(); j++) {
+            if (oldDescs[j].name != aDesc.name || oldDescs[j].type != aDesc.type)
+                continue;
+            size_t newSize = componentRegistry->getAttributeSize(i);
+            size_t oldSize = getAttributeSize(oldDescs, old.description.attributesEnd ? old.description.attributesEnd : old.sizeofT, j);
+            copies.push_back({oldDescs[j].offset, aDesc.offset, std::min(newSize, oldSize)});
+            break;
+        }
+    }
+
+    // Attributes of the old components that may own memory
+    struct AttributeDestroy {
+        AttributeType type;
+        unsigned offset;
+        size_t size;
+    };
+    std::vector<AttributeDestroy> destroys;
+    for (size_t j = 0; j < oldDescs.size(); j++)
+        if (oldDescs[j].type >= AttributeType::VECTOR_BOOL && oldDescs[j].type < AttributeType::QUAT)
+            destroys.push_back(
+                {oldDescs[j].type, oldDescs[j].offset, getAttributeSize(oldDescs, old.description.attributesEnd ? old.description.attributesEnd : old.sizeofT, j)});
+
+    // The old pool memory is released after the migration and reused by the next pool that fits in it
+    memory::BitmapAllocator* oldPool = getComponentAllocator(componentRegistry);
+    createComponentPool(componentRegistry);
+    memory::BitmapAllocator* newPool = getComponentAllocator(componentRegistry);
+
+    // Allocate in entity order to keep clone components contiguous
+    std::vector<uint8_t> defaultInit = componentRegistry->getDefault();
+    unsigned index = componentRegistry->getIndex();
+    size_t numMigrated = 0;
+    for (EntityId eid : _entities) {
+        EntityBlock* e = getEntityBlock(eid);
+        uint8_t* oldComponent = reinterpret_cast<uint8_t*>(e->components[index]);
+        if (!oldComponent)
+            continue;
+        uint8_t* newComponent = newPool->alloc<uint8_t>();
+        ASSERT(newComponent != nullptr, "Could not allocate component [w]$0[] while migrating its layout", componentRegistry->getDescription().name);
+        memcpy(newComponent, defaultInit.data(), componentRegistry->getSizeof());
+        for (const AttributeCopy& copy : copies)
+            memcpy(newComponent + copy.newOffset, oldComponent + copy.oldOffset, copy.size);
+        for (const AttributeDestroy& destroy : destroys)
+            destroyAttribute(destroy.type, oldComponent + destroy.offset, destroy.size);
+        e->components[index] = newComponent;
+        numMigrated++;
+    }
+    _releasedPools.push_back({const_cast<uint8_t*>(oldPool->getMemory()), oldPool->getSize()});
+    delete oldPool;
+
+    LOG_INFO("component::Manager", "Component [w]$0[] layout changed, migrated [w]$1[] components keeping [w]$2[] of [w]$3[] attributes",
+             componentRegistry->getDescription().name, numMigrated, copies.size(), newDescs.size());
 }
 
 void Manager::unregisterCustomComponentsImpl() {
     // Return stack pointer to the point before custom components (free custom component allocators)
     _componentRegistries.resize(_numAttaComponents);
     _allocator->rollback(_customComponentsMarker);
+    _releasedPools.clear();
 }
 
 //----------------------------------------//
@@ -439,6 +632,45 @@ Component* Manager::addComponentPtrImpl(Entity entity, unsigned index, uint8_t*
     return componentPtr;
 }
 
+uint8_t* Manager::addComponentsByIdImpl(ComponentId id, Span<const EntityId> entities) {
+    if (entities.empty())
+        return nullptr;
+
+    // Get component registry
+    ComponentRegistry* compReg = nullptr;
+    for (auto cg : _componentRegistries)
+        if (cg->getId() == id) {
+            compReg = cg;
+            break;
+        }
+    ASSERT(compReg != nullptr, "Trying to add unknown component with id $0", id);
+    for (EntityId eid : entities) {
+        EntityBlock* e = getEntityBlock(eid);
+        ASSERT(e != nullptr, "Trying to add component [w]$0[] to entity [w]$1[] that was not created", compReg->getDescription().name, eid);
+        if (e->components[compReg->getIndex()] != nullptr) {
+            LOG_WARN("component::Manager", "Could not add component [w]$1[] to entity [w]$0[]. The entity [w]$0[] already has the component [w]$1[]",
+                     eid, compReg->getDescription().name);
+            return nullptr;
+        }
+    }
+
+    // Alloc all components at once
+    const size_t componentSize = compReg->getSizeof();
+    memory::BitmapAllocator* cpool = memory::getAllocator<memory::BitmapAllocator>(id);
+    uint8_t* components = static_cast<uint8_t*>(cpool->allocBytes(entities.size() * componentSize, componentSize));
+    if (components == nullptr)
+        return nullptr;
+
+    std::vector<uint8_t> defaultInit = compReg->getDefault();
+    for (size_t i = 0; i < entities.size(); i++)
+        memcpy(components + i * componentSize, defaultInit.data(), componentSize);
+
+    // Views and events are handled as when adding each component pointer
+    for (size_t i = 0; i < entities.size(); i++)
+        addComponentPtrImpl(entities[i], compReg->getIndex(), components + i * componentSize);
+    return components;
+}
+
 void Manager::removeComponentByIdImpl(ComponentId id, Entity entity) {
     EntityId eid = entity.getId();
     DASSERT(eid < (int)_maxEntities, "Trying to access entity outside of range");
@@ -542,6 +774,14 @@ std::vector<EntityId> Manager::getNoCloneViewImpl() {
 
 std::vector<EntityId> Manager::getScriptViewImpl() { return std::vector<EntityId>(_scriptView.begin(), _scriptView.end()); }
 
+Span<EntityId> Manager::copyView(const std::set<EntityId>& view, memory::Scratch& scratch) {
+    Span<EntityId> entities = scratch.alloc<EntityId>(view.size());
+    if (entities.size() != view.size())
+        return {};
+    std::copy(view.begin(), view.end(), entities.begin());
+    return entities;
+}
+
 //----------------------------------------//
 //----------- Memory Management ----------//
 //----------------------------------------//
@@ -595,15 +835,18 @@ void Manager::onMeshEvent(event::Event& event) {
     switch (event.getType()) {
         case event::MeshLoad::type: {
             event::MeshLoad& e = reinterpret_cast<event::MeshLoad&>(event);
-            bool found = false;
-            for (std::string op : TypedComponentRegistry<Mesh>::description->attributeDescriptions[0].options)
-                if (e.sid == op) {
-                    found = true;
-                    break;
-                }
+            // Mesh and MeshCollider have the mesh sid as first attribute
+            for (ComponentDescription* desc : {TypedComponentRegistry<Mesh>::description, TypedComponentRegistry<MeshCollider>::description}) {
+                bool found = false;
+                for (std::string op : desc->attributeDescriptions[0].options)
+                    if (e.sid == op) {
+                        found = true;
+                        break;
+                    }
 
-            if (!found)
-                TypedComponentRegistry<Mesh>::description->attributeDescriptions[0].options.push_back(e.sid.getString());
+                if (!found)
+                    desc->attributeDescriptions[0].options.push_back(e.sid.getString());
+            }
 
             break;
         }
@@ -645,6 +888,17 @@ void Manager::onScriptEvent(event::Event& event) {
     for (StringId script : e.scriptSids)
         TypedComponentRegistry<Script>::description->attributeDescriptions[0].options.push_back(script.getString());
 
+    // Registries were reloaded, so pointers to them or to migrated pools are no longer valid
+    _registryGeneration++;
+
+    // Migrate reloaded components whose layout changed, the components with the same layout are kept in place
+    for (size_t i = 0; i < _componentRegistries.size() && i < _componentRegistriesBackupInfo.size(); i++) {
+        const ComponentRegistryBackupInfo& backup = _componentRegistriesBackupInfo[i];
+        ComponentRegistry* reg = _componentRegistries[i];
+        if (backup.poolCreated && backup.typeidHash == reg->getTypeidHash() && !backup.sameLayout(reg))
+            migrateComponentPool(reg, backup);
+    }
+
     // Created pool to new components if necessary
     createComponentPoolsFromRegistered();
 
@@ -655,7 +909,10 @@ void Manager::onScriptEvent(event::Event& event) {
         crbi.typeidHash = reg->getTypeidHash();
         crbi.description.name = reg->getDescription().name;
         crbi.description.attributeDescriptions = reg->getDescription().attributeDescriptions;
+        crbi.description.maxInstances = reg->getDescription().maxInstances;
+        crbi.description.attributesEnd = reg->getDescription().attributesEnd;
         crbi.poolCreated = true;
+        crbi.sizeofT = reg->getSizeof();
         _componentRegistriesBackupInfo.push_back(crbi);
     }
 }
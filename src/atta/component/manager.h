@@ -18,6 +18,8 @@
 
 namespace atta::component {
 
+class Checkpoint;
+
 constexpr unsigned maxRegisteredComponents = 32;
 constexpr unsigned maxEntities = 1024;
 
@@ -35,12 +37,14 @@ class Manager final {
     friend T* addComponent(Entity entity);
     friend Component* addComponentById(ComponentId id, Entity entity);
     friend Component* addComponentPtr(Entity entity, unsigned index, uint8_t* component);
+    friend uint8_t* addComponentsById(ComponentId id, Span<const EntityId> entities);
     template <typename T>
     friend T* getComponent(Entity entity);
     friend Component* getComponentById(ComponentId id, Entity entity);
     friend std::vector<Component*> getComponents(Entity entity);
     friend void removeComponentById(ComponentId id, Entity entity);
     friend std::vector<ComponentRegistry*> getComponentRegistries();
+    friend uint32_t getRegistryGeneration();
     friend std::vector<Factory>& getFactories();
     friend Factory* getFactory(Entity prototype);
     friend std::vector<EntityId> getEntitiesView();
@@ -48,6 +52,10 @@ class Manager final {
     friend std::vector<EntityId> getCloneView();
     friend std::vector<EntityId> getNoCloneView();
     friend std::vector<EntityId> getScriptView();
+    friend Span<EntityId> getEntitiesView(memory::Scratch& scratch);
+    friend Span<EntityId> getNoPrototypeView(memory::Scratch& scratch);
+    friend Span<EntityId> getCloneView(memory::Scratch& scratch);
+    friend Span<EntityId> getScriptView(memory::Scratch& scratch);
     friend Entity getSelectedEntity();
     friend void setSelectedEntity(Entity entity);
     friend void createDefault();
@@ -74,6 +82,7 @@ class Manager final {
     T* addComponentImpl(Entity entity);
     Component* addComponentByIdImpl(ComponentId id, Entity entity);
     Component* addComponentPtrImpl(Entity entity, unsigned index, uint8_t* component);
+    uint8_t* addComponentsByIdImpl(ComponentId id, Span<const EntityId> entities);
     void removeComponentByIdImpl(ComponentId id, Entity entity);
     template <typename T>
     T* getComponentImpl(Entity entity);
@@ -88,6 +97,7 @@ class Manager final {
     std::vector<EntityId> getCloneViewImpl();
     std::vector<EntityId> getNoCloneViewImpl();
     std::vector<EntityId> getScriptViewImpl();
+    static Span<EntityId> copyView(const std::set<EntityId>& view, memory::Scratch& scratch);
 
     //----- Component management -----//
     void registerComponentImpl(ComponentRegistry* componentRegistry); // Used to register internal components and custom components
@@ -110,16 +120,26 @@ class Manager final {
 
     memory::StackAllocator* _allocator;                     // Used to allocate more memory to component pools
     memory::StackAllocator::Marker _customComponentsMarker; // Marker to free custom components
+    struct ReleasedPool {
+        uint8_t* memory;
+        size_t size;
+    };
+    std::vector<ReleasedPool> _releasedPools; // Stack memory of the pools released by migrations, reused by the next pools
     size_t _numAttaComponents;                              // Used to remove custom components form componentRegistries
     std::vector<ComponentRegistry*> _componentRegistries;   // All registered components
+    uint32_t _registryGeneration = 0;                       // Incremented when the script components are reloaded
 
     // Need to store this because old componentRegistry data is lost when component shared library is reloaded
     struct ComponentRegistryBackupInfo {
         size_t typeidHash;
         ComponentDescription description;
         bool poolCreated;
+        unsigned sizeofT; ///< Used to detect layout changes when the component is reloaded
+        bool sameLayout(ComponentRegistry* componentRegistry) const;
     };
     std::vector<ComponentRegistryBackupInfo> _componentRegistriesBackupInfo;
+    /// Move the components to a new pool with the new layout, attributes with the same name and type are kept
+    void migrateComponentPool(ComponentRegistry* componentRegistry, const ComponentRegistryBackupInfo& old);
 
     // Entity views(TODO create views from template?)
     size_t _maxEntities;                 // Maximum number of entities
@@ -134,11 +154,14 @@ class Manager final {
     void createFactories();
     void destroyFactories();
     EntityId createClonesImpl(size_t quantity);
+    /// Add contiguous components to contiguous entities, no event is published (used to bulk create clones)
+    void addComponentPtrsImpl(EntityId firstEntity, size_t quantity, unsigned index, uint8_t* components);
     std::vector<Factory>& getFactoriesImpl() { return _factories; }
     Factory* getFactoryImpl(Entity prototype);
 
     std::vector<Factory> _factories;
     friend Factory;
+    friend Checkpoint;
 };
 
 } // namespace atta::component
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/checkpoint.h>
+#include <atta/component/components/polygonCollider2D.h>
+#include <atta/component/components/transform.h>
+#include <atta/component/tests/common.h>
+#include <atta/event/events/createComponent.h>
+#include <atta/event/events/deleteComponent.h>
+#include <atta/event/events/deleteEntity.h>
+#include <atta/memory/heapStats.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::component;
+
+namespace {
+
+class Component_Checkpoint : public ::testing::Test {
+  public:
+    void SetUp() override {
+        test::startUp();
+        event::subscribe<event::CreateComponent>(BIND_EVENT_FUNC(Component_Checkpoint::onEvent));
+        event::subscribe<event::DeleteComponent>(BIND_EVENT_FUNC(Component_Checkpoint::onEvent));
+        event::subscribe<event::DeleteEntity>(BIND_EVENT_FUNC(Component_Checkpoint::onEvent));
+    }
+    void TearDown() override {
+        event::unsubscribe<event::CreateComponent>(BIND_EVENT_FUNC(Component_Checkpoint::onEvent));
+        event::unsubscribe<event::DeleteComponent>(BIND_EVENT_FUNC(Component_Checkpoint::onEvent));
+        event::unsubscribe<event::DeleteEntity>(BIND_EVENT_FUNC(Component_Checkpoint::onEvent));
+        component::clear();
+    }
+
+  protected:
+    void onEvent(event::Event& event) {
+        switch (event.getType()) {
+            case event::CreateComponent::type:
+                _created.push_back(reinterpret_cast<event::CreateComponent&>(event).entityId);
+                break;
+            case event::DeleteComponent::type:
+                _deleted.push_back(reinterpret_cast<event::DeleteComponent&>(event).entityId);
+                break;
+            case event::DeleteEntity::type:
+                _deletedEntities.push_back(reinterpret_cast<event::DeleteEntity&>(event).entityId);
+                break;
+            default:
+                break;
+        }
+    }
+    void clearEvents() {
+        _created.clear();
+        _deleted.clear();
+        _deletedEntities.clear();
+    }
+
+    std::vector<EntityId> _created;
+    std::vector<EntityId> _deleted;
+    std::vector<EntityId> _deletedEntities;
+};
+
+TEST_F(Component_Checkpoint, Restore) {
+    Entity a = createEntity();
+    a.add<Transform>()->position = vec3(1.0f, 2.0f, 3.0f);
+    a.add<PolygonCollider2D>()->points = {vec2(0.0f, 0.0f), vec2(1.0f, 0.0f), vec2(0.0f, 1.0f)};
+
+    Checkpoint checkpoint;
+    checkpoint.save();
+
+    // Mutate the entity and create another one
+    a.get<Transform>()->position = vec3(4.0f, 5.0f, 6.0f);
+    a.get<PolygonCollider2D>()->points.push_back(vec2(1.0f, 1.0f));
+    Entity b = createEntity();
+    b.add<Transform>();
+    b.add<PolygonCollider2D>()->points = {vec2(0.0f, 0.0f)};
+    clearEvents();
+
+    checkpoint.restore();
+    EXPECT_EQ(a.get<Transform>()->position, vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(a.get<PolygonCollider2D>()->points.size(), 3);
+    std::vector<EntityId> entities = getEntitiesView();
+    EXPECT_EQ(std::count(entities.begin(), entities.end(), a.getId()), 1);
+    EXPECT_EQ(std::count(entities.begin(), entities.end(), b.getId()), 0);
+
+    // Entity b and its components were deleted by the restore
+    EXPECT_TRUE(_created.empty());
+    EXPECT_EQ(_deleted, std::vector<EntityId>({b.getId(), b.getId()}));
+    EXPECT_EQ(_deletedEntities, std::vector<EntityId>({b.getId()}));
+
+    // Removed component is created back by the restore
+    removeComponentById(getId<Transform>(), a);
+    clearEvents();
+    checkpoint.restore();
+    ASSERT_NE(a.get<Transform>(), nullptr);
+    EXPECT_EQ(a.get<Transform>()->position, vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(_created, std::vector<EntityId>({a.getId()}));
+    EXPECT_TRUE(_deleted.empty());
+}
+
+TEST_F(Component_Checkpoint, DestroyCreatedComponents) {
+    Checkpoint checkpoint;
+    checkpoint.save();
+
+    // Components created after the checkpoint must be destroyed by the restore (heap stats are only counted with ATTA_HEAP_STATS)
+    constexpr int NUM_EPISODES = 100;
+    memory::HeapStats before = memory::getHeapStats();
+    for (int i = 0; i < NUM_EPISODES; i++) {
+        Entity e = createEntity();
+        e.add<PolygonCollider2D>()->points = {vec2(0.0f, 0.0f), vec2(1.0f, 0.0f), vec2(0.0f, 1.0f)};
+        checkpoint.restore();
+    }
+    memory::HeapStats after = memory::getHeapStats();
+    EXPECT_LT((after.numAllocs - after.numFrees) - (before.numAllocs - before.numFrees), NUM_EPISODES);
+}
+
+} // namespace
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/interface.h>
+#include <atta/file/interface.h>
+#include <atta/memory/allocators/stackAllocator.h>
+#include <atta/memory/interface.h>
+#include <atta/resource/interface.h>
+
+namespace atta::component::test {
+
+// All tests run in the same process, so the modules the component module depends on are started only once
+inline void startUp() {
+    static bool started = [] {
+        file::startUp();
+        memory::registerAllocator(SSID("MainAllocator"), static_cast<memory::Allocator*>(new memory::StackAllocator(512 * 1024 * 1024)));
+        resource::startUp();
+        component::startUp();
+        return true;
+    }();
+    (void)started;
+    component::clear();
+}
+
+} // namespace atta::component::test
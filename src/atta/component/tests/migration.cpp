@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/checkpoint.h>
+#include <atta/component/tests/common.h>
+#include <atta/event/events/scriptTarget.h>
+#include <atta/memory/allocators/stackAllocator.h>
+#include <atta/memory/interface.h>
+#include <gtest/gtest.h>
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace atta::component {
+
+// Component whose description is changed by the tests to simulate a script component reload
+struct MigrationTest final : public Component {
+    int a = 0;
+    float b = 0.0f;
+    int c = 7;
+    vector<float> d;
+};
+ATTA_REGISTER_COMPONENT(MigrationTest)
+template <>
+ComponentDescription& TypedComponentRegistry<MigrationTest>::getDescription() {
+    static ComponentDescription desc = {"MigrationTest",
+                                        {
+                                            {AttributeType::INT32, offsetof(MigrationTest, a), "a"},
+                                            {AttributeType::FLOAT32, offsetof(MigrationTest, b), "b"},
+                                            {AttributeType::VECTOR_FLOAT32, offsetof(MigrationTest, d), "d"},
+                                        }};
+    return desc;
+}
+
+} // namespace atta::component
+
+using namespace atta;
+using namespace atta::component;
+
+namespace {
+
+class Component_Migration : public ::testing::Test {
+  public:
+    void SetUp() override {
+        test::startUp();
+        _original = TypedComponentRegistry<MigrationTest>::description->attributeDescriptions;
+        reload(); // Store the current layout
+    }
+    void TearDown() override {
+        component::clear();
+        TypedComponentRegistry<MigrationTest>::description->attributeDescriptions = _original;
+        reload();
+    }
+
+  protected:
+    // Same event that is published after the script components are reloaded
+    void reload() {
+        event::ScriptTarget evt;
+        event::publish(evt);
+    }
+    // Rename b and describe c
+    void changeLayout() {
+        TypedComponentRegistry<MigrationTest>::description->attributeDescriptions = {
+            {AttributeType::INT32, offsetof(MigrationTest, a), "a"},
+            {AttributeType::FLOAT32, offsetof(MigrationTest, b), "renamed"},
+            {AttributeType::INT32, offsetof(MigrationTest, c), "c"},
+            {AttributeType::VECTOR_FLOAT32, offsetof(MigrationTest, d), "d"},
+        };
+    }
+    size_t getUsedMemory() { return static_cast<memory::StackAllocator*>(memory::getAllocator(SSID("ComponentAllocator")))->getUsedMemory(); }
+
+    std::vector<AttributeDescription> _original;
+};
+
+TEST_F(Component_Migration, SameLayoutKeepsPool) {
+    Entity e = createEntity();
+    MigrationTest* m = e.add<MigrationTest>();
+    m->a = 1;
+    m->b = 2.0f;
+    uint32_t generation = getRegistryGeneration();
+
+    reload();
+    EXPECT_EQ(getRegistryGeneration(), generation + 1);
+    EXPECT_EQ(e.get<MigrationTest>(), m);
+    EXPECT_EQ(m->a, 1);
+    EXPECT_EQ(m->b, 2.0f);
+}
+
+TEST_F(Component_Migration, KeepAttributes) {
+    std::vector<Entity> entities;
+    for (int i = 0; i < 10; i++) {
+        Entity e = createEntity();
+        MigrationTest* m = e.add<MigrationTest>();
+        m->a = i;
+        m->b = i * 0.5f;
+        m->c = -i;
+        entities.push_back(e);
+    }
+    MigrationTest* old = entities[0].get<MigrationTest>();
+
+    changeLayout();
+    reload();
+
+    // New pool, a was kept, the renamed and the new attributes have the default value
+    EXPECT_NE(entities[0].get<MigrationTest>(), old);
+    for (int i = 0; i < 10; i++) {
+        MigrationTest* m = entities[i].get<MigrationTest>();
+        ASSERT_NE(m, nullptr);
+        EXPECT_EQ(m->a, i);
+        EXPECT_EQ(m->b, 0.0f);
+        EXPECT_EQ(m->c, 7);
+    }
+}
+
+TEST_F(Component_Migration, ReuseReleasedPool) {
+    createEntity().add<MigrationTest>()->a = 1;
+
+    // The first migration takes a new pool from the stack, the next ones reuse the released pools
+    changeLayout();
+    reload();
+    size_t used = getUsedMemory();
+    for (int i = 0; i < 4; i++) {
+        if (i % 2)
+            changeLayout();
+        else
+            TypedComponentRegistry<MigrationTest>::description->attributeDescriptions = _original;
+        reload();
+    }
+    EXPECT_EQ(getUsedMemory(), used);
+}
+
+TEST_F(Component_Migration, DestroyOwningAttributes) {
+#ifndef __GLIBC__
+    GTEST_SKIP() << "Allocated heap memory is measured with mallinfo2";
+#else
+    constexpr size_t numFloats = 16 * 1024; // Below the mmap threshold, counted as allocated heap memory
+    std::vector<Entity> entities;
+    for (int i = 0; i < 10; i++) {
+        Entity e = createEntity();
+        e.add<MigrationTest>()->d = vector<float>(numFloats, 1.0f);
+        entities.push_back(e);
+    }
+
+    // The vectors of the old components are freed, the migrated ones have the default value
+    size_t allocated = mallinfo2().uordblks;
+    changeLayout();
+    reload();
+    EXPECT_LE(mallinfo2().uordblks + 9 * numFloats * sizeof(float), allocated);
+    for (Entity e : entities)
+        EXPECT_EQ(e.get<MigrationTest>()->d.n, 0u);
+#endif
+}
+
+TEST_F(Component_Migration, CheckpointRefreshesRegistries) {
+    Entity e = createEntity();
+    e.add<MigrationTest>()->a = 1;
+    Checkpoint checkpoint;
+    checkpoint.save();
+    e.get<MigrationTest>()->a = 2;
+
+    // Same layout, the checkpoint is still valid after the reload
+    reload();
+    checkpoint.restore();
+    EXPECT_TRUE(checkpoint.isSaved());
+    EXPECT_EQ(e.get<MigrationTest>()->a, 1);
+
+    // Layout changed, the checkpoint points to the old pool and is discarded
+    e.get<MigrationTest>()->a = 3;
+    changeLayout();
+    reload();
+    checkpoint.restore();
+    EXPECT_FALSE(checkpoint.isSaved());
+    EXPECT_EQ(e.get<MigrationTest>()->a, 3);
+}
+
+} // namespace
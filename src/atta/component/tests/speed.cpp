@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/checkpoint.h>
+#include <atta/component/components/prototype.h>
+#include <atta/component/components/relationship.h>
+#include <atta/component/components/rigidBody2D.h>
+#include <atta/component/components/transform.h>
+#include <atta/component/factory.h>
+#include <atta/component/tests/common.h>
+#include <atta/event/events/simulationStart.h>
+#include <atta/event/events/simulationStop.h>
+#include <atta/event/interface.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::component;
+
+namespace {
+constexpr int NUM_ENTITIES = 500;
+constexpr int NUM_EPISODES = 1000;
+constexpr int NUM_CREATED = 10;
+constexpr int NUM_NODES = 10;  // Prototype entity and its children
+constexpr int NUM_CLONES = 90; // Clones of each node, the clones must fit the entity pool
+constexpr int NUM_STARTS = 50;
+
+class Component_Speed : public ::testing::Test {
+  public:
+    void SetUp() override { test::startUp(); }
+    void TearDown() override { component::clear(); }
+};
+
+// Reset episodes with a checkpoint, each episode moves all entities and creates some new ones
+TEST_F(Component_Speed, CheckpointEpisodes) {
+    for (int i = 0; i < NUM_ENTITIES; i++) {
+        Entity e = createEntity();
+        e.add<Transform>()->position = vec3(float(i), 0.0f, 0.0f);
+        e.add<RigidBody2D>();
+    }
+
+    Checkpoint checkpoint;
+    checkpoint.save();
+    size_t numDirtyPages = 0;
+    auto begin = std::chrono::steady_clock::now();
+    for (int episode = 0; episode < NUM_EPISODES; episode++) {
+        for (EntityId eid : getEntitiesView())
+            Entity(eid).get<Transform>()->position.y += 1.0f;
+        for (int i = 0; i < NUM_CREATED; i++)
+            createEntity().add<Transform>();
+        numDirtyPages += checkpoint.restore().numDirtyPages;
+    }
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - begin;
+    EXPECT_EQ(getEntitiesView().size(), NUM_ENTITIES);
+    RecordProperty("episodesPerSecond", int(NUM_EPISODES / seconds.count()));
+    RecordProperty("dirtyPagesPerRestore", int(numDirtyPages / NUM_EPISODES));
+}
+
+// Simulation start latency, the factory clones the prototype hierarchy on each start and deletes the clones on stop
+TEST_F(Component_Speed, SimulationStart) {
+    Entity prototype = createEntity();
+    prototype.add<Prototype>()->maxClones = NUM_CLONES;
+    prototype.add<Transform>();
+    prototype.add<RigidBody2D>();
+    for (int i = 1; i < NUM_NODES; i++) {
+        Entity child = createEntity();
+        child.add<Transform>()->position = vec3(float(i), 0.0f, 0.0f);
+        child.add<RigidBody2D>();
+        Relationship::setParent(prototype, child);
+    }
+
+    double startSeconds = 0.0;
+    for (int i = 0; i < NUM_STARTS; i++) {
+        auto begin = std::chrono::steady_clock::now();
+        event::SimulationStart start;
+        event::publish(start);
+        startSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - begin).count();
+
+        ASSERT_EQ(getFactories().size(), 1u);
+        Factory& factory = getFactories()[0];
+        ASSERT_EQ(factory.getNumEntitiesCloned(), NUM_NODES);
+        EXPECT_EQ(getEntitiesView().size(), NUM_NODES * (NUM_CLONES + 1));
+        Relationship* r = factory.getFirstClone().get<Relationship>();
+        ASSERT_NE(r, nullptr);
+        EXPECT_EQ(r->getChildren().size(), NUM_NODES - 1);
+
+        event::SimulationStop stop;
+        event::publish(stop);
+        EXPECT_EQ(getEntitiesView().size(), NUM_NODES);
+    }
+    RecordProperty("startMs", std::to_string(startSeconds * 1000.0 / NUM_STARTS));
+    RecordProperty("clonesPerSecond", int(NUM_NODES * NUM_CLONES * NUM_STARTS / startSeconds));
+}
+
+} // namespace
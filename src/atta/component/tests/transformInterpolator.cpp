@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/rigidBody2D.h>
+#include <atta/component/tests/common.h>
+#include <atta/component/transformInterpolator.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::component;
+
+namespace {
+
+class Component_TransformInterpolator : public ::testing::Test {
+  public:
+    void SetUp() override { test::startUp(); }
+    void TearDown() override { component::clear(); }
+
+  protected:
+    Entity createBody(vec3 position) {
+        Entity e = createEntity();
+        e.add<Transform>()->position = position;
+        e.add<RigidBody2D>();
+        return e;
+    }
+};
+
+TEST_F(Component_TransformInterpolator, ApplyRestore) {
+    Entity e = createBody(vec3(0.0f));
+    TransformInterpolator interpolator;
+    interpolator.beginStep();
+    e.get<Transform>()->position = vec3(10.0f, 0.0f, 0.0f);
+
+    interpolator.apply(0.5f);
+    EXPECT_EQ(e.get<Transform>()->position, vec3(5.0f, 0.0f, 0.0f));
+    interpolator.restore();
+    EXPECT_EQ(e.get<Transform>()->position, vec3(10.0f, 0.0f, 0.0f));
+
+    // Transforms edited while the interpolation is applied are kept
+    interpolator.apply(0.5f);
+    e.get<Transform>()->position = vec3(1.0f, 2.0f, 3.0f);
+    interpolator.restore();
+    EXPECT_EQ(e.get<Transform>()->position, vec3(1.0f, 2.0f, 3.0f));
+}
+
+TEST_F(Component_TransformInterpolator, ComponentChangeRestores) {
+    Entity e = createBody(vec3(0.0f));
+    TransformInterpolator interpolator;
+    interpolator.beginStep();
+    e.get<Transform>()->position = vec3(10.0f, 0.0f, 0.0f);
+    interpolator.apply(0.5f);
+
+    // The simulated transform is restored before the bodies are found again
+    createEntity().add<Transform>();
+    EXPECT_EQ(e.get<Transform>()->position, vec3(10.0f, 0.0f, 0.0f));
+
+    // The next step starts from the simulated transform
+    interpolator.beginStep();
+    e.get<Transform>()->position = vec3(20.0f, 0.0f, 0.0f);
+    interpolator.apply(0.5f);
+    EXPECT_EQ(e.get<Transform>()->position, vec3(15.0f, 0.0f, 0.0f));
+    interpolator.restore();
+}
+
+TEST_F(Component_TransformInterpolator, DeleteBody) {
+    Entity a = createBody(vec3(0.0f));
+    Entity b = createBody(vec3(0.0f));
+    TransformInterpolator interpolator;
+    interpolator.beginStep();
+    a.get<Transform>()->position = vec3(10.0f, 0.0f, 0.0f);
+    b.get<Transform>()->position = vec3(10.0f, 0.0f, 0.0f);
+    interpolator.apply(0.5f);
+
+    deleteEntity(b);
+    EXPECT_EQ(a.get<Transform>()->position, vec3(10.0f, 0.0f, 0.0f));
+    interpolator.restore();
+    EXPECT_EQ(a.get<Transform>()->position, vec3(10.0f, 0.0f, 0.0f));
+}
+
+} // namespace
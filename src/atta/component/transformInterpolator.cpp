@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/rigidBody.h>
+#include <atta/component/components/rigidBody2D.h>
+#include <atta/component/interface.h>
+#include <atta/component/transformInterpolator.h>
+#include <atta/event/events/checkpointRestore.h>
+#include <atta/event/events/createClones.h>
+#include <atta/event/events/createComponent.h>
+#include <atta/event/events/deleteComponent.h>
+#include <atta/event/events/deleteEntity.h>
+
+namespace atta::component {
+
+TransformInterpolator::TransformInterpolator() : _hasStep(false), _applied(false), _outdated(true) {
+    event::subscribe<event::CreateComponent>(BIND_EVENT_FUNC(TransformInterpolator::onComponentChange));
+    event::subscribe<event::CreateClones>(BIND_EVENT_FUNC(TransformInterpolator::onComponentChange));
+    event::subscribe<event::DeleteComponent>(BIND_EVENT_FUNC(TransformInterpolator::onComponentChange));
+    event::subscribe<event::DeleteEntity>(BIND_EVENT_FUNC(TransformInterpolator::onComponentChange));
+    event::subscribe<event::CheckpointRestore>(BIND_EVENT_FUNC(TransformInterpolator::onComponentChange));
+}
+
+TransformInterpolator::~TransformInterpolator() {
+    event::unsubscribe<event::CreateComponent>(BIND_EVENT_FUNC(TransformInterpolator::onComponentChange));
+    event::unsubscribe<event::CreateClones>(BIND_EVENT_FUNC(TransformInterpolator::onComponentChange));
+    event::unsubscribe<event::DeleteComponent>(BIND_EVENT_FUNC(TransformInterpolator::onComponentChange));
+    event::unsubscribe<event::DeleteEntity>(BIND_EVENT_FUNC(TransformInterpolator::onComponentChange));
+    event::unsubscribe<event::CheckpointRestore>(BIND_EVENT_FUNC(TransformInterpolator::onComponentChange));
+}
+
+void TransformInterpolator::onComponentChange(event::Event& event) {
+    // Component pointers may be invalid, the transforms are stored again in the next step. The simulated transforms are
+    // restored first, otherwise the interpolated transforms that are shown would be simulated in the next step
+    _outdated = true;
+    restore();
+    _hasStep = false;
+}
+
+void TransformInterpolator::update() {
+    _bodies.clear();
+    for (EntityId entity : getNoPrototypeView()) {
+        Transform* t = getComponent<Transform>(entity);
+        if (t && (getComponent<RigidBody>(entity) || getComponent<RigidBody2D>(entity)))
+            _bodies.push_back({entity, t, vec3(), quat(), vec3(), quat(), vec3(), quat()});
+    }
+    _outdated = false;
+}
+
+void TransformInterpolator::beginStep() {
+    PROFILE();
+    if (_applied)
+        restore();
+    if (_outdated)
+        update();
+    for (Body& body : _bodies) {
+        body.previousPosition = body.transform->position;
+        body.previousOrientation = body.transform->orientation;
+    }
+    _hasStep = true;
+}
+
+void TransformInterpolator::apply(float alpha) {
+    PROFILE();
+    if (!_hasStep || _applied || alpha >= 1.0f)
+        return;
+    for (Body& body : _bodies) {
+        Transform* t = body.transform;
+        vec3 position = body.previousPosition + (t->position - body.previousPosition) * alpha;
+
+        // Normalized linear interpolation, the orientations of consecutive steps are close
+        quat q0 = body.previousOrientation;
+        quat q1 = t->orientation;
+        float sign = q0.r * q1.r + q0.i * q1.i + q0.j * q1.j + q0.k * q1.k < 0.0f ? -1.0f : 1.0f;
+        quat orientation(q0.r + (sign * q1.r - q0.r) * alpha, q0.i + (sign * q1.i - q0.i) * alpha, q0.j + (sign * q1.j - q0.j) * alpha,
+                         q0.k + (sign * q1.k - q0.k) * alpha);
+        orientation.normalize();
+
+        // Keep the simulated transform to restore it after rendering
+        body.position = t->position;
+        body.orientation = t->orientation;
+        body.shownPosition = t->position = position;
+        body.shownOrientation = t->orientation = orientation;
+    }
+    _applied = true;
+}
+
+void TransformInterpolator::restore() {
+    if (!_applied)
+        return;
+    // Bodies may have been deleted after apply if the components changed
+    std::vector<EntityId> entities;
+    if (_outdated)
+        entities = getEntitiesView();
+    for (Body& body : _bodies) {
+        bool deleted = _outdated && (!std::binary_search(entities.begin(), entities.end(), body.entity) ||
+                                     getComponent<Transform>(body.entity) != body.transform);
+        if (deleted)
+            continue;
+        Transform* t = body.transform;
+        if (t->position == body.shownPosition)
+            t->position = body.position;
+        if (t->orientation == body.shownOrientation)
+            t->orientation = body.orientation;
+    }
+    _applied = false;
+}
+
+void TransformInterpolator::clear() {
+    restore();
+    _hasStep = false;
+}
+
+} // namespace atta::component
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/components/transform.h>
+#include <atta/event/event.h>
+
+namespace atta::component {
+
+/// Interpolate the rendered transforms of rigid bodies between simulation steps
+/** When frames are rendered between two fixed steps, the bodies are shown where they would be at the frame time
+ * instead of jumping at each step. The interpolated transforms are written to the Transform components only while the
+ * frame is rendered, and the simulated transforms are restored after it.
+ **/
+class TransformInterpolator final {
+  public:
+    TransformInterpolator();
+    ~TransformInterpolator();
+
+    /// Store the transforms before the simulation step
+    void beginStep();
+    /// Write the transforms interpolated between the previous and the current step
+    /** @param alpha 0 shows the previous step, 1 shows the current step **/
+    void apply(float alpha);
+    /// Restore the simulated transforms, transforms that were edited after apply (e.g. by the UI) are kept
+    void restore();
+    /// Forget the previous step (e.g. when the simulation stops)
+    void clear();
+
+  private:
+    void onComponentChange(event::Event& event);
+    void update();
+
+    struct Body {
+        EntityId entity;
+        Transform* transform;
+        vec3 previousPosition;    ///< Position before the step
+        quat previousOrientation; ///< Orientation before the step
+        vec3 position;            ///< Simulated position, stored while the interpolation is applied
+        quat orientation;         ///< Simulated orientation, stored while the interpolation is applied
+        vec3 shownPosition;       ///< Interpolated position
+        quat shownOrientation;    ///< Interpolated orientation
+    };
+    std::vector<Body> _bodies;
+    bool _hasStep;  ///< If the previous transforms were stored
+    bool _applied;  ///< If the interpolated transforms are in the components
+    bool _outdated; ///< If the bodies need to be found again
+};
+
+} // namespace atta::component
@@ -25,6 +25,11 @@ class TypedComponentRegistry : public ComponentRegistry {
 
     std::vector<uint8_t> getDefault() override;
 
+    bool isTriviallyDestructible() const override { return std::is_trivially_destructible_v<T>; }
+    void copyConstruct(uint8_t* dst, const uint8_t* src) override { new (dst) T(*reinterpret_cast<const T*>(src)); }
+    void copyAssign(uint8_t* dst, const uint8_t* src) override { *reinterpret_cast<T*>(dst) = *reinterpret_cast<const T*>(src); }
+    void destroy(uint8_t* ptr) override { reinterpret_cast<T*>(ptr)->~T(); }
+
     ComponentDescription& getDescription() override;
     static ComponentDescription* description;
 
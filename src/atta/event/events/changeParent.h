@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/component/interface.h>
+#include <atta/event/event.h>
+
+namespace atta::event {
+
+/// Published when the parent of an entity is set or removed
+class ChangeParent : public EventTyped<SID("ChangeParent")> {
+  public:
+    component::EntityId entityId;
+    component::EntityId oldParent; ///< -1 if the entity was a root
+    component::EntityId newParent; ///< -1 if the entity is now a root
+};
+
+} // namespace atta::event
@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/event/event.h>
+
+namespace atta::event {
+
+/// Published after the component pools were restored from a simulation checkpoint
+class CheckpointRestore : public EventTyped<SID("CheckpointRestore")> {
+  public:
+    CheckpointRestore(const std::map<StringHash, std::vector<uint8_t>>& state_) : state(state_) {}
+
+    const std::map<StringHash, std::vector<uint8_t>>& state; ///< Module state saved by CheckpointSave
+};
+
+} // namespace atta::event
@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/event/event.h>
+
+namespace atta::event {
+
+/// Published when a simulation checkpoint is saved
+/** Modules that keep simulation state outside the component pools (e.g. physics engine) should add it to the state map **/
+class CheckpointSave : public EventTyped<SID("CheckpointSave")> {
+  public:
+    CheckpointSave(std::map<StringHash, std::vector<uint8_t>>& state_) : state(state_) {}
+
+    std::map<StringHash, std::vector<uint8_t>>& state; ///< Module state by module name
+};
+
+} // namespace atta::event
@@ -0,0 +1,19 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/component/interface.h>
+#include <atta/event/event.h>
+
+namespace atta::event {
+
+/// Published once when a factory creates its clones
+/** The clone components are added in bulk, so no CreateComponent event is published for them. The clones are the
+ * entities [firstClone, firstClone + numClones)
+ **/
+class CreateClones : public EventTyped<SID("CreateClones")> {
+  public:
+    component::EntityId firstClone;
+    size_t numClones; ///< Clones of the prototype and of its children
+};
+
+} // namespace atta::event
@@ -0,0 +1,17 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/component/interface.h>
+#include <atta/event/event.h>
+
+namespace atta::event {
+
+/// Component written outside of the module that simulates it (e.g. by a script or the UI)
+class UpdateComponent : public EventTyped<SID("UpdateComponent")> {
+  public:
+    component::ComponentId componentId;
+    component::EntityId entityId;
+    component::Component* component;
+};
+
+} // namespace atta::event
@@ -2,6 +2,7 @@
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #include <atta/file/interface.h>
 #include <atta/file/manager.h>
+#include <atta/utils/config.h>
 
 namespace atta::file {
 
@@ -11,7 +12,7 @@ void shutDown() { Manager::getInstance().shutDownImpl(); }
 //----- Project -----//
 bool openProject(fs::path projectFile) { return Manager::getInstance().openProjectImpl(projectFile); }
 bool createProject(fs::path projectFile) { return Manager::getInstance().createProjectImpl(projectFile); }
-void saveProject() { Manager::getInstance().saveProjectImpl(); }
+void saveProject(Project::Format format) { Manager::getInstance().saveProjectImpl(format); }
 void closeProject() { Manager::getInstance().closeProjectImpl(); }
 bool isProjectOpen() { return Manager::getInstance().isProjectOpenImpl(); }
 std::shared_ptr<Project> getProject() { return Manager::getInstance().getProjectImpl(); }
@@ -25,6 +26,22 @@ void getComponentIO(cmp::ComponentId cid, std::optional<SerializeFunc>& serializ
     Manager::getInstance().getComponentIOImpl(cid, serialize, deserialize);
 }
 
+//----- Recording -----//
+void startRecording(fs::path file, std::vector<cmp::ComponentId> components, uint32_t stepInterval) {
+    Manager::getInstance().startRecordingImpl(file, components, stepInterval);
+}
+void stopRecording() { Manager::getInstance().stopRecordingImpl(); }
+bool isRecording() { return Manager::getInstance()._recorder != nullptr; }
+void recordStep() {
+    if (Manager::getInstance()._recorder)
+        Manager::getInstance()._recorder->step(Config::getTime());
+}
+
+//----- Playback -----//
+bool openPlayback(fs::path file) { return Manager::getInstance().openPlaybackImpl(file); }
+void closePlayback() { Manager::getInstance()._player.reset(); }
+Player* getPlayback() { return Manager::getInstance()._player.get(); }
+
 //----- Path -----//
 fs::path solveResourcePath(fs::path relativePath, bool mustExist) { return Manager::getInstance().solveResourcePathImpl(relativePath, mustExist); }
 
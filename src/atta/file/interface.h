@@ -8,13 +8,15 @@
 
 namespace atta::file {
 
+class Player;
+
 void startUp();
 void shutDown();
 
 //----- Project -----//
 bool openProject(fs::path projectFile);
 bool createProject(fs::path projectFile);
-void saveProject();
+void saveProject(Project::Format format = Project::Format::TEXT);
 void closeProject();
 bool isProjectOpen();
 std::shared_ptr<Project> getProject();
@@ -30,6 +32,20 @@ template <typename T>
 void getComponentIO(std::optional<SerializeFunc>& serialize, std::optional<DeserializeFunc>& deserialize);
 void getComponentIO(cmp::ComponentId cid, std::optional<SerializeFunc>& serialize, std::optional<DeserializeFunc>& deserialize);
 
+//----- Recording -----//
+// Record the components every stepInterval steps (Transform, RigidBody and RigidBody2D if no component is specified)
+// The recording is stopped when the simulation stops, it can be played back with file::Player
+void startRecording(fs::path file, std::vector<cmp::ComponentId> components = {}, uint32_t stepInterval = 1);
+void stopRecording();
+bool isRecording();
+void recordStep(); // Called after each simulation step
+
+//----- Playback -----//
+// Apply the frames of a recording to the components while the simulation is not running (closed when it starts)
+bool openPlayback(fs::path file);
+void closePlayback();
+Player* getPlayback(); // nullptr if no recording is open
+
 //----- Path -----//
 // Receives a relative resource path and searches the registered directories for that file
 // By default searches on the <ATTA_DIR>/resources and <PROJECT_DIR>/resources directories
@@ -3,6 +3,9 @@
 #include <atta/cmakeConfig.h>
 #include <atta/component/components/polygonCollider2D.h>
 #include <atta/component/components/relationship.h>
+#include <atta/component/components/rigidBody.h>
+#include <atta/component/components/rigidBody2D.h>
+#include <atta/component/components/transform.h>
 #include <atta/component/entity.h>
 #include <atta/component/interface.h>
 #include <atta/event/events/projectBeforeDeserialize.h>
@@ -48,6 +51,7 @@ void Manager::startUpImpl() {
 }
 
 void Manager::shutDownImpl() {
+    stopRecordingImpl();
     _componentSerialize.clear();
     _componentDeserialize.clear();
 }
@@ -130,14 +134,14 @@ bool Manager::createProjectImpl(fs::path projectFile) {
     return true;
 }
 
-void Manager::saveProjectImpl() {
+void Manager::saveProjectImpl(Project::Format format) {
     if (_simulationRunning) {
         event::SimulationStop e;
         event::publish(e);
     }
 
     if (_projectSerializer)
-        _projectSerializer->serialize();
+        _projectSerializer->serialize(format);
 }
 
 void Manager::closeProjectImpl() {
@@ -146,6 +150,7 @@ void Manager::closeProjectImpl() {
         return;
 
     _fileWatcher->removeWatch(_project->getDirectory());
+    _player.reset();
 
     _project.reset();
     _projectSerializer.reset();
@@ -266,13 +271,47 @@ std::vector<fs::path> Manager::getDirectoryFilesRecursiveImpl(const fs::path& di
     return files;
 }
 
+void Manager::startRecordingImpl(fs::path file, std::vector<cmp::ComponentId> components, uint32_t stepInterval) {
+    stopRecordingImpl();
+    if (components.empty())
+        components = {cmp::getId<cmp::Transform>(), cmp::getId<cmp::RigidBody>(), cmp::getId<cmp::RigidBody2D>()};
+    _recorder = std::make_unique<Recorder>(file, components, stepInterval);
+    if (!_recorder->isOpen())
+        _recorder.reset();
+}
+
+void Manager::stopRecordingImpl() {
+    if (_recorder == nullptr)
+        return;
+    _recorder->close();
+    LOG_INFO("file::Manager", "Recorded $0 frames ($1 KB)", _recorder->getNumFrames(), _recorder->getFileSize() / 1024);
+    _recorder.reset();
+}
+
+bool Manager::openPlaybackImpl(fs::path file) {
+    _player.reset();
+    if (_simulationRunning) {
+        LOG_WARN("file::Manager", "Recordings can only be played while the simulation is stopped");
+        return false;
+    }
+    _player = std::make_unique<Player>(file);
+    if (!_player->isOpen()) {
+        _player.reset();
+        return false;
+    }
+    return true;
+}
+
 void Manager::onSimulationStateChange(event::Event& event) {
     switch (event.getType()) {
         case event::SimulationStart::type:
+            // The simulation would overwrite the played components
             _simulationRunning = true;
+            _player.reset();
             break;
         case event::SimulationStop::type:
             _simulationRunning = false;
+            stopRecordingImpl();
             break;
         default:
             LOG_WARN("file::Manager", "Unknown simulation event");
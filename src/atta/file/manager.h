@@ -4,6 +4,8 @@
 #include <atta/event/interface.h>
 #include <atta/file/interface.h>
 #include <atta/file/project/projectSerializer.h>
+#include <atta/file/recording/player.h>
+#include <atta/file/recording/recorder.h>
 #include <atta/file/watchers/fileWatcher.h>
 
 namespace atta::file {
@@ -16,7 +18,7 @@ class Manager final {
     friend void shutDown();
     friend bool openProject(fs::path projectFile);
     friend bool createProject(fs::path projectFile);
-    friend void saveProject();
+    friend void saveProject(Project::Format format);
     friend void closeProject();
     friend bool isProjectOpen();
     friend std::shared_ptr<Project> getProject();
@@ -24,6 +26,14 @@ class Manager final {
     friend void registerComponentIO(cmp::ComponentId cid, const SerializeFunc& serialize, const DeserializeFunc& deserialize);
     friend void getComponentIO(cmp::ComponentId cid, std::optional<SerializeFunc>& serialize, std::optional<DeserializeFunc>& deserialize);
 
+    friend void startRecording(fs::path file, std::vector<cmp::ComponentId> components, uint32_t stepInterval);
+    friend void stopRecording();
+    friend bool isRecording();
+    friend void recordStep();
+    friend bool openPlayback(fs::path file);
+    friend void closePlayback();
+    friend Player* getPlayback();
+
     friend fs::path solveResourcePath(fs::path relativePath, bool mustExist);
     friend std::vector<fs::path> getResourcePaths();
     friend fs::path getBuildPath();
@@ -37,7 +47,7 @@ class Manager final {
 
     bool openProjectImpl(fs::path projectFile);
     bool createProjectImpl(fs::path projectFile);
-    void saveProjectImpl();
+    void saveProjectImpl(Project::Format format);
     void closeProjectImpl();
     bool isProjectOpenImpl() const;
     std::shared_ptr<Project> getProjectImpl() const { return _project; }
@@ -47,6 +57,10 @@ class Manager final {
     void registerComponentIOImpl(cmp::ComponentId cid, const SerializeFunc& serialize, const DeserializeFunc& deserialize);
     void getComponentIOImpl(cmp::ComponentId cid, std::optional<SerializeFunc>& serialize, std::optional<DeserializeFunc>& deserialize) const;
 
+    void startRecordingImpl(fs::path file, std::vector<cmp::ComponentId> components, uint32_t stepInterval);
+    void stopRecordingImpl();
+    bool openPlaybackImpl(fs::path file);
+
     fs::path solveResourcePathImpl(fs::path relativePath, bool mustExist);
     std::vector<fs::path> getResourcePathsImpl() const;
     fs::path getBuildPathImpl() const;
@@ -62,6 +76,8 @@ class Manager final {
     std::shared_ptr<Project> _project;
     std::shared_ptr<ProjectSerializer> _projectSerializer;
     bool _simulationRunning;
+    std::unique_ptr<Recorder> _recorder;
+    std::unique_ptr<Player> _player;
     fs::path _defaultProjectFolder; ///< Default folder to clone published projects and save projects
 
     std::map<cmp::ComponentId, SerializeFunc> _componentSerialize;     // Custom component serialization
@@ -13,6 +13,12 @@ Project::Project(fs::path file) : _name(file.stem().string()), _file(fs::absolut
     LOG_DEBUG("file::Project", "Opened project [*g]$0[] ([w]$1[])", _name, _file);
 }
 
+fs::path Project::getBinaryFile() const {
+    fs::path binaryFile = _file;
+    binaryFile.replace_extension(".attab");
+    return binaryFile;
+}
+
 fs::path Project::getBuildDirectory() { return _directory / "build"; }
 
 fs::path Project::getSnapshotDirectory() { return _directory / "snapshots"; }
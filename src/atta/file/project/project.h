@@ -7,10 +7,17 @@ namespace atta::file {
 class Manager;
 class Project final {
   public:
+    /// Project file format
+    enum class Format {
+        TEXT = 0, ///< Human readable .atta file
+        BINARY,   ///< Binary .attab snapshot, faster to save/load big scenes
+    };
+
     Project(fs::path file);
 
     std::string getName() { return _name; }
     fs::path getFile() const { return _file; }
+    fs::path getBinaryFile() const;
     fs::path getDirectory() const { return _directory; }
 
     fs::path getBuildDirectory();
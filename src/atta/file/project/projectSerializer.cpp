@@ -7,6 +7,8 @@
 #include <atta/component/interface.h>
 #include <atta/file/interface.h>
 #include <atta/file/project/projectSerializer.h>
+#include <atta/file/project/snapshotSerializer.h>
+#include <atta/file/serializer/binarySerializer.h>
 #include <atta/file/serializer/section.h>
 #include <atta/file/serializer/serializer.h>
 #include <atta/graphics/cameras/orthographicCamera.h>
@@ -16,6 +18,7 @@
 #include <atta/graphics/renderers/pbrRenderer.h>
 #include <atta/graphics/renderers/phongRenderer.h>
 #include <atta/physics/engines/bulletEngine.h>
+#include <atta/physics/engines/swarmEngine.h>
 #include <atta/physics/interface.h>
 #include <atta/resource/interface.h>
 #include <atta/resource/resources/image.h>
@@ -29,7 +32,28 @@ namespace atta::file {
 
 ProjectSerializer::ProjectSerializer(std::shared_ptr<Project> project) : _project(project) {}
 
-void ProjectSerializer::serialize() {
+void ProjectSerializer::serialize(Project::Format format) {
+    Serializer serializer = serializeSettings();
+    if (format == Project::Format::BINARY) {
+        serializeBinary(serializer);
+        return;
+    }
+
+    std::vector<Section> nodes = serializeNodes();
+    for (const Section& node : nodes)
+        serializer.addSection(node);
+
+    // Serialize to temporary file
+    fs::path attaTemp = _project->getFile();
+    attaTemp.replace_extension(".atta.temp");
+    serializer.serialize(attaTemp);
+
+    // Override atta file with temp file
+    fs::rename(attaTemp, _project->getFile());
+    LOG_SUCCESS("file::ProjectSerializer", "Project [w]$0[] was saved", _project->getName());
+}
+
+Serializer ProjectSerializer::serializeSettings() {
     Serializer serializer;
     serializer.addSection(serializeProject());
     serializer.addSection(serializeConfig());
@@ -45,25 +69,61 @@ void ProjectSerializer::serialize() {
     for (const Section& viewport : viewports)
         serializer.addSection(viewport);
 
-    std::vector<Section> nodes = serializeNodes();
-    for (const Section& node : nodes)
-        serializer.addSection(node);
+    return serializer;
+}
 
-    // Serialize to temporary file
-    fs::path attaTemp = _project->getFile();
-    attaTemp.replace_extension(".atta.temp");
-    serializer.serialize(attaTemp);
+void ProjectSerializer::serializeBinary(const Serializer& settings) {
+    BinaryWriter writer;
+    writer.writeBytes(BINARY_MAGIC, sizeof(BINARY_MAGIC));
+    writer.write<uint32_t>(BINARY_VERSION);
+    writer.writeString(settings.toString());
+    SnapshotSerializer::serialize(writer);
 
-    // Override atta file with temp file
-    fs::rename(attaTemp, _project->getFile());
-    LOG_SUCCESS("file::ProjectSerializer", "Project [w]$0[] was saved", _project->getName());
+    if (writer.saveToFile(_project->getBinaryFile()))
+        LOG_SUCCESS("file::ProjectSerializer", "Project [w]$0[] was saved to binary snapshot ([w]$1[] bytes)", _project->getName(), writer.getSize());
 }
 
 bool ProjectSerializer::deserialize() {
+    // Load binary snapshot if it was saved after the .atta file
     fs::path attaFile = _project->getFile();
+    fs::path binaryFile = _project->getBinaryFile();
+    if (fs::exists(binaryFile) && (!fs::exists(attaFile) || fs::last_write_time(binaryFile) >= fs::last_write_time(attaFile))) {
+        LOG_INFO("file::ProjectSerializer", "Loading binary snapshot [w]$0[] because it is newer than [w]$1[]", binaryFile, attaFile);
+        return deserializeBinary();
+    }
+
     Serializer serializer;
     serializer.deserialize(attaFile);
+    return deserializeSections(serializer);
+}
+
+bool ProjectSerializer::deserializeBinary() {
+    MappedFile file(_project->getBinaryFile());
+    if (!file.isOpen())
+        return false;
+
+    BinaryReader reader(file.getData(), file.getSize());
+    const uint8_t* magic = reader.readBytes(sizeof(BINARY_MAGIC));
+    uint32_t version = 0;
+    reader.read(version);
+    if (magic == nullptr || std::memcmp(magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) != 0 || version != BINARY_VERSION) {
+        LOG_ERROR("file::ProjectSerializer", "File [w]$0[] is not a valid binary snapshot (version [w]$1[] expected)", _project->getBinaryFile(),
+                  BINARY_VERSION);
+        return false;
+    }
+
+    // Settings are stored as text sections
+    std::string settings;
+    reader.readString(settings);
+    Serializer serializer;
+    serializer.fromString(settings);
+    if (!deserializeSections(serializer))
+        return false;
+
+    return SnapshotSerializer::deserialize(reader);
+}
 
+bool ProjectSerializer::deserializeSections(const Serializer& serializer) {
     // Make sure atta versions match
     bool canLoadProject = false;
     for (const Section& section : serializer.getSections()) {
@@ -129,6 +189,11 @@ Section ProjectSerializer::serializePhysicsModule() {
     auto bullet = physics::getEngine<physics::BulletEngine>();
     section["bullet.showAabb"] = bullet->getShowAabb();
     section["bullet.numSubSteps"] = bullet->getNumSubSteps();
+    section["bullet.multithreaded"] = bullet->getMultithreaded();
+    section["bullet.numThreads"] = bullet->getNumThreads();
+    auto swarm = physics::getEngine<physics::SwarmEngine>();
+    section["swarm.numThreads"] = swarm->getNumThreads();
+    section["swarm.numIterations"] = swarm->getNumIterations();
 
     return section;
 }
@@ -137,6 +202,7 @@ Section ProjectSerializer::serializeSensorModule() {
     Section section("sensor");
     section["showCameras"] = sensor::getShowCameras();
     section["showInfrareds"] = sensor::getShowInfrareds();
+    section["showLidars"] = sensor::getShowLidars();
     return section;
 }
 
@@ -335,9 +401,7 @@ std::vector<Section> ProjectSerializer::serializeNodes() {
                 const std::vector<cmp::AttributeDescription> attributeDescriptions = compReg->getDescription().attributeDescriptions;
                 for (size_t i = 0; i < attributeDescriptions.size(); i++) {
                     cmp::AttributeDescription aDesc = attributeDescriptions[i];
-                    size_t size = (i == attributeDescriptions.size() - 1) ? compReg->getSizeof() - aDesc.offset
-                                                                          : attributeDescriptions[i + 1].offset - aDesc.offset;
-                    serializeAttribute(section, cmpName, comp, aDesc, size);
+                    serializeAttribute(section, cmpName, comp, aDesc, compReg->getAttributeSize(i));
                 }
             }
         }
@@ -399,6 +463,15 @@ void ProjectSerializer::deserializePhysicsModule(const Section& section) {
         bullet->setShowAabb(bool(section["bullet.showAabb"]));
     if (section.contains("bullet.numSubSteps"))
         bullet->setNumSubSteps(unsigned(section["bullet.numSubSteps"]));
+    if (section.contains("bullet.multithreaded"))
+        bullet->setMultithreaded(bool(section["bullet.multithreaded"]));
+    if (section.contains("bullet.numThreads"))
+        bullet->setNumThreads(unsigned(section["bullet.numThreads"]));
+    auto swarm = physics::getEngine<physics::SwarmEngine>();
+    if (section.contains("swarm.numThreads"))
+        swarm->setNumThreads(int(section["swarm.numThreads"]));
+    if (section.contains("swarm.numIterations"))
+        swarm->setNumIterations(unsigned(section["swarm.numIterations"]));
 }
 
 void ProjectSerializer::deserializeSensorModule(const Section& section) {
@@ -406,6 +479,8 @@ void ProjectSerializer::deserializeSensorModule(const Section& section) {
         sensor::setShowCameras(bool(section["showCameras"]));
     if (section.contains("showInfrareds"))
         sensor::setShowInfrareds(bool(section["showInfrareds"]));
+    if (section.contains("showLidars"))
+        sensor::setShowLidars(bool(section["showLidars"]));
 }
 
 void ProjectSerializer::deserializeMaterial(const Section& section) {
@@ -652,9 +727,7 @@ void ProjectSerializer::deserializeNode(const Section& section) {
             const std::vector<cmp::AttributeDescription> attributeDescriptions = compReg->getDescription().attributeDescriptions;
             for (size_t i = 0; i < attributeDescriptions.size(); i++) {
                 cmp::AttributeDescription aDesc = attributeDescriptions[i];
-                size_t size = (i == attributeDescriptions.size() - 1) ? compReg->getSizeof() - aDesc.offset
-                                                                      : attributeDescriptions[i + 1].offset - aDesc.offset;
-                deserializeAttribute(section, cmpName, comp, aDesc, size);
+                deserializeAttribute(section, cmpName, comp, aDesc, compReg->getAttributeSize(i));
             }
         }
     }
@@ -10,10 +10,18 @@ class ProjectSerializer final {
   public:
     ProjectSerializer(std::shared_ptr<Project> project);
 
-    void serialize();
-    bool deserialize();
+    void serialize(Project::Format format = Project::Format::TEXT);
+    bool deserialize(); ///< Load binary snapshot if it is newer than the .atta file, otherwise load .atta file
 
   private:
+    static constexpr char BINARY_MAGIC[8] = {'A', 'T', 'T', 'A', 'S', 'N', 'A', 'P'};
+    static constexpr uint32_t BINARY_VERSION = 1;
+
+    Serializer serializeSettings(); ///< All sections except the nodes
+    void serializeBinary(const Serializer& settings);
+    bool deserializeSections(const Serializer& serializer);
+    bool deserializeBinary();
+
     Section serializeProject();
     Section serializeConfig();
     Section serializeGraphicsModule();
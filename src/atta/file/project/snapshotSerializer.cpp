@@ -0,0 +1,258 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/relationship.h>
+#include <atta/component/interface.h>
+#include <atta/file/interface.h>
+#include <atta/file/project/snapshotSerializer.h>
+#include <atta/file/serializer/serializer.h>
+
+namespace atta::file {
+
+std::vector<SnapshotSerializer::Attribute> SnapshotSerializer::getAttributes(cmp::ComponentRegistry* compReg) {
+    std::vector<Attribute> attributes;
+    const std::vector<cmp::AttributeDescription>& attributeDescriptions = compReg->getDescription().attributeDescriptions;
+    for (size_t i = 0; i < attributeDescriptions.size(); i++) {
+        const cmp::AttributeDescription& aDesc = attributeDescriptions[i];
+        if (aDesc.type == cmp::AttributeType::CUSTOM)
+            continue;
+        attributes.push_back({&aDesc, compReg->getAttributeSize(i)});
+    }
+    return attributes;
+}
+
+static bool hasCustomIO(cmp::ComponentRegistry* compReg) {
+    std::optional<SerializeFunc> serializeFunc;
+    std::optional<DeserializeFunc> deserializeFunc;
+    file::getComponentIO(compReg->getId(), serializeFunc, deserializeFunc);
+    return serializeFunc.has_value() && deserializeFunc.has_value();
+}
+
+void SnapshotSerializer::serialize(BinaryWriter& writer) {
+    PROFILE();
+    std::vector<cmp::EntityId> entities = cmp::getNoCloneView();
+
+    //---------- Entities ----------//
+    std::vector<cmp::EntityId> parents(entities.size(), -1);
+    for (size_t i = 0; i < entities.size(); i++) {
+        cmp::Relationship* relationship = cmp::getComponent<cmp::Relationship>(entities[i]);
+        if (relationship)
+            parents[i] = relationship->getParent().getId();
+    }
+    writer.write<uint32_t>(entities.size());
+    writer.align(COLUMN_ALIGNMENT);
+    writer.writeBytes(entities.data(), entities.size() * sizeof(cmp::EntityId));
+    writer.align(COLUMN_ALIGNMENT);
+    writer.writeBytes(parents.data(), parents.size() * sizeof(cmp::EntityId));
+
+    //---------- Components ----------//
+    std::vector<cmp::ComponentRegistry*> columnRegistries;
+    std::vector<cmp::ComponentRegistry*> customRegistries;
+    for (cmp::ComponentRegistry* compReg : cmp::getComponentRegistries()) {
+        if (compReg->getId() == cmp::getId<cmp::Relationship>())
+            continue; // Stored in the parents column
+        if (hasCustomIO(compReg))
+            customRegistries.push_back(compReg);
+        else
+            columnRegistries.push_back(compReg);
+    }
+
+    std::unordered_map<StringHash, std::string> strings;
+    writer.write<uint32_t>(columnRegistries.size());
+    for (cmp::ComponentRegistry* compReg : columnRegistries) {
+        // Schema
+        std::vector<Attribute> attributes = getAttributes(compReg);
+        writer.writeString(compReg->getDescription().name);
+        writer.write<uint32_t>(attributes.size());
+        for (const Attribute& attribute : attributes) {
+            writer.writeString(attribute.desc->name);
+            writer.write<uint32_t>(uint32_t(attribute.desc->type));
+            writer.write<uint32_t>(attribute.size);
+        }
+
+        // Entities that have this component
+        std::vector<cmp::EntityId> rows;
+        std::vector<uint8_t*> components;
+        for (cmp::EntityId eid : entities) {
+            cmp::Component* comp = cmp::getComponentById(compReg->getId(), eid);
+            if (comp == nullptr)
+                continue;
+            rows.push_back(eid);
+            components.push_back(reinterpret_cast<uint8_t*>(comp));
+        }
+        writer.write<uint32_t>(rows.size());
+        writer.align(COLUMN_ALIGNMENT);
+        writer.writeBytes(rows.data(), rows.size() * sizeof(cmp::EntityId));
+
+        // Attribute columns
+        for (const Attribute& attribute : attributes) {
+            writer.align(COLUMN_ALIGNMENT);
+            for (uint8_t* comp : components) {
+                uint8_t* ptr = comp + attribute.desc->offset;
+                writer.writeBytes(ptr, attribute.size);
+                if (attribute.desc->type == cmp::AttributeType::STRINGID) {
+                    StringId sid = *reinterpret_cast<StringId*>(ptr);
+                    strings[sid.getId()] = sid.getString();
+                }
+            }
+        }
+    }
+
+    //---------- String table ----------//
+    writer.write<uint32_t>(strings.size());
+    for (const auto& [hash, str] : strings)
+        writer.writeString(str);
+
+    //---------- Custom components ----------//
+    Serializer serializer;
+    for (cmp::EntityId eid : entities) {
+        Section section("node");
+        section["id"] = eid;
+        for (cmp::ComponentRegistry* compReg : customRegistries) {
+            cmp::Component* comp = cmp::getComponentById(compReg->getId(), eid);
+            if (comp == nullptr)
+                continue;
+            std::optional<SerializeFunc> serializeFunc;
+            std::optional<DeserializeFunc> deserializeFunc;
+            file::getComponentIO(compReg->getId(), serializeFunc, deserializeFunc);
+            serializeFunc.value()(section, comp);
+        }
+        if (section.size() > 1)
+            serializer.addSection(section);
+    }
+    writer.writeString(serializer.toString());
+}
+
+bool SnapshotSerializer::deserialize(BinaryReader& reader) {
+    PROFILE();
+
+    //---------- Entities ----------//
+    uint32_t numEntities = 0;
+    reader.read(numEntities);
+    reader.align(COLUMN_ALIGNMENT);
+    const uint8_t* entitiesPtr = reader.readBytes(numEntities * sizeof(cmp::EntityId));
+    reader.align(COLUMN_ALIGNMENT);
+    const uint8_t* parentsPtr = reader.readBytes(numEntities * sizeof(cmp::EntityId));
+    if (!reader.isValid()) {
+        LOG_ERROR("file::SnapshotSerializer", "Snapshot is corrupted, could not read entities");
+        return false;
+    }
+    std::vector<cmp::EntityId> entities(numEntities);
+    std::vector<cmp::EntityId> parents(numEntities);
+    std::memcpy(entities.data(), entitiesPtr, numEntities * sizeof(cmp::EntityId));
+    std::memcpy(parents.data(), parentsPtr, numEntities * sizeof(cmp::EntityId));
+
+    for (cmp::EntityId eid : entities)
+        if (cmp::createEntity(eid).getId() != eid)
+            LOG_WARN("file::SnapshotSerializer", "Could not create entity with id $0", eid);
+
+    // Parents are set before the transforms are loaded, so the local transforms are not changed by Relationship::setParent
+    for (uint32_t i = 0; i < numEntities; i++)
+        if (parents[i] != -1)
+            cmp::Relationship::setParent(parents[i], entities[i]);
+
+    //---------- Components ----------//
+    std::vector<cmp::ComponentRegistry*> registries = cmp::getComponentRegistries();
+    uint32_t numComponents = 0;
+    reader.read(numComponents);
+    for (uint32_t c = 0; c < numComponents && reader.isValid(); c++) {
+        // Find registered component with the same name
+        std::string name;
+        reader.readString(name);
+        cmp::ComponentRegistry* compReg = nullptr;
+        for (cmp::ComponentRegistry* reg : registries)
+            if (reg->getDescription().name == name) {
+                compReg = reg;
+                break;
+            }
+        if (compReg == nullptr)
+            LOG_WARN("file::SnapshotSerializer", "Component [w]$0[] is not registered, it will not be loaded", name);
+
+        // Match snapshot schema with the component attributes
+        uint32_t numAttributes = 0;
+        reader.read(numAttributes);
+        std::vector<uint32_t> sizes(numAttributes);
+        std::vector<int> offsets(numAttributes, -1); // Offset in the component, -1 if the attribute should be ignored
+        std::vector<Attribute> attributes;
+        if (compReg)
+            attributes = getAttributes(compReg);
+        for (uint32_t a = 0; a < numAttributes; a++) {
+            std::string attributeName;
+            uint32_t type = 0;
+            reader.readString(attributeName);
+            reader.read(type);
+            reader.read(sizes[a]);
+            for (const Attribute& attribute : attributes)
+                if (attribute.desc->name == attributeName && uint32_t(attribute.desc->type) == type && attribute.size == sizes[a])
+                    offsets[a] = attribute.desc->offset;
+            if (compReg && offsets[a] == -1)
+                LOG_WARN("file::SnapshotSerializer", "Attribute [w]$0.$1[] changed since the snapshot was saved, it will not be loaded", name,
+                         attributeName);
+        }
+
+        // Create components
+        uint32_t numRows = 0;
+        reader.read(numRows);
+        reader.align(COLUMN_ALIGNMENT);
+        const uint8_t* rows = reader.readBytes(numRows * sizeof(cmp::EntityId));
+        if (!reader.isValid())
+            break;
+        std::vector<uint8_t*> components(numRows, nullptr);
+        if (compReg) {
+            std::vector<cmp::EntityId> rowEntities(numRows);
+            std::memcpy(rowEntities.data(), rows, numRows * sizeof(cmp::EntityId));
+            // Components are allocated contiguously, so the columns are copied with a fixed stride
+            uint8_t* block = cmp::addComponentsById(compReg->getId(), rowEntities);
+            for (uint32_t r = 0; r < numRows; r++)
+                components[r] = block ? block + size_t(r) * compReg->getSizeof()
+                                      : reinterpret_cast<uint8_t*>(cmp::addComponentById(compReg->getId(), rowEntities[r]));
+        }
+
+        // Copy attribute columns
+        for (uint32_t a = 0; a < numAttributes; a++) {
+            reader.align(COLUMN_ALIGNMENT);
+            const uint8_t* column = reader.readBytes(size_t(numRows) * sizes[a]);
+            if (column == nullptr || offsets[a] == -1)
+                continue;
+            for (uint32_t r = 0; r < numRows; r++)
+                if (components[r])
+                    std::memcpy(components[r] + offsets[a], column + size_t(r) * sizes[a], sizes[a]);
+        }
+    }
+
+    //---------- String table ----------//
+    uint32_t numStrings = 0;
+    reader.read(numStrings);
+    for (uint32_t i = 0; i < numStrings && reader.isValid(); i++) {
+        std::string str;
+        reader.readString(str);
+        StringId sid(str); // Register string so StringId attributes can be converted back to string
+    }
+
+    //---------- Custom components ----------//
+    std::string custom;
+    reader.readString(custom);
+    if (!reader.isValid()) {
+        LOG_ERROR("file::SnapshotSerializer", "Snapshot is corrupted, could not read components");
+        return false;
+    }
+    Serializer serializer;
+    serializer.fromString(custom);
+    for (const Section& section : serializer.getSections()) {
+        if (!section.contains("id"))
+            continue;
+        cmp::Entity entity = cmp::EntityId(section["id"]);
+        for (cmp::ComponentRegistry* compReg : registries) {
+            if (compReg->getId() == cmp::getId<cmp::Relationship>())
+                continue;
+            std::optional<SerializeFunc> serializeFunc;
+            std::optional<DeserializeFunc> deserializeFunc;
+            file::getComponentIO(compReg->getId(), serializeFunc, deserializeFunc);
+            if (serializeFunc.has_value() && deserializeFunc.has_value())
+                deserializeFunc.value()(section, entity);
+        }
+    }
+
+    return true;
+}
+
+} // namespace atta::file
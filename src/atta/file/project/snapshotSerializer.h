@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/component/componentRegistry.h>
+#include <atta/file/serializer/binarySerializer.h>
+
+namespace atta::file {
+
+/** Binary snapshot of the entities and their components
+ *
+ * Components are written as typed columns (one column per attribute) after a schema describing the attribute names,
+ * types and sizes. When loading, the schema is matched against the registered component descriptions, the components of
+ * each type are allocated contiguously and each column is copied directly to the component memory, so no value parsing
+ * is necessary. Attributes that were removed or changed type since the snapshot was saved are ignored. Runtime data after
+ * the component attributes (ComponentDescription::attributesEnd) is not stored
+ *
+ * Layout:
+ *   - Entities: count, entity ids, parent ids (Relationship)
+ *   - Components: count, then for each component: name, schema, entity ids, attribute columns
+ *   - String table: strings referenced by StringId attributes
+ *   - Custom components: components with custom IO, serialized as text sections
+ **/
+class SnapshotSerializer final {
+  public:
+    static constexpr size_t COLUMN_ALIGNMENT = 16;
+
+    /// Attribute that can be stored as a column (custom attributes are not)
+    struct Attribute {
+        const cmp::AttributeDescription* desc;
+        uint32_t size;
+    };
+    static std::vector<Attribute> getAttributes(cmp::ComponentRegistry* compReg);
+
+    /// Serialize all entities that are not clones
+    static void serialize(BinaryWriter& writer);
+    /// Create entities and components from snapshot, the entities should not exist yet
+    static bool deserialize(BinaryReader& reader);
+};
+
+} // namespace atta::file
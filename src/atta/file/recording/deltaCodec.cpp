@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/file/recording/deltaCodec.h>
+
+namespace atta::file {
+
+void DeltaCodec::encode(const uint8_t* prev, const uint8_t* curr, size_t size, BinaryWriter& writer) {
+    auto delta = [&](size_t i) -> uint8_t { return prev ? curr[i] ^ prev[i] : curr[i]; };
+
+    size_t i = 0;
+    while (i < size) {
+        // Zero run
+        size_t zeros = 0;
+        while (i + zeros < size && delta(i + zeros) == 0)
+            zeros++;
+        i += zeros;
+
+        // Literal run (stops at a run of zeros long enough to be worth a new pair)
+        size_t literals = 0;
+        while (i + literals < size) {
+            size_t j = i + literals;
+            if (delta(j) == 0 && (j + 1 >= size || delta(j + 1) == 0) && (j + 2 >= size || delta(j + 2) == 0))
+                break;
+            literals++;
+        }
+
+        writeVarint(writer, zeros);
+        writeVarint(writer, literals);
+        for (size_t l = 0; l < literals; l++)
+            writer.write<uint8_t>(delta(i + l));
+        i += literals;
+    }
+}
+
+bool DeltaCodec::decode(BinaryReader& reader, uint8_t* data, size_t size) {
+    size_t i = 0;
+    while (i < size) {
+        uint64_t zeros, literals;
+        if (!readVarint(reader, zeros) || !readVarint(reader, literals))
+            return false;
+        i += zeros;
+        if (i + literals > size)
+            return false;
+        const uint8_t* bytes = reader.readBytes(literals);
+        if (bytes == nullptr)
+            return false;
+        for (size_t l = 0; l < literals; l++)
+            data[i + l] ^= bytes[l];
+        i += literals;
+    }
+    return i == size;
+}
+
+void DeltaCodec::writeVarint(BinaryWriter& writer, uint64_t value) {
+    while (value >= 0x80) {
+        writer.write<uint8_t>(uint8_t(value) | 0x80);
+        value >>= 7;
+    }
+    writer.write<uint8_t>(uint8_t(value));
+}
+
+bool DeltaCodec::readVarint(BinaryReader& reader, uint64_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        uint8_t byte;
+        if (!reader.read(byte))
+            return false;
+        value |= uint64_t(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+    return false;
+}
+
+} // namespace atta::file
@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/file/serializer/binarySerializer.h>
+
+namespace atta::file {
+
+/** Delta codec for recording frames
+ *
+ * The current buffer is XORed with the previous one, so unchanged bytes become zero, and the result is written as
+ * runs of (zero count, literal count, literal bytes) with variable length integers. Without a previous buffer the
+ * data is written as is (keyframe). Buffers where most bytes did not change between frames are reduced to a few bytes
+ **/
+class DeltaCodec final {
+  public:
+    /// Encode curr against prev (prev can be nullptr)
+    static void encode(const uint8_t* prev, const uint8_t* curr, size_t size, BinaryWriter& writer);
+    /// Decode into data, which should contain the previous buffer (or zeros for keyframes)
+    static bool decode(BinaryReader& reader, uint8_t* data, size_t size);
+
+  private:
+    static void writeVarint(BinaryWriter& writer, uint64_t value);
+    static bool readVarint(BinaryReader& reader, uint64_t& value);
+};
+
+} // namespace atta::file
@@ -0,0 +1,189 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/file/project/snapshotSerializer.h>
+#include <atta/file/recording/deltaCodec.h>
+#include <atta/file/recording/player.h>
+#include <atta/file/recording/recorder.h>
+
+namespace atta::file {
+
+Player::Player(const fs::path& file)
+    : _file(file), _valid(false), _stepInterval(1), _keyframeInterval(1), _numFrames(0), _frame(0), _time(0.0f), _pos(0) {
+    if (!_file.isOpen()) {
+        LOG_ERROR("file::Player", "Could not open recording [w]$0[]", fs::absolute(file));
+        return;
+    }
+    _valid = readHeader() && readIndex();
+    if (!_valid)
+        LOG_ERROR("file::Player", "Recording [w]$0[] is corrupted", fs::absolute(file));
+    _frame = _numFrames;
+}
+
+bool Player::seek(uint32_t frame) {
+    PROFILE();
+    if (!_valid || frame >= _numFrames)
+        return false;
+
+    // Decode from the closest keyframe, unless the frame is after the current one in the same chunk
+    auto chunk = std::upper_bound(_chunkIndex.begin(), _chunkIndex.end(), frame,
+                                  [](uint32_t f, const std::pair<uint64_t, uint32_t>& c) { return f < c.second; }) -
+                 1;
+    uint32_t nextFrame = _frame + 1;
+    if (_frame >= _numFrames || _frame < chunk->second || _frame > frame) {
+        _pos = chunk->first + sizeof(uint32_t);
+        nextFrame = chunk->second;
+        for (ComponentState& component : _components)
+            component.rows.clear();
+    }
+    while (nextFrame <= frame) {
+        if (!decodeFrame()) {
+            LOG_ERROR("file::Player", "Could not decode frame [w]$0[]", nextFrame);
+            _valid = false;
+            return false;
+        }
+        nextFrame++;
+        // Skip the header of the next chunk
+        auto nextChunk = chunk + 1;
+        if (nextChunk != _chunkIndex.end() && nextFrame == nextChunk->second) {
+            chunk = nextChunk;
+            _pos = chunk->first + sizeof(uint32_t);
+        }
+    }
+    _frame = frame;
+    apply();
+    return true;
+}
+
+bool Player::next() { return seek(_frame >= _numFrames ? 0 : _frame + 1); }
+
+bool Player::readHeader() {
+    BinaryReader reader(_file.getData(), _file.getSize());
+    const uint8_t* magic = reader.readBytes(sizeof(Recorder::MAGIC));
+    uint32_t version = 0;
+    reader.read(version);
+    if (magic == nullptr || std::memcmp(magic, Recorder::MAGIC, sizeof(Recorder::MAGIC)) != 0 || version != Recorder::VERSION)
+        return false;
+    reader.read(_stepInterval);
+    reader.read(_keyframeInterval);
+
+    std::vector<cmp::ComponentRegistry*> registries = cmp::getComponentRegistries();
+    uint32_t numComponents = 0;
+    reader.read(numComponents);
+    for (uint32_t c = 0; c < numComponents && reader.isValid(); c++) {
+        ComponentState component{};
+        std::string name;
+        reader.readString(name);
+        cmp::ComponentRegistry* compReg = nullptr;
+        for (cmp::ComponentRegistry* reg : registries)
+            if (reg->getDescription().name == name)
+                compReg = reg;
+        if (compReg == nullptr)
+            LOG_WARN("file::Player", "Component [w]$0[] is not registered, it will not be played", name);
+        component.id = compReg ? compReg->getId() : cmp::ComponentId(-1);
+
+        std::vector<SnapshotSerializer::Attribute> attributes;
+        if (compReg)
+            attributes = SnapshotSerializer::getAttributes(compReg);
+        uint32_t numAttributes = 0;
+        reader.read(numAttributes);
+        component.sizes.resize(numAttributes);
+        component.offsets.resize(numAttributes, -1);
+        for (uint32_t a = 0; a < numAttributes; a++) {
+            std::string attributeName;
+            uint32_t type = 0;
+            reader.readString(attributeName);
+            reader.read(type);
+            reader.read(component.sizes[a]);
+            for (const SnapshotSerializer::Attribute& attribute : attributes)
+                if (attribute.desc->name == attributeName && uint32_t(attribute.desc->type) == type && attribute.size == component.sizes[a])
+                    component.offsets[a] = attribute.desc->offset;
+        }
+        _components.push_back(std::move(component));
+    }
+    return reader.isValid();
+}
+
+bool Player::readIndex() {
+    // Footer: number of frames, index offset, magic
+    constexpr size_t footerSize = sizeof(uint32_t) + sizeof(uint64_t) + sizeof(Recorder::MAGIC);
+    if (_file.getSize() < footerSize)
+        return false;
+    BinaryReader footer(_file.getData() + _file.getSize() - footerSize, footerSize);
+    uint64_t indexOffset = 0;
+    footer.read(_numFrames);
+    footer.read(indexOffset);
+    const uint8_t* magic = footer.readBytes(sizeof(Recorder::MAGIC));
+    if (!footer.isValid() || std::memcmp(magic, Recorder::MAGIC, sizeof(Recorder::MAGIC)) != 0 || indexOffset > _file.getSize())
+        return false;
+
+    BinaryReader reader(_file.getData() + indexOffset, _file.getSize() - indexOffset);
+    uint32_t numChunks = 0;
+    reader.read(numChunks);
+    for (uint32_t i = 0; i < numChunks && reader.isValid(); i++) {
+        uint64_t offset = 0;
+        uint32_t firstFrame = 0;
+        reader.read(offset);
+        reader.read(firstFrame);
+        _chunkIndex.push_back({offset, firstFrame});
+    }
+    return reader.isValid() && (_numFrames == 0 || (!_chunkIndex.empty() && _chunkIndex.front().second == 0));
+}
+
+bool Player::decodeFrame() {
+    if (_pos >= _file.getSize())
+        return false;
+    BinaryReader reader(_file.getData() + _pos, _file.getSize() - _pos);
+    reader.read(_time);
+    for (ComponentState& component : _components) {
+        uint8_t rowsChanged = 0;
+        reader.read(rowsChanged);
+        if (rowsChanged) {
+            uint32_t numRows = 0;
+            reader.read(numRows);
+            component.rows.assign(numRows, 0);
+            if (!DeltaCodec::decode(reader, reinterpret_cast<uint8_t*>(component.rows.data()), numRows * sizeof(cmp::EntityId)))
+                return false;
+        }
+
+        size_t columnsSize = 0;
+        for (uint32_t size : component.sizes)
+            columnsSize += size_t(size) * component.rows.size();
+        if (rowsChanged)
+            component.columns.assign(columnsSize, 0);
+        if (component.columns.size() != columnsSize || !DeltaCodec::decode(reader, component.columns.data(), columnsSize))
+            return false;
+    }
+    _pos += reader.getPosition();
+    return reader.isValid();
+}
+
+void Player::apply() {
+    std::vector<cmp::EntityId> entities = cmp::getEntitiesView();
+    for (const ComponentState& component : _components) {
+        if (component.id == cmp::ComponentId(-1))
+            continue;
+        size_t columnOffset = 0;
+        std::vector<uint8_t*> comps(component.rows.size());
+        for (size_t r = 0; r < component.rows.size(); r++) {
+            cmp::Entity entity(component.rows[r]);
+            if (!std::binary_search(entities.begin(), entities.end(), entity.getId())) {
+                entity = cmp::createEntity(component.rows[r]);
+                entities.insert(std::upper_bound(entities.begin(), entities.end(), entity.getId()), entity.getId());
+            }
+            cmp::Component* comp = cmp::getComponentById(component.id, entity);
+            if (comp == nullptr)
+                comp = cmp::addComponentById(component.id, entity);
+            comps[r] = reinterpret_cast<uint8_t*>(comp);
+        }
+        for (size_t a = 0; a < component.sizes.size(); a++) {
+            uint32_t size = component.sizes[a];
+            if (component.offsets[a] != -1)
+                for (size_t r = 0; r < comps.size(); r++)
+                    if (comps[r])
+                        std::memcpy(comps[r] + component.offsets[a], component.columns.data() + columnOffset + r * size, size);
+            columnOffset += comps.size() * size;
+        }
+    }
+}
+
+} // namespace atta::file
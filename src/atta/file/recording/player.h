@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/component/interface.h>
+#include <atta/file/serializer/binarySerializer.h>
+
+namespace atta::file {
+
+/** Simulation recording player
+ *
+ * Reads a log written by the Recorder and copies the recorded frames back to the component pools. Entities and
+ * components that do not exist are created. Seeking decodes from the closest keyframe, so it is not necessary to
+ * decode all previous frames. Recorded attributes that do not match the registered components are ignored
+ **/
+class Player final {
+  public:
+    Player(const fs::path& file);
+
+    bool isOpen() const { return _valid; }
+    uint32_t getNumFrames() const { return _numFrames; }
+    uint32_t getFrame() const { return _frame; } ///< Last applied frame
+    float getTime() const { return _time; }      ///< Simulation time of the last applied frame
+    uint32_t getStepInterval() const { return _stepInterval; }
+
+    /// Decode frame and apply it to the components
+    bool seek(uint32_t frame);
+    /// Apply next frame, returns false at the end of the recording
+    bool next();
+
+  private:
+    bool readHeader();
+    bool readIndex();
+    bool decodeFrame();
+    void apply();
+
+    struct ComponentState {
+        cmp::ComponentId id;
+        std::vector<uint32_t> sizes;
+        std::vector<int> offsets; ///< Offset in the component, -1 if the attribute should be ignored
+        std::vector<cmp::EntityId> rows;
+        std::vector<uint8_t> columns;
+    };
+
+    MappedFile _file;
+    bool _valid;
+    std::vector<ComponentState> _components;
+    uint32_t _stepInterval;
+    uint32_t _keyframeInterval;
+    uint32_t _numFrames;
+    std::vector<std::pair<uint64_t, uint32_t>> _chunkIndex; ///< Offset and first frame of each chunk
+
+    uint32_t _frame; ///< Last decoded frame (numFrames if no frame was decoded)
+    float _time;
+    size_t _pos; ///< Position of the next frame in the file
+};
+
+} // namespace atta::file
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/file/recording/deltaCodec.h>
+#include <atta/file/recording/recorder.h>
+#include <atta/memory/scratch.h>
+
+namespace atta::file {
+
+Recorder::Recorder(const fs::path& file, const std::vector<cmp::ComponentId>& components, uint32_t stepInterval, uint32_t keyframeInterval)
+    : _fileSize(0), _stepInterval(std::max(stepInterval, 1u)), _keyframeInterval(std::max(keyframeInterval, 1u)), _numSteps(0), _numFrames(0),
+      _registryGeneration(cmp::getRegistryGeneration()), _chunkNumFrames(0) {
+    for (cmp::ComponentRegistry* compReg : cmp::getComponentRegistries())
+        if (std::find(components.begin(), components.end(), compReg->getId()) != components.end()) {
+            std::vector<SnapshotSerializer::Attribute> attributes = SnapshotSerializer::getAttributes(compReg);
+            _components.push_back({compReg->getId(), compReg, attributes, getLayout(attributes), {}, {}});
+        }
+    if (_components.size() != components.size())
+        LOG_WARN("file::Recorder", "Some components are not registered, they will not be recorded");
+
+    _file.open(file, std::ios::binary | std::ios::trunc);
+    if (!_file.is_open()) {
+        LOG_ERROR("file::Recorder", "Could not open [w]$0[] to record", fs::absolute(file));
+        return;
+    }
+
+    // Header
+    BinaryWriter header;
+    header.writeBytes(MAGIC, sizeof(MAGIC));
+    header.write<uint32_t>(VERSION);
+    header.write<uint32_t>(_stepInterval);
+    header.write<uint32_t>(_keyframeInterval);
+    header.write<uint32_t>(_components.size());
+    for (const ComponentState& component : _components) {
+        header.writeString(component.compReg->getDescription().name);
+        header.write<uint32_t>(component.attributes.size());
+        for (const SnapshotSerializer::Attribute& attribute : component.attributes) {
+            header.writeString(attribute.desc->name);
+            header.write<uint32_t>(uint32_t(attribute.desc->type));
+            header.write<uint32_t>(attribute.size);
+        }
+    }
+    _file.write(reinterpret_cast<const char*>(header.getData().data()), header.getSize());
+    _fileSize += header.getSize();
+}
+
+Recorder::~Recorder() { close(); }
+
+void Recorder::step(float time) {
+    if (!_file.is_open())
+        return;
+    if (_numSteps++ % _stepInterval == 0)
+        recordFrame(time);
+}
+
+void Recorder::close() {
+    if (!_file.is_open())
+        return;
+    writeChunk();
+
+    // Index
+    BinaryWriter index;
+    uint64_t indexOffset = _fileSize;
+    index.write<uint32_t>(_chunkIndex.size());
+    for (const auto& [offset, firstFrame] : _chunkIndex) {
+        index.write<uint64_t>(offset);
+        index.write<uint32_t>(firstFrame);
+    }
+    index.write<uint32_t>(_numFrames);
+    index.write<uint64_t>(indexOffset);
+    index.writeBytes(MAGIC, sizeof(MAGIC));
+    _file.write(reinterpret_cast<const char*>(index.getData().data()), index.getSize());
+    _fileSize += index.getSize();
+    _file.close();
+}
+
+void Recorder::recordFrame(float time) {
+    PROFILE();
+    if (!updateRegistries()) {
+        LOG_WARN("file::Recorder", "Recorded component layout changed after the components were reloaded, the recording was closed");
+        close();
+        return;
+    }
+    bool keyframe = _chunkNumFrames == 0;
+    memory::Scratch scratch;
+    Span<cmp::EntityId> entities = cmp::getEntitiesView(scratch);
+
+    _chunk.write<float>(time);
+    for (ComponentState& component : _components) {
+        // Entities that have this component
+        std::vector<cmp::EntityId> rows;
+        std::vector<uint8_t*> comps;
+        for (cmp::EntityId eid : entities) {
+            cmp::Component* comp = cmp::getComponentById(component.id, eid);
+            if (comp == nullptr)
+                continue;
+            rows.push_back(eid);
+            comps.push_back(reinterpret_cast<uint8_t*>(comp));
+        }
+        bool rowsChanged = keyframe || rows != component.rows;
+        _chunk.write<uint8_t>(rowsChanged);
+        if (rowsChanged) {
+            _chunk.write<uint32_t>(rows.size());
+            DeltaCodec::encode(nullptr, reinterpret_cast<const uint8_t*>(rows.data()), rows.size() * sizeof(cmp::EntityId), _chunk);
+        }
+
+        // Attribute columns
+        std::vector<uint8_t> columns;
+        for (const SnapshotSerializer::Attribute& attribute : component.attributes)
+            for (uint8_t* comp : comps)
+                columns.insert(columns.end(), comp + attribute.desc->offset, comp + attribute.desc->offset + attribute.size);
+        DeltaCodec::encode(rowsChanged ? nullptr : component.columns.data(), columns.data(), columns.size(), _chunk);
+
+        component.rows = std::move(rows);
+        component.columns = std::move(columns);
+    }
+
+    _numFrames++;
+    if (++_chunkNumFrames == _keyframeInterval)
+        writeChunk();
+}
+
+bool Recorder::updateRegistries() {
+    if (_registryGeneration == cmp::getRegistryGeneration())
+        return true;
+    _registryGeneration = cmp::getRegistryGeneration();
+
+    std::vector<cmp::ComponentRegistry*> registries = cmp::getComponentRegistries();
+    for (ComponentState& component : _components) {
+        auto it = std::find_if(registries.begin(), registries.end(), [&](cmp::ComponentRegistry* r) { return r->getId() == component.id; });
+        if (it == registries.end())
+            return false;
+        std::vector<SnapshotSerializer::Attribute> attributes = SnapshotSerializer::getAttributes(*it);
+        if (!(getLayout(attributes) == component.layout))
+            return false;
+        component.compReg = *it;
+        component.attributes = std::move(attributes);
+    }
+    return true;
+}
+
+std::vector<Recorder::AttributeLayout> Recorder::getLayout(const std::vector<SnapshotSerializer::Attribute>& attributes) {
+    std::vector<AttributeLayout> layout;
+    for (const SnapshotSerializer::Attribute& attribute : attributes)
+        layout.push_back({attribute.desc->name, uint32_t(attribute.desc->type), attribute.desc->offset, attribute.size});
+    return layout;
+}
+
+void Recorder::writeChunk() {
+    if (_chunkNumFrames == 0)
+        return;
+    _chunkIndex.push_back({_fileSize, _numFrames - _chunkNumFrames});
+    _file.write(reinterpret_cast<const char*>(&_chunkNumFrames), sizeof(uint32_t));
+    _file.write(reinterpret_cast<const char*>(_chunk.getData().data()), _chunk.getSize());
+    _fileSize += sizeof(uint32_t) + _chunk.getSize();
+    _chunk.clear();
+    _chunkNumFrames = 0;
+}
+
+} // namespace atta::file
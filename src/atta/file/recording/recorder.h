@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/component/interface.h>
+#include <atta/file/project/snapshotSerializer.h>
+#include <atta/file/serializer/binarySerializer.h>
+
+namespace atta::file {
+
+/** Simulation recorder
+ *
+ * Every stepInterval steps, the selected components of all entities are appended to a binary log. Each component is
+ * stored as attribute columns, encoded with the DeltaCodec against the previous recorded frame. Frames are grouped in
+ * chunks that start with a keyframe (encoded without previous frame), so the Player can seek without decoding the
+ * whole log. Chunks are written to the file as soon as they are complete
+ *
+ * Layout:
+ *   - Header: magic, version, step interval, keyframe interval, component schemas (name, attribute name/type/size)
+ *   - Chunks: number of frames, then for each frame: time and, for each component, entity ids (if changed) and columns
+ *   - Index: chunk offsets and first frames, number of frames, index offset, magic
+ *
+ * If the script components are reloaded while recording, the registries are looked up again. The recording is closed if
+ * the layout of a recorded component changed, because the header schema would no longer match the frames
+ **/
+class Recorder final {
+  public:
+    static constexpr char MAGIC[8] = {'A', 'T', 'T', 'A', 'R', 'E', 'C', '\0'};
+    static constexpr uint32_t VERSION = 1;
+
+    Recorder(const fs::path& file, const std::vector<cmp::ComponentId>& components, uint32_t stepInterval = 1, uint32_t keyframeInterval = 100);
+    ~Recorder();
+    Recorder(const Recorder&) = delete;
+    Recorder& operator=(const Recorder&) = delete;
+
+    /// Should be called after each simulation step, records a frame every stepInterval steps
+    void step(float time);
+    /// Write the last chunk and the index, no frames can be recorded after closing
+    void close();
+
+    bool isOpen() const { return _file.is_open(); }
+    uint32_t getNumFrames() const { return _numFrames; }
+    size_t getFileSize() const { return _fileSize; }
+
+  private:
+    void recordFrame(float time);
+    void writeChunk();
+    /// Look up the registries again if they were reloaded, return false if the layout of some recorded component changed
+    bool updateRegistries();
+
+    struct AttributeLayout {
+        std::string name;
+        uint32_t type;
+        unsigned offset;
+        uint32_t size;
+        bool operator==(const AttributeLayout& o) const { return name == o.name && type == o.type && offset == o.offset && size == o.size; }
+    };
+    static std::vector<AttributeLayout> getLayout(const std::vector<SnapshotSerializer::Attribute>& attributes);
+
+    struct ComponentState {
+        cmp::ComponentId id;
+        cmp::ComponentRegistry* compReg;
+        std::vector<SnapshotSerializer::Attribute> attributes;
+        std::vector<AttributeLayout> layout; ///< Copy of the attribute descriptions, they are unloaded with the registries
+        std::vector<cmp::EntityId> rows;
+        std::vector<uint8_t> columns;
+    };
+
+    std::ofstream _file;
+    size_t _fileSize;
+    std::vector<ComponentState> _components;
+    uint32_t _stepInterval;
+    uint32_t _keyframeInterval;
+    uint32_t _numSteps;
+    uint32_t _numFrames;
+    uint32_t _registryGeneration;
+
+    BinaryWriter _chunk;
+    uint32_t _chunkNumFrames;
+    std::vector<std::pair<uint64_t, uint32_t>> _chunkIndex; ///< Offset and first frame of each chunk
+};
+
+} // namespace atta::file
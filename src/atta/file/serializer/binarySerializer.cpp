@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/file/serializer/binarySerializer.h>
+
+#ifdef ATTA_OS_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace atta::file {
+
+//---------- BinaryWriter ----------//
+void BinaryWriter::writeBytes(const void* data, size_t size) {
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    _data.insert(_data.end(), bytes, bytes + size);
+}
+
+void BinaryWriter::writeString(const std::string& str) {
+    write<uint32_t>(str.size());
+    writeBytes(str.data(), str.size());
+}
+
+void BinaryWriter::align(size_t alignment) {
+    size_t padding = (alignment - _data.size() % alignment) % alignment;
+    _data.resize(_data.size() + padding, 0);
+}
+
+bool BinaryWriter::saveToFile(const fs::path& file) const {
+    fs::path temp = file;
+    temp += ".temp";
+    {
+        std::ofstream ofs(temp, std::ios::binary);
+        if (!ofs.is_open()) {
+            LOG_ERROR("file::BinaryWriter", "Failed to open file for writing: [w]$0", temp);
+            return false;
+        }
+        ofs.write(reinterpret_cast<const char*>(_data.data()), _data.size());
+    }
+    fs::rename(temp, file);
+    return true;
+}
+
+//---------- BinaryReader ----------//
+BinaryReader::BinaryReader(const uint8_t* data, size_t size) : _data(data), _size(size), _pos(0), _valid(data != nullptr) {}
+
+const uint8_t* BinaryReader::readBytes(size_t size) {
+    if (!_valid || size > _size - _pos) {
+        _valid = false;
+        return nullptr;
+    }
+    const uint8_t* bytes = _data + _pos;
+    _pos += size;
+    return bytes;
+}
+
+bool BinaryReader::readString(std::string& str) {
+    uint32_t size;
+    if (!read(size))
+        return false;
+    const uint8_t* bytes = readBytes(size);
+    if (bytes == nullptr)
+        return false;
+    str.assign(reinterpret_cast<const char*>(bytes), size);
+    return true;
+}
+
+void BinaryReader::align(size_t alignment) { readBytes((alignment - _pos % alignment) % alignment); }
+
+//---------- MappedFile ----------//
+MappedFile::MappedFile(const fs::path& file) : _data(nullptr), _size(0) {
+#ifdef ATTA_OS_LINUX
+    int fd = ::open(file.c_str(), O_RDONLY);
+    if (fd < 0) {
+        LOG_ERROR("file::MappedFile", "Failed to open file [w]$0", file);
+        return;
+    }
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* ptr = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (ptr != MAP_FAILED) {
+            _data = static_cast<const uint8_t*>(ptr);
+            _size = st.st_size;
+        }
+    }
+    ::close(fd);
+    if (_data == nullptr)
+        LOG_ERROR("file::MappedFile", "Failed to map file [w]$0", file);
+#else
+    std::ifstream ifs(file, std::ios::binary);
+    if (!ifs.is_open()) {
+        LOG_ERROR("file::MappedFile", "Failed to open file [w]$0", file);
+        return;
+    }
+    _buffer.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    if (!_buffer.empty()) {
+        _data = _buffer.data();
+        _size = _buffer.size();
+    }
+#endif
+}
+
+MappedFile::~MappedFile() {
+#ifdef ATTA_OS_LINUX
+    if (_data != nullptr)
+        munmap(const_cast<uint8_t*>(_data), _size);
+#endif
+}
+
+} // namespace atta::file
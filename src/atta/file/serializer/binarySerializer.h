@@ -0,0 +1,84 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+namespace atta::file {
+
+/** Binary writer
+ *
+ * Appends raw values to a byte buffer. Used by binary formats (snapshots, caches) where the data should be loaded
+ * back with a memcpy instead of being parsed. Values are written with the native byte order
+ **/
+class BinaryWriter {
+  public:
+    template <typename T>
+    void write(const T& value);
+    void writeBytes(const void* data, size_t size);
+    void writeString(const std::string& str);
+
+    /// Pad with zeros until the buffer size is a multiple of alignment
+    void align(size_t alignment);
+
+    const std::vector<uint8_t>& getData() const { return _data; }
+    size_t getSize() const { return _data.size(); }
+    void clear() { _data.clear(); }
+
+    /// Write buffer to file (writes to a temporary file and then renames it)
+    bool saveToFile(const fs::path& file) const;
+
+  private:
+    std::vector<uint8_t> _data;
+};
+
+/** Binary reader
+ *
+ * Reads values from memory written by the BinaryWriter. The memory is not copied, so it must be valid while the reader
+ * is used. After reading past the end, all reads fail and isValid() returns false
+ **/
+class BinaryReader {
+  public:
+    BinaryReader(const uint8_t* data, size_t size);
+
+    template <typename T>
+    bool read(T& value);
+    const uint8_t* readBytes(size_t size); ///< Return pointer to the bytes in memory, nullptr if out of bounds
+    bool readString(std::string& str);
+
+    /// Skip bytes until the position is a multiple of alignment
+    void align(size_t alignment);
+
+    bool isValid() const { return _valid; }
+    size_t getPosition() const { return _pos; }
+    size_t getSize() const { return _size; }
+
+  private:
+    const uint8_t* _data;
+    size_t _size;
+    size_t _pos;
+    bool _valid;
+};
+
+/** Read-only file mapped to memory
+ *
+ * Uses mmap when available, otherwise the whole file is read to memory
+ **/
+class MappedFile {
+  public:
+    MappedFile(const fs::path& file);
+    ~MappedFile();
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool isOpen() const { return _data != nullptr; }
+    const uint8_t* getData() const { return _data; }
+    size_t getSize() const { return _size; }
+
+  private:
+    const uint8_t* _data;
+    size_t _size;
+    std::vector<uint8_t> _buffer; ///< Used when mmap is not available
+};
+
+} // namespace atta::file
+
+#include <atta/file/serializer/binarySerializer.inl>
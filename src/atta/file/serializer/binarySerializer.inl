@@ -0,0 +1,21 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+namespace atta::file {
+
+template <typename T>
+void BinaryWriter::write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "BinaryWriter can only write trivially copyable types");
+    writeBytes(&value, sizeof(T));
+}
+
+template <typename T>
+bool BinaryReader::read(T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "BinaryReader can only read trivially copyable types");
+    const uint8_t* bytes = readBytes(sizeof(T));
+    if (bytes == nullptr)
+        return false;
+    std::memcpy(&value, bytes, sizeof(T));
+    return true;
+}
+
+} // namespace atta::file
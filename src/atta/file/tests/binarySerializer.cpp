@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/transform.h>
+#include <atta/component/tests/common.h>
+#include <atta/file/project/snapshotSerializer.h>
+#include <atta/file/serializer/binarySerializer.h>
+#include <atta/file/serializer/section.h>
+#include <atta/file/serializer/serializer.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::file;
+
+namespace {
+
+TEST(File_BinarySerializer, WriteRead) {
+    BinaryWriter writer;
+    writer.write<uint32_t>(42);
+    writer.write<float>(3.5f);
+    writer.writeString("atta");
+    writer.write(vec3(1.0f, 2.0f, 3.0f));
+
+    BinaryReader reader(writer.getData().data(), writer.getSize());
+    uint32_t u;
+    float f;
+    std::string s;
+    vec3 v;
+    EXPECT_TRUE(reader.read(u));
+    EXPECT_TRUE(reader.read(f));
+    EXPECT_TRUE(reader.readString(s));
+    EXPECT_TRUE(reader.read(v));
+    EXPECT_EQ(u, 42);
+    EXPECT_EQ(f, 3.5f);
+    EXPECT_EQ(s, "atta");
+    EXPECT_EQ(v, vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_TRUE(reader.isValid());
+    EXPECT_EQ(reader.getPosition(), reader.getSize());
+}
+
+TEST(File_BinarySerializer, Align) {
+    BinaryWriter writer;
+    writer.write<uint8_t>(1);
+    writer.align(16);
+    EXPECT_EQ(writer.getSize(), 16);
+    writer.write<uint32_t>(7);
+
+    BinaryReader reader(writer.getData().data(), writer.getSize());
+    uint8_t b;
+    uint32_t u;
+    reader.read(b);
+    reader.align(16);
+    EXPECT_EQ(reader.getPosition(), 16);
+    reader.read(u);
+    EXPECT_EQ(u, 7);
+}
+
+TEST(File_BinarySerializer, ReadOutOfBounds) {
+    BinaryWriter writer;
+    writer.write<uint16_t>(1);
+
+    BinaryReader reader(writer.getData().data(), writer.getSize());
+    uint32_t u;
+    EXPECT_FALSE(reader.read(u));
+    EXPECT_FALSE(reader.isValid());
+    EXPECT_EQ(reader.readBytes(1), nullptr);
+}
+
+TEST(File_BinarySerializer, MappedFile) {
+    fs::path file = fs::temp_directory_path() / "atta_binary_serializer_test.bin";
+    BinaryWriter writer;
+    for (uint32_t i = 0; i < 100; i++)
+        writer.write(i);
+    ASSERT_TRUE(writer.saveToFile(file));
+
+    {
+        MappedFile mapped(file);
+        ASSERT_TRUE(mapped.isOpen());
+        ASSERT_EQ(mapped.getSize(), writer.getSize());
+        EXPECT_EQ(std::memcmp(mapped.getData(), writer.getData().data(), writer.getSize()), 0);
+    }
+    fs::remove(file);
+}
+
+//---------- Speed ----------//
+// Compare text sections with the binary snapshot when saving/loading many transforms
+constexpr size_t NUM_ENTITIES = 1000;
+
+class File_Speed : public ::testing::Test {
+  public:
+    void SetUp() override {
+        cmp::test::startUp();
+        for (size_t i = 0; i < NUM_ENTITIES; i++) {
+            cmp::Transform* t = cmp::createEntity(cmp::EntityId(i)).add<cmp::Transform>();
+            t->position = vec3(float(i), 1.0f, 2.0f);
+        }
+        _textFile = fs::temp_directory_path() / "atta_file_speed.atta";
+        _binaryFile = fs::temp_directory_path() / "atta_file_speed.attab";
+    }
+
+    void TearDown() override {
+        cmp::clear();
+        fs::remove(_textFile);
+        fs::remove(_binaryFile);
+    }
+
+    void saveText() {
+        Serializer serializer;
+        for (cmp::EntityId eid : cmp::getEntitiesView()) {
+            cmp::Transform* t = cmp::getComponent<cmp::Transform>(eid);
+            Section section("node");
+            section["id"] = uint32_t(eid);
+            section["transform.position"] = t->position;
+            section["transform.orientation"] = t->orientation;
+            section["transform.scale"] = t->scale;
+            serializer.addSection(section);
+        }
+        serializer.serialize(_textFile);
+    }
+
+    void saveBinary() {
+        BinaryWriter writer;
+        SnapshotSerializer::serialize(writer);
+        writer.saveToFile(_binaryFile);
+    }
+
+    fs::path _textFile;
+    fs::path _binaryFile;
+};
+
+TEST_F(File_Speed, SaveText) { saveText(); }
+
+TEST_F(File_Speed, SaveBinary) { saveBinary(); }
+
+TEST_F(File_Speed, LoadText) {
+    saveText();
+    cmp::clear();
+
+    Serializer serializer;
+    serializer.deserialize(_textFile);
+    for (const Section& section : serializer.getSections()) {
+        cmp::Transform* t = cmp::createEntity(cmp::EntityId(uint32_t(section["id"]))).add<cmp::Transform>();
+        t->position = vec3(section["transform.position"]);
+        t->orientation = quat(section["transform.orientation"]);
+        t->scale = vec3(section["transform.scale"]);
+    }
+    EXPECT_EQ(cmp::getComponent<cmp::Transform>(NUM_ENTITIES - 1)->position, vec3(float(NUM_ENTITIES - 1), 1.0f, 2.0f));
+}
+
+TEST_F(File_Speed, LoadBinary) {
+    saveBinary();
+    cmp::clear();
+
+    MappedFile file(_binaryFile);
+    ASSERT_TRUE(file.isOpen());
+    BinaryReader reader(file.getData(), file.getSize());
+    ASSERT_TRUE(SnapshotSerializer::deserialize(reader));
+    EXPECT_EQ(cmp::getComponent<cmp::Transform>(NUM_ENTITIES - 1)->position, vec3(float(NUM_ENTITIES - 1), 1.0f, 2.0f));
+}
+
+} // namespace
@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/file/recording/deltaCodec.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::file;
+
+namespace {
+
+TEST(File_DeltaCodec, Keyframe) {
+    std::vector<uint8_t> data(1000);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = (i % 7 == 0) ? 0 : uint8_t(i);
+
+    BinaryWriter writer;
+    DeltaCodec::encode(nullptr, data.data(), data.size(), writer);
+
+    std::vector<uint8_t> decoded(data.size(), 0);
+    BinaryReader reader(writer.getData().data(), writer.getSize());
+    ASSERT_TRUE(DeltaCodec::decode(reader, decoded.data(), decoded.size()));
+    EXPECT_EQ(decoded, data);
+    EXPECT_EQ(reader.getPosition(), reader.getSize());
+}
+
+TEST(File_DeltaCodec, Delta) {
+    std::vector<vec3> prev(1000), curr(1000);
+    for (size_t i = 0; i < prev.size(); i++)
+        prev[i] = curr[i] = vec3(float(i), 1.0f, 2.0f);
+    // Only a few values changed
+    curr[10].x = 5.0f;
+    curr[500].z = -1.0f;
+    curr[999].y = 3.0f;
+
+    const uint8_t* prevPtr = reinterpret_cast<const uint8_t*>(prev.data());
+    const uint8_t* currPtr = reinterpret_cast<const uint8_t*>(curr.data());
+    size_t size = curr.size() * sizeof(vec3);
+    BinaryWriter writer;
+    DeltaCodec::encode(prevPtr, currPtr, size, writer);
+    EXPECT_LT(writer.getSize(), 64);
+
+    std::vector<vec3> decoded = prev;
+    BinaryReader reader(writer.getData().data(), writer.getSize());
+    ASSERT_TRUE(DeltaCodec::decode(reader, reinterpret_cast<uint8_t*>(decoded.data()), size));
+    EXPECT_EQ(decoded, curr);
+}
+
+TEST(File_DeltaCodec, Corrupted) {
+    std::vector<uint8_t> data(100, 1);
+    BinaryWriter writer;
+    DeltaCodec::encode(nullptr, data.data(), data.size(), writer);
+
+    // Decode to smaller buffer
+    std::vector<uint8_t> decoded(50, 0);
+    BinaryReader reader(writer.getData().data(), writer.getSize());
+    EXPECT_FALSE(DeltaCodec::decode(reader, decoded.data(), decoded.size()));
+}
+
+} // namespace
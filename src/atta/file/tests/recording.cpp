@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/transform.h>
+#include <atta/component/tests/common.h>
+#include <atta/file/recording/player.h>
+#include <atta/file/recording/recorder.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::file;
+
+namespace {
+constexpr int NUM_ENTITIES = 10;
+constexpr uint32_t NUM_FRAMES = 25;
+constexpr uint32_t KEYFRAME_INTERVAL = 4;
+
+class File_Recording : public ::testing::Test {
+  public:
+    void SetUp() override {
+        cmp::test::startUp();
+        _file = fs::temp_directory_path() / "atta_file_recording.attarec";
+    }
+    void TearDown() override {
+        cmp::clear();
+        fs::remove(_file);
+    }
+
+  protected:
+    static vec3 getPosition(int entity, uint32_t frame) { return vec3(float(entity), float(frame), entity % 2 ? 0.0f : float(frame * frame)); }
+
+    // Record NUM_FRAMES frames of entities moving, the last entity is created in the middle of the recording
+    void record() {
+        std::vector<cmp::Entity> entities;
+        for (int i = 0; i < NUM_ENTITIES - 1; i++)
+            entities.push_back(cmp::createEntity());
+        for (cmp::Entity e : entities)
+            e.add<cmp::Transform>();
+
+        Recorder recorder(_file, {cmp::getId<cmp::Transform>()}, 1, KEYFRAME_INTERVAL);
+        ASSERT_TRUE(recorder.isOpen());
+        for (uint32_t f = 0; f < NUM_FRAMES; f++) {
+            if (f == NUM_FRAMES / 2) {
+                entities.push_back(cmp::createEntity());
+                entities.back().add<cmp::Transform>();
+            }
+            for (size_t i = 0; i < entities.size(); i++)
+                entities[i].get<cmp::Transform>()->position = getPosition(i, f);
+            recorder.step(f * 0.1f);
+        }
+        recorder.close();
+        EXPECT_EQ(recorder.getNumFrames(), NUM_FRAMES);
+        _entities.clear();
+        for (cmp::Entity e : entities)
+            _entities.push_back(e.getId());
+    }
+
+    void expectFrame(uint32_t frame) {
+        for (size_t i = 0; i < _entities.size(); i++) {
+            bool recorded = i < NUM_ENTITIES - 1 || frame >= NUM_FRAMES / 2;
+            cmp::Transform* t = recorded ? cmp::getComponent<cmp::Transform>(_entities[i]) : nullptr;
+            if (recorded) {
+                ASSERT_NE(t, nullptr) << "entity " << i << " frame " << frame;
+                EXPECT_EQ(t->position, getPosition(i, frame)) << "entity " << i << " frame " << frame;
+            }
+        }
+    }
+
+    fs::path _file;
+    std::vector<cmp::EntityId> _entities;
+};
+
+TEST_F(File_Recording, RoundTrip) {
+    record();
+    cmp::clear();
+
+    // Entities and components are created by the player
+    Player player(_file);
+    ASSERT_TRUE(player.isOpen());
+    EXPECT_EQ(player.getNumFrames(), NUM_FRAMES);
+    for (uint32_t f = 0; f < NUM_FRAMES; f++) {
+        ASSERT_TRUE(player.next());
+        EXPECT_EQ(player.getFrame(), f);
+        EXPECT_FLOAT_EQ(player.getTime(), f * 0.1f);
+        expectFrame(f);
+    }
+}
+
+TEST_F(File_Recording, Seek) {
+    record();
+    Player player(_file);
+    ASSERT_TRUE(player.isOpen());
+
+    // First frame, backwards in the same chunk, across chunks, and forward in the same chunk
+    for (uint32_t f : {0u, NUM_FRAMES - 1, 2u, 1u, 13u, 14u, 0u, KEYFRAME_INTERVAL, KEYFRAME_INTERVAL - 1, NUM_FRAMES / 2}) {
+        ASSERT_TRUE(player.seek(f));
+        EXPECT_EQ(player.getFrame(), f);
+        expectFrame(f);
+    }
+    EXPECT_FALSE(player.seek(NUM_FRAMES));
+}
+
+TEST_F(File_Recording, Corrupted) {
+    record();
+    fs::resize_file(_file, fs::file_size(_file) / 2);
+    Player player(_file);
+    EXPECT_FALSE(player.isOpen());
+    EXPECT_FALSE(player.seek(0));
+}
+
+} // namespace
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/cameraSensor.h>
+#include <atta/component/components/name.h>
+#include <atta/component/components/relationship.h>
+#include <atta/component/components/transform.h>
+#include <atta/component/tests/common.h>
+#include <atta/file/project/snapshotSerializer.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::file;
+
+namespace {
+
+class File_SnapshotSerializer : public ::testing::Test {
+  public:
+    void SetUp() override { cmp::test::startUp(); }
+    void TearDown() override { cmp::clear(); }
+};
+
+TEST_F(File_SnapshotSerializer, AttributeSizes) {
+    // The last attribute ends where the runtime data (sensorHandle) starts
+    cmp::ComponentRegistry* camera = &cmp::TypedComponentRegistry<cmp::CameraSensor>::getInstance();
+    std::vector<SnapshotSerializer::Attribute> attributes = SnapshotSerializer::getAttributes(camera);
+    ASSERT_FALSE(attributes.empty());
+    EXPECT_EQ(attributes.back().desc->name, "captureTime");
+    EXPECT_EQ(attributes.back().size, sizeof(float));
+
+    attributes = SnapshotSerializer::getAttributes(&cmp::TypedComponentRegistry<cmp::Transform>::getInstance());
+    ASSERT_EQ(attributes.size(), 3);
+    EXPECT_EQ(attributes[0].size, sizeof(vec3f));
+    EXPECT_EQ(attributes[1].size, sizeof(quat));
+    EXPECT_EQ(attributes[2].size, sizeof(cmp::Transform) - offsetof(cmp::Transform, scale));
+}
+
+TEST_F(File_SnapshotSerializer, RoundTrip) {
+    cmp::Entity parent = cmp::createEntity();
+    parent.add<cmp::Name>()->set("parent");
+    cmp::Transform* t = parent.add<cmp::Transform>();
+    t->position = vec3(1.0f, 2.0f, 3.0f);
+    t->scale = vec3(2.0f, 2.0f, 2.0f);
+    cmp::CameraSensor* camera = parent.add<cmp::CameraSensor>();
+    camera->width = 320;
+    camera->fov = 60.0f;
+    camera->captureTime = 1.5f;
+    camera->sensorHandle = 7;
+
+    cmp::Entity child = cmp::createEntity();
+    child.add<cmp::Name>()->set("child");
+    child.add<cmp::Transform>();
+    cmp::Relationship::setParent(parent, child);
+    child.get<cmp::Transform>()->position = vec3(0.0f, 0.0f, 1.0f);
+
+    BinaryWriter writer;
+    SnapshotSerializer::serialize(writer);
+    cmp::clear();
+    BinaryReader reader(writer.getData().data(), writer.getSize());
+    ASSERT_TRUE(SnapshotSerializer::deserialize(reader));
+    EXPECT_EQ(reader.getPosition(), reader.getSize());
+
+    ASSERT_NE(parent.get<cmp::Name>(), nullptr);
+    EXPECT_STREQ(parent.get<cmp::Name>()->name, "parent");
+    EXPECT_STREQ(child.get<cmp::Name>()->name, "child");
+    EXPECT_EQ(parent.get<cmp::Transform>()->position, vec3(1.0f, 2.0f, 3.0f));
+    EXPECT_EQ(parent.get<cmp::Transform>()->scale, vec3(2.0f, 2.0f, 2.0f));
+    EXPECT_EQ(child.get<cmp::Transform>()->position, vec3(0.0f, 0.0f, 1.0f));
+    ASSERT_NE(child.get<cmp::Relationship>(), nullptr);
+    EXPECT_EQ(child.get<cmp::Relationship>()->getParent(), parent);
+
+    // Camera attributes are loaded, the sensor handle is runtime data and keeps its default value
+    camera = parent.get<cmp::CameraSensor>();
+    ASSERT_NE(camera, nullptr);
+    EXPECT_EQ(camera->width, 320);
+    EXPECT_EQ(camera->fov, 60.0f);
+    EXPECT_EQ(camera->captureTime, 1.5f);
+    EXPECT_EQ(camera->sensorHandle, UINT32_MAX);
+}
+
+TEST_F(File_SnapshotSerializer, Corrupted) {
+    cmp::createEntity().add<cmp::Transform>();
+    BinaryWriter writer;
+    SnapshotSerializer::serialize(writer);
+    cmp::clear();
+
+    // Truncated snapshot
+    BinaryReader reader(writer.getData().data(), writer.getSize() / 2);
+    EXPECT_FALSE(SnapshotSerializer::deserialize(reader));
+}
+
+} // namespace
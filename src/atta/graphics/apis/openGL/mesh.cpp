@@ -13,6 +13,12 @@ Mesh::Mesh(CreateInfo info) : gfx::Mesh(info), _id(0) {
     _vertexBuffer = gfx::create<gfx::VertexBuffer>(info.vertexBufferInfo);
     if (info.indexBufferInfo.size > 0)
         _indexBuffer = gfx::create<gfx::IndexBuffer>(info.indexBufferInfo);
+    if (info.instanceBufferInfo.size > 0) {
+        VertexBuffer::CreateInfo instanceInfo = info.instanceBufferInfo;
+        instanceInfo.firstAttribute = info.vertexBufferInfo.layout.getElements().size();
+        instanceInfo.perInstance = true;
+        _instanceBuffer = gfx::create<gfx::VertexBuffer>(instanceInfo);
+    }
     glBindVertexArray(0);
 }
 
@@ -30,6 +36,19 @@ void Mesh::draw(Pipeline::Primitive primitive, size_t numVertices) {
     glBindVertexArray(0);
 }
 
+void Mesh::drawInstanced(Pipeline::Primitive primitive, size_t numInstances) {
+    if (!_instanceBuffer) {
+        LOG_WARN("gfx::gl::Mesh", "Could not draw instanced mesh without instance buffer");
+        return;
+    }
+    glBindVertexArray(_id);
+    if (_indexBuffer)
+        glDrawElementsInstanced(convert(primitive), _indexBuffer->getCount(), GL_UNSIGNED_INT, 0, numInstances);
+    else
+        glDrawArraysInstanced(convert(primitive), 0, _vertexBuffer->getCount(), numInstances);
+    glBindVertexArray(0);
+}
+
 GLenum Mesh::convert(Pipeline::Primitive primitive) {
     switch (primitive) {
         case Pipeline::Primitive::POINT:
@@ -15,6 +15,8 @@ class Mesh final : public gfx::Mesh {
     ~Mesh();
 
     void draw(Pipeline::Primitive primitive, size_t numVertices = 0);
+    /// Draw the mesh once for each of the first numInstances in the instance buffer
+    void drawInstanced(Pipeline::Primitive primitive, size_t numInstances);
 
     OpenGLId getHandle() const { return _id; }
 
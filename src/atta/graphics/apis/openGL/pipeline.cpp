@@ -22,13 +22,21 @@ void Pipeline::end() { _shader->unbind(); }
 void Pipeline::resize(uint32_t width, uint32_t height) { _renderPass->getFramebuffer()->resize(width, height); }
 
 void Pipeline::renderMesh(StringId meshSid, size_t numVertices) {
-    std::shared_ptr<gl::Mesh> mesh = std::dynamic_pointer_cast<gl::Mesh>(Manager::getInstance().getMeshes().at(meshSid));
+    const auto& meshes = Manager::getInstance().getMeshes();
+    auto it = meshes.find(meshSid);
+    if (it == meshes.end())
+        return; // Mesh resource is still being loaded
+    std::shared_ptr<gl::Mesh> mesh = std::dynamic_pointer_cast<gl::Mesh>(it->second);
     if (mesh)
         mesh->draw(_primitive, numVertices);
     else
         LOG_WARN("gfx::gl::Pipeline", "Could not render mesh [w]$0[], mesh not found", meshSid);
 }
 
+void Pipeline::renderMeshInstanced(std::shared_ptr<gfx::Mesh> mesh, size_t numInstances) {
+    std::static_pointer_cast<gl::Mesh>(mesh)->drawInstanced(_primitive, numInstances);
+}
+
 void Pipeline::renderQuad() {
     renderMesh("atta::gfx::quad");
     if (_renderPass->getFramebuffer()->hasDepthAttachment())
@@ -18,6 +18,7 @@ class Pipeline final : public gfx::Pipeline {
     void resize(uint32_t width, uint32_t height) override;
 
     void renderMesh(StringId meshSid, size_t numVertices = 0) override;
+    void renderMeshInstanced(std::shared_ptr<gfx::Mesh> mesh, size_t numInstances) override;
     void renderQuad() override;
     void renderQuad3() override;
     void renderCube() override;
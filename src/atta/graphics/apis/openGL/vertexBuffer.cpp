@@ -9,7 +9,7 @@ VertexBuffer::VertexBuffer(const VertexBuffer::CreateInfo& info) : gfx::VertexBu
     glBindBuffer(GL_ARRAY_BUFFER, _id);
     glBufferData(GL_ARRAY_BUFFER, _size, _data, GL_STATIC_DRAW);
 
-    uint32_t i = 0;
+    uint32_t i = info.firstAttribute;
     for (const auto& element : _layout.getElements()) {
         GLenum openGLType = convertBaseType(element.type);
 
@@ -23,6 +23,8 @@ VertexBuffer::VertexBuffer(const VertexBuffer::CreateInfo& info) : gfx::VertexBu
 
         // Enable attribute
         glEnableVertexAttribArray(i);
+        if (info.perInstance)
+            glVertexAttribDivisor(i, 1);
         i++;
     }
 }
@@ -261,7 +261,11 @@ void Pipeline::resize(uint32_t width, uint32_t height) {
 }
 
 void Pipeline::renderMesh(StringId meshSid, size_t numVertices) {
-    std::shared_ptr<vk::Mesh> mesh = std::dynamic_pointer_cast<vk::Mesh>(Manager::getInstance().getMeshes().at(meshSid));
+    const auto& meshes = Manager::getInstance().getMeshes();
+    auto it = meshes.find(meshSid);
+    if (it == meshes.end())
+        return; // Mesh resource is still being loaded
+    std::shared_ptr<vk::Mesh> mesh = std::dynamic_pointer_cast<vk::Mesh>(it->second);
     if (mesh) {
         // Get command buffer
         VkCommandBuffer commandBuffer = std::dynamic_pointer_cast<vk::RenderQueue>(_renderPass->getRenderQueue())->getCommandBuffer();
@@ -10,7 +10,7 @@ StringId Drawer::pointMeshName = "atta::gfx::Drawer::point";
 
 Drawer::Drawer()
     : _maxNumberOfLines(100000), _currNumberOfLines(0), _linesChanged(false), _maxNumberOfPoints(1000000), _currNumberOfPoints(0),
-      _pointsChanged(false) {
+      _pointsChanged(false), _maxNumberOfInstances(25000), _instancesChanged(false), _instancing(false) {
     _lines.resize(_maxNumberOfLines);
     _points.resize(_maxNumberOfPoints);
     // Line buffer
@@ -41,22 +41,178 @@ Drawer& Drawer::getInstance() {
     return drawer;
 }
 
+void Drawer::addLines(Span<const Line> lines, StringId group) { getInstance().addLinesImpl(lines, group); }
+void Drawer::addLinesImpl(Span<const Line> lines, StringId group) {
+    std::vector<Line>& groupLines = _lineGroups[group.getId()];
+    groupLines.insert(groupLines.end(), lines.begin(), lines.end());
+    _currNumberOfLines += lines.size();
+    _linesChanged = true;
+}
+
+void Drawer::addInstances(Shape shape, Span<const Instance> instances, StringId group) {
+    getInstance().addInstancesImpl(shape, instances, group);
+}
+void Drawer::addInstancesImpl(Shape shape, Span<const Instance> instances, StringId group) {
+    if (instances.empty())
+        return;
+    if (_instancing) {
+        std::vector<Instance>& groupInstances = _instanceGroups[group.getId()][size_t(shape)];
+        groupInstances.insert(groupInstances.end(), instances.begin(), instances.end());
+        _instancesChanged = true;
+    } else
+        expandInstances(shape, instances, group);
+}
+
+void Drawer::expandInstances(Shape shape, Span<const Instance> instances, StringId group) {
+    const ShapeLines& shapeLines = getShapeLines(shape);
+    const size_t numLines = shapeLines.indices.size() / 2;
+    _shapeVertices.resize(shapeLines.vertices.size());
+
+    std::vector<Line>& groupLines = _lineGroups[group.getId()];
+    size_t first = groupLines.size();
+    groupLines.resize(first + instances.size() * numLines);
+    Line* line = groupLines.data() + first;
+    for (const Instance& instance : instances) {
+        // Each vertex is shared by many lines, transform it once
+        for (size_t v = 0; v < shapeLines.vertices.size(); v++)
+            _shapeVertices[v] = vec3(instance.transform * vec4(shapeLines.vertices[v], 1.0f));
+        for (size_t i = 0; i < shapeLines.indices.size(); i += 2, line++) {
+            line->p0 = _shapeVertices[shapeLines.indices[i]];
+            line->p1 = _shapeVertices[shapeLines.indices[i + 1]];
+            line->c0 = instance.color;
+            line->c1 = instance.color;
+        }
+    }
+    _currNumberOfLines += instances.size() * numLines;
+    _linesChanged = true;
+}
+
+Span<const Drawer::Instance> Drawer::getInstances(Shape shape) { return getInstance()._instances[size_t(shape)]; }
+unsigned Drawer::getMaxNumberOfInstances() { return getInstance()._maxNumberOfInstances; }
+
+void Drawer::setInstancing(bool instancing) { getInstance().setInstancingImpl(instancing); }
+bool Drawer::getInstancing() { return getInstance()._instancing; }
+void Drawer::setInstancingImpl(bool instancing) {
+    if (_instancing && !instancing) {
+        // Draw the stored instances as lines
+        for (auto& [key, shapes] : _instanceGroups)
+            for (size_t s = 0; s < NUM_SHAPES; s++)
+                expandInstances(Shape(s), shapes[s], StringId(key));
+        _instanceGroups.clear();
+        _instancesChanged = true;
+    }
+    _instancing = instancing;
+}
+
+const Drawer::ShapeLines& Drawer::getShapeLines(Shape shape) {
+    static const std::array<ShapeLines, 5> shapes = []() {
+        constexpr uint16_t numSegments = 32;
+        std::array<ShapeLines, 5> s{};
+        // Closed loop of numSegments vertices starting at first
+        auto addLoop = [](ShapeLines& sl, uint16_t first, uint16_t num) {
+            for (uint16_t i = 0; i < num; i++) {
+                sl.indices.push_back(first + i);
+                sl.indices.push_back(first + (i + 1) % num);
+            }
+        };
+
+        ShapeLines& square = s[size_t(Shape::SQUARE)];
+        square.vertices = {{0.5, 0.5, 0}, {-0.5, 0.5, 0}, {-0.5, -0.5, 0}, {0.5, -0.5, 0}};
+        addLoop(square, 0, 4);
+
+        ShapeLines& box = s[size_t(Shape::BOX)];
+        box.vertices = {{0.5, 0.5, 0.5},  {-0.5, 0.5, 0.5},  {-0.5, -0.5, 0.5},  {0.5, -0.5, 0.5},
+                        {0.5, 0.5, -0.5}, {-0.5, 0.5, -0.5}, {-0.5, -0.5, -0.5}, {0.5, -0.5, -0.5}};
+        addLoop(box, 0, 4); // Top
+        addLoop(box, 4, 4); // Bottom
+        for (uint16_t i = 0; i < 4; i++) {
+            box.indices.push_back(i);
+            box.indices.push_back(i + 4);
+        }
+
+        ShapeLines& circle = s[size_t(Shape::CIRCLE)];
+        ShapeLines& sphere = s[size_t(Shape::SPHERE)];
+        ShapeLines& cylinder = s[size_t(Shape::CYLINDER)];
+        for (uint16_t i = 0; i < numSegments; i++) {
+            float angle = i / float(numSegments) * 2 * M_PI;
+            float c = std::cos(angle);
+            float sn = std::sin(angle);
+            circle.vertices.push_back(vec3(c, sn, 0.0f));
+            sphere.vertices.push_back(vec3(c, sn, 0.0f));
+            sphere.vertices.push_back(vec3(c, 0.0f, sn));
+            sphere.vertices.push_back(vec3(0.0f, c, sn));
+            cylinder.vertices.push_back(vec3(c * 0.5f, sn * 0.5f, 0.5f));
+            cylinder.vertices.push_back(vec3(c * 0.5f, sn * 0.5f, -0.5f));
+        }
+        addLoop(circle, 0, numSegments);
+        // Sphere and cylinder vertices are interleaved, one loop for each plane
+        for (uint16_t p = 0; p < 3; p++)
+            for (uint16_t i = 0; i < numSegments; i++) {
+                sphere.indices.push_back(i * 3 + p);
+                sphere.indices.push_back((i + 1) % numSegments * 3 + p);
+            }
+        for (uint16_t p = 0; p < 2; p++)
+            for (uint16_t i = 0; i < numSegments; i++) {
+                cylinder.indices.push_back(i * 2 + p);
+                cylinder.indices.push_back((i + 1) % numSegments * 2 + p);
+            }
+        for (uint16_t i = 0; i < numSegments; i += numSegments / 4) {
+            cylinder.indices.push_back(i * 2);
+            cylinder.indices.push_back(i * 2 + 1);
+        }
+        return s;
+    }();
+    return shapes[size_t(shape)];
+}
+
 void Drawer::clear(StringId group) { getInstance().clearImpl(group); }
 void Drawer::clearImpl(StringId group) {
     if (group == "No group"_sid) {
         _lineGroups.clear();
         _pointGroups.clear();
+        _instanceGroups.clear();
         _linesChanged = true;
         _pointsChanged = true;
+        _instancesChanged = true;
     } else {
         clearImpl<Line>(group);
         clearImpl<Point>(group);
     }
 }
 
+void Drawer::clearInstances(StringId group) {
+    // The vectors are kept to avoid allocations when the group is updated every frame
+    auto it = _instanceGroups.find(group.getId());
+    if (it != _instanceGroups.end()) {
+        for (std::vector<Instance>& instances : it->second)
+            instances.clear();
+        _instancesChanged = true;
+    }
+}
+
 void Drawer::update() {
     getInstance().updateImpl<Drawer::Line>();
     getInstance().updateImpl<Drawer::Point>();
+    getInstance().updateInstances();
+}
+
+void Drawer::updateInstances() {
+    if (!_instancesChanged)
+        return;
+    for (size_t s = 0; s < NUM_SHAPES; s++) {
+        // Copy group instances, instances that do not fit in the GPU buffer are not drawn
+        std::vector<Instance>& buffer = _instances[s];
+        buffer.clear();
+        for (const auto& [key, shapes] : _instanceGroups) {
+            size_t count = std::min<size_t>(shapes[s].size(), _maxNumberOfInstances - buffer.size());
+            buffer.insert(buffer.end(), shapes[s].begin(), shapes[s].begin() + count);
+            if (count < shapes[s].size()) {
+                LOG_WARN("gfx::Drawer", "Too many instances to draw, only the first [w]$0[] of each shape are drawn", _maxNumberOfInstances);
+                break;
+            }
+        }
+    }
+    _instancesChanged = false;
 }
 
 template <typename T>
@@ -66,28 +222,36 @@ void Drawer::updateImpl() {
             setCurrNumber<T>(0);
 
             // Populate vertex buffer
-            std::map<StringHash, std::vector<T>> groups = getGroupsImpl<T>();
-            for (auto& [key, group] : groups) {
-                // Copy group objects to preallocated vector
-                for (uint32_t i = 0; i < group.size(); i++) {
-                    if constexpr (std::is_same<T, Drawer::Line>::value)
-                        _lines[_currNumberOfLines++] = group[i];
-                    else if constexpr (std::is_same<T, Drawer::Point>::value)
-                        _points[_currNumberOfPoints++] = group[i];
+            std::vector<T>& buffer = [this]() -> std::vector<T>& {
+                if constexpr (std::is_same<T, Drawer::Line>::value)
+                    return _lines;
+                else
+                    return _points;
+            }();
+            unsigned num = 0;
+            for (const auto& [key, group] : getGroupsImpl<T>()) {
+                // Copy group objects to preallocated vector, objects that do not fit are not drawn
+                size_t count = std::min(group.size(), buffer.size() - num);
+                std::copy(group.begin(), group.begin() + count, buffer.begin() + num);
+                num += count;
+                if (count < group.size()) {
+                    LOG_WARN("gfx::Drawer", "Too many objects to draw, only the first [w]$0[] are drawn", buffer.size());
+                    break;
                 }
             }
+            setCurrNumber<T>(num);
 
             // Update mesh
             if constexpr (std::is_same<T, Drawer::Line>::value) {
                 res::Mesh* lineMesh = res::get<res::Mesh>(lineMeshName);
                 uint8_t* data = (uint8_t*)_lines.data();
                 size_t size = _lines.size() * sizeof(Line);
-                lineMesh->updateVertices(std::vector<uint8_t>(data, data + size));
+                lineMesh->updateVertices(data, size);
             } else if constexpr (std::is_same<T, Drawer::Point>::value) {
                 res::Mesh* pointMesh = res::get<res::Mesh>(pointMeshName);
                 uint8_t* data = (uint8_t*)_points.data();
                 size_t size = _points.size() * sizeof(Point);
-                pointMesh->updateVertices(std::vector<uint8_t>(data, data + size));
+                pointMesh->updateVertices(data, size);
             }
 
             // Set changed as false
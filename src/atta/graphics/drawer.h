@@ -4,6 +4,7 @@
 
 #include <atta/graphics/mesh.h>
 #include <atta/utils/math/math.h>
+#include <atta/utils/span.h>
 #include <atta/utils/stringId.h>
 
 namespace atta::graphics {
@@ -29,11 +30,28 @@ class Drawer {
         Point(vec3 p_, vec4 c_ = vec4(1, 0, 1, 1)) : p(p_), c(c_) {}
     };
 
+    /// Unit shapes drawn with lines
+    /** SQUARE (xy plane) and BOX have unit size, CIRCLE (xy plane) and SPHERE have unit radius, and CYLINDER has unit
+     * diameter and unit height along the z axis. All shapes are centered at the origin
+     **/
+    enum class Shape { SQUARE = 0, BOX, CIRCLE, SPHERE, CYLINDER };
+    static constexpr size_t NUM_SHAPES = size_t(Shape::CYLINDER) + 1;
+    struct Instance {
+        mat4 transform; ///< Unit shape to world transform
+        vec4 color;
+    };
+
     // Draw 3d objects
     template <typename T>
     static void add(T obj, StringId group = StringId("No group"));
+    static void addLines(Span<const Line> lines, StringId group = StringId("No group")); ///< Add many lines with one group lookup
+    /// Add the lines of the unit shape transformed by each instance
+    /** Used to draw many shapes with one group lookup. When instancing is enabled, the instances are drawn with one instanced
+     * draw per shape, otherwise their lines are written directly to the group buffer
+     **/
+    static void addInstances(Shape shape, Span<const Instance> instances, StringId group = StringId("No group"));
     template <typename T>
-    static void clear(StringId group = StringId("No group")); // Clear lines or points of specific group
+    static void clear(StringId group = StringId("No group")); // Clear lines or points of specific group, lines also clear instances
     static void clear(StringId group = StringId("No group")); // Clear specific group or all groups
 
     // Get data
@@ -43,6 +61,21 @@ class Drawer {
     static unsigned getMaxNumber();
     template <typename T>
     static unsigned getCurrNumber();
+    /// Instances of all groups, updated by update()
+    static Span<const Instance> getInstances(Shape shape);
+    static unsigned getMaxNumberOfInstances(); ///< Per shape
+
+    /// Enabled by the drawer pipeline if the graphics API supports instanced drawing, the stored instances are expanded to
+    /// lines when it is disabled
+    static void setInstancing(bool instancing);
+    static bool getInstancing();
+
+    /// Unit shape vertices and the vertex index pairs of its lines
+    struct ShapeLines {
+        std::vector<vec3> vertices;
+        std::vector<uint16_t> indices;
+    };
+    static const ShapeLines& getShapeLines(Shape shape);
 
     /**
      * @brief Update line and point data
@@ -63,9 +96,14 @@ class Drawer {
     // Draw 3d objects implementation
     template <typename T>
     void addImpl(T obj, StringId group);
+    void addLinesImpl(Span<const Line> lines, StringId group);
+    void addInstancesImpl(Shape shape, Span<const Instance> instances, StringId group);
+    void expandInstances(Shape shape, Span<const Instance> instances, StringId group);
     template <typename T>
     void clearImpl(StringId group);
     void clearImpl(StringId group);
+    void clearInstances(StringId group);
+    void setInstancingImpl(bool instancing);
 
     // Get data implementation
     template <typename T>
@@ -83,6 +121,7 @@ class Drawer {
 
     template <typename T>
     void updateImpl();
+    void updateInstances();
 
     // The _lines vector is updated only when getImpl()
     // is called and _linesChanged is true. Analogous to _points
@@ -97,6 +136,15 @@ class Drawer {
     unsigned _currNumberOfPoints; // Always have the right number of points, even if _points still need to be updated
     bool _pointsChanged;
     std::vector<Point> _points; // Updated only when get() is called
+
+    using ShapeInstances = std::array<std::vector<Instance>, NUM_SHAPES>;
+    std::map<StringHash, ShapeInstances> _instanceGroups; ///< Only used when instancing is enabled
+    unsigned _maxNumberOfInstances;
+    bool _instancesChanged;
+    bool _instancing;
+    ShapeInstances _instances; ///< Updated only when update() is called
+
+    std::vector<vec3> _shapeVertices; ///< Instance shape vertices in world space (kept to avoid allocations)
 };
 } // namespace atta::graphics
 
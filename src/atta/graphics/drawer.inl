@@ -16,7 +16,7 @@ void Drawer::clear(StringId group) {
 // Get data
 template <typename T>
 std::map<StringHash, std::vector<T>>& Drawer::getGroups() {
-    return getInstance().getGroups<T>();
+    return getInstance().getGroupsImpl<T>();
 }
 template <typename T>
 unsigned Drawer::getMaxNumber() {
@@ -44,6 +44,8 @@ void Drawer::clearImpl(StringId group) {
         setCurrNumber<T>(getCurrNumber<T>() - getGroupsImpl<T>()[group.getId()].size());
         getGroupsImpl<T>()[group.getId()].clear();
         setChanged<T>(true);
+        if constexpr (std::is_same<T, Drawer::Line>::value)
+            clearInstances(group);
     } else
         ASSERT(false, "Drawer clear() to unknown type $0. Should clear only lines or points.", typeid(T).name());
 }
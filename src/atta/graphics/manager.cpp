@@ -27,6 +27,7 @@
 #include <atta/memory/interface.h>
 
 #include <atta/resource/interface.h>
+#include <atta/resource/meshOptimizer.h>
 
 namespace atta::graphics {
 
@@ -99,26 +100,19 @@ void Manager::updateImpl() {
     if (_graphicsAPI->getType() != _desiredGraphicsAPI)
         recreateGraphicsAPI();
 
-    // Graphics fps
-    static clock_t gfxLastTime = std::clock();
-    const clock_t gfxCurrTime = std::clock();
-    const float gfxTimeDiff = float(gfxCurrTime - gfxLastTime) / CLOCKS_PER_SEC;
-
-    if (_graphicsFPS > 0 && (gfxTimeDiff > 1 / _graphicsFPS)) {
-        gfxLastTime = gfxCurrTime;
-        // Update window events
-        _window->update();
-
-        // Render UI viewports
-        if (_uiRenderViewportsFunc)
-            _uiRenderViewportsFunc();
-
-        // Render UI
-        _graphicsAPI->beginFrame();
-        if (_uiRenderFunc)
-            _uiRenderFunc();
-        _graphicsAPI->endFrame();
-    }
+    // The main loop calls update at the graphics fps (StepScheduler)
+    // Update window events
+    _window->update();
+
+    // Render UI viewports
+    if (_uiRenderViewportsFunc)
+        _uiRenderViewportsFunc();
+
+    // Render UI
+    _graphicsAPI->beginFrame();
+    if (_uiRenderFunc)
+        _uiRenderFunc();
+    _graphicsAPI->endFrame();
 }
 
 std::shared_ptr<GraphicsAPI> Manager::getGraphicsAPIImpl() const { return _graphicsAPI; }
@@ -177,6 +171,7 @@ gfx::Image::Format Manager::convertFormat(res::Image::Format format) const {
 
 void Manager::syncResources() {
     _meshes.clear();
+    _meshLods.clear();
     _images.clear();
     // Initialize meshes already loaded
     for (auto meshSid : resource::getResources<resource::Mesh>())
@@ -320,14 +315,18 @@ void Manager::onMeshUpdateEvent(event::Event& event) {
     if (_meshes.find(e.sid) != _meshes.end()) {
         std::shared_ptr<gfx::Mesh> mesh = _meshes[e.sid];
         mesh->getVertexBuffer()->update(meshResource->getVertices().data(), meshResource->getVertices().size());
+        // The resource dropped its LODs, the full mesh is rendered at any distance (no simplification for each update)
+        destroyMeshLods(e.sid);
     } else
         LOG_WARN("gfx::Manager", "Can not update mesh [w]$0[] that was not created", e.sid);
 }
 
 void Manager::onMeshDestroyEvent(event::Event& event) {
     event::MeshDestroy& e = reinterpret_cast<event::MeshDestroy&>(event);
-    if (_meshes.find(e.sid) != _meshes.end())
+    if (_meshes.find(e.sid) != _meshes.end()) {
         _meshes[e.sid].reset();
+        destroyMeshLods(e.sid);
+    }
     else
         LOG_WARN("gfx::Manager", "Can not destroy mesh [w]$0[] that was not created", e.sid);
 }
@@ -367,12 +366,52 @@ void Manager::onImageUpdateEvent(event::Event& event) {
 void Manager::createMesh(StringId sid) {
     LOG_VERBOSE("gfx::Manager", "Create mesh [w]$0[]", sid);
     resource::Mesh* mesh = resource::get<resource::Mesh>(sid.getString());
+    _meshes[sid] = createMesh(mesh->getVertexLayout(), mesh->getVertices(), mesh->getIndices());
 
+    // Create LODs
+    destroyMeshLods(sid);
+    if (mesh->getLods().empty())
+        return;
+    MeshLods& meshLods = _meshLods[sid];
+    int positionOffset = resource::MeshOptimizer::getPositionOffset(mesh->getVertexLayout());
+    size_t vertexSize = resource::MeshOptimizer::getVertexSize(mesh->getVertexLayout());
+    size_t numVertices = mesh->getVertices().size() / vertexSize;
+    std::vector<vec3> positions(numVertices);
+    for (size_t v = 0; v < numVertices; v++)
+        std::memcpy(&positions[v], &mesh->getVertices()[v * vertexSize + positionOffset], sizeof(vec3));
+    vec3 pMin = positions.empty() ? vec3(0.0f) : positions[0], pMax = pMin;
+    for (const vec3& p : positions) {
+        pMin = min(pMin, p);
+        pMax = max(pMax, p);
+    }
+    meshLods.center = (pMin + pMax) * 0.5f;
+    meshLods.radius = 0.0f;
+    for (const vec3& p : positions)
+        meshLods.radius = std::max(meshLods.radius, length(p - meshLods.center));
+    for (size_t i = 0; i < mesh->getLods().size(); i++) {
+        StringId lodSid(sid.getString() + "#lod" + std::to_string(i + 1));
+        const resource::Mesh::Lod& lod = mesh->getLods()[i];
+        _meshes[lodSid] = createMesh(mesh->getVertexLayout(), lod.vertices, lod.indices);
+        meshLods.lods.push_back(lodSid);
+    }
+}
+
+void Manager::destroyMeshLods(StringId sid) {
+    auto it = _meshLods.find(sid);
+    if (it == _meshLods.end())
+        return;
+    for (StringId lod : it->second.lods)
+        _meshes.erase(lod);
+    _meshLods.erase(it);
+}
+
+std::shared_ptr<Mesh> Manager::createMesh(const res::Mesh::VertexLayout& layout, const std::vector<uint8_t>& vertices,
+                                          const std::vector<res::Mesh::Index>& indices) {
     VertexBuffer::CreateInfo vertexInfo{};
-    vertexInfo.data = (uint8_t*)mesh->getVertices().data();
-    vertexInfo.size = mesh->getVertices().size();
+    vertexInfo.data = (uint8_t*)vertices.data();
+    vertexInfo.size = vertices.size();
     // Populate vertex layout
-    for (resource::Mesh::VertexElement element : mesh->getVertexLayout()) {
+    for (resource::Mesh::VertexElement element : layout) {
         BufferLayout::Element::Type type;
         switch (element.type) {
             case resource::Mesh::VertexElement::FLOAT:
@@ -392,15 +431,40 @@ void Manager::createMesh(StringId sid) {
     }
 
     IndexBuffer::CreateInfo indexInfo{};
-    if (!mesh->getIndices().empty()) {
-        indexInfo.data = (uint8_t*)mesh->getIndices().data();
-        indexInfo.size = mesh->getIndices().size() * sizeof(res::Mesh::Index);
+    if (!indices.empty()) {
+        indexInfo.data = (uint8_t*)indices.data();
+        indexInfo.size = indices.size() * sizeof(res::Mesh::Index);
     }
 
     Mesh::CreateInfo info{};
     info.vertexBufferInfo = vertexInfo;
     info.indexBufferInfo = indexInfo;
-    _meshes[sid] = create<Mesh>(info);
+    return create<Mesh>(info);
+}
+
+StringId Manager::getMeshLod(StringId sid, const mat4& model, const Camera& camera, uint32_t viewportHeight) const {
+    auto it = _meshLods.find(sid);
+    if (it == _meshLods.end())
+        return sid;
+    const MeshLods& meshLods = it->second;
+
+    // Projected bounding sphere diameter in pixels
+    vec3 scale = model.getScale();
+    float radius = meshLods.radius * std::max(scale.x, std::max(scale.y, scale.z));
+    mat4 proj = camera.getProj();
+    float pixels = radius * std::abs(proj.mat[1][1]) * viewportHeight;
+    if (proj.mat[3][2] != 0.0f) {
+        // Perspective projection, size decreases with distance
+        float distance = length(model * meshLods.center - camera.getPosition());
+        if (distance <= radius)
+            return sid;
+        pixels /= distance;
+    }
+
+    if (pixels >= res::Mesh::LOD_SCREEN_SIZE)
+        return sid;
+    size_t lod = 1 + size_t(std::log2(res::Mesh::LOD_SCREEN_SIZE / std::max(pixels, 1e-3f)));
+    return meshLods.lods[std::min(lod, meshLods.lods.size()) - 1];
 }
 
 void Manager::createImage(StringId sid) {
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <atta/graphics/apis/graphicsAPI.h>
+#include <atta/graphics/cameras/camera.h>
 #include <atta/graphics/framebuffer.h>
 #include <atta/graphics/image.h>
 #include <atta/graphics/indexBuffer.h>
@@ -13,6 +14,7 @@
 #include <atta/graphics/shader.h>
 #include <atta/graphics/vertexBuffer.h>
 #include <atta/resource/resources/image.h>
+#include <atta/resource/resources/mesh.h>
 
 namespace atta::graphics {
 
@@ -45,6 +47,9 @@ class Manager final {
     const std::unordered_map<StringId, std::shared_ptr<Mesh>>& getMeshes() const;
     const std::unordered_map<StringId, std::shared_ptr<Image>>& getImages() const;
 
+    /// Select mesh LOD from the size of the mesh bounding sphere projected on the viewport
+    StringId getMeshLod(StringId sid, const mat4& model, const Camera& camera, uint32_t viewportHeight) const;
+
   private:
     void startUpImpl();
     void shutDownImpl();
@@ -74,6 +79,9 @@ class Manager final {
     void onImageLoadEvent(event::Event& event);
     void onImageUpdateEvent(event::Event& event);
     void createMesh(StringId sid);
+    std::shared_ptr<Mesh> createMesh(const res::Mesh::VertexLayout& layout, const std::vector<uint8_t>& vertices,
+                                     const std::vector<res::Mesh::Index>& indices);
+    void destroyMeshLods(StringId sid);
     void createImage(StringId sid);
 
     std::shared_ptr<Window> _window;
@@ -86,6 +94,12 @@ class Manager final {
     // Resource binding
     std::unordered_map<StringId, std::shared_ptr<Mesh>> _meshes;
     std::unordered_map<StringId, std::shared_ptr<Image>> _images;
+    struct MeshLods {
+        vec3 center; ///< Bounding sphere in mesh space
+        float radius;
+        std::vector<StringId> lods;
+    };
+    std::unordered_map<StringId, MeshLods> _meshLods;
 
     // UI
     std::function<void()> _uiRenderViewportsFunc;
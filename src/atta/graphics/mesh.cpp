@@ -8,5 +8,6 @@ Mesh::Mesh(CreateInfo info) {}
 
 std::shared_ptr<VertexBuffer> Mesh::getVertexBuffer() const { return _vertexBuffer; }
 std::shared_ptr<IndexBuffer> Mesh::getIndexBuffer() const { return _indexBuffer; }
+std::shared_ptr<VertexBuffer> Mesh::getInstanceBuffer() const { return _instanceBuffer; }
 
 } // namespace atta::graphics
@@ -13,10 +13,13 @@ class Mesh {
      * @brief Mesh create info
      *
      * @note Index buffer can be empty if indices should not be used while drawing
+     * @note Instance buffer can be empty if the mesh is not drawn instanced, its attributes are placed after the vertex
+     * attributes
      */
     struct CreateInfo {
         VertexBuffer::CreateInfo vertexBufferInfo;
         IndexBuffer::CreateInfo indexBufferInfo;
+        VertexBuffer::CreateInfo instanceBufferInfo;
     };
 
     Mesh(CreateInfo info);
@@ -24,10 +27,12 @@ class Mesh {
 
     std::shared_ptr<VertexBuffer> getVertexBuffer() const;
     std::shared_ptr<IndexBuffer> getIndexBuffer() const;
+    std::shared_ptr<VertexBuffer> getInstanceBuffer() const;
 
   protected:
-    std::shared_ptr<VertexBuffer> _vertexBuffer; ///< Vertex buffer
-    std::shared_ptr<IndexBuffer> _indexBuffer;   ///< Index buffer (may be nullptr)
+    std::shared_ptr<VertexBuffer> _vertexBuffer;   ///< Vertex buffer
+    std::shared_ptr<IndexBuffer> _indexBuffer;     ///< Index buffer (may be nullptr)
+    std::shared_ptr<VertexBuffer> _instanceBuffer; ///< Per instance attributes (may be nullptr)
 };
 
 } // namespace atta::graphics
@@ -42,6 +42,9 @@ void Pipeline::setImageGroup(std::string name) { setImageGroup(name.c_str()); }
 void Pipeline::setImageGroup(StringId name) { setImageGroup(name.getString().c_str()); }
 
 void Pipeline::renderMesh(StringId meshSid, size_t numVertices) { LOG_WARN("Pipeline", "[w]renderMesh[] was not implemented yet"); }
+void Pipeline::renderMeshInstanced(std::shared_ptr<Mesh> mesh, size_t numInstances) {
+    LOG_WARN("Pipeline", "[w]renderMeshInstanced[] was not implemented yet");
+}
 void Pipeline::renderQuad() { LOG_WARN("Pipeline", "[w]renderQuad[] was not implemented yet"); }
 void Pipeline::renderQuad3() { LOG_WARN("Pipeline", "[w]renderQuad3[] was not implemented yet"); }
 void Pipeline::renderCube() { LOG_WARN("Pipeline", "[w]renderCube[] was not implemented yet"); }
@@ -3,6 +3,7 @@
 #pragma once
 
 #include <atta/event/event.h>
+#include <atta/graphics/mesh.h>
 #include <atta/graphics/renderPass.h>
 #include <atta/graphics/shader.h>
 #include <atta/graphics/vertexBuffer.h>
@@ -72,6 +73,12 @@ class Pipeline {
      * @warning numVertices should only be used if there is no index buffer
      */
     virtual void renderMesh(StringId meshSid, size_t numVertices = 0);
+    /**
+     * @brief Render mesh once for each instance
+     *
+     * The mesh must have been created with an instance buffer holding at least numInstances
+     */
+    virtual void renderMeshInstanced(std::shared_ptr<Mesh> mesh, size_t numInstances);
     virtual void renderQuad();
     virtual void renderQuad3();
     virtual void renderCube();
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: MIT
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/file/interface.h>
 #include <atta/graphics/drawer.h>
 #include <atta/graphics/interface.h>
 #include <atta/graphics/renderers/common/drawerPipeline.h>
@@ -26,9 +27,53 @@ DrawerPipeline::DrawerPipeline(std::shared_ptr<RenderPass> renderPass) {
         pipelineInfo.debugName = StringId("Drawer Point Pipeline");
         _pointPipeline = graphics::create<Pipeline>(pipelineInfo);
     }
+
+    //---------- Create instance pipeline ----------//
+    // Resource packs older than the instanced shader also use the fallback
+    const char* instanceShader = "shaders/drawer/instancedLine.asl";
+    bool instancing = graphics::getGraphicsAPI()->getType() == GraphicsAPI::OPENGL && !file::solveResourcePath(instanceShader).empty();
+    if (instancing) {
+        Pipeline::CreateInfo pipelineInfo{};
+        pipelineInfo.shader = graphics::create<Shader>(instanceShader);
+        pipelineInfo.renderPass = renderPass;
+        pipelineInfo.primitive = Pipeline::Primitive::LINE;
+        pipelineInfo.debugName = StringId("Drawer Instance Pipeline");
+        _instancePipeline = graphics::create<Pipeline>(pipelineInfo);
+
+        for (size_t s = 0; s < Drawer::NUM_SHAPES; s++) {
+            // Line vertex pairs of the unit shape
+            const Drawer::ShapeLines& shapeLines = Drawer::getShapeLines(Drawer::Shape(s));
+            std::vector<vec3> vertices;
+            for (uint16_t i : shapeLines.indices)
+                vertices.push_back(shapeLines.vertices[i]);
+
+            Mesh::CreateInfo info{};
+            info.vertexBufferInfo.layout.push(BufferLayout::Element::Type::VEC3, "iPos");
+            info.vertexBufferInfo.data = (uint8_t*)vertices.data();
+            info.vertexBufferInfo.size = vertices.size() * sizeof(vec3);
+            // Instance transform rows and color
+            info.instanceBufferInfo.layout.push(BufferLayout::Element::Type::VEC4, "iRow0");
+            info.instanceBufferInfo.layout.push(BufferLayout::Element::Type::VEC4, "iRow1");
+            info.instanceBufferInfo.layout.push(BufferLayout::Element::Type::VEC4, "iRow2");
+            info.instanceBufferInfo.layout.push(BufferLayout::Element::Type::VEC4, "iRow3");
+            info.instanceBufferInfo.layout.push(BufferLayout::Element::Type::VEC4, "iColor");
+            info.instanceBufferInfo.usage = VertexBuffer::Usage::DYNAMIC;
+            info.instanceBufferInfo.size = Drawer::getMaxNumberOfInstances() * sizeof(Drawer::Instance);
+            _shapeMeshes[s] = graphics::create<Mesh>(info);
+        }
+    }
+    Drawer::setInstancing(instancing);
 }
 
-void DrawerPipeline::update() { Drawer::update(); }
+void DrawerPipeline::update() {
+    Drawer::update();
+    if (_instancePipeline)
+        for (size_t s = 0; s < Drawer::NUM_SHAPES; s++) {
+            Span<const Drawer::Instance> instances = Drawer::getInstances(Drawer::Shape(s));
+            if (!instances.empty())
+                _shapeMeshes[s]->getInstanceBuffer()->update((const uint8_t*)instances.data(), instances.size() * sizeof(Drawer::Instance));
+        }
+}
 
 void DrawerPipeline::render(std::shared_ptr<Camera> camera) {
     _linePipeline->begin();
@@ -42,6 +87,21 @@ void DrawerPipeline::render(std::shared_ptr<Camera> camera) {
     }
     _linePipeline->end();
 
+    if (_instancePipeline) {
+        _instancePipeline->begin();
+        {
+            _instancePipeline->setMat4("uProjection", camera->getProj());
+            _instancePipeline->setMat4("uView", camera->getView());
+
+            for (size_t s = 0; s < Drawer::NUM_SHAPES; s++) {
+                size_t numInstances = Drawer::getInstances(Drawer::Shape(s)).size();
+                if (numInstances)
+                    _instancePipeline->renderMeshInstanced(_shapeMeshes[s], numInstances);
+            }
+        }
+        _instancePipeline->end();
+    }
+
     _pointPipeline->begin();
     {
         _pointPipeline->setMat4("uProjection", camera->getProj());
@@ -2,6 +2,7 @@
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #pragma once
 #include <atta/graphics/cameras/camera.h>
+#include <atta/graphics/drawer.h>
 #include <atta/graphics/pipeline.h>
 #include <atta/graphics/renderQueue.h>
 
@@ -11,7 +12,7 @@ class DrawerPipeline final {
   public:
     DrawerPipeline(std::shared_ptr<RenderPass> renderPass);
 
-    /// Update GPU line and point data
+    /// Update GPU line, point, and instance data
     void update();
 
     /**
@@ -24,6 +25,10 @@ class DrawerPipeline final {
   private:
     std::shared_ptr<Pipeline> _linePipeline;
     std::shared_ptr<Pipeline> _pointPipeline;
+
+    // Instanced drawing is only implemented for OpenGL, with other APIs the drawer expands the instances to lines
+    std::shared_ptr<Pipeline> _instancePipeline;                        ///< nullptr if instancing is not supported
+    std::array<std::shared_ptr<Mesh>, Drawer::NUM_SHAPES> _shapeMeshes; ///< Unit shape lines with the instance buffers
 };
 
 } // namespace atta::graphics
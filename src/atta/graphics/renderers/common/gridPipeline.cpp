@@ -70,7 +70,7 @@ void GridPipeline::update(std::shared_ptr<Camera> camera) {
     // Update mesh with grid
     uint8_t* data = (uint8_t*)_lines.data();
     size_t size = _lines.size() * sizeof(Line);
-    res::get<res::Mesh>(_gridMeshName)->updateVertices(std::vector<uint8_t>(data, data + size));
+    res::get<res::Mesh>(_gridMeshName)->updateVertices(data, size);
 }
 
 void GridPipeline::render(std::shared_ptr<Camera> camera) {
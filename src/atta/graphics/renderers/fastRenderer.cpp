@@ -101,8 +101,8 @@ void FastRenderer::render(std::shared_ptr<Camera> camera) {
                             _geometryPipeline->setVec3("uAlbedo", defaultMaterial.color);
                         }
 
-                        // Draw mesh
-                        _geometryPipeline->renderMesh(mesh->sid);
+                        // Draw mesh (LOD selected by projected size)
+                        _geometryPipeline->renderMesh(Manager::getInstance().getMeshLod(mesh->sid, model, *camera, _height));
                     }
                 }
             }
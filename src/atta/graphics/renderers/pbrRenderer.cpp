@@ -398,8 +398,8 @@ void PbrRenderer::geometryPass(std::shared_ptr<Camera> camera) {
                             _geometryPipeline->setFloat("material.ao", defaultMaterial.ao);
                         }
 
-                        // Draw mesh
-                        _geometryPipeline->renderMesh(mesh->sid);
+                        // Draw mesh (LOD selected by projected size)
+                        _geometryPipeline->renderMesh(Manager::getInstance().getMeshLod(mesh->sid, model, *camera, _height));
                     }
                 }
             }
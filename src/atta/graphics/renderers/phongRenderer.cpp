@@ -151,8 +151,8 @@ void PhongRenderer::render(std::shared_ptr<Camera> camera) {
                             _geometryPipeline->setFloat("uMaterial.ao", defaultMaterial.ao);
                         }
 
-                        // Draw mesh
-                        _geometryPipeline->renderMesh(mesh->sid);
+                        // Draw mesh (LOD selected by projected size)
+                        _geometryPipeline->renderMesh(Manager::getInstance().getMeshLod(mesh->sid, model, *camera, _height));
                     }
                 }
             }
@@ -19,6 +19,8 @@ class VertexBuffer {
         Usage usage = Usage::STATIC; ///< Vertex buffer usage
         uint32_t size = 0;           ///< Size in bytes
         uint8_t* data = nullptr;     ///< Vertex buffer data
+        uint32_t firstAttribute = 0; ///< Shader input location of the first layout element
+        bool perInstance = false;    ///< Attributes advance once per instance instead of once per vertex
     };
 
     VertexBuffer(const CreateInfo& info);
@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/allocators/frameAllocator.h>
+
+namespace atta::memory {
+
+FrameAllocator::FrameAllocator(uint64_t size) : Allocator(size), _current(0), _failed(0), _peak(0) {}
+
+FrameAllocator::FrameAllocator(uint8_t* memory, uint64_t size) : Allocator(memory, size), _current(0), _failed(0), _peak(0) {}
+
+void* FrameAllocator::allocBytes(size_t size, size_t align) {
+    bool aligned = align > 1 && (align & (align - 1)) == 0;
+    size_t current = _current.load(std::memory_order_relaxed);
+    size_t start, end;
+    do {
+        // Padding is computed from the absolute address because the memory may come from another allocator
+        start = current;
+        if (aligned) {
+            uintptr_t addr = reinterpret_cast<uintptr_t>(_memory) + current;
+            start += (align - addr % align) % align;
+        }
+        end = start + size;
+        if (end > _size) {
+            _failed.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    } while (!_current.compare_exchange_weak(current, end, std::memory_order_relaxed));
+
+    return reinterpret_cast<void*>(_memory + start);
+}
+
+void FrameAllocator::freeBytes(void* ptr, size_t size, size_t align) {
+    // Memory is only released on reset
+}
+
+void FrameAllocator::reset() {
+    _peak = std::max(_peak, _current.load(std::memory_order_relaxed));
+    _current.store(0, std::memory_order_relaxed);
+    _failed.store(0, std::memory_order_relaxed);
+}
+
+} // namespace atta::memory
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/memory/allocator.h>
+#include <atomic>
+
+namespace atta::memory {
+
+// Linear allocator for transient data that lives at most one simulation step
+//
+// Any thread can allocate concurrently (the offset is moved with atomic operations). Individual frees are
+// ignored, all the memory is released at once with reset(), which atta calls at the beginning of each step
+class FrameAllocator final : public Allocator {
+  public:
+    // Allocate heap memory
+    FrameAllocator(uint64_t size);
+    // Use already allocated memory
+    FrameAllocator(uint8_t* memory, uint64_t size);
+
+    // Simplified alloc
+    template <typename T>
+    T* alloc(size_t size = 1);
+
+    // Default alloc/free. If align is a power of two the returned pointer is aligned to it
+    void* allocBytes(size_t size, size_t align) override;
+    void freeBytes(void* ptr, size_t size, size_t align) override;
+
+    // Release all allocations (not thread-safe, no other thread should be allocating)
+    void reset();
+
+    size_t getUsedMemory() const { return _current.load(std::memory_order_relaxed); }
+    // Maximum memory used in one frame since creation
+    size_t getPeakMemory() const { return std::max(_peak, getUsedMemory()); }
+    // Number of allocations that did not fit since the last reset
+    size_t getFailedCount() const { return _failed.load(std::memory_order_relaxed); }
+
+  private:
+    std::atomic<size_t> _current;
+    std::atomic<size_t> _failed;
+    size_t _peak;
+};
+
+} // namespace atta::memory
+
+#include <atta/memory/allocators/frameAllocator.inl>
@@ -0,0 +1,10 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+namespace atta::memory {
+
+template <typename T>
+T* FrameAllocator::alloc(size_t size) {
+    return static_cast<T*>(allocBytes(size * sizeof(T), alignof(T)));
+}
+
+} // namespace atta::memory
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/allocators/lockFreePoolAllocator.h>
+
+namespace atta::memory {
+
+LockFreePoolAllocator::LockFreePoolAllocator(size_t blockCount, size_t minBlockSize)
+    : Allocator(std::max(sizeof(Node), minBlockSize) * blockCount), _blockSize(std::max(sizeof(Node), minBlockSize)), _blockCount(blockCount),
+      _head(INVALID_INDEX) {
+    DASSERT(_blockCount > 0, "Pool should have more than 0 blocks");
+    DASSERT(_blockCount < INVALID_INDEX, "Pool can have at most [w]$0[] blocks", INVALID_INDEX - 1);
+
+    // Create free list
+    clear();
+}
+
+LockFreePoolAllocator::LockFreePoolAllocator(uint8_t* memory, size_t blockCount, size_t minBlockSize)
+    : Allocator(memory, std::max(sizeof(Node), minBlockSize) * blockCount), _blockSize(std::max(sizeof(Node), minBlockSize)),
+      _blockCount(blockCount), _head(INVALID_INDEX) {
+    DASSERT(_blockCount > 0, "Pool should have more than 0 blocks");
+    DASSERT(_blockCount < INVALID_INDEX, "Pool can have at most [w]$0[] blocks", INVALID_INDEX - 1);
+
+    // Create free list
+    clear();
+}
+
+void* LockFreePoolAllocator::alloc() { return allocBytes(_blockSize, _blockSize); }
+
+void LockFreePoolAllocator::free(void* ptr) { freeBytes(ptr, _blockSize, _blockSize); }
+
+void LockFreePoolAllocator::clear() {
+    for (size_t i = 0; i < _blockCount; i++)
+        new (getNode(i)) Node{i + 1 < _blockCount ? uint32_t(i + 1) : INVALID_INDEX};
+    _head.store(makeHead(_head.load(std::memory_order_relaxed), 0), std::memory_order_release);
+}
+
+uint64_t LockFreePoolAllocator::getIndex(void* block) { return (reinterpret_cast<uint8_t*>(block) - _memory) / _blockSize; }
+
+void* LockFreePoolAllocator::getBlock(uint64_t index) { return reinterpret_cast<void*>(_memory + index * _blockSize); }
+
+void* LockFreePoolAllocator::allocBytes(size_t size, size_t align) {
+    DASSERT(size <= _blockSize, "AllocBytes with more than one block is not supported");
+
+    uint64_t head = _head.load(std::memory_order_acquire);
+    while (true) {
+        uint32_t index = headIndex(head);
+        // Check if there are blocks available
+        if (index == INVALID_INDEX)
+            return nullptr;
+
+        // If another thread pops this node first, next may be stale, but the tag makes the exchange fail
+        uint32_t next = getNode(index)->next.load(std::memory_order_relaxed);
+        if (_head.compare_exchange_weak(head, makeHead(head, next), std::memory_order_acq_rel, std::memory_order_acquire))
+            return reinterpret_cast<void*>(getNode(index));
+    }
+}
+
+void LockFreePoolAllocator::freeBytes(void* ptr, size_t size, size_t align) {
+    DASSERT(owns(ptr), "Trying to free pointer that is not owned by this pool");
+
+    uint32_t index = uint32_t(getIndex(ptr));
+    Node* node = getNode(index);
+    uint64_t head = _head.load(std::memory_order_relaxed);
+    do {
+        node->next.store(headIndex(head), std::memory_order_relaxed);
+    } while (!_head.compare_exchange_weak(head, makeHead(head, index), std::memory_order_release, std::memory_order_relaxed));
+}
+
+} // namespace atta::memory
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/memory/allocator.h>
+#include <atomic>
+
+namespace atta::memory {
+
+// Fixed-size block allocator that can be used by multiple threads without locks
+//
+// The free list is stored as block indices and its head is packed together with a tag
+// (| tag:32 | index:32 |) that is incremented at every update. This avoids the ABA problem when
+// a block is popped and pushed back by other threads between the load and the compare-exchange
+class LockFreePoolAllocator : public Allocator {
+  public:
+    // The block size can be greater than the specified because the same position is used to store the next free index
+    // Allocate heap memory
+    LockFreePoolAllocator(size_t countBlocks, size_t minBlockSize);
+    // Use already allocated memory
+    LockFreePoolAllocator(uint8_t* memory, size_t countBlocks, size_t minBlockSize);
+
+    // Simplified alloc/free
+    void* alloc();
+    void free(void* ptr);
+
+    void* allocBytes(size_t size, size_t align) override;
+    void freeBytes(void* ptr, size_t size, size_t align) override;
+
+    void clear(); // Not thread-safe, no other thread should be using the pool
+    uint64_t getIndex(void* block);
+    void* getBlock(uint64_t index); // Return the block even if it is free, this can broke the pool allocator
+
+    size_t getBlockSize() const { return _blockSize; }
+    size_t getBlockCount() const { return _blockCount; }
+
+  private:
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+    struct Node {
+        std::atomic<uint32_t> next;
+    };
+
+    Node* getNode(uint32_t index) { return reinterpret_cast<Node*>(_memory + size_t(index) * _blockSize); }
+    static uint32_t headIndex(uint64_t head) { return uint32_t(head & 0xFFFFFFFF); }
+    static uint64_t makeHead(uint64_t oldHead, uint32_t index) { return (((oldHead >> 32) + 1) << 32) | index; }
+
+    size_t _blockSize;
+    size_t _blockCount;
+    std::atomic<uint64_t> _head;
+};
+
+} // namespace atta::memory
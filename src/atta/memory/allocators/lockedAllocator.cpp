@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/allocators/lockedAllocator.h>
+
+namespace atta::memory {
+
+LockedAllocator::LockedAllocator(Allocator* allocator)
+    : Allocator(const_cast<uint8_t*>(allocator->getMemory()), allocator->getSize()), _allocator(allocator) {}
+
+void* LockedAllocator::allocBytes(size_t size, size_t align) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _allocator->allocBytes(size, align);
+}
+
+void LockedAllocator::freeBytes(void* ptr, size_t size, size_t align) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _allocator->freeBytes(ptr, size, align);
+}
+
+} // namespace atta::memory
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/memory/allocator.h>
+#include <mutex>
+
+namespace atta::memory {
+
+// Makes a single-threaded allocator safe to be shared by multiple threads by serializing alloc/free with a mutex
+// The wrapped allocator is not owned and must outlive the LockedAllocator
+class LockedAllocator final : public Allocator {
+  public:
+    LockedAllocator(Allocator* allocator);
+
+    void* allocBytes(size_t size, size_t align) override;
+    void freeBytes(void* ptr, size_t size, size_t align) override;
+
+    Allocator* getAllocator() { return _allocator; }
+
+  private:
+    Allocator* _allocator;
+    std::mutex _mutex;
+};
+
+} // namespace atta::memory
@@ -25,6 +25,9 @@ class PoolAllocator : public Allocator {
     uint64_t getIndex(void* block);
     void* getBlock(uint64_t index); // Return the block even if it is free, this can broke the pool allocator
 
+    size_t getBlockSize() const { return _blockSize; }
+    size_t getBlockCount() const { return _blockCount; }
+
   private:
     struct Node {
         Node* next;
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/allocators/threadCachedPoolAllocator.h>
+
+namespace atta::memory {
+
+namespace {
+// Allocators and thread indices shared by all ThreadCachedPoolAllocators, never destroyed because threads may exit after
+// the static objects were destroyed
+struct Registry {
+    std::mutex mutex;
+    std::vector<ThreadCachedPoolAllocator*> allocators;
+    std::vector<bool> usedIndices;
+};
+Registry& getRegistry() {
+    static Registry* registry = new Registry();
+    return *registry;
+}
+} // namespace
+
+// Index of a thread, released when the thread exits
+struct ThreadCachedPoolAllocator::ThreadIndex {
+    size_t index;
+
+    ThreadIndex() {
+        Registry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        std::vector<bool>& used = registry.usedIndices;
+        index = std::find(used.begin(), used.end(), false) - used.begin();
+        if (index == used.size())
+            used.push_back(true);
+        else
+            used[index] = true;
+    }
+
+    ~ThreadIndex() {
+        Registry& registry = getRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        for (ThreadCachedPoolAllocator* allocator : registry.allocators)
+            allocator->flushCache(index);
+        registry.usedIndices[index] = false;
+    }
+};
+
+ThreadCachedPoolAllocator::ThreadCachedPoolAllocator(size_t blockCount, size_t minBlockSize, size_t blockAlign)
+    : PoolAllocator(blockCount, minBlockSize, blockAlign) {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.allocators.push_back(this);
+}
+
+ThreadCachedPoolAllocator::ThreadCachedPoolAllocator(uint8_t* memory, size_t blockCount, size_t minBlockSize, size_t blockAlign)
+    : PoolAllocator(memory, blockCount, minBlockSize, blockAlign) {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.allocators.push_back(this);
+}
+
+ThreadCachedPoolAllocator::~ThreadCachedPoolAllocator() {
+    Registry& registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.allocators.erase(std::find(registry.allocators.begin(), registry.allocators.end(), this));
+}
+
+size_t ThreadCachedPoolAllocator::getThreadIndex() {
+    thread_local ThreadIndex threadIndex;
+    return threadIndex.index;
+}
+
+void* ThreadCachedPoolAllocator::allocBytes(size_t size, size_t align) {
+    DASSERT(size == getBlockSize(), "AllocBytes with more than one block is not supported yet");
+
+    size_t threadIndex = getThreadIndex();
+    if (threadIndex >= MAX_THREADS) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return PoolAllocator::allocBytes(size, align);
+    }
+
+    Cache& cache = _caches[threadIndex];
+    if (cache.count == 0) {
+        // Refill half of the cache with blocks from the shared pool
+        std::lock_guard<std::mutex> lock(_mutex);
+        while (cache.count < CACHE_SIZE / 2) {
+            void* block = PoolAllocator::allocBytes(size, align);
+            if (block == nullptr)
+                break;
+            cache.blocks[cache.count++] = block;
+        }
+        if (cache.count == 0)
+            return nullptr;
+    }
+    return cache.blocks[--cache.count];
+}
+
+void ThreadCachedPoolAllocator::freeBytes(void* ptr, size_t size, size_t align) {
+    DASSERT(size == getBlockSize(), "FreeBytes with more than one block is not supported yet");
+
+    size_t threadIndex = getThreadIndex();
+    if (threadIndex >= MAX_THREADS) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        PoolAllocator::freeBytes(ptr, size, align);
+        return;
+    }
+
+    Cache& cache = _caches[threadIndex];
+    if (cache.count == CACHE_SIZE) {
+        // Return half of the cache to the shared pool
+        std::lock_guard<std::mutex> lock(_mutex);
+        while (cache.count > CACHE_SIZE / 2)
+            PoolAllocator::freeBytes(cache.blocks[--cache.count], size, align);
+    }
+    cache.blocks[cache.count++] = ptr;
+}
+
+void ThreadCachedPoolAllocator::flushThreadCache() { flushCache(getThreadIndex()); }
+
+void ThreadCachedPoolAllocator::flushCache(size_t threadIndex) {
+    if (threadIndex >= MAX_THREADS)
+        return;
+
+    Cache& cache = _caches[threadIndex];
+    std::lock_guard<std::mutex> lock(_mutex);
+    while (cache.count > 0)
+        PoolAllocator::freeBytes(cache.blocks[--cache.count], getBlockSize(), getBlockSize());
+}
+
+void ThreadCachedPoolAllocator::clear() {
+    for (Cache& cache : _caches)
+        cache.count = 0;
+    PoolAllocator::clear();
+}
+
+} // namespace atta::memory
@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/memory/allocators/poolAllocator.h>
+#include <mutex>
+
+namespace atta::memory {
+
+// Pool allocator that can be shared by multiple threads
+//
+// Each thread has a small cache of free blocks in front of the pool. Blocks are allocated/freed from the
+// thread cache without synchronization, and only when the cache is empty/full a batch of blocks is moved
+// from/to the shared pool while holding the lock
+//
+// Threads are identified by a global index, the threads with index lower than MAX_THREADS get a cache, the other
+// threads always use the locked path. When a thread exits, its caches are returned to the pools and the index is
+// reused by the next thread
+class ThreadCachedPoolAllocator final : public PoolAllocator {
+  public:
+    static constexpr size_t MAX_THREADS = 64;
+    static constexpr size_t CACHE_SIZE = 64;
+
+    // If blockAlign is set to zero, no alignment
+    // Allocate heap memory
+    ThreadCachedPoolAllocator(size_t countBlocks, size_t minBlockSize, size_t blockAlign = 0);
+    // Use already allocated memory
+    ThreadCachedPoolAllocator(uint8_t* memory, size_t countBlocks, size_t minBlockSize, size_t blockAlign = 0);
+    ~ThreadCachedPoolAllocator();
+
+    void* allocBytes(size_t size, size_t align) override;
+    void freeBytes(void* ptr, size_t size, size_t align) override;
+
+    // Return the blocks cached by the calling thread to the pool. The cache is also flushed when the thread exits
+    void flushThreadCache();
+
+    void clear(); // Not thread-safe, no other thread should be using the pool
+
+  private:
+    struct alignas(64) Cache {
+        void* blocks[CACHE_SIZE];
+        size_t count = 0;
+    };
+
+    struct ThreadIndex;
+
+    // Index of the calling thread, unique among the running threads
+    static size_t getThreadIndex();
+    // Return the blocks in the cache of the thread index to the pool
+    void flushCache(size_t threadIndex);
+
+    std::array<Cache, MAX_THREADS> _caches;
+    std::mutex _mutex;
+};
+
+} // namespace atta::memory
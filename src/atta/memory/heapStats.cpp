@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/heapStats.h>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace atta::memory {
+
+namespace {
+// Each thread counts in its own slot, so the allocations of different threads do not contend for the same cache line.
+// The slots are never cleared, a thread that exits releases its slot to the next thread and the sum stays monotonic
+struct alignas(64) Counters {
+    std::atomic<bool> used{false};
+    std::atomic<uint64_t> numAllocs{0};
+    std::atomic<uint64_t> numFrees{0};
+    std::atomic<uint64_t> numBytes{0};
+};
+constexpr size_t MAX_THREADS = 256;
+Counters threadCounters[MAX_THREADS];
+Counters sharedCounters; // Threads without a slot, or after their slot was released
+
+HeapStats stepBegin{};
+HeapStats stepStats{};
+
+#ifdef ATTA_HEAP_STATS
+thread_local Counters* counters = nullptr;
+
+// Releases the slot when the thread exits
+struct SlotGuard {
+    ~SlotGuard() {
+        Counters* slot = counters;
+        counters = &sharedCounters;
+        slot->used.store(false, std::memory_order_release);
+    }
+};
+
+Counters* getCounters() {
+    if (counters)
+        return counters;
+    counters = &sharedCounters;
+    for (Counters& slot : threadCounters)
+        if (!slot.used.load(std::memory_order_relaxed) && !slot.used.exchange(true, std::memory_order_acquire)) {
+            // Allocations made while the guard is registered are counted in the shared counters
+            thread_local SlotGuard guard;
+            (void)guard;
+            counters = &slot;
+            break;
+        }
+    return counters;
+}
+#endif
+} // namespace
+
+HeapStats getHeapStats() {
+    HeapStats stats;
+    auto add = [&stats](const Counters& c) {
+        stats.numAllocs += c.numAllocs.load(std::memory_order_relaxed);
+        stats.numFrees += c.numFrees.load(std::memory_order_relaxed);
+        stats.numBytes += c.numBytes.load(std::memory_order_relaxed);
+    };
+    add(sharedCounters);
+    for (const Counters& slot : threadCounters)
+        add(slot);
+    return stats;
+}
+
+HeapStats getStepHeapStats() { return stepStats; }
+
+void beginStepHeapStats() { stepBegin = getHeapStats(); }
+
+void endStepHeapStats() {
+    HeapStats stepEnd = getHeapStats();
+    stepStats.numAllocs = stepEnd.numAllocs - stepBegin.numAllocs;
+    stepStats.numFrees = stepEnd.numFrees - stepBegin.numFrees;
+    stepStats.numBytes = stepEnd.numBytes - stepBegin.numBytes;
+}
+
+} // namespace atta::memory
+
+#ifdef ATTA_HEAP_STATS
+// The other global new/delete overloads (array, nothrow, sized) forward to these two by default
+void* operator new(std::size_t size) {
+    atta::memory::Counters* c = atta::memory::getCounters();
+    c->numAllocs.fetch_add(1, std::memory_order_relaxed);
+    c->numBytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size))
+        return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    if (ptr == nullptr)
+        return;
+    atta::memory::getCounters()->numFrees.fetch_add(1, std::memory_order_relaxed);
+    std::free(ptr);
+}
+#endif
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+namespace atta::memory {
+
+// Global heap usage (operator new/delete)
+// Only counted when atta is built with ATTA_HEAP_STATS (replaces the global operator new/delete), otherwise all values are zero
+struct HeapStats {
+    uint64_t numAllocs = 0; ///< Number of allocations
+    uint64_t numFrees = 0;  ///< Number of frees
+    uint64_t numBytes = 0;  ///< Number of allocated bytes
+};
+
+// Heap usage since the program started
+HeapStats getHeapStats();
+
+// Heap usage of the last simulation step
+HeapStats getStepHeapStats();
+
+// Called by Atta::step to delimit the simulation step
+void beginStepHeapStats();
+void endStepHeapStats();
+
+} // namespace atta::memory
@@ -3,6 +3,8 @@
 #pragma once
 
 #include <atta/memory/allocator.h>
+#include <atta/memory/heapStats.h>
+#include <atta/memory/scratch.h>
 #include <atta/utils/stringId.h>
 
 namespace atta::memory {
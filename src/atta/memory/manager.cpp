@@ -11,6 +11,7 @@ Manager& Manager::getInstance() {
 }
 
 Allocator* Manager::getAllocatorImpl(StringHash hash) {
+    std::lock_guard<std::mutex> lock(_mutex);
     auto allocator = _allocators.find(hash);
     if (allocator == _allocators.end()) {
         ASSERT(false, "Trying to use allocator that was never registered [w]$0[]", hash);
@@ -20,6 +21,7 @@ Allocator* Manager::getAllocatorImpl(StringHash hash) {
 }
 
 Allocator** Manager::getAllocatorPtrImpl(StringHash hash) {
+    std::lock_guard<std::mutex> lock(_mutex);
     auto allocator = _allocators.find(hash);
     if (allocator == _allocators.end()) {
         ASSERT(false, "Trying to use allocator that was never registered");
@@ -30,6 +32,7 @@ Allocator** Manager::getAllocatorPtrImpl(StringHash hash) {
 
 void Manager::registerAllocatorImpl(StringHash hash, Allocator* alloc) {
     // Just replaces the pointer, does not delete the allocator
+    std::lock_guard<std::mutex> lock(_mutex);
     _allocators[hash] = alloc;
 }
 
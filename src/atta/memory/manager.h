@@ -1,6 +1,7 @@
 // SPDX-License-Identifier: MIT
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #pragma once
+#include <mutex>
 
 namespace atta::memory {
 
@@ -20,6 +21,7 @@ class Manager final {
     void registerAllocatorImpl(StringHash hash, Allocator* alloc);
 
     std::unordered_map<StringHash, Allocator*> _allocators;
+    std::mutex _mutex; // Allocators can be registered/queried from worker threads
 };
 
 } // namespace atta::memory
@@ -0,0 +1,247 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/memorySnapshot.h>
+#include <atomic>
+#include <mutex>
+
+#ifdef ATTA_OS_LINUX
+#include <signal.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace atta::memory {
+
+#ifdef ATTA_OS_LINUX
+// Write protected pages of a captured region, the table is read by the signal handler without locks
+struct MemorySnapshot::Tracker {
+    static constexpr size_t MAX_TRACKERS = 256;
+    static std::atomic<Tracker*> table[MAX_TRACKERS];
+    static std::mutex mutex; // Serializes the table changes
+    static struct sigaction previousAction;
+
+    uintptr_t memory; // Captured memory
+    size_t size;
+    uintptr_t begin; // First page
+    uintptr_t end;   // End of the last page
+    size_t pageSize;
+    // Written by the handler, mapped separately because a fault inside the handler would terminate the process
+    std::atomic<uint32_t>* numDirty = nullptr;
+    uint32_t* dirtyList = nullptr;          // Dirty pages in the order they were written
+    std::atomic<uint8_t>* dirty = nullptr; // Dirty flag of each page
+    size_t mappedSize = 0;
+
+    ~Tracker() {
+        if (mappedSize)
+            munmap(numDirty, mappedSize);
+    }
+    size_t getNumPages() const { return (end - begin) / pageSize; }
+    bool contains(uintptr_t address) const { return address >= begin && address < end; }
+    uintptr_t getPage(size_t page) const { return begin + page * pageSize; }
+    bool isDirty(uintptr_t address) const { return dirty[(address - begin) / pageSize].load(std::memory_order_relaxed); }
+
+    /// Protect the pages and add to the table, nullptr if the writes can not be tracked
+    static std::unique_ptr<Tracker> create(const uint8_t* memory, size_t size);
+    /// Remove from the table and unprotect the pages that no other tracker keeps protected
+    static void destroy(std::unique_ptr<Tracker> tracker);
+    static void protect(uintptr_t begin, uintptr_t end, bool writable);
+    static void onWriteFault(int signal, siginfo_t* info, void* context);
+};
+
+std::atomic<MemorySnapshot::Tracker*> MemorySnapshot::Tracker::table[MAX_TRACKERS];
+std::mutex MemorySnapshot::Tracker::mutex;
+struct sigaction MemorySnapshot::Tracker::previousAction;
+
+std::unique_ptr<MemorySnapshot::Tracker> MemorySnapshot::Tracker::create(const uint8_t* memory, size_t size) {
+    if (memory == nullptr || size == 0)
+        return nullptr;
+    std::lock_guard<std::mutex> lock(mutex);
+    static bool installed = [] {
+        struct sigaction action {};
+        action.sa_sigaction = onWriteFault;
+        action.sa_flags = SA_SIGINFO;
+        sigemptyset(&action.sa_mask);
+        return sigaction(SIGSEGV, &action, &previousAction) == 0;
+    }();
+    if (!installed)
+        return nullptr;
+
+    auto tracker = std::make_unique<Tracker>();
+    tracker->pageSize = sysconf(_SC_PAGESIZE);
+    tracker->memory = uintptr_t(memory);
+    tracker->size = size;
+    tracker->begin = tracker->memory & ~(tracker->pageSize - 1);
+    tracker->end = (tracker->memory + size + tracker->pageSize - 1) & ~(tracker->pageSize - 1);
+    size_t numPages = tracker->getNumPages();
+    size_t mappedSize = sizeof(uint32_t) * (numPages + 1) + numPages;
+    void* mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapped == MAP_FAILED)
+        return nullptr;
+    tracker->mappedSize = mappedSize;
+    tracker->numDirty = static_cast<std::atomic<uint32_t>*>(mapped);
+    tracker->dirtyList = reinterpret_cast<uint32_t*>(tracker->numDirty + 1);
+    tracker->dirty = reinterpret_cast<std::atomic<uint8_t>*>(tracker->dirtyList + numPages);
+
+    for (std::atomic<Tracker*>& slot : table)
+        if (slot.load(std::memory_order_relaxed) == nullptr) {
+            // Added before protecting, so the handler finds it
+            slot.store(tracker.get(), std::memory_order_release);
+            if (mprotect(reinterpret_cast<void*>(tracker->begin), tracker->end - tracker->begin, PROT_READ) == 0)
+                return tracker;
+            slot.store(nullptr, std::memory_order_release);
+            return nullptr;
+        }
+    return nullptr;
+}
+
+void MemorySnapshot::Tracker::destroy(std::unique_ptr<Tracker> tracker) {
+    std::lock_guard<std::mutex> lock(mutex);
+    for (std::atomic<Tracker*>& slot : table)
+        if (slot.load(std::memory_order_relaxed) == tracker.get())
+            slot.store(nullptr, std::memory_order_release);
+
+    // Pages that are clean in another tracker of the same memory must stay protected
+    uintptr_t runBegin = tracker->begin;
+    for (size_t p = 0; p <= tracker->getNumPages(); p++) {
+        bool keep = false;
+        uintptr_t page = tracker->getPage(p);
+        if (p < tracker->getNumPages())
+            for (std::atomic<Tracker*>& slot : table) {
+                Tracker* other = slot.load(std::memory_order_relaxed);
+                if (other && other->contains(page) && !other->isDirty(page))
+                    keep = true;
+            }
+        if (keep || p == tracker->getNumPages()) {
+            if (runBegin < page)
+                protect(runBegin, page, true);
+            runBegin = page + tracker->pageSize;
+        }
+    }
+}
+
+void MemorySnapshot::Tracker::protect(uintptr_t begin, uintptr_t end, bool writable) {
+    mprotect(reinterpret_cast<void*>(begin), end - begin, writable ? PROT_READ | PROT_WRITE : PROT_READ);
+}
+
+void MemorySnapshot::Tracker::onWriteFault(int signal, siginfo_t* info, void* context) {
+    uintptr_t address = uintptr_t(info->si_addr);
+    size_t pageSize = 0;
+    for (std::atomic<Tracker*>& slot : table) {
+        Tracker* tracker = slot.load(std::memory_order_acquire);
+        if (tracker && tracker->contains(address)) {
+            uint32_t page = (address - tracker->begin) / tracker->pageSize;
+            if (tracker->dirty[page].exchange(1, std::memory_order_relaxed) == 0)
+                tracker->dirtyList[tracker->numDirty->fetch_add(1, std::memory_order_relaxed)] = page;
+            pageSize = tracker->pageSize;
+        }
+    }
+    if (pageSize != 0) {
+        // The write is executed again when the handler returns
+        uintptr_t page = address & ~(pageSize - 1);
+        mprotect(reinterpret_cast<void*>(page), pageSize, PROT_READ | PROT_WRITE);
+        return;
+    }
+
+    // Not a tracked page, forward to the previous handler or fault again with the default action
+    if (previousAction.sa_flags & SA_SIGINFO)
+        previousAction.sa_sigaction(signal, info, context);
+    else if (previousAction.sa_handler != SIG_DFL && previousAction.sa_handler != SIG_IGN)
+        previousAction.sa_handler(signal);
+    else
+        ::signal(SIGSEGV, SIG_DFL);
+}
+#else
+struct MemorySnapshot::Tracker {
+    uintptr_t memory;
+    size_t size;
+    uintptr_t begin;
+    size_t pageSize;
+    std::atomic<uint32_t>* numDirty;
+    uint32_t* dirtyList;
+    std::atomic<uint8_t>* dirty;
+
+    uintptr_t getPage(size_t page) const { return begin + page * pageSize; }
+    static std::unique_ptr<Tracker> create(const uint8_t* memory, size_t size) { return nullptr; }
+    static void destroy(std::unique_ptr<Tracker> tracker) {}
+    static void protect(uintptr_t begin, uintptr_t end, bool writable) {}
+};
+#endif
+
+MemorySnapshot::MemorySnapshot() = default;
+
+MemorySnapshot::MemorySnapshot(const uint8_t* memory, size_t size) { capture(memory, size); }
+
+MemorySnapshot::~MemorySnapshot() { release(); }
+
+MemorySnapshot::MemorySnapshot(MemorySnapshot&& other) noexcept = default;
+
+MemorySnapshot& MemorySnapshot::operator=(MemorySnapshot&& other) noexcept {
+    if (this != &other) {
+        release();
+        _data = std::move(other._data);
+        _tracker = std::move(other._tracker);
+    }
+    return *this;
+}
+
+void MemorySnapshot::capture(const uint8_t* memory, size_t size) {
+    release();
+    _data.assign(memory, memory + size);
+    _tracker = Tracker::create(memory, size);
+}
+
+void MemorySnapshot::release() {
+    if (_tracker)
+        Tracker::destroy(std::move(_tracker));
+}
+
+size_t MemorySnapshot::restore(uint8_t* memory) {
+    size_t numCopied = 0;
+    if (_tracker && uintptr_t(memory) == _tracker->memory) {
+        // Copy the dirty pages and protect them again
+        uint32_t numDirty = _tracker->numDirty->load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < numDirty; i++) {
+            uint32_t p = _tracker->dirtyList[i];
+            uintptr_t page = _tracker->getPage(p);
+            uintptr_t first = std::max(page, _tracker->memory);
+            uintptr_t last = std::min(page + _tracker->pageSize, _tracker->memory + _tracker->size);
+            std::memcpy(reinterpret_cast<void*>(first), _data.data() + (first - _tracker->memory), last - first);
+            _tracker->dirty[p].store(0, std::memory_order_relaxed);
+            Tracker::protect(page, page + _tracker->pageSize, false);
+        }
+        _tracker->numDirty->store(0, std::memory_order_relaxed);
+        return numDirty;
+    }
+
+    for (size_t offset = 0; offset < _data.size(); offset += PAGE_SIZE) {
+        size_t size = std::min(PAGE_SIZE, _data.size() - offset);
+        if (std::memcmp(memory + offset, _data.data() + offset, size) != 0) {
+            std::memcpy(memory + offset, _data.data() + offset, size);
+            numCopied++;
+        }
+    }
+    return numCopied;
+}
+
+size_t MemorySnapshot::getNumDirtyPages(const uint8_t* memory) const {
+    size_t numDirty = 0;
+    if (_tracker && uintptr_t(memory) == _tracker->memory) {
+        // Only the written pages can differ
+        uint32_t numWritten = _tracker->numDirty->load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < numWritten; i++) {
+            uintptr_t page = _tracker->getPage(_tracker->dirtyList[i]);
+            uintptr_t first = std::max(page, _tracker->memory);
+            uintptr_t last = std::min(page + _tracker->pageSize, _tracker->memory + _tracker->size);
+            if (std::memcmp(reinterpret_cast<const void*>(first), _data.data() + (first - _tracker->memory), last - first) != 0)
+                numDirty++;
+        }
+        return numDirty;
+    }
+
+    for (size_t offset = 0; offset < _data.size(); offset += PAGE_SIZE)
+        if (std::memcmp(memory + offset, _data.data() + offset, std::min(PAGE_SIZE, _data.size() - offset)) != 0)
+            numDirty++;
+    return numDirty;
+}
+
+} // namespace atta::memory
@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+namespace atta::memory {
+
+// Copy of a memory region that can be restored later
+//
+// After the capture, the pages of the region are write protected. The first write to a page marks it dirty (SIGSEGV
+// handler) and makes it writable again, so restoring only copies the dirty pages back and costs O(pages written), not
+// O(region size). While tracked, the memory should only be written by user code (system calls that write to a protected
+// page fail with EFAULT) and must not be written while it is restored. If writes can not be tracked (not Linux, or too
+// many tracked regions), the pages are compared with the snapshot instead
+class MemorySnapshot {
+  public:
+    static constexpr size_t PAGE_SIZE = 4096; // Page size used to compare when the writes are not tracked
+
+    MemorySnapshot();
+    MemorySnapshot(const uint8_t* memory, size_t size);
+    ~MemorySnapshot();
+    MemorySnapshot(MemorySnapshot&& other) noexcept;
+    MemorySnapshot& operator=(MemorySnapshot&& other) noexcept;
+    MemorySnapshot(const MemorySnapshot&) = delete;
+    MemorySnapshot& operator=(const MemorySnapshot&) = delete;
+
+    // Save current memory content and start tracking the writes to it
+    void capture(const uint8_t* memory, size_t size);
+    // Restore memory content, return number of pages that were copied
+    size_t restore(uint8_t* memory);
+    // Number of pages that changed since the snapshot
+    size_t getNumDirtyPages(const uint8_t* memory) const;
+    // If the writes to the captured memory are tracked
+    bool isTracked() const { return _tracker != nullptr; }
+
+    size_t getSize() const { return _data.size(); }
+    size_t getNumPages() const { return (_data.size() + PAGE_SIZE - 1) / PAGE_SIZE; }
+    const uint8_t* getData() const { return _data.data(); }
+
+  private:
+    struct Tracker;
+    void release(); // Stop tracking the writes
+
+    std::vector<uint8_t> _data;
+    std::unique_ptr<Tracker> _tracker; // Dirty pages of the captured memory, nullptr if the writes are not tracked
+};
+
+} // namespace atta::memory
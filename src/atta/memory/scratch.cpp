@@ -0,0 +1,16 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/scratch.h>
+
+namespace atta::memory {
+
+Scratch::Scratch() : _allocator(getAllocator()), _marker(_allocator.getMarker()) {}
+
+Scratch::~Scratch() { _allocator.rollback(_marker); }
+
+StackAllocator& Scratch::getAllocator() {
+    thread_local StackAllocator allocator(SIZE);
+    return allocator;
+}
+
+} // namespace atta::memory
@@ -0,0 +1,41 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/memory/allocators/stackAllocator.h>
+#include <atta/utils/span.h>
+
+namespace atta::memory {
+
+// Scratch memory for transient allocations inside hot loops
+//
+// Each thread has its own scratch StackAllocator. A Scratch saves the stack marker when created and rolls the stack
+// back when destroyed, so everything allocated through it is released at the end of the scope. Scratches must be
+// destroyed in the reverse order of creation, which is always the case when they are local variables
+//
+// Example:
+//     memory::Scratch scratch;
+//     Span<cmp::EntityId> entities = cmp::getNoPrototypeView(scratch);
+class Scratch {
+  public:
+    static constexpr size_t SIZE = 4 * 1024 * 1024; // Scratch memory of each thread (4MB)
+
+    Scratch();
+    ~Scratch();
+    Scratch(const Scratch&) = delete;
+    Scratch& operator=(const Scratch&) = delete;
+
+    // Allocate uninitialized memory, empty span if the scratch memory is full
+    template <typename T>
+    Span<T> alloc(size_t count);
+
+    // Allocator of the calling thread
+    static StackAllocator& getAllocator();
+
+  private:
+    StackAllocator& _allocator;
+    StackAllocator::Marker _marker;
+};
+
+} // namespace atta::memory
+
+#include <atta/memory/scratch.inl>
@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+namespace atta::memory {
+
+template <typename T>
+Span<T> Scratch::alloc(size_t count) {
+    static_assert(std::is_trivially_destructible_v<T>, "Scratch memory is released without calling destructors");
+
+    // Keep the scratch stack aligned to T
+    StackAllocator::Marker marker = _allocator.getMarker();
+    size_t padding = (alignof(T) - (reinterpret_cast<uintptr_t>(_allocator.getMemory()) + marker) % alignof(T)) % alignof(T);
+    if (padding > 0 && _allocator.allocBytes(padding, 1) == nullptr)
+        return {};
+
+    T* data = _allocator.alloc<T>(count);
+    if (data == nullptr) {
+        _allocator.rollback(marker);
+        LOG_WARN("memory::Scratch", "Scratch memory is full, could not allocate [w]$0[] bytes", count * sizeof(T));
+        return {};
+    }
+    return Span<T>(data, count);
+}
+
+} // namespace atta::memory
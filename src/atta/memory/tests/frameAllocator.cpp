@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/allocators/frameAllocator.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace atta;
+using namespace atta::memory;
+
+namespace {
+TEST(Memory_FrameAllocator, Allocate) {
+    FrameAllocator frame(1024);
+    int* i0 = frame.alloc<int>();
+    int* i1 = frame.alloc<int>(10);
+    *i0 = 10;
+    i1[9] = 20;
+
+    EXPECT_EQ(*i0, 10);
+    EXPECT_EQ(i1[9], 20);
+    EXPECT_EQ(frame.getUsedMemory(), 11 * sizeof(int));
+
+    // Should not be possible to alloc more than the frame supports
+    EXPECT_EQ(frame.alloc<uint8_t>(1024), nullptr);
+    EXPECT_EQ(frame.getFailedCount(), 1);
+}
+
+TEST(Memory_FrameAllocator, Alignment) {
+    FrameAllocator frame(1024);
+    frame.alloc<char>();
+    double* d = frame.alloc<double>();
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(d) % alignof(double), 0);
+
+    frame.alloc<char>();
+    void* v = frame.allocBytes(16, 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(v) % 64, 0);
+}
+
+TEST(Memory_FrameAllocator, Reset) {
+    FrameAllocator frame(1024);
+    int* i0 = frame.alloc<int>(100);
+    frame.freeBytes(i0, 100 * sizeof(int), sizeof(int));
+    EXPECT_EQ(frame.getUsedMemory(), 100 * sizeof(int)); // Free is ignored
+
+    frame.reset();
+    EXPECT_EQ(frame.getUsedMemory(), 0);
+    EXPECT_EQ(frame.getPeakMemory(), 100 * sizeof(int));
+    EXPECT_EQ(frame.alloc<int>(), i0);
+}
+
+TEST(Memory_FrameAllocator, Concurrent) {
+    constexpr int numThreads = 4;
+    constexpr int numAllocs = 1000;
+    FrameAllocator frame(numThreads * numAllocs * sizeof(uint64_t));
+
+    std::vector<std::thread> threads;
+    std::vector<std::vector<uint64_t*>> ptrs(numThreads);
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < numAllocs; i++) {
+                uint64_t* ptr = frame.alloc<uint64_t>();
+                *ptr = t;
+                ptrs[t].push_back(ptr);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+
+    // Allocations should not overlap
+    for (int t = 0; t < numThreads; t++)
+        for (uint64_t* ptr : ptrs[t])
+            EXPECT_EQ(*ptr, uint64_t(t));
+    EXPECT_EQ(frame.getUsedMemory(), numThreads * numAllocs * sizeof(uint64_t));
+    EXPECT_EQ(frame.alloc<uint64_t>(), nullptr);
+}
+} // namespace
@@ -0,0 +1,38 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/heapStats.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace atta;
+using namespace atta::memory;
+
+namespace {
+TEST(Memory_HeapStats, Threads) {
+#ifndef ATTA_HEAP_STATS
+    GTEST_SKIP() << "Heap stats are only counted with ATTA_HEAP_STATS";
+#endif
+    constexpr int NUM_THREADS = 8;
+    constexpr int NUM_ALLOCS = 1000;
+    HeapStats before = getHeapStats();
+
+    // Threads count in their own slots, the allocations of the threads that exited are still counted
+    for (int round = 0; round < 2; round++) {
+        std::vector<std::thread> threads;
+        for (int t = 0; t < NUM_THREADS; t++)
+            threads.emplace_back([] {
+                for (int i = 0; i < NUM_ALLOCS; i++) {
+                    int* volatile value = new int(i); // Volatile so the allocation is not elided
+                    delete value;
+                }
+            });
+        for (std::thread& thread : threads)
+            thread.join();
+    }
+
+    HeapStats after = getHeapStats();
+    EXPECT_GE(after.numAllocs - before.numAllocs, uint64_t(2 * NUM_THREADS * NUM_ALLOCS));
+    EXPECT_GE(after.numFrees - before.numFrees, uint64_t(2 * NUM_THREADS * NUM_ALLOCS));
+    EXPECT_GE(after.numBytes - before.numBytes, uint64_t(2 * NUM_THREADS * NUM_ALLOCS * sizeof(int)));
+}
+} // namespace
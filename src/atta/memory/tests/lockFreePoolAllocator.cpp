@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/allocators/lockFreePoolAllocator.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace atta;
+using namespace atta::memory;
+
+namespace {
+TEST(Memory_LockFreePoolAllocator, Constructors) {
+    // No external memory
+    {
+        LockFreePoolAllocator pool(2, sizeof(int));
+        int* i0 = static_cast<int*>(pool.alloc());
+        int* i1 = static_cast<int*>(pool.alloc());
+        int* i2 = static_cast<int*>(pool.alloc());
+
+        EXPECT_NE(i0, nullptr);
+        EXPECT_NE(i1, nullptr);
+        EXPECT_EQ(i2, nullptr);
+        if (i0 == nullptr || i1 == nullptr)
+            GTEST_SKIP();
+
+        *i0 = 10;
+        *i1 = 20;
+
+        EXPECT_EQ(*i0, 10);
+        EXPECT_EQ(*i1, 20);
+    }
+
+    // External memory
+    {
+        uint8_t* mem = static_cast<uint8_t*>(malloc(10 * sizeof(int)));
+        LockFreePoolAllocator pool(mem, 2, sizeof(int));
+        int* i0 = static_cast<int*>(pool.alloc());
+        int* i1 = static_cast<int*>(pool.alloc());
+        int* i2 = static_cast<int*>(pool.alloc());
+
+        EXPECT_NE(i0, nullptr);
+        EXPECT_NE(i1, nullptr);
+        EXPECT_EQ(i2, nullptr);
+        free(mem);
+    }
+}
+
+TEST(Memory_LockFreePoolAllocator, PoolReuse) {
+    LockFreePoolAllocator pool(2, sizeof(int));
+    int* i0 = static_cast<int*>(pool.alloc());
+    int* i1 = static_cast<int*>(pool.alloc());
+    EXPECT_NE(i1, nullptr);
+
+    pool.free(i0);
+    int* i2 = static_cast<int*>(pool.alloc());
+    EXPECT_EQ(i0, i2);
+    EXPECT_EQ(pool.alloc(), nullptr);
+
+    pool.clear();
+    EXPECT_NE(pool.alloc(), nullptr);
+    EXPECT_NE(pool.alloc(), nullptr);
+    EXPECT_EQ(pool.alloc(), nullptr);
+}
+
+TEST(Memory_LockFreePoolAllocator, Concurrent) {
+    constexpr int numThreads = 4;
+    constexpr int numBlocks = 256;
+    constexpr int numIt = 2000;
+    LockFreePoolAllocator pool(numThreads * numBlocks, sizeof(uint64_t));
+
+    std::atomic<bool> corrupted = false;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            std::vector<uint64_t*> blocks(numBlocks);
+            for (int it = 0; it < numIt; it++) {
+                // Each thread writes its id to the blocks, if two threads get the same block the value changes
+                for (int i = 0; i < numBlocks; i++) {
+                    blocks[i] = static_cast<uint64_t*>(pool.alloc());
+                    if (blocks[i] == nullptr) {
+                        corrupted = true;
+                        return;
+                    }
+                    *blocks[i] = t;
+                }
+                for (int i = 0; i < numBlocks; i++) {
+                    if (*blocks[i] != uint64_t(t))
+                        corrupted = true;
+                    pool.free(blocks[i]);
+                }
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    EXPECT_FALSE(corrupted);
+
+    // All blocks should have returned to the free list
+    std::set<void*> blocks;
+    for (int i = 0; i < numThreads * numBlocks; i++)
+        blocks.insert(pool.alloc());
+    EXPECT_EQ(blocks.size(), numThreads * numBlocks);
+    EXPECT_EQ(blocks.count(nullptr), 0);
+    EXPECT_EQ(pool.alloc(), nullptr);
+}
+} // namespace
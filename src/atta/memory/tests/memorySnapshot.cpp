@@ -0,0 +1,111 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/memorySnapshot.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::memory;
+
+namespace {
+constexpr size_t SIZE = 256 * MemorySnapshot::PAGE_SIZE + 100;
+constexpr int NUM_RESETS = 1000;
+
+TEST(Memory_MemorySnapshot, Restore) {
+    std::vector<uint8_t> memory(SIZE);
+    for (size_t i = 0; i < SIZE; i++)
+        memory[i] = i % 251;
+    MemorySnapshot snapshot(memory.data(), memory.size());
+    EXPECT_EQ(snapshot.getNumPages(), 257);
+    EXPECT_EQ(snapshot.getNumDirtyPages(memory.data()), 0);
+
+    // Change first page, some middle page and last (partial) page
+    memory[0] = 255;
+    memory[10 * MemorySnapshot::PAGE_SIZE + 5] = 255;
+    memory[SIZE - 1] = 255;
+    EXPECT_EQ(snapshot.getNumDirtyPages(memory.data()), 3);
+
+    EXPECT_EQ(snapshot.restore(memory.data()), 3);
+    for (size_t i = 0; i < SIZE; i++)
+        ASSERT_EQ(memory[i], i % 251);
+    EXPECT_EQ(snapshot.restore(memory.data()), 0);
+}
+
+TEST(Memory_MemorySnapshot, TrackedWrites) {
+    std::vector<uint8_t> memory(SIZE, 0);
+    MemorySnapshot snapshot(memory.data(), memory.size());
+#ifdef ATTA_OS_LINUX
+    EXPECT_TRUE(snapshot.isTracked());
+#endif
+
+    // Written pages are copied back even if the content did not change
+    memory[3 * MemorySnapshot::PAGE_SIZE] = 0;
+    memory[7 * MemorySnapshot::PAGE_SIZE] = 1;
+    EXPECT_EQ(snapshot.getNumDirtyPages(memory.data()), 1);
+    EXPECT_EQ(snapshot.restore(memory.data()), snapshot.isTracked() ? 2 : 1);
+    EXPECT_EQ(memory[7 * MemorySnapshot::PAGE_SIZE], 0);
+
+    // Pages are tracked again after the restore
+    memory[7 * MemorySnapshot::PAGE_SIZE] = 2;
+    EXPECT_EQ(snapshot.restore(memory.data()), 1);
+    EXPECT_EQ(memory[7 * MemorySnapshot::PAGE_SIZE], 0);
+}
+
+TEST(Memory_MemorySnapshot, Overlapping) {
+    std::vector<uint8_t> memory(SIZE, 0);
+    MemorySnapshot first(memory.data(), memory.size());
+    {
+        MemorySnapshot second(memory.data() + MemorySnapshot::PAGE_SIZE * 10, MemorySnapshot::PAGE_SIZE * 10);
+        memory[MemorySnapshot::PAGE_SIZE * 15] = 1;
+        EXPECT_EQ(second.getNumDirtyPages(memory.data() + MemorySnapshot::PAGE_SIZE * 10), 1);
+        EXPECT_EQ(first.getNumDirtyPages(memory.data()), 1);
+        EXPECT_EQ(second.restore(memory.data() + MemorySnapshot::PAGE_SIZE * 10), 1);
+    }
+
+    // Stopping to track the second snapshot keeps the first one tracking
+    memory[MemorySnapshot::PAGE_SIZE * 12] = 1;
+    EXPECT_EQ(first.getNumDirtyPages(memory.data()), 1);
+    EXPECT_GE(first.restore(memory.data()), 1);
+    for (size_t i = 0; i < SIZE; i++)
+        ASSERT_EQ(memory[i], 0);
+}
+
+TEST(Memory_MemorySnapshot, UntrackedFaultDeath) {
+    std::vector<uint8_t> memory(SIZE, 0);
+    MemorySnapshot snapshot(memory.data(), memory.size());
+    EXPECT_DEATH(*static_cast<volatile int*>(nullptr) = 1, "");
+}
+
+// Restore cost depends on the written pages, not on the region size
+TEST(Memory_MemorySnapshot, SpeedResetLarge) {
+    constexpr size_t LARGE_SIZE = 4096 * MemorySnapshot::PAGE_SIZE;
+    std::vector<uint8_t> memory(LARGE_SIZE, 0);
+    MemorySnapshot snapshot(memory.data(), memory.size());
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < NUM_RESETS; i++) {
+        memory[(i * 7 % 4096) * MemorySnapshot::PAGE_SIZE] = 1;
+        ASSERT_EQ(snapshot.restore(memory.data()), 1);
+    }
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - begin;
+    RecordProperty("restoreUs", std::to_string(seconds.count() * 1e6 / NUM_RESETS));
+}
+
+// Episode resets when few pages change (compare with full copy)
+TEST(Memory_MemorySnapshot, SpeedResetFewDirty) {
+    std::vector<uint8_t> memory(SIZE, 0);
+    MemorySnapshot snapshot(memory.data(), memory.size());
+    for (int i = 0; i < NUM_RESETS; i++) {
+        memory[(i * 7 % 256) * MemorySnapshot::PAGE_SIZE] = 1;
+        ASSERT_EQ(snapshot.restore(memory.data()), 1);
+    }
+}
+
+TEST(Memory_MemorySnapshot, SpeedResetFullCopy) {
+    std::vector<uint8_t> memory(SIZE, 0);
+    MemorySnapshot snapshot(memory.data(), memory.size());
+    for (int i = 0; i < NUM_RESETS; i++) {
+        memory[(i * 7 % 256) * MemorySnapshot::PAGE_SIZE] = 1;
+        std::memcpy(memory.data(), snapshot.getData(), snapshot.getSize());
+    }
+    EXPECT_EQ(snapshot.getNumDirtyPages(memory.data()), 0);
+}
+} // namespace
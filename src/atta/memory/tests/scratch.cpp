@@ -0,0 +1,57 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/heapStats.h>
+#include <atta/memory/scratch.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::memory;
+
+namespace {
+TEST(Memory_Scratch, Allocate) {
+    Scratch scratch;
+    Span<int> ints = scratch.alloc<int>(100);
+    ASSERT_EQ(ints.size(), 100);
+    for (size_t i = 0; i < ints.size(); i++)
+        ints[i] = i;
+    EXPECT_EQ(ints[99], 99);
+}
+
+TEST(Memory_Scratch, Alignment) {
+    Scratch scratch;
+    scratch.alloc<uint8_t>(3);
+    Span<double> doubles = scratch.alloc<double>(4);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(doubles.data()) % alignof(double), 0);
+}
+
+TEST(Memory_Scratch, Rollback) {
+    StackAllocator& allocator = Scratch::getAllocator();
+    StackAllocator::Marker marker = allocator.getMarker();
+    {
+        Scratch scratch;
+        scratch.alloc<int>(10);
+        {
+            Scratch inner;
+            inner.alloc<int>(10);
+        }
+        EXPECT_EQ(allocator.getMarker(), marker + 10 * sizeof(int));
+    }
+    EXPECT_EQ(allocator.getMarker(), marker);
+}
+
+TEST(Memory_Scratch, Full) {
+    Scratch scratch;
+    Span<uint8_t> bytes = scratch.alloc<uint8_t>(Scratch::SIZE + 1);
+    EXPECT_TRUE(bytes.empty());
+}
+
+TEST(Memory_Scratch, NoHeapAllocation) {
+    HeapStats before = getHeapStats();
+    {
+        Scratch scratch;
+        scratch.alloc<int>(1000);
+    }
+    HeapStats after = getHeapStats();
+    EXPECT_EQ(before.numAllocs, after.numAllocs);
+}
+} // namespace
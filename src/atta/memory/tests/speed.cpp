@@ -1,11 +1,17 @@
 // SPDX-License-Identifier: MIT
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #include <atta/memory/allocatedObject.h>
+#include <atta/memory/allocators/frameAllocator.h>
+#include <atta/memory/allocators/lockFreePoolAllocator.h>
+#include <atta/memory/allocators/lockedAllocator.h>
 #include <atta/memory/allocators/mallocAllocator.h>
+#include <atta/memory/allocators/poolAllocatorT.h>
 #include <atta/memory/allocators/stackAllocator.h>
+#include <atta/memory/allocators/threadCachedPoolAllocator.h>
 #include <atta/memory/interface.h>
 #include <atta/utils/stringId.h>
 #include <gtest/gtest.h>
+#include <thread>
 
 using namespace atta;
 using namespace atta::memory;
@@ -13,6 +19,8 @@ using namespace atta::memory;
 namespace {
 constexpr int NUM_IT = 1000;
 constexpr int NUM_OBJ = 5000;
+constexpr int NUM_THREADS = 4;
+constexpr int NUM_IT_THREAD = 200;
 
 struct TestStack : public AllocatedObject<TestStack, SID("Stack")> {
     int x, y, z;
@@ -100,4 +108,59 @@ TEST_F(Memory_Speed, StackWithManager) {
     StackAllocator* stack = memory::getAllocator<StackAllocator>(SID("Stack"));
     EXPECT_EQ(stack->getUsedMemory(), 0);
 }
+
+//---------- Contention ----------//
+// Each thread allocates NUM_OBJ objects and frees them NUM_IT_THREAD times using the same allocator
+template <typename Alloc, typename Free>
+void runContention(Alloc alloc, Free free) {
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; t++) {
+        threads.emplace_back([&]() {
+            std::vector<TestCpp*> a(NUM_OBJ);
+            for (int it = 0; it < NUM_IT_THREAD; it++) {
+                for (int i = 0; i < NUM_OBJ; i++)
+                    a[i] = new (alloc()) TestCpp();
+                for (int i = NUM_OBJ - 1; i >= 0; i--)
+                    free(a[i]);
+            }
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+TEST_F(Memory_Speed, ContentionDefaultNewCpp) {
+    runContention([]() { return malloc(sizeof(TestCpp)); }, [](TestCpp* ptr) { ::free(ptr); });
+}
+
+TEST_F(Memory_Speed, ContentionLockedPool) {
+    PoolAllocatorT<TestCpp> pool(NUM_THREADS * NUM_OBJ);
+    LockedAllocator locked(&pool);
+    runContention([&]() { return locked.allocBytes(pool.getBlockSize(), pool.getBlockSize()); },
+                  [&](TestCpp* ptr) { locked.freeBytes(ptr, pool.getBlockSize(), pool.getBlockSize()); });
+}
+
+TEST_F(Memory_Speed, ContentionLockFreePool) {
+    LockFreePoolAllocator pool(NUM_THREADS * NUM_OBJ, sizeof(TestCpp));
+    runContention([&]() { return pool.alloc(); }, [&](TestCpp* ptr) { pool.free(ptr); });
+}
+
+TEST_F(Memory_Speed, ContentionThreadCachedPool) {
+    ThreadCachedPoolAllocator pool(NUM_THREADS * (NUM_OBJ + ThreadCachedPoolAllocator::CACHE_SIZE), sizeof(TestCpp));
+    runContention([&]() { return pool.alloc(); }, [&](TestCpp* ptr) { pool.free(ptr); });
+}
+
+TEST_F(Memory_Speed, ContentionFrame) {
+    FrameAllocator frame(NUM_THREADS * NUM_OBJ * sizeof(TestCpp));
+    std::vector<std::thread> threads;
+    for (int t = 0; t < NUM_THREADS; t++) {
+        threads.emplace_back([&]() {
+            for (int i = 0; i < NUM_OBJ; i++)
+                new (frame.alloc<TestCpp>()) TestCpp();
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    EXPECT_EQ(frame.getFailedCount(), 0);
+}
 } // namespace
@@ -0,0 +1,101 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/memory/allocators/threadCachedPoolAllocator.h>
+#include <gtest/gtest.h>
+#include <thread>
+
+using namespace atta;
+using namespace atta::memory;
+
+namespace {
+TEST(Memory_ThreadCachedPoolAllocator, Allocate) {
+    ThreadCachedPoolAllocator pool(2, sizeof(int));
+    int* i0 = static_cast<int*>(pool.alloc());
+    int* i1 = static_cast<int*>(pool.alloc());
+    int* i2 = static_cast<int*>(pool.alloc());
+
+    EXPECT_NE(i0, nullptr);
+    EXPECT_NE(i1, nullptr);
+    EXPECT_NE(i0, i1);
+    EXPECT_EQ(i2, nullptr);
+
+    pool.free(i0);
+    EXPECT_EQ(pool.alloc(), i0);
+}
+
+TEST(Memory_ThreadCachedPoolAllocator, FlushThreadCache) {
+    ThreadCachedPoolAllocator pool(4, sizeof(int));
+
+    // Main thread gets all blocks in its cache
+    void* b0 = pool.alloc();
+    pool.free(b0);
+
+    // Other thread can only use the blocks after the main thread cache is flushed
+    void* other = nullptr;
+    std::thread([&]() { other = pool.alloc(); }).join();
+    EXPECT_EQ(other, nullptr);
+
+    pool.flushThreadCache();
+    std::thread([&]() {
+        other = pool.alloc();
+        pool.free(other);
+        pool.flushThreadCache();
+    }).join();
+    EXPECT_NE(other, nullptr);
+}
+
+TEST(Memory_ThreadCachedPoolAllocator, ThreadExit) {
+    constexpr size_t numBlocks = 4;
+    ThreadCachedPoolAllocator pool(numBlocks, sizeof(int));
+
+    // The caches of the threads that exited are returned to the pool, and their indices are reused
+    for (size_t t = 0; t < 2 * ThreadCachedPoolAllocator::MAX_THREADS; t++) {
+        void* block = nullptr;
+        std::thread([&]() {
+            block = pool.alloc();
+            pool.free(block);
+        }).join();
+        EXPECT_NE(block, nullptr) << "thread " << t;
+    }
+
+    std::vector<void*> blocks;
+    for (size_t i = 0; i < numBlocks; i++)
+        blocks.push_back(pool.alloc());
+    for (void* block : blocks)
+        EXPECT_NE(block, nullptr);
+}
+
+TEST(Memory_ThreadCachedPoolAllocator, Concurrent) {
+    constexpr int numThreads = 4;
+    constexpr int numBlocks = 256;
+    constexpr int numIt = 2000;
+    ThreadCachedPoolAllocator pool(numThreads * (numBlocks + ThreadCachedPoolAllocator::CACHE_SIZE), sizeof(uint64_t));
+
+    std::atomic<bool> corrupted = false;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            std::vector<uint64_t*> blocks(numBlocks);
+            for (int it = 0; it < numIt; it++) {
+                for (int i = 0; i < numBlocks; i++) {
+                    blocks[i] = static_cast<uint64_t*>(pool.alloc());
+                    if (blocks[i] == nullptr) {
+                        corrupted = true;
+                        return;
+                    }
+                    *blocks[i] = t;
+                }
+                for (int i = 0; i < numBlocks; i++) {
+                    if (*blocks[i] != uint64_t(t))
+                        corrupted = true;
+                    pool.free(blocks[i]);
+                }
+            }
+            pool.flushThreadCache();
+        });
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    EXPECT_FALSE(corrupted);
+}
+} // namespace
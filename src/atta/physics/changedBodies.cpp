@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/relationship.h>
+#include <atta/component/components/rigidBody.h>
+#include <atta/component/components/rigidBody2D.h>
+#include <atta/component/components/transform.h>
+#include <atta/event/events/updateComponent.h>
+#include <atta/event/interface.h>
+#include <atta/physics/changedBodies.h>
+
+namespace atta::physics {
+
+ChangedBodies::~ChangedBodies() { stop(); }
+
+void ChangedBodies::start() {
+    if (!_listening)
+        event::subscribe<event::UpdateComponent>(BIND_EVENT_FUNC(ChangedBodies::onUpdateComponent));
+    _listening = true;
+    _entities.clear();
+}
+
+void ChangedBodies::stop() {
+    if (_listening)
+        event::unsubscribe<event::UpdateComponent>(BIND_EVENT_FUNC(ChangedBodies::onUpdateComponent));
+    _listening = false;
+    _entities.clear();
+}
+
+void ChangedBodies::add(component::EntityId entity, bool descendants) {
+    _entities.push_back(entity);
+    if (!descendants)
+        return;
+    component::Relationship* relationship = component::getComponent<component::Relationship>(entity);
+    if (relationship)
+        for (component::Entity descendant : relationship->getDescendants(entity))
+            _entities.push_back(descendant);
+}
+
+void ChangedBodies::onUpdateComponent(event::Event& event) {
+    event::UpdateComponent& e = reinterpret_cast<event::UpdateComponent&>(event);
+    if (e.componentId == component::getId<component::Transform>())
+        add(e.entityId, true);
+    else if (e.componentId == component::getId<component::RigidBody>() || e.componentId == component::getId<component::RigidBody2D>())
+        add(e.entityId, false);
+}
+
+} // namespace atta::physics
@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/interface.h>
+#include <atta/event/event.h>
+
+namespace atta::physics {
+
+/// Entities whose Transform or rigid body component was updated outside of the engine
+/** Scripts and the UI write directly to the components and then call component::updateComponent. The engines only sync
+ * the bodies of these entities instead of checking all bodies every step. The descendants of an entity with an updated
+ * Transform are added too, because their world transform changed
+ **/
+class ChangedBodies final {
+  public:
+    ChangedBodies() = default;
+    ~ChangedBodies();
+    ChangedBodies(const ChangedBodies&) = delete;
+    ChangedBodies& operator=(const ChangedBodies&) = delete;
+
+    /// Start listening to event::UpdateComponent
+    void start();
+    /// Stop listening and clear the entities
+    void stop();
+
+    /// Add the entity, and its descendants if its world transform changed
+    void add(component::EntityId entity, bool descendants);
+    /// Entities added since the last clear, may contain repeated entities and entities without bodies
+    const std::vector<component::EntityId>& get() const { return _entities; }
+    void clear() { _entities.clear(); }
+
+  private:
+    void onUpdateComponent(event::Event& event);
+
+    bool _listening = false;
+    std::vector<component::EntityId> _entities;
+};
+
+} // namespace atta::physics
@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/physics/contactList.h>
+
+namespace atta::physics {
+
+void ContactList::clear() {
+    _contacts.clear();
+    _start.clear();
+}
+
+void ContactList::add(component::EntityId a, component::EntityId b, vec3 point, vec3 normal, float impulse) {
+    DASSERT(a >= 0 && b >= 0, "Contact entities must be valid");
+    _contacts.push_back({a, b, point, normal, impulse});
+    _contacts.push_back({b, a, point, -normal, impulse});
+}
+
+void ContactList::build() {
+    std::sort(_contacts.begin(), _contacts.end(), [](const Contact& c0, const Contact& c1) {
+        return c0.entity < c1.entity || (c0.entity == c1.entity && c0.other < c1.other);
+    });
+
+    // Entity contacts are in [_start[entity], _start[entity + 1])
+    size_t size = _contacts.empty() ? 0 : _contacts.back().entity + 2;
+    _start.assign(size, 0);
+    for (const Contact& c : _contacts)
+        _start[c.entity + 1]++;
+    for (size_t i = 1; i < _start.size(); i++)
+        _start[i] += _start[i - 1];
+}
+
+Span<const Contact> ContactList::getContacts(component::EntityId entity) const {
+    if (entity < 0 || size_t(entity) + 1 >= _start.size())
+        return {};
+    return Span<const Contact>(_contacts.data() + _start[entity], _start[entity + 1] - _start[entity]);
+}
+
+std::vector<component::EntityId> ContactList::getEntities(component::EntityId entity) const {
+    std::vector<component::EntityId> entities;
+    for (const Contact& c : getContacts(entity))
+        if (entities.empty() || entities.back() != c.other)
+            entities.push_back(c.other);
+    return entities;
+}
+
+bool ContactList::areColliding(component::EntityId eid0, component::EntityId eid1) const {
+    for (const Contact& c : getContacts(eid0))
+        if (c.other == eid1)
+            return true;
+    return false;
+}
+
+} // namespace atta::physics
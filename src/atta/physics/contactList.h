@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/base.h>
+#include <atta/utils/math/vector.h>
+#include <atta/utils/span.h>
+
+namespace atta::physics {
+
+/// Contact point between two entities
+struct Contact {
+    component::EntityId entity; ///< Entity that owns this contact
+    component::EntityId other;  ///< Entity that is touching the owner
+    vec3 point;                 ///< World position
+    vec3 normal;                ///< From entity to other
+    float impulse;              ///< Normal impulse applied in the last step (0 if not computed by the engine)
+};
+
+/** Contacts of the last physics step
+ *
+ * Rebuilt by the engine after each step. Each contact point is stored once for each entity, sorted by entity and then by
+ * the other entity, and an index table by entity id gives the contacts of one entity as a contiguous span. The buffers
+ * are reused between steps, so querying and rebuilding the list does not allocate after the first steps
+ **/
+class ContactList final {
+  public:
+    void clear();
+    /// Add contact point between a and b, the normal points from a to b
+    void add(component::EntityId a, component::EntityId b, vec3 point, vec3 normal, float impulse = 0.0f);
+    /// Sort the contacts and build the index table, must be called after all contacts were added
+    void build();
+
+    /// All contact points, each one is stored for both entities
+    Span<const Contact> getContacts() const { return Span<const Contact>(_contacts.data(), _contacts.size()); }
+    /// Contact points of the entity, sorted by the other entity
+    Span<const Contact> getContacts(component::EntityId entity) const;
+    /// Entities that are touching the entity
+    std::vector<component::EntityId> getEntities(component::EntityId entity) const;
+    bool areColliding(component::EntityId eid0, component::EntityId eid1) const;
+
+  private:
+    std::vector<Contact> _contacts;
+    std::vector<uint32_t> _start; ///< First index in _contacts of each entity id
+};
+
+} // namespace atta::physics
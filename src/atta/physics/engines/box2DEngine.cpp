@@ -12,40 +12,86 @@
 namespace atta::physics {
 
 //---------- Callbacks ----------//
-class ContactListener : public b2ContactListener {
-  public:
-    ContactListener(std::unordered_map<component::EntityId, std::unordered_set<component::EntityId>>& collisions) : _collisions(collisions) {}
-
-    void BeginContact(b2Contact* contact) override {
-        if (contact->IsTouching()) {
-            component::EntityId eidA = contact->GetFixtureA()->GetBody()->GetUserData().pointer;
-            component::EntityId eidB = contact->GetFixtureB()->GetBody()->GetUserData().pointer;
-
-            _collisions[eidA].insert(eidB);
-            _collisions[eidB].insert(eidA);
-        }
-    }
+inline b2AABB getShapeAabb(const b2Shape& shape, const b2Transform& xf) {
+    b2AABB aabb;
+    shape.ComputeAABB(&aabb, xf, 0);
+    return aabb;
+}
 
-    void EndContact(b2Contact* contact) override {
-        component::EntityId eidA = contact->GetFixtureA()->GetBody()->GetUserData().pointer;
-        component::EntityId eidB = contact->GetFixtureB()->GetBody()->GetUserData().pointer;
+// Append the entities with a fixture overlapping the shape, each entity is added once
+class ShapeOverlapCallback : public b2QueryCallback {
+  public:
+    ShapeOverlapCallback(const b2Shape* shape, const b2Transform& xf, std::vector<component::EntityId>& entities)
+        : _shape(shape), _xf(xf), _entities(entities), _first(entities.size()) {}
 
-        _collisions[eidA].erase(eidB);
-        _collisions[eidB].erase(eidA);
+    bool ReportFixture(b2Fixture* fixture) override {
+        component::EntityId eid = fixture->GetBody()->GetUserData().pointer;
+        if (std::find(_entities.begin() + _first, _entities.end(), eid) != _entities.end())
+            return true;
+        const b2Shape* shape = fixture->GetShape();
+        for (int32 i = 0; i < shape->GetChildCount(); i++)
+            if (b2TestOverlap(_shape, 0, shape, i, _xf, fixture->GetBody()->GetTransform())) {
+                _entities.push_back(eid);
+                break;
+            }
+        return true;
     }
 
   private:
-    std::unordered_map<component::EntityId, std::unordered_set<component::EntityId>>& _collisions;
+    const b2Shape* _shape;
+    b2Transform _xf;
+    std::vector<component::EntityId>& _entities;
+    size_t _first;
 };
 
-class EntityCollisionQueryCallback : public b2QueryCallback {
+// Append the closest hit of each entity when sweeping the shape by the translation
+class ShapeCastCallback : public b2QueryCallback {
   public:
+    ShapeCastCallback(const b2Shape* shape, b2Vec2 begin, b2Vec2 translation, std::vector<RayCastHit>& hits)
+        : _shape(shape), _xf(begin, b2Rot(0.0f)), _translation(translation), _hits(hits), _first(hits.size()) {}
+
     bool ReportFixture(b2Fixture* fixture) override {
-        entities.push_back(fixture->GetBody()->GetUserData().pointer);
+        const b2Shape* shape = fixture->GetShape();
+        const b2Transform& xf = fixture->GetBody()->GetTransform();
+        for (int32 i = 0; i < shape->GetChildCount(); i++) {
+            RayCastHit hit{};
+            hit.entity = fixture->GetBody()->GetUserData().pointer;
+            if (b2TestOverlap(_shape, 0, shape, i, _xf, xf))
+                hit.distance = 0.0f; // Initially overlapping
+            else {
+                b2ShapeCastInput input;
+                input.proxyA.Set(shape, i);
+                input.proxyB.Set(_shape, 0);
+                input.transformA = xf;
+                input.transformB = _xf;
+                input.translationB = _translation;
+                b2ShapeCastOutput output;
+                if (!b2ShapeCast(&output, &input))
+                    continue;
+                hit.distance = output.lambda * _translation.Length();
+                hit.normal = vec3(output.normal.x, output.normal.y, 0.0f);
+            }
+            addHit(hit);
+        }
         return true;
     }
 
-    std::vector<component::EntityId> entities;
+  private:
+    void addHit(const RayCastHit& hit) {
+        for (auto it = _hits.begin() + _first; it != _hits.end(); it++)
+            if (it->entity == hit.entity) {
+                if (hit.distance < it->distance)
+                    *it = hit;
+                return;
+            }
+        _hits.push_back(hit);
+    }
+
+    const b2Shape* _shape;
+    b2Transform _xf;
+    b2Vec2 _translation;
+    std::vector<RayCastHit>& _hits;
+    size_t _first;
 };
 
 class RayCastCallback : public b2RayCastCallback {
@@ -70,6 +116,32 @@ class RayCastCallback : public b2RayCastCallback {
     vec2 _start;
 };
 
+// Same as RayCastCallback, but writing the hits to a span
+class RayCastSpanCallback : public b2RayCastCallback {
+  public:
+    RayCastSpanCallback(Span<RayCastHit> hits, bool onlyFirst, vec2 start) : _hits(hits), _onlyFirst(onlyFirst), _start(start) {}
+
+    float ReportFixture(b2Fixture* fixture, const b2Vec2& point, const b2Vec2& normal, float fraction) override {
+        if (_onlyFirst)
+            numHits = 0;
+        RayCastHit& hit = _hits[numHits++];
+        hit.entity = fixture->GetBody()->GetUserData().pointer;
+        hit.distance = length(vec2(point.x, point.y) - _start);
+        hit.normal = vec3(normal.x, normal.y, 0.0f);
+        // Stop the ray cast when the span is full
+        if (_onlyFirst)
+            return fraction;
+        return numHits < _hits.size() ? 1 : 0;
+    }
+
+    size_t numHits = 0;
+
+  private:
+    Span<RayCastHit> _hits;
+    bool _onlyFirst;
+    vec2 _start;
+};
+
 //---------- Conversions ----------//
 inline b2BodyType attaToBox2D(component::RigidBody2D::Type type) {
     switch (type) {
@@ -93,14 +165,10 @@ Box2DEngine::~Box2DEngine() {
 
 void Box2DEngine::start() {
     _running = true;
+    _changedBodies.start();
     vec2 g = vec2(physics::getGravity());
     _world = std::make_shared<b2World>(b2Vec2(g.x, g.y));
 
-    // Create contact listener
-    // TODO need to free?
-    ContactListener* contactlistener = new ContactListener(_collisions);
-    _world->SetContactListener(contactlistener);
-
     //---------- Create ground body----------//
     // This body is used to apply top-down friction if necessary
     b2BodyDef groundBodyDef{};
@@ -159,55 +227,60 @@ void Box2DEngine::step(float dt) {
     int positionIterations = 3;
 
     //----- Update box2d bodies -----//
-    for (auto [eid, body] : _bodies) {
-        auto t = component::getComponent<component::Transform>(eid);
-        auto rb2d = component::getComponent<component::RigidBody2D>(eid);
-
+    // Only the bodies whose components were updated since the last step (e.g. by a script or the UI) are checked
+    _syncedParents.nextStep();
+    for (component::EntityId entity : _changedBodies.get()) {
+        auto it = _syncedIndices.find(entity);
+        if (it == _syncedIndices.end())
+            continue;
+        SyncedBody& s = _syncedBodies[it->second];
         // Check type change
-        if (body->GetType() != attaToBox2D(rb2d->type))
-            body->SetType(attaToBox2D(rb2d->type));
-
-        // Get atta pos/angle
-        component::Transform trans = t->getWorldTransform(eid);
-
-        // Get box2d pos/angle
-        b2Vec2 pos = body->GetPosition();
-        vec3 physicsPosition = {pos.x, pos.y, trans.position.z};
-        quat physicsOrientation;
-        physicsOrientation.set2DAngle(body->GetAngle());
-
-        // Calculate quaternion distance
-        quat po = physicsOrientation;
-        quat o = trans.orientation;
-        float qDist = po.r * o.r + po.i * o.i + po.j * o.j + po.k * o.k;
-        qDist = 1 - qDist * qDist; // 0 if they are the same, 1 if they are opposite
-        bool isSameOri = qDist < 0.001 || qDist > 0.999;
-
-        // Check if need to update physics transform
-        if (trans.position != physicsPosition || !isSameOri) {
-            body->SetTransform(b2Vec2(trans.position.x, trans.position.y), trans.orientation.get2DAngle());
-            body->SetAwake(true);
+        if (s.rigidBody->type != s.type) {
+            s.body->SetType(attaToBox2D(s.rigidBody->type));
+            s.type = s.rigidBody->type;
+        }
+
+        // Check transform change
+        vec3 position;
+        quat orientation;
+        if (s.transform.changed(position, orientation)) {
+            s.body->SetTransform(b2Vec2(position.x, position.y), orientation.get2DAngle());
+            s.body->SetAwake(true);
         }
+        listAwake(it->second);
     }
+    _changedBodies.clear();
 
     //----- Step simulation -----//
     _world->Step(dt, velocityIterations, positionIterations);
+    updateContacts();
 
     //----- Update atta components -----//
-    for (auto [eid, body] : _bodies) {
-        auto t = component::getComponent<component::Transform>(eid);
-        if (body->IsAwake() && t) {
-            component::Transform worldTrans;
-
-            // Get new transform (after physics step)
-            b2Vec2 pos = body->GetPosition();
-            worldTrans.position = {pos.x, pos.y, t->position.z};
-            worldTrans.orientation.set2DAngle(body->GetAngle());
-            worldTrans.scale = t->scale;
-
-            // Update transform
-            t->setWorldTransform(eid, worldTrans);
+    // Sleeping bodies did not move. The bodies woken up during the step are in the same island as an awake body, so they are
+    // found through the touching contacts and joints of the awake bodies
+    for (size_t i = 0; i < _awakeBodies.size();) {
+        SyncedBody& s = _syncedBodies[_awakeBodies[i]];
+        if (!s.body->IsAwake()) {
+            s.listed = false;
+            _awakeBodies[i] = _awakeBodies.back();
+            _awakeBodies.pop_back();
+            continue;
         }
+        for (b2ContactEdge* edge = s.body->GetContactList(); edge; edge = edge->next)
+            if (edge->contact->IsTouching())
+                listAwake(_syncedIndices[edge->other->GetUserData().pointer]);
+        for (b2JointEdge* edge = s.body->GetJointList(); edge; edge = edge->next)
+            if (edge->other != _groundBody)
+                listAwake(_syncedIndices[edge->other->GetUserData().pointer]);
+
+        b2Vec2 pos = s.body->GetPosition();
+        quat orientation;
+        orientation.set2DAngle(s.body->GetAngle());
+        s.transform.write(vec3(pos.x, pos.y, s.transform.getPosition().z), orientation);
+        // Synced children follow in the next step
+        if (_syncedParents.contains(s.transform.getEntity()))
+            _changedBodies.add(s.transform.getEntity(), true);
+        i++;
     }
 }
 
@@ -215,7 +288,12 @@ void Box2DEngine::stop() {
     _running = false;
     _bodies.clear();
     _componentToEntity.clear();
-    _collisions.clear();
+    _syncedBodies.clear();
+    _syncedIndices.clear();
+    _awakeBodies.clear();
+    _syncedParents.clear();
+    _changedBodies.stop();
+    _contacts.clear();
     _world.reset();
 }
 
@@ -248,6 +326,9 @@ void Box2DEngine::createRigidBody(component::EntityId entity) {
     // Create body
     b2Body* body = _world->CreateBody(&bodyDef);
     _bodies[entity] = body;
+    _syncedIndices[entity] = _syncedBodies.size();
+    _syncedBodies.push_back({body, rb2d, rb2d->type, false, SyncedTransform(entity, t, _syncedParents)});
+    listAwake(_syncedBodies.size() - 1);
 
     // Apply top-down friction
     vec3 gravity = physics::getGravity();
@@ -267,6 +348,26 @@ void Box2DEngine::createRigidBody(component::EntityId entity) {
 void Box2DEngine::deleteRigidBody(component::EntityId entity) {
     _world->DestroyBody(_bodies[entity]);
     _bodies.erase(entity);
+
+    // Remove the body from the awake bodies, the last synced body is moved to its index
+    size_t index = _syncedIndices[entity];
+    size_t last = _syncedBodies.size() - 1;
+    for (size_t i = 0; i < _awakeBodies.size();) {
+        if (_awakeBodies[i] == index) {
+            _awakeBodies[i] = _awakeBodies.back();
+            _awakeBodies.pop_back();
+            continue;
+        }
+        if (_awakeBodies[i] == last)
+            _awakeBodies[i] = index;
+        i++;
+    }
+
+    // Move the last synced body to the removed index
+    _syncedBodies[index] = _syncedBodies.back();
+    _syncedIndices[_syncedBodies[index].transform.getEntity()] = index;
+    _syncedBodies.pop_back();
+    _syncedIndices.erase(entity);
 }
 
 void Box2DEngine::createColliders(component::EntityId entity) {
@@ -422,14 +523,6 @@ void Box2DEngine::createRigidJoint(component::RigidJoint* rigid) {
     _world->CreateJoint(&pjd);
 }
 
-std::vector<component::EntityId> Box2DEngine::getEntityCollisions(component::EntityId eid) {
-    if (_collisions.find(eid) != _collisions.end()) {
-        std::vector<component::EntityId> collisions(_collisions[eid].begin(), _collisions[eid].end());
-        return collisions;
-    } else
-        return {};
-}
-
 std::vector<RayCastHit> Box2DEngine::rayCast(vec3 begin, vec3 end, bool onlyFirst) {
     RayCastCallback rc(onlyFirst, vec2(begin));
     _world->RayCast(&rc, b2Vec2(begin.x, begin.y), b2Vec2(end.x, end.y));
@@ -437,8 +530,13 @@ std::vector<RayCastHit> Box2DEngine::rayCast(vec3 begin, vec3 end, bool onlyFirs
     return rc.hits;
 }
 
-bool Box2DEngine::areColliding(component::EntityId eid0, component::EntityId eid1) {
-    return _collisions.find(eid0) != _collisions.end() && _collisions[eid0].find(eid1) != _collisions[eid0].end();
+size_t Box2DEngine::rayCast(vec3 begin, vec3 end, Span<RayCastHit> hits, bool onlyFirst) {
+    if (hits.empty())
+        return 0;
+    RayCastSpanCallback rc(hits, onlyFirst, vec2(begin));
+    _world->RayCast(&rc, b2Vec2(begin.x, begin.y), b2Vec2(end.x, end.y));
+
+    return rc.numHits;
 }
 
 void Box2DEngine::updateGravity() {
@@ -448,48 +546,148 @@ void Box2DEngine::updateGravity() {
     }
 }
 
+struct Box2DBodyState {
+    component::EntityId entity;
+    b2Vec2 position;
+    float angle;
+    b2Vec2 linearVelocity;
+    float angularVelocity;
+    bool awake;
+};
+
+void Box2DEngine::saveState(std::vector<uint8_t>& state) {
+    state.resize(_bodies.size() * sizeof(Box2DBodyState));
+    Box2DBodyState* bodyStates = reinterpret_cast<Box2DBodyState*>(state.data());
+    for (auto [eid, body] : _bodies)
+        *bodyStates++ = {eid, body->GetPosition(), body->GetAngle(), body->GetLinearVelocity(), body->GetAngularVelocity(), body->IsAwake()};
+}
+
+void Box2DEngine::restoreState(const std::vector<uint8_t>& state) {
+    const Box2DBodyState* bodyStates = reinterpret_cast<const Box2DBodyState*>(state.data());
+    for (size_t i = 0; i < state.size() / sizeof(Box2DBodyState); i++) {
+        const Box2DBodyState& s = bodyStates[i];
+        auto it = _bodies.find(s.entity);
+        if (it == _bodies.end())
+            continue;
+        b2Body* body = it->second;
+        body->SetTransform(s.position, s.angle);
+        body->SetLinearVelocity(s.linearVelocity);
+        body->SetAngularVelocity(s.angularVelocity);
+        body->SetAwake(s.awake);
+        listAwake(_syncedIndices[s.entity]);
+    }
+}
+
+void Box2DEngine::listAwake(size_t index) {
+    SyncedBody& s = _syncedBodies[index];
+    if (!s.listed && s.body->IsAwake()) {
+        s.listed = true;
+        _awakeBodies.push_back(index);
+    }
+}
+
+void Box2DEngine::updateContacts() {
+    _contacts.clear();
+    for (b2Contact* contact = _world->GetContactList(); contact; contact = contact->GetNext()) {
+        if (!contact->IsTouching())
+            continue;
+        component::EntityId eidA = contact->GetFixtureA()->GetBody()->GetUserData().pointer;
+        component::EntityId eidB = contact->GetFixtureB()->GetBody()->GetUserData().pointer;
+
+        // World manifold normal points from A to B
+        b2WorldManifold worldManifold;
+        contact->GetWorldManifold(&worldManifold);
+        const b2Manifold* manifold = contact->GetManifold();
+        vec3 normal(worldManifold.normal.x, worldManifold.normal.y, 0.0f);
+        for (int i = 0; i < manifold->pointCount; i++) {
+            vec3 point(worldManifold.points[i].x, worldManifold.points[i].y, 0.0f);
+            _contacts.add(eidA, eidB, point, normal, manifold->points[i].normalImpulse);
+        }
+    }
+    _contacts.build();
+}
+
 b2Body* Box2DEngine::getBox2DRigidBody(component::EntityId entity) { return _bodies.find(entity) != _bodies.end() ? _bodies[entity] : nullptr; }
 
-std::vector<component::EntityId> Box2DEngine::getAABBEntities(vec2 lower, vec2 upper) {
-    EntityCollisionQueryCallback callback;
+void Box2DEngine::overlapAabb(vec3 lower, vec3 upper, std::vector<component::EntityId>& entities) {
+    b2PolygonShape box;
+    vec2 halfSize = (vec2(upper) - vec2(lower)) * 0.5f;
+    vec2 center = (vec2(upper) + vec2(lower)) * 0.5f;
+    box.SetAsBox(halfSize.x, halfSize.y);
+    b2Transform xf(b2Vec2(center.x, center.y), b2Rot(0.0f));
+    ShapeOverlapCallback callback(&box, xf, entities);
+    _world->QueryAABB(&callback, getShapeAabb(box, xf));
+}
+
+void Box2DEngine::overlapSphere(vec3 center, float radius, std::vector<component::EntityId>& entities) {
+    b2CircleShape circle;
+    circle.m_radius = radius;
+    b2Transform xf(b2Vec2(center.x, center.y), b2Rot(0.0f));
+    ShapeOverlapCallback callback(&circle, xf, entities);
+    _world->QueryAABB(&callback, getShapeAabb(circle, xf));
+}
 
+void Box2DEngine::sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst, std::vector<RayCastHit>& hits) {
+    b2CircleShape circle;
+    circle.m_radius = radius;
+    size_t first = hits.size();
+    ShapeCastCallback callback(&circle, b2Vec2(begin.x, begin.y), b2Vec2(end.x - begin.x, end.y - begin.y), hits);
+
+    // Fixtures that can be hit are inside the swept circle bounding box
     b2AABB aabb;
-    aabb.lowerBound.Set(lower.x, lower.y);
-    aabb.upperBound.Set(upper.x, upper.y);
+    aabb.lowerBound.Set(std::min(begin.x, end.x) - radius, std::min(begin.y, end.y) - radius);
+    aabb.upperBound.Set(std::max(begin.x, end.x) + radius, std::max(begin.y, end.y) + radius);
     _world->QueryAABB(&callback, aabb);
-
-    return callback.entities;
+    sortHits(hits, first, onlyFirst);
 }
 
 // component::RigidBody2D interface
 void Box2DEngine::setTransform(component::RigidBody2D* rb2d, vec2 position, float angle) {
-    if (Config::getState() != Config::State::IDLE)
-        _bodies[_componentToEntity[rb2d]]->SetTransform(b2Vec2(position.x, position.y), angle);
+    if (Config::getState() != Config::State::IDLE) {
+        component::EntityId entity = _componentToEntity[rb2d];
+        _bodies[entity]->SetTransform(b2Vec2(position.x, position.y), angle);
+        listAwake(_syncedIndices[entity]);
+    }
 }
 
 void Box2DEngine::setLinearVelocity(component::RigidBody2D* rb2d, vec2 vel) {
-    if (Config::getState() != Config::State::IDLE)
-        _bodies[_componentToEntity[rb2d]]->SetLinearVelocity(b2Vec2(vel.x, vel.y));
+    if (Config::getState() != Config::State::IDLE) {
+        component::EntityId entity = _componentToEntity[rb2d];
+        _bodies[entity]->SetLinearVelocity(b2Vec2(vel.x, vel.y));
+        listAwake(_syncedIndices[entity]);
+    }
 }
 
 void Box2DEngine::setAngularVelocity(component::RigidBody2D* rb2d, float omega) {
-    if (Config::getState() != Config::State::IDLE)
-        _bodies[_componentToEntity[rb2d]]->SetAngularVelocity(omega);
+    if (Config::getState() != Config::State::IDLE) {
+        component::EntityId entity = _componentToEntity[rb2d];
+        _bodies[entity]->SetAngularVelocity(omega);
+        listAwake(_syncedIndices[entity]);
+    }
 }
 
 void Box2DEngine::applyForce(component::RigidBody2D* rb2d, vec2 force, vec2 point, bool wake) {
-    if (Config::getState() != Config::State::IDLE)
-        _bodies[_componentToEntity[rb2d]]->ApplyForce(b2Vec2(force.x, force.y), b2Vec2(point.x, point.y), wake);
+    if (Config::getState() != Config::State::IDLE) {
+        component::EntityId entity = _componentToEntity[rb2d];
+        _bodies[entity]->ApplyForce(b2Vec2(force.x, force.y), b2Vec2(point.x, point.y), wake);
+        listAwake(_syncedIndices[entity]);
+    }
 }
 
 void Box2DEngine::applyForceToCenter(component::RigidBody2D* rb2d, vec2 force, bool wake) {
-    if (Config::getState() != Config::State::IDLE)
-        _bodies[_componentToEntity[rb2d]]->ApplyForceToCenter(b2Vec2(force.x, force.y), wake);
+    if (Config::getState() != Config::State::IDLE) {
+        component::EntityId entity = _componentToEntity[rb2d];
+        _bodies[entity]->ApplyForceToCenter(b2Vec2(force.x, force.y), wake);
+        listAwake(_syncedIndices[entity]);
+    }
 }
 
 void Box2DEngine::applyTorque(component::RigidBody2D* rb2d, float torque, bool wake) {
-    if (Config::getState() != Config::State::IDLE)
-        _bodies[_componentToEntity[rb2d]]->ApplyTorque(torque, wake);
+    if (Config::getState() != Config::State::IDLE) {
+        component::EntityId entity = _componentToEntity[rb2d];
+        _bodies[entity]->ApplyTorque(torque, wake);
+        listAwake(_syncedIndices[entity]);
+    }
 }
 
 } // namespace atta::physics
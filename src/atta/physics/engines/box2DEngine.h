@@ -7,7 +7,9 @@
 #include <atta/component/components/revoluteJoint.h>
 #include <atta/component/components/rigidBody2D.h>
 #include <atta/component/components/rigidJoint.h>
+#include <atta/physics/changedBodies.h>
 #include <atta/physics/engines/engine.h>
+#include <atta/physics/syncedTransform.h>
 
 namespace atta::physics {
 
@@ -25,11 +27,17 @@ class Box2DEngine : public Engine {
     void createColliders(component::EntityId entity) override;
     void deleteColliders(component::EntityId entity) override;
 
-    std::vector<component::EntityId> getEntityCollisions(component::EntityId eid) override;
     std::vector<RayCastHit> rayCast(vec3 begin, vec3 end, bool onlyFirst) override;
-    bool areColliding(component::EntityId eid0, component::EntityId eid1) override;
+    size_t rayCast(vec3 begin, vec3 end, Span<RayCastHit> hits, bool onlyFirst) override;
+
+    // The queries ignore the z coordinate
+    void overlapAabb(vec3 lower, vec3 upper, std::vector<component::EntityId>& entities) override;
+    void overlapSphere(vec3 center, float radius, std::vector<component::EntityId>& entities) override;
+    void sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst, std::vector<RayCastHit>& hits) override;
 
     void updateGravity() override;
+    void saveState(std::vector<uint8_t>& state) override;
+    void restoreState(const std::vector<uint8_t>& state) override;
 
     b2Body* getBox2DRigidBody(component::EntityId entity);
 
@@ -41,18 +49,38 @@ class Box2DEngine : public Engine {
     void applyForceToCenter(component::RigidBody2D* rb2d, vec2 force, bool wake);
     void applyTorque(component::RigidBody2D* rb2d, float torque, bool wake);
 
+  protected:
+    bool isRayCastThreadSafe() const override { return true; }
+
   private:
-    std::vector<component::EntityId> getAABBEntities(vec2 lower, vec2 upper);
+    /// Rebuild the contact list with the touching contacts of the world
+    void updateContacts();
 
     void createPrismaticJoint(component::PrismaticJoint* prismatic);
     void createRevoluteJoint(component::RevoluteJoint* revolute);
     void createRigidJoint(component::RigidJoint* rigid);
 
+    /// Add the synced body to the awake bodies if it is awake and not listed yet
+    void listAwake(size_t index);
+
     std::shared_ptr<b2World> _world;
     b2Body* _groundBody; ///< Ground body used to apply top-down friction if necessary
     std::unordered_map<component::EntityId, b2Body*> _bodies;
     std::unordered_map<component::RigidBody2D*, component::EntityId> _componentToEntity;
-    std::unordered_map<component::EntityId, std::unordered_set<component::EntityId>> _collisions;
+
+    /// Body and the component values after the last sync, used to only sync updated and awake bodies
+    struct SyncedBody {
+        b2Body* body;
+        component::RigidBody2D* rigidBody;
+        component::RigidBody2D::Type type;
+        bool listed; ///< If the body is in _awakeBodies
+        SyncedTransform transform;
+    };
+    std::vector<SyncedBody> _syncedBodies;
+    std::unordered_map<component::EntityId, size_t> _syncedIndices; ///< Index of each entity in _syncedBodies
+    std::vector<size_t> _awakeBodies;                               ///< Index of the bodies that were awake in the last step
+    SyncedTransform::Parents _syncedParents;
+    ChangedBodies _changedBodies; ///< Entities to sync in the next step
 };
 
 } // namespace atta::physics
@@ -2,11 +2,15 @@
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #include <atta/component/components/boxCollider.h>
 #include <atta/component/components/cylinderCollider.h>
+#include <atta/component/components/meshCollider.h>
 #include <atta/component/components/rigidBody.h>
 #include <atta/component/components/sphereCollider.h>
 #include <atta/component/components/transform.h>
 #include <atta/physics/engines/bulletEngine.h>
 #include <atta/physics/interface.h>
+#include <atta/resource/interface.h>
+#include <atta/resource/meshOptimizer.h>
+#include <atta/resource/resources/mesh.h>
 #include <atta/utils/config.h>
 
 #define BT_USRPTR_TO_EID(usrPtr) component::EntityId(static_cast<uint8_t*>(usrPtr) - static_cast<uint8_t*>(0))
@@ -15,8 +19,9 @@ namespace atta::physics {
 
 constexpr int USER_TYPE_PRISMATIC = 0;
 constexpr int USER_TYPE_REVOLUTE = 1;
+constexpr float SHAPE_QUANTUM = 1e-4f; ///< Collider dimensions closer than this share the same collision shape
 
-BulletEngine::BulletEngine() : Engine(Engine::BULLET), _numSubSteps(1), _showAabb(false) {}
+BulletEngine::BulletEngine() : Engine(Engine::BULLET), _numSubSteps(1), _multithreaded(false), _numThreads(0), _showAabb(false) {}
 
 BulletEngine::~BulletEngine() {
     if (_running)
@@ -46,22 +51,40 @@ inline mat3 btToAtta(const btMatrix3x3& mat) {
 //------------------- START --------------------//
 //----------------------------------------------//
 void BulletEngine::start() {
+    PROFILE();
     _running = true;
-    gContactStartedCallback = collisionStarted;
-    gContactEndedCallback = collisionEnded;
+    _changedBodies.start();
 
     _collisionConfiguration = std::make_shared<btDefaultCollisionConfiguration>();
-    _dispatcher = std::make_shared<btCollisionDispatcher>(_collisionConfiguration.get());
     _broadPhase = std::make_shared<btDbvtBroadphase>();
-    _solver = std::make_shared<btSequentialImpulseConstraintSolver>();
-
-    _world = std::make_shared<btDiscreteDynamicsWorld>(_dispatcher.get(), _broadPhase.get(), _solver.get(), _collisionConfiguration.get());
+    // The parallel queries use the task scheduler workers, so all threads that call bullet have fixed thread indices
+    if (!_taskScheduler)
+        _taskScheduler = std::make_shared<BulletTaskScheduler>();
+    _taskScheduler->setNumThreads(_numThreads == 0 ? int(std::thread::hardware_concurrency()) : int(_numThreads));
+    _queryPool = _taskScheduler->getWorkerPool();
+    if (_multithreaded) {
+        // Bullet runs the parallel parts of the step with the global task scheduler
+        btSetTaskScheduler(_taskScheduler.get());
+
+        _dispatcher = std::make_shared<btCollisionDispatcherMt>(_collisionConfiguration.get());
+        _solverPool = std::make_shared<btConstraintSolverPoolMt>(_taskScheduler->getNumThreads());
+        _solver = std::make_shared<btSequentialImpulseConstraintSolverMt>();
+        _world = std::make_shared<btDiscreteDynamicsWorldMt>(_dispatcher.get(), _broadPhase.get(), _solverPool.get(), _solver.get(),
+                                                             _collisionConfiguration.get());
+    } else {
+        _dispatcher = std::make_shared<btCollisionDispatcher>(_collisionConfiguration.get());
+        _solver = std::make_shared<btSequentialImpulseConstraintSolver>();
+        _world = std::make_shared<btDiscreteDynamicsWorld>(_dispatcher.get(), _broadPhase.get(), _solver.get(), _collisionConfiguration.get());
+    }
     updateGravity();
+    _movedBodies.resize(BT_MAX_THREAD_COUNT);
 
     std::vector<component::EntityId> entities = component::getNoPrototypeView();
     //---------- Create rigid bodies ----------//
     for (component::EntityId entity : entities)
         createRigidBody(entity);
+    LOG_DEBUG("physics::BulletEngine", "Created [w]$0[] rigid bodies sharing [w]$1[] collision shapes ([w]$2[] compound shapes)", _entityToBody.size(),
+              _shapeCache.size(), _compoundShapes.size());
 
     //---------- Create joints ----------//
     for (component::EntityId entity : entities) {
@@ -83,65 +106,60 @@ void BulletEngine::start() {
 //----------------------------------------------//
 void BulletEngine::step(float dt) {
     //----- Update bullet rigid bodies -----//
-    for (int j = _world->getNumCollisionObjects() - 1; j >= 0; j--) {
-        btCollisionObject* obj = _world->getCollisionObjectArray()[j];
-        btRigidBody* body = btRigidBody::upcast(obj);
-        component::EntityId eid = BT_USRPTR_TO_EID(obj->getUserPointer());
-        auto rb = component::getComponent<component::RigidBody>(eid);
-
-        // Wake up entity if it is not active
-        if (rb->awake && !body->isActive())
-            wakeUpEntity(eid);
-
-        // Update linear velocity
-        if (rb->linearVelocity != btToAtta(body->getLinearVelocity())) {
+    // Only the bodies whose components were updated since the last step (e.g. by a script or the UI) are checked
+    _syncedParents.nextStep();
+    for (component::EntityId entity : _changedBodies.get()) {
+        auto it = _syncedIndices.find(entity);
+        if (it == _syncedIndices.end())
+            continue;
+        SyncedBody& s = _syncedBodies[it->second];
+        btRigidBody* body = s.body;
+        component::RigidBody* rb = s.rigidBody;
+
+        // Wake up entity if it was set awake
+        bool wakeUp = rb->awake && !s.awake;
+
+        // Update linear/angular velocity
+        if (rb->linearVelocity != s.linearVelocity) {
             body->setLinearVelocity(attaToBt(rb->linearVelocity));
-            wakeUpEntity(eid);
+            s.linearVelocity = rb->linearVelocity;
+            wakeUp = true;
         }
-
-        // Update angular velocity
-        if (rb->angularVelocity != btToAtta(body->getAngularVelocity())) {
-            LOG_INFO("BulletEngine", "Updating ang vel");
+        if (rb->angularVelocity != s.angularVelocity) {
             body->setAngularVelocity(attaToBt(rb->angularVelocity));
-            wakeUpEntity(eid);
+            s.angularVelocity = rb->angularVelocity;
+            wakeUp = true;
         }
 
         if (rb->type == component::RigidBody::DYNAMIC) {
             // Update mass
-            if (rb->mass != body->getMass()) {
+            if (rb->mass != s.mass) {
                 body->setMassProps(rb->mass, body->getLocalInertia());
                 rb->mass = body->getMass(); // Bullet's internal mass may be slightly different
+                s.mass = rb->mass;
             }
 
             // Update linear/angular damping
-            if (rb->linearDamping != body->getLinearDamping() || rb->angularDamping != body->getAngularDamping())
+            if (rb->linearDamping != s.linearDamping || rb->angularDamping != s.angularDamping) {
                 body->setDamping(rb->linearDamping, rb->angularDamping);
+                s.linearDamping = rb->linearDamping;
+                s.angularDamping = rb->angularDamping;
+            }
         }
 
         // Update transform (position/orientation)
-        {
-            // Get atta transform
-            auto t = component::getComponent<component::Transform>(eid);
-            component::Transform worldT = t->getWorldTransform(eid);
-            vec3 position = worldT.position;
-            quat orientation = worldT.orientation;
-
-            // Get bullet transform
-            btTransform trans;
-            trans = obj->getWorldTransform();
-            quat physicsOrientation = btToAtta(trans.getRotation());
-            vec3 physicsPosition = btToAtta(trans.getOrigin());
-
-            // Check if atta and bullet transforms match
-            if (position != physicsPosition || orientation != physicsOrientation) {
-                trans = btTransform(attaToBt(orientation), attaToBt(position));
-                body->setWorldTransform(trans);
-
-                // Wake up entity
-                wakeUpEntity(eid);
-            }
+        vec3 position;
+        quat orientation;
+        if (s.transform.changed(position, orientation)) {
+            body->setWorldTransform(btTransform(attaToBt(orientation), attaToBt(position)));
+            wakeUp = true;
         }
+
+        // Bodies woken up here or by the interface (e.g. applyForce) are reported by their motion state after the step
+        if (wakeUp)
+            wakeUpEntity(entity);
     }
+    _changedBodies.clear();
 
     //----- Update bullet constraints -----//
     for (int i = 0; i < _world->getNumConstraints(); i++) {
@@ -170,35 +188,46 @@ void BulletEngine::step(float dt) {
     }
 
     //----- Step simulation -----//
-    _world->stepSimulation(dt, _numSubSteps, dt / _numSubSteps);
+    {
+        PROFILE_NAME("atta::physics::BulletEngine::stepSimulation");
+        _world->stepSimulation(dt, _numSubSteps, dt / _numSubSteps);
+    }
+    updateContacts();
 
     //----- Update atta rigid body -----//
-    for (int j = _world->getNumCollisionObjects() - 1; j >= 0; j--) {
-        // TODO Should go through collisionObjects from the root down the relationship hierarchy,
-        // strange simulations may happen otherwise because of wrong parent transform
-        btCollisionObject* obj = _world->getCollisionObjectArray()[j];
-        btRigidBody* body = btRigidBody::upcast(obj);
-        btTransform trans;
-        trans = obj->getWorldTransform();
-
-        // Calculate world transform
-        component::EntityId eid = BT_USRPTR_TO_EID(obj->getUserPointer());
-        auto t = component::getComponent<component::Transform>(eid);
+    // Sleeping bodies did not move, the bodies woken up during the step were reported by their motion state
+    for (std::vector<size_t>& moved : _movedBodies) {
+        for (size_t i : moved)
+            listAwake(i);
+        moved.clear();
+    }
+    // TODO Should go through the bodies from the root down the relationship hierarchy,
+    // strange simulations may happen otherwise because of wrong parent transform
+    for (size_t i = 0; i < _awakeBodies.size();) {
+        SyncedBody& s = _syncedBodies[_awakeBodies[i]];
+        btRigidBody* body = s.body;
+        component::RigidBody* rb = s.rigidBody;
 
         // Update world transform
-        component::Transform worldTrans;
-        worldTrans.position = btToAtta(trans.getOrigin());
-        worldTrans.orientation = btToAtta(trans.getRotation());
-        worldTrans.scale = t->scale;
-        t->setWorldTransform(eid, worldTrans);
+        const btTransform& trans = body->getWorldTransform();
+        s.transform.write(btToAtta(trans.getOrigin()), btToAtta(trans.getRotation()));
+        // Synced children follow in the next step
+        if (_syncedParents.contains(s.transform.getEntity()))
+            _changedBodies.add(s.transform.getEntity(), true);
 
         // Update rigid body
-        auto rb = component::getComponent<component::RigidBody>(eid);
-        rb->linearVelocity = btToAtta(body->getLinearVelocity());
-        rb->angularVelocity = btToAtta(body->getAngularVelocity());
-
-        // Update is awake
-        rb->awake = body->isActive();
+        s.linearVelocity = rb->linearVelocity = btToAtta(body->getLinearVelocity());
+        s.angularVelocity = rb->angularVelocity = btToAtta(body->getAngularVelocity());
+        s.awake = rb->awake = body->isActive();
+
+        // Bodies are updated one last time when they fall asleep
+        if (!s.awake) {
+            s.listed = false;
+            _awakeBodies[i] = _awakeBodies.back();
+            _awakeBodies.pop_back();
+            continue;
+        }
+        i++;
     }
 
     //----- Update atta joints -----//
@@ -233,9 +262,13 @@ void BulletEngine::stop() {
     _bodyToEntity.clear();
     _componentToEntity.clear();
     _entityToBody.clear();
-    _collisions.clear();
-    gContactStartedCallback = nullptr;
-    gContactEndedCallback = nullptr;
+    _syncedBodies.clear();
+    _syncedIndices.clear();
+    _awakeBodies.clear();
+    _movedBodies.clear();
+    _syncedParents.clear();
+    _changedBodies.stop();
+    _contacts.clear();
 
     // Delete rigid bodies
     for (int i = _world->getNumCollisionObjects() - 1; i >= 0; i--) {
@@ -248,22 +281,20 @@ void BulletEngine::stop() {
     }
 
     // Delete collision shapes
-    for (int i = 0; i < _collisionShapes.size(); i++) {
-        delete _collisionShapes[i];
-        _collisionShapes[i] = nullptr;
+    for (int i = 0; i < _compoundShapes.size(); i++) {
+        delete _compoundShapes[i];
+        _compoundShapes[i] = nullptr;
     }
-    _collisionShapes.clear();
+    _compoundShapes.clear();
+    for (auto& [key, shape] : _shapeCache)
+        delete shape;
+    _shapeCache.clear();
+    _triangleMeshes.clear();
 
     // Delete world
     _world.reset();
-}
-
-std::vector<component::EntityId> BulletEngine::getEntityCollisions(component::EntityId eid) {
-    std::vector<component::EntityId> result;
-    if (_collisions.find(eid) != _collisions.end())
-        for (auto [other, data] : _collisions[eid])
-            result.push_back(other);
-    return result;
+    _solverPool.reset();
+    btSetTaskScheduler(btGetSequentialTaskScheduler());
 }
 
 std::vector<RayCastHit> BulletEngine::rayCast(vec3 begin, vec3 end, bool onlyFirst) {
@@ -305,8 +336,201 @@ std::vector<RayCastHit> BulletEngine::rayCast(vec3 begin, vec3 end, bool onlyFir
     return result;
 }
 
-bool BulletEngine::areColliding(component::EntityId eid0, component::EntityId eid1) {
-    return _collisions.find(eid0) != _collisions.end() && _collisions[eid0].find(eid1) != _collisions[eid0].end();
+// Write all hits to a span, stop when the span is full
+class SpanRayResultCallback : public btCollisionWorld::RayResultCallback {
+  public:
+    SpanRayResultCallback(Span<RayCastHit> hits, float rayLength) : _hits(hits), _rayLength(rayLength) {}
+
+    bool needsCollision(btBroadphaseProxy* proxy0) const override { return numHits < _hits.size() && RayResultCallback::needsCollision(proxy0); }
+
+    btScalar addSingleResult(btCollisionWorld::LocalRayResult& rayResult, bool normalInWorldSpace) override {
+        m_collisionObject = rayResult.m_collisionObject;
+        RayCastHit& hit = _hits[numHits++];
+        hit.entity = BT_USRPTR_TO_EID(rayResult.m_collisionObject->getUserPointer());
+        hit.distance = rayResult.m_hitFraction * _rayLength;
+        btVector3 normal = normalInWorldSpace ? rayResult.m_hitNormalLocal
+                                              : rayResult.m_collisionObject->getWorldTransform().getBasis() * rayResult.m_hitNormalLocal;
+        hit.normal = btToAtta(normal);
+        return m_closestHitFraction; // Keep the full ray length to report all hits
+    }
+
+    size_t numHits = 0;
+
+  private:
+    Span<RayCastHit> _hits;
+    float _rayLength;
+};
+
+size_t BulletEngine::rayCast(vec3 begin, vec3 end, Span<RayCastHit> hits, bool onlyFirst) {
+    if (hits.empty())
+        return 0;
+    btVector3 btBegin = attaToBt(begin);
+    btVector3 btEnd = attaToBt(end);
+
+    if (onlyFirst) {
+        btCollisionWorld::ClosestRayResultCallback rayCallback(btBegin, btEnd);
+        _world->rayTest(btBegin, btEnd, rayCallback);
+        if (!rayCallback.hasHit())
+            return 0;
+        hits[0].entity = BT_USRPTR_TO_EID(rayCallback.m_collisionObject->getUserPointer());
+        hits[0].distance = rayCallback.m_closestHitFraction * length(end - begin);
+        hits[0].normal = btToAtta(rayCallback.m_hitNormalWorld);
+        return 1;
+    } else {
+        SpanRayResultCallback rayCallback(hits, length(end - begin));
+        _world->rayTest(btBegin, btEnd, rayCallback);
+        return rayCallback.numHits;
+    }
+}
+
+// Append the entities found by the broadphase whose collider bounding box passes the test, each entity is added once
+template <typename Test>
+class OverlapAabbCallback : public btBroadphaseAabbCallback {
+  public:
+    OverlapAabbCallback(Test test, std::vector<component::EntityId>& entities) : _test(test), _entities(entities), _first(entities.size()) {}
+
+    bool process(const btBroadphaseProxy* proxy) override {
+        // The broadphase bounds are enlarged by the contact threshold, the collider bounds are tested again
+        const btCollisionObject* obj = static_cast<const btCollisionObject*>(proxy->m_clientObject);
+        btVector3 aabbMin, aabbMax;
+        obj->getCollisionShape()->getAabb(obj->getWorldTransform(), aabbMin, aabbMax);
+        if (_test(btToAtta(aabbMin), btToAtta(aabbMax))) {
+            component::EntityId eid = BT_USRPTR_TO_EID(obj->getUserPointer());
+            if (std::find(_entities.begin() + _first, _entities.end(), eid) == _entities.end())
+                _entities.push_back(eid);
+        }
+        return true;
+    }
+
+  private:
+    Test _test;
+    std::vector<component::EntityId>& _entities;
+    size_t _first;
+};
+
+void BulletEngine::overlapAabb(vec3 lower, vec3 upper, std::vector<component::EntityId>& entities) {
+    auto overlaps = [lower, upper](vec3 aabbMin, vec3 aabbMax) {
+        return aabbMin.x <= upper.x && aabbMax.x >= lower.x && aabbMin.y <= upper.y && aabbMax.y >= lower.y && aabbMin.z <= upper.z &&
+               aabbMax.z >= lower.z;
+    };
+    OverlapAabbCallback callback(overlaps, entities);
+    _world->getBroadphase()->aabbTest(attaToBt(lower), attaToBt(upper), callback);
+}
+
+void BulletEngine::overlapSphere(vec3 center, float radius, std::vector<component::EntityId>& entities) {
+    auto overlaps = [center, radius](vec3 aabbMin, vec3 aabbMax) {
+        // Distance from the sphere center to the box
+        vec3 closest = max(aabbMin, min(center, aabbMax));
+        return (closest - center).squareLength() <= radius * radius;
+    };
+    OverlapAabbCallback callback(overlaps, entities);
+    _world->getBroadphase()->aabbTest(attaToBt(center - vec3(radius)), attaToBt(center + vec3(radius)), callback);
+}
+
+// Append the closest hit of each entity swept by the shape
+class AllHitsConvexResultCallback : public btCollisionWorld::ConvexResultCallback {
+  public:
+    AllHitsConvexResultCallback(std::vector<RayCastHit>& hits, float sweepLength) : _hits(hits), _first(hits.size()), _sweepLength(sweepLength) {}
+
+    btScalar addSingleResult(btCollisionWorld::LocalConvexResult& convexResult, bool normalInWorldSpace) override {
+        RayCastHit hit{};
+        hit.entity = BT_USRPTR_TO_EID(convexResult.m_hitCollisionObject->getUserPointer());
+        hit.distance = convexResult.m_hitFraction * _sweepLength;
+        btVector3 normal = normalInWorldSpace ? convexResult.m_hitNormalLocal
+                                              : convexResult.m_hitCollisionObject->getWorldTransform().getBasis() * convexResult.m_hitNormalLocal;
+        hit.normal = btToAtta(normal);
+        for (auto it = _hits.begin() + _first; it != _hits.end(); it++)
+            if (it->entity == hit.entity) {
+                if (hit.distance < it->distance)
+                    *it = hit;
+                return m_closestHitFraction;
+            }
+        _hits.push_back(hit);
+        return m_closestHitFraction; // Keep the full sweep to report all hits
+    }
+
+  private:
+    std::vector<RayCastHit>& _hits;
+    size_t _first;
+    float _sweepLength;
+};
+
+void BulletEngine::sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst, std::vector<RayCastHit>& hits) {
+    btSphereShape sphere(radius);
+    btTransform from(btQuaternion::getIdentity(), attaToBt(begin));
+    btTransform to(btQuaternion::getIdentity(), attaToBt(end));
+
+    if (onlyFirst) {
+        btCollisionWorld::ClosestConvexResultCallback callback(from.getOrigin(), to.getOrigin());
+        _world->convexSweepTest(&sphere, from, to, callback);
+        if (!callback.hasHit())
+            return;
+        RayCastHit hit{};
+        hit.entity = BT_USRPTR_TO_EID(callback.m_hitCollisionObject->getUserPointer());
+        hit.distance = callback.m_closestHitFraction * length(end - begin);
+        hit.normal = btToAtta(callback.m_hitNormalWorld);
+        hits.push_back(hit);
+    } else {
+        size_t first = hits.size();
+        AllHitsConvexResultCallback callback(hits, length(end - begin));
+        _world->convexSweepTest(&sphere, from, to, callback);
+        sortHits(hits, first, false);
+    }
+}
+
+struct BulletBodyState {
+    component::EntityId entity;
+    btTransform transform;
+    btVector3 linearVelocity;
+    btVector3 angularVelocity;
+    int activationState;
+};
+
+void BulletEngine::saveState(std::vector<uint8_t>& state) {
+    state.resize(_world->getNumCollisionObjects() * sizeof(BulletBodyState));
+    BulletBodyState* bodyStates = reinterpret_cast<BulletBodyState*>(state.data());
+    for (int i = 0; i < _world->getNumCollisionObjects(); i++) {
+        btCollisionObject* obj = _world->getCollisionObjectArray()[i];
+        btRigidBody* body = btRigidBody::upcast(obj);
+        BulletBodyState& s = bodyStates[i];
+        s.entity = BT_USRPTR_TO_EID(obj->getUserPointer());
+        s.transform = obj->getWorldTransform();
+        s.linearVelocity = body ? body->getLinearVelocity() : btVector3(0, 0, 0);
+        s.angularVelocity = body ? body->getAngularVelocity() : btVector3(0, 0, 0);
+        s.activationState = obj->getActivationState();
+    }
+}
+
+void BulletEngine::restoreState(const std::vector<uint8_t>& state) {
+    // Bodies are found by entity because the collision object array may have changed
+    std::unordered_map<component::EntityId, btCollisionObject*> objects;
+    for (int i = 0; i < _world->getNumCollisionObjects(); i++) {
+        btCollisionObject* obj = _world->getCollisionObjectArray()[i];
+        objects[BT_USRPTR_TO_EID(obj->getUserPointer())] = obj;
+    }
+
+    const BulletBodyState* bodyStates = reinterpret_cast<const BulletBodyState*>(state.data());
+    for (size_t i = 0; i < state.size() / sizeof(BulletBodyState); i++) {
+        const BulletBodyState& s = bodyStates[i];
+        auto it = objects.find(s.entity);
+        if (it == objects.end())
+            continue;
+        btCollisionObject* obj = it->second;
+        obj->setWorldTransform(s.transform);
+        obj->forceActivationState(s.activationState);
+        btRigidBody* body = btRigidBody::upcast(obj);
+        if (body) {
+            if (body->getMotionState())
+                body->getMotionState()->setWorldTransform(s.transform);
+            body->setInterpolationWorldTransform(s.transform);
+            body->setLinearVelocity(s.linearVelocity);
+            body->setAngularVelocity(s.angularVelocity);
+            body->clearForces();
+        }
+        // Remove cached contact points, they are not valid anymore
+        if (obj->getBroadphaseHandle())
+            _world->getBroadphase()->getOverlappingPairCache()->cleanProxyFromPairs(obj->getBroadphaseHandle(), _world->getDispatcher());
+    }
 }
 
 void BulletEngine::updateGravity() {
@@ -327,6 +551,10 @@ unsigned BulletEngine::getNumSubSteps() const { return _numSubSteps; }
 void BulletEngine::setNumSubSteps(unsigned numSubSteps) { _numSubSteps = numSubSteps; }
 bool BulletEngine::getShowAabb() const { return _showAabb; }
 void BulletEngine::setShowAabb(bool showAabb) { _showAabb = showAabb; }
+bool BulletEngine::getMultithreaded() const { return _multithreaded; }
+void BulletEngine::setMultithreaded(bool multithreaded) { _multithreaded = multithreaded; }
+unsigned BulletEngine::getNumThreads() const { return _numThreads; }
+void BulletEngine::setNumThreads(unsigned numThreads) { _numThreads = numThreads; }
 
 btRigidBody* BulletEngine::getBulletRigidBody(component::EntityId entity) {
     if (!_running)
@@ -348,9 +576,6 @@ bnd3 BulletEngine::getAabb(component::EntityId entity) {
     return {};
 }
 
-const std::unordered_map<component::EntityId, std::unordered_map<component::EntityId, btPersistentManifold*>>& BulletEngine::getCollisions() {
-    return _collisions;
-}
 
 //----------------------------------------------//
 //----------------- RIGID BODY -----------------//
@@ -358,9 +583,6 @@ const std::unordered_map<component::EntityId, std::unordered_map<component::Enti
 void BulletEngine::createRigidBody(component::EntityId entity) {
     auto t = component::getComponent<component::Transform>(entity);
     auto rb = component::getComponent<component::RigidBody>(entity);
-    auto box = component::getComponent<component::BoxCollider>(entity);
-    auto sphere = component::getComponent<component::SphereCollider>(entity);
-    auto cylinder = component::getComponent<component::CylinderCollider>(entity);
 
     if (!rb)
         return;
@@ -370,16 +592,6 @@ void BulletEngine::createRigidBody(component::EntityId entity) {
         return;
     }
 
-    if (rb && !(box || sphere || cylinder)) {
-        LOG_WARN("physics::BulletEngine", "Entity [w]$0[] is a rigid body but does not have any collider component", entity);
-        return;
-    }
-
-    if (int(box != nullptr) + int(sphere != nullptr) + int(cylinder != nullptr) > 1) {
-        LOG_WARN("physics::BulletEngine", "Entity [w]$0[] must have only one collider", entity);
-        return;
-    }
-
     component::Transform worldT = t->getWorldTransform(entity);
     vec3 position = worldT.position;
     vec3 scale = worldT.scale;
@@ -389,16 +601,9 @@ void BulletEngine::createRigidBody(component::EntityId entity) {
     btTransform bodyTransform(attaToBt(orientation), attaToBt(position));
 
     // Create collision shape
-    btCollisionShape* colShape = nullptr;
-    if (box)
-        colShape = new btBoxShape(btVector3(scale.x * box->size.x / 2.0f, scale.y * box->size.y / 2.0f, scale.z * box->size.z / 2.0f));
-    else if (sphere)
-        colShape = new btSphereShape(btScalar(std::max(std::max(scale.x, scale.y), scale.z) * sphere->radius));
-    else if (cylinder)
-        colShape = new btCylinderShape(btVector3(scale.x * cylinder->radius, scale.y * cylinder->radius, scale.z * cylinder->height * 0.5f));
-    colShape->setUserPointer(reinterpret_cast<uint8_t*>(entity));
-
-    _collisionShapes.push_back(colShape);
+    btCollisionShape* colShape = createCollisionShape(entity, scale, rb->type == component::RigidBody::DYNAMIC);
+    if (!colShape)
+        return;
 
     // Calculate mass and inertia
     btScalar mass = rb->mass;
@@ -409,7 +614,7 @@ void BulletEngine::createRigidBody(component::EntityId entity) {
         mass = 0.0f;
 
     // Create rigid body
-    btDefaultMotionState* motionState = new btDefaultMotionState(bodyTransform);
+    SyncedMotionState* motionState = new SyncedMotionState(bodyTransform, this, _syncedBodies.size());
     btRigidBody::btRigidBodyConstructionInfo rbInfo(mass, motionState, colShape, localInertia);
     rbInfo.m_linearDamping = rb->linearDamping;
     rbInfo.m_angularDamping = rb->angularDamping;
@@ -430,6 +635,155 @@ void BulletEngine::createRigidBody(component::EntityId entity) {
     _bodyToEntity[body] = entity;
     _componentToEntity[rb] = entity;
     _entityToBody[entity] = body;
+    _syncedIndices[entity] = _syncedBodies.size();
+    _syncedBodies.push_back({body, rb, btToAtta(body->getLinearVelocity()), btToAtta(body->getAngularVelocity()), rb->mass, rb->linearDamping,
+                             rb->angularDamping, true, false, SyncedTransform(entity, t, _syncedParents)});
+    // Bodies are written to the components at least once
+    listAwake(_syncedBodies.size() - 1);
+}
+
+btCollisionShape* BulletEngine::createCollisionShape(component::EntityId entity, vec3 scale, bool dynamic) {
+    auto box = component::getComponent<component::BoxCollider>(entity);
+    auto sphere = component::getComponent<component::SphereCollider>(entity);
+    auto cylinder = component::getComponent<component::CylinderCollider>(entity);
+    auto mesh = component::getComponent<component::MeshCollider>(entity);
+
+    if (!(box || sphere || cylinder || mesh)) {
+        LOG_WARN("physics::BulletEngine", "Entity [w]$0[] is a rigid body but does not have any collider component", entity);
+        return nullptr;
+    }
+
+    // Shared shape of each collider and its offset
+    std::vector<std::pair<btCollisionShape*, vec3>> children;
+    if (box)
+        children.push_back({getShape(ShapeKey::BOX, scale * box->size * 0.5f), box->offset});
+    if (sphere)
+        children.push_back({getShape(ShapeKey::SPHERE, vec3(std::max(std::max(scale.x, scale.y), scale.z) * sphere->radius, 0.0f, 0.0f)),
+                            sphere->offset});
+    if (cylinder)
+        children.push_back({getShape(ShapeKey::CYLINDER, vec3(scale.x * cylinder->radius, scale.y * cylinder->radius, scale.z * cylinder->height * 0.5f)),
+                            cylinder->offset});
+    if (mesh) {
+        ShapeKey::Type type = ShapeKey::CONVEX_HULL;
+        if (mesh->type == component::MeshCollider::TRIANGLE_MESH) {
+            if (dynamic)
+                LOG_WARN("physics::BulletEngine", "Entity [w]$0[] is a dynamic rigid body, its triangle mesh collider will be a convex hull", entity);
+            else
+                type = ShapeKey::SCALED_TRIANGLE_MESH;
+        }
+        btCollisionShape* shape = getShape(type, scale, mesh->sid);
+        if (shape)
+            children.push_back({shape, mesh->offset});
+    }
+    if (children.empty())
+        return nullptr;
+
+    // One collider without offset, use the shared shape directly
+    if (children.size() == 1 && children[0].second == vec3(0.0f))
+        return children[0].first;
+
+    // Multiple colliders are combined in a compound shape, the child shapes are still shared
+    btCompoundShape* compound = new btCompoundShape(false, children.size());
+    for (auto [shape, offset] : children)
+        compound->addChildShape(btTransform(btQuaternion::getIdentity(), attaToBt(offset)), shape);
+    _compoundShapes.push_back(compound);
+    return compound;
+}
+
+bool BulletEngine::ShapeKey::operator==(const ShapeKey& other) const {
+    return type == other.type && mesh == other.mesh && dims[0] == other.dims[0] && dims[1] == other.dims[1] && dims[2] == other.dims[2];
+}
+
+size_t BulletEngine::ShapeKeyHash::operator()(const ShapeKey& key) const {
+    size_t hash = std::hash<uint32_t>()(key.type);
+    auto combine = [&hash](size_t h) { hash ^= h + 0x9e3779b9 + (hash << 6) + (hash >> 2); };
+    combine(std::hash<StringHash>()(key.mesh));
+    for (int32_t d : key.dims)
+        combine(std::hash<int32_t>()(d));
+    return hash;
+}
+
+btCollisionShape* BulletEngine::getShape(ShapeKey::Type type, vec3 dims, StringId mesh) {
+    ShapeKey key{type, mesh.getId(), {}};
+    for (int i = 0; i < 3; i++)
+        key.dims[i] = int32_t(std::round(dims[i] / SHAPE_QUANTUM));
+
+    auto it = _shapeCache.find(key);
+    if (it != _shapeCache.end())
+        return it->second;
+
+    btCollisionShape* shape = nullptr;
+    switch (type) {
+        case ShapeKey::BOX:
+            shape = new btBoxShape(attaToBt(dims));
+            break;
+        case ShapeKey::SPHERE:
+            shape = new btSphereShape(btScalar(dims.x));
+            break;
+        case ShapeKey::CYLINDER:
+            shape = new btCylinderShape(attaToBt(dims));
+            break;
+        case ShapeKey::CONVEX_HULL:
+        case ShapeKey::TRIANGLE_MESH:
+            shape = createMeshShape(type, dims, mesh);
+            break;
+        case ShapeKey::SCALED_TRIANGLE_MESH: {
+            // The BVH is built once per mesh and shared by all scales
+            btCollisionShape* bvh = getShape(ShapeKey::TRIANGLE_MESH, vec3(1.0f), mesh);
+            if (bvh)
+                shape = new btScaledBvhTriangleMeshShape(static_cast<btBvhTriangleMeshShape*>(bvh), attaToBt(dims));
+            break;
+        }
+    }
+
+    // Cache failed mesh shapes as well, so the warning is shown only once
+    _shapeCache[key] = shape;
+    return shape;
+}
+
+btCollisionShape* BulletEngine::createMeshShape(ShapeKey::Type type, vec3 scale, StringId mesh) {
+    resource::Mesh* m = resource::get<resource::Mesh>(mesh.getString());
+    int positionOffset = m ? resource::MeshOptimizer::getPositionOffset(m->getVertexLayout()) : -1;
+    if (!m || m->getVertices().empty() || positionOffset == -1) {
+        LOG_WARN("physics::BulletEngine", "Could not create mesh collider from [w]$0[], mesh is not loaded or has no vertex positions", mesh);
+        return nullptr;
+    }
+
+    const std::vector<uint8_t>& vertices = m->getVertices();
+    size_t vertexSize = resource::MeshOptimizer::getVertexSize(m->getVertexLayout());
+    size_t numVertices = vertices.size() / vertexSize;
+    auto getPosition = [&](size_t i) {
+        vec3 p;
+        std::memcpy(&p, vertices.data() + i * vertexSize + positionOffset, sizeof(vec3));
+        return p;
+    };
+
+    if (type == ShapeKey::CONVEX_HULL) {
+        btConvexHullShape* hull = new btConvexHullShape();
+        for (size_t i = 0; i < numVertices; i++)
+            hull->addPoint(attaToBt(getPosition(i) * scale), false);
+        hull->optimizeConvexHull(); // Keep only the hull vertices
+        hull->recalcLocalAabb();
+        return hull;
+    }
+
+    // Triangle mesh (unscaled, scale is applied by btScaledBvhTriangleMeshShape)
+    if (m->getIndices().size() < 3) {
+        LOG_WARN("physics::BulletEngine", "Could not create triangle mesh collider from [w]$0[], mesh has no triangles", mesh);
+        return nullptr;
+    }
+    TriangleMesh& tri = _triangleMeshes[mesh.getId()];
+    tri.vertices.resize(numVertices * 3);
+    for (size_t i = 0; i < numVertices; i++) {
+        vec3 p = getPosition(i);
+        tri.vertices[i * 3 + 0] = p.x;
+        tri.vertices[i * 3 + 1] = p.y;
+        tri.vertices[i * 3 + 2] = p.z;
+    }
+    tri.indices.assign(m->getIndices().begin(), m->getIndices().end());
+    tri.array = std::make_shared<btTriangleIndexVertexArray>(int(tri.indices.size() / 3), tri.indices.data(), int(3 * sizeof(int)), int(numVertices),
+                                                             tri.vertices.data(), int(3 * sizeof(btScalar)));
+    return new btBvhTriangleMeshShape(tri.array.get(), true);
 }
 
 void BulletEngine::applyForce(component::RigidBody* rb, vec3 force, vec3 point) {
@@ -620,24 +974,23 @@ void BulletEngine::createRigidJoint(component::RigidJoint* rigid) {
 //----------------------------------------------//
 //----------------- COLLLISION -----------------//
 //----------------------------------------------//
-void BulletEngine::collisionStarted(btPersistentManifold* const& manifold) {
-    auto bullet = physics::getEngine<BulletEngine>();
-    const btCollisionObject* obA = manifold->getBody0();
-    const btCollisionObject* obB = manifold->getBody1();
-    component::EntityId eidA = BT_USRPTR_TO_EID(obA->getUserPointer());
-    component::EntityId eidB = BT_USRPTR_TO_EID(obB->getUserPointer());
-    bullet->_collisions[eidA][eidB] = manifold;
-    bullet->_collisions[eidB][eidA] = manifold;
-}
-
-void BulletEngine::collisionEnded(btPersistentManifold* const& manifold) {
-    auto bullet = physics::getEngine<BulletEngine>();
-    const btCollisionObject* obA = manifold->getBody0();
-    const btCollisionObject* obB = manifold->getBody1();
-    component::EntityId eidA = BT_USRPTR_TO_EID(obA->getUserPointer());
-    component::EntityId eidB = BT_USRPTR_TO_EID(obB->getUserPointer());
-    bullet->_collisions[eidA].erase(eidB);
-    bullet->_collisions[eidB].erase(eidA);
+void BulletEngine::updateContacts() {
+    // Manifolds with points are the touching pairs of the last step
+    _contacts.clear();
+    for (int i = 0; i < _dispatcher->getNumManifolds(); i++) {
+        const btPersistentManifold* manifold = _dispatcher->getManifoldByIndexInternal(i);
+        if (manifold->getNumContacts() == 0)
+            continue;
+        component::EntityId eidA = BT_USRPTR_TO_EID(manifold->getBody0()->getUserPointer());
+        component::EntityId eidB = BT_USRPTR_TO_EID(manifold->getBody1()->getUserPointer());
+        for (int j = 0; j < manifold->getNumContacts(); j++) {
+            const btManifoldPoint& point = manifold->getContactPoint(j);
+            // Bullet normal points from B to A
+            vec3 position = (btToAtta(point.getPositionWorldOnA()) + btToAtta(point.getPositionWorldOnB())) * 0.5f;
+            _contacts.add(eidA, eidB, position, -btToAtta(point.m_normalWorldOnB), point.getAppliedImpulse());
+        }
+    }
+    _contacts.build();
 }
 
 void BulletEngine::wakeUpEntity(component::EntityId entity) {
@@ -654,4 +1007,22 @@ void BulletEngine::wakeUpEntity(component::EntityId entity) {
                 _entityToBody[other]->activate();
 }
 
+void BulletEngine::listAwake(size_t index) {
+    SyncedBody& s = _syncedBodies[index];
+    if (!s.listed && s.body->isActive() && !s.body->isStaticObject()) {
+        s.listed = true;
+        _awakeBodies.push_back(index);
+    }
+}
+
+BulletEngine::SyncedMotionState::SyncedMotionState(const btTransform& transform, BulletEngine* engine, size_t index)
+    : _transform(transform), _engine(engine), _index(index) {}
+
+void BulletEngine::SyncedMotionState::getWorldTransform(btTransform& transform) const { transform = _transform; }
+
+void BulletEngine::SyncedMotionState::setWorldTransform(const btTransform& transform) {
+    _transform = transform;
+    _engine->_movedBodies[btGetCurrentThreadIndex()].push_back(_index);
+}
+
 } // namespace atta::physics
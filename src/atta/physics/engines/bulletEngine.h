@@ -2,12 +2,18 @@
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #pragma once
 
+#include "BulletCollision/CollisionDispatch/btCollisionDispatcherMt.h"
+#include "BulletDynamics/ConstraintSolver/btSequentialImpulseConstraintSolverMt.h"
+#include "BulletDynamics/Dynamics/btDiscreteDynamicsWorldMt.h"
 #include "btBulletDynamicsCommon.h"
 #include <atta/component/components/prismaticJoint.h>
 #include <atta/component/components/revoluteJoint.h>
 #include <atta/component/components/rigidBody.h>
 #include <atta/component/components/rigidJoint.h>
+#include <atta/physics/changedBodies.h>
+#include <atta/physics/engines/bulletTaskScheduler.h>
 #include <atta/physics/engines/engine.h>
+#include <atta/physics/syncedTransform.h>
 
 namespace atta::physics {
 
@@ -20,11 +26,16 @@ class BulletEngine : public Engine {
     void step(float dt) override;
     void stop() override;
 
-    std::vector<component::EntityId> getEntityCollisions(component::EntityId eid) override;
     std::vector<RayCastHit> rayCast(vec3 begin, vec3 end, bool onlyFirst) override;
-    bool areColliding(component::EntityId eid0, component::EntityId eid1) override;
+    size_t rayCast(vec3 begin, vec3 end, Span<RayCastHit> hits, bool onlyFirst) override;
+    /// The overlap queries test the collider bounding boxes found by the broadphase, the narrowphase is not used
+    void overlapAabb(vec3 lower, vec3 upper, std::vector<component::EntityId>& entities) override;
+    void overlapSphere(vec3 center, float radius, std::vector<component::EntityId>& entities) override;
+    void sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst, std::vector<RayCastHit>& hits) override;
 
     void updateGravity() override;
+    void saveState(std::vector<uint8_t>& state) override;
+    void restoreState(const std::vector<uint8_t>& state) override;
 
     // component::RigidBody interface
     void applyForce(component::RigidBody* rb, vec3 force, vec3 point);
@@ -36,22 +47,73 @@ class BulletEngine : public Engine {
     void setNumSubSteps(unsigned numSubSteps);
     bool getShowAabb() const;
     void setShowAabb(bool showAabb);
+    /// Multithreaded dynamics world (collision detection, constraint solving, and integration in parallel)
+    /** Takes effect when the simulation starts **/
+    bool getMultithreaded() const;
+    void setMultithreaded(bool multithreaded);
+    unsigned getNumThreads() const; ///< Number of threads used by the multithreaded world and the parallel queries, 0 uses all hardware threads
+    void setNumThreads(unsigned numThreads);
     btRigidBody* getBulletRigidBody(component::EntityId entity);
     bnd3 getAabb(component::EntityId entity);
-    const std::unordered_map<component::EntityId, std::unordered_map<component::EntityId, btPersistentManifold*>>& getCollisions();
+
+  protected:
+    bool isRayCastThreadSafe() const override { return true; }
 
   private:
     void createRigidBody(component::EntityId entity) override;
+    btCollisionShape* createCollisionShape(component::EntityId entity, vec3 scale, bool dynamic);
     void createPrismaticJoint(component::PrismaticJoint* prismatic);
     void createRevoluteJoint(component::RevoluteJoint* revolute);
     void createRigidJoint(component::RigidJoint* rigid);
 
-    static void collisionStarted(btPersistentManifold* const& manifold);
-    static void collisionEnded(btPersistentManifold* const& manifold);
+    /// Rebuild the contact list from the manifolds of the dispatcher
+    void updateContacts();
 
     void wakeUpEntity(component::EntityId entity);
+    /// Add the synced body to the awake bodies if it is active and not listed yet
+    void listAwake(size_t index);
+
+    /// Motion state that reports the bodies moved by Bullet
+    /** Bullet only synchronizes the motion states of the active bodies. The multithreaded world synchronizes them in
+     * parallel, so each thread reports to its own list
+     **/
+    class SyncedMotionState final : public btMotionState {
+      public:
+        SyncedMotionState(const btTransform& transform, BulletEngine* engine, size_t index);
+        void getWorldTransform(btTransform& transform) const override;
+        void setWorldTransform(const btTransform& transform) override;
+
+      private:
+        btTransform _transform;
+        BulletEngine* _engine;
+        size_t _index; ///< Index in _syncedBodies
+    };
+
+    /// Key used to share collision shapes between entities with the same collider (e.g. clones)
+    struct ShapeKey {
+        enum Type : uint32_t { BOX = 0, SPHERE, CYLINDER, CONVEX_HULL, TRIANGLE_MESH, SCALED_TRIANGLE_MESH };
+        Type type;
+        StringHash mesh; ///< Mesh sid for mesh colliders
+        int32_t dims[3]; ///< Quantized dimensions (half extents, radius, or scale for mesh colliders)
+        bool operator==(const ShapeKey& other) const;
+    };
+    struct ShapeKeyHash {
+        size_t operator()(const ShapeKey& key) const;
+    };
+    /// Triangles referenced by the bullet triangle mesh shape
+    struct TriangleMesh {
+        std::vector<btScalar> vertices;
+        std::vector<int> indices;
+        std::shared_ptr<btTriangleIndexVertexArray> array;
+    };
+
+    /// Get shape from the cache, the shape is created if it does not exist yet
+    btCollisionShape* getShape(ShapeKey::Type type, vec3 dims, StringId mesh = {});
+    btCollisionShape* createMeshShape(ShapeKey::Type type, vec3 scale, StringId mesh);
 
     unsigned _numSubSteps; ///< Number of physics sub steps for each simulation step
+    bool _multithreaded;
+    unsigned _numThreads;
 
     // World configutation
     std::shared_ptr<btDiscreteDynamicsWorld> _world;
@@ -59,15 +121,38 @@ class BulletEngine : public Engine {
     std::shared_ptr<btBroadphaseInterface> _broadPhase;
     std::shared_ptr<btCollisionDispatcher> _dispatcher;
     std::shared_ptr<btDefaultCollisionConfiguration> _collisionConfiguration;
-    btAlignedObjectArray<btCollisionShape*> _collisionShapes;
+    std::shared_ptr<btConstraintSolverPoolMt> _solverPool;                     ///< Only used by the multithreaded world
+    std::shared_ptr<BulletTaskScheduler> _taskScheduler;                       ///< Kept between simulations to reuse the worker threads
+    std::unordered_map<ShapeKey, btCollisionShape*, ShapeKeyHash> _shapeCache; ///< Shapes shared between entities
+    std::unordered_map<StringHash, TriangleMesh> _triangleMeshes;
+    btAlignedObjectArray<btCompoundShape*> _compoundShapes; ///< Entities with multiple colliders or collider offset
 
     // World data
     std::unordered_map<component::EntityId, btRigidBody*> _entityToBody;
     std::unordered_map<btRigidBody*, component::EntityId> _bodyToEntity;
     std::unordered_map<component::RigidBody*, component::EntityId> _componentToEntity;
-    std::unordered_map<component::EntityId, std::unordered_map<component::EntityId, btPersistentManifold*>> _collisions;
     std::unordered_map<component::EntityId, std::vector<component::EntityId>> _connectedEntities; ///< Which entities are connect by joints
 
+    /// Body and the component values after the last sync, used to only sync updated and active bodies
+    struct SyncedBody {
+        btRigidBody* body;
+        component::RigidBody* rigidBody;
+        vec3 linearVelocity;
+        vec3 angularVelocity;
+        float mass;
+        float linearDamping;
+        float angularDamping;
+        bool awake;
+        bool listed; ///< If the body is in _awakeBodies
+        SyncedTransform transform;
+    };
+    std::vector<SyncedBody> _syncedBodies;
+    std::unordered_map<component::EntityId, size_t> _syncedIndices; ///< Index of each entity in _syncedBodies
+    std::vector<size_t> _awakeBodies;                               ///< Index of the bodies that were active in the last step
+    std::vector<std::vector<size_t>> _movedBodies;                  ///< Index of the bodies moved by Bullet in the current step, one list per thread
+    SyncedTransform::Parents _syncedParents;
+    ChangedBodies _changedBodies; ///< Entities to sync in the next step
+
     /// Show broad phase aabb
     bool _showAabb;
 };
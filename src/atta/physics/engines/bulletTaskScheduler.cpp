@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/physics/engines/bulletTaskScheduler.h>
+
+namespace atta::physics {
+
+BulletTaskScheduler::BulletTaskScheduler(int numThreads) : btITaskScheduler("atta"), _pool(std::make_shared<WorkerPool>(1)) {
+    setNumThreads(numThreads);
+}
+
+int BulletTaskScheduler::getMaxNumThreads() const { return BT_MAX_THREAD_COUNT; }
+
+int BulletTaskScheduler::getNumThreads() const { return _pool->getNumThreads(); }
+
+void BulletTaskScheduler::setNumThreads(int numThreads) {
+    if (numThreads <= 0)
+        numThreads = int(std::thread::hardware_concurrency());
+    numThreads = std::max(1, std::min(numThreads, getMaxNumThreads()));
+    if (numThreads == getNumThreads())
+        return;
+
+    // The old workers were joined, the new workers get their indices from 1 again (the counter would overflow otherwise)
+    _pool->setNumThreads(numThreads);
+    btResetThreadIndexCounter();
+}
+
+void BulletTaskScheduler::parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) {
+    _pool->parallelFor(iBegin, iEnd, grainSize, [&body](int begin, int end) { body.forLoop(begin, end); });
+}
+
+btScalar BulletTaskScheduler::parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) {
+    btScalar sum = 0;
+    std::mutex sumMutex;
+    _pool->parallelFor(iBegin, iEnd, grainSize, [&](int begin, int end) {
+        btScalar s = body.sumLoop(begin, end);
+        std::lock_guard<std::mutex> lock(sumMutex);
+        sum += s;
+    });
+    return sum;
+}
+
+} // namespace atta::physics
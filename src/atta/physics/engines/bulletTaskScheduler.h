@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include "LinearMath/btThreads.h"
+#include <atta/physics/workerPool.h>
+
+namespace atta::physics {
+
+/** Bullet task scheduler backed by an atta WorkerPool
+ *
+ * Used by the multithreaded dynamics world to run the parallel parts of each step (narrowphase, island solving,
+ * integration). Bullet gives each thread an index the first time it is used, so the worker pool is also used by the
+ * parallel queries and the index counter is reset when the workers are replaced. The calling thread has index 0 and
+ * the workers have the indices 1 to getNumThreads() - 1
+ **/
+class BulletTaskScheduler final : public btITaskScheduler {
+  public:
+    BulletTaskScheduler(int numThreads = 0); ///< Uses the number of hardware threads if numThreads is 0
+
+    int getMaxNumThreads() const override;
+    int getNumThreads() const override; ///< Workers plus the calling thread
+    void setNumThreads(int numThreads) override;
+    void parallelFor(int iBegin, int iEnd, int grainSize, const btIParallelForBody& body) override;
+    btScalar parallelSum(int iBegin, int iEnd, int grainSize, const btIParallelSumBody& body) override;
+
+    std::shared_ptr<WorkerPool> getWorkerPool() const { return _pool; } ///< Workers that may call bullet
+
+  private:
+    std::shared_ptr<WorkerPool> _pool;
+};
+
+} // namespace atta::physics
@@ -1,5 +1,6 @@
 // SPDX-License-Identifier: MIT
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/transform.h>
 #include <atta/physics/engines/engine.h>
 #include <atta/physics/interface.h>
 
@@ -10,6 +11,7 @@ const std::unordered_map<Engine::Type, std::string> Engine::typeToString = {
     {Engine::NONE, "NONE"},
     {Engine::BOX2D, "BOX2D"},
     {Engine::BULLET, "BULLET"},
+    {Engine::SWARM, "SWARM"},
 };
 
 // Map String to Type
@@ -17,6 +19,7 @@ const std::unordered_map<std::string, Engine::Type> Engine::stringToType = {
     {"NONE", Engine::NONE},
     {"BOX2D", Engine::BOX2D},
     {"BULLET", Engine::BULLET},
+    {"SWARM", Engine::SWARM},
 };
 
 Engine::Engine(Type type) : _type(type), _running(false) {}
@@ -26,8 +29,97 @@ void Engine::deleteRigidBody(component::EntityId entity) {}
 void Engine::createColliders(component::EntityId entity) {}
 void Engine::deleteColliders(component::EntityId entity) {}
 
-std::vector<component::EntityId> Engine::getEntityCollisions(component::EntityId eid) { return {}; }
+std::vector<component::EntityId> Engine::getEntityCollisions(component::EntityId eid) { return _contacts.getEntities(eid); }
 std::vector<RayCastHit> Engine::rayCast(vec3 begin, vec3 end, bool onlyFirst) { return {}; }
-bool Engine::areColliding(component::EntityId eid0, component::EntityId eid1) { return false; }
+size_t Engine::rayCast(vec3 begin, vec3 end, Span<RayCastHit> hits, bool onlyFirst) { return 0; }
+bool Engine::areColliding(component::EntityId eid0, component::EntityId eid1) { return _contacts.areColliding(eid0, eid1); }
+
+void Engine::overlapAabb(vec3 lower, vec3 upper, std::vector<component::EntityId>& entities) {}
+void Engine::overlapSphere(vec3 center, float radius, std::vector<component::EntityId>& entities) {}
+void Engine::sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst, std::vector<RayCastHit>& hits) {}
+
+void Engine::nearest(vec3 point, unsigned k, float maxDistance, std::vector<component::EntityId>& entities) {
+    size_t first = entities.size();
+    overlapSphere(point, maxDistance, entities);
+
+    // Sort candidates by the distance of their world position
+    std::vector<std::pair<float, component::EntityId>> candidates;
+    candidates.reserve(entities.size() - first);
+    for (size_t i = first; i < entities.size(); i++) {
+        vec3 pos = component::Transform::getEntityWorldTransform(entities[i]).position;
+        candidates.push_back({(pos - point).squareLength(), entities[i]});
+    }
+    size_t num = std::min<size_t>(k, candidates.size());
+    std::partial_sort(candidates.begin(), candidates.begin() + num, candidates.end());
+
+    entities.resize(first + num);
+    for (size_t i = 0; i < num; i++)
+        entities[first + i] = candidates[i].second;
+}
+
+void Engine::sortHits(std::vector<RayCastHit>& hits, size_t first, bool onlyFirst) {
+    auto closer = [](const RayCastHit& a, const RayCastHit& b) { return a.distance < b.distance; };
+    if (!onlyFirst)
+        std::sort(hits.begin() + first, hits.end(), closer);
+    else if (hits.size() > first) {
+        std::iter_swap(hits.begin() + first, std::min_element(hits.begin() + first, hits.end(), closer));
+        hits.resize(first + 1);
+    }
+}
+
+void Engine::overlapAabbBatch(Span<const bnd3> boxes, QueryResults& results) {
+    PROFILE();
+    results.clear();
+    for (const bnd3& box : boxes) {
+        overlapAabb(box.pMin, box.pMax, results.entities);
+        results.offsets.push_back(results.entities.size());
+    }
+}
+
+void Engine::overlapSphereBatch(Span<const vec3> centers, float radius, QueryResults& results) {
+    PROFILE();
+    results.clear();
+    for (vec3 center : centers) {
+        overlapSphere(center, radius, results.entities);
+        results.offsets.push_back(results.entities.size());
+    }
+}
+
+void Engine::nearestBatch(Span<const vec3> points, unsigned k, float maxDistance, QueryResults& results) {
+    PROFILE();
+    results.clear();
+    for (vec3 point : points) {
+        nearest(point, k, maxDistance, results.entities);
+        results.offsets.push_back(results.entities.size());
+    }
+}
+
+void Engine::rayCastBatch(Span<const vec3> begins, Span<const vec3> ends, Span<RayCastHit> hits) {
+    PROFILE();
+    DASSERT(begins.size() == ends.size() && begins.size() == hits.size(), "Batched ray cast spans must have the same size");
+    auto castRays = [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            hits[i] = RayCastHit{};
+            rayCast(begins[i], ends[i], hits.subspan(i, 1), true);
+        }
+    };
+
+    if (isRayCastThreadSafe() && hits.size() > size_t(PARALLEL_BATCH_GRAIN)) {
+        if (!_queryPool)
+            _queryPool = physics::getWorkerPool();
+        _queryPool->parallelFor(0, int(hits.size()), PARALLEL_BATCH_GRAIN, castRays);
+    } else
+        castRays(0, int(hits.size()));
+}
+
+void Engine::sphereCastBatch(Span<const vec3> begins, Span<const vec3> ends, float radius, Span<RayCastHit> hits) {
+    PROFILE();
+    DASSERT(begins.size() == ends.size() && begins.size() == hits.size(), "Batched sphere cast spans must have the same size");
+    for (size_t i = 0; i < hits.size(); i++) {
+        _batchHits.clear();
+        sphereCast(begins[i], ends[i], radius, true, _batchHits);
+        hits[i] = _batchHits.empty() ? RayCastHit{} : _batchHits.front();
+    }
+}
 
 } // namespace atta::physics
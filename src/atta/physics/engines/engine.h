@@ -3,15 +3,18 @@
 #pragma once
 
 #include <atta/component/interface.h>
+#include <atta/physics/contactList.h>
+#include <atta/physics/workerPool.h>
 #include <atta/utils/math/math.h>
 
 namespace atta::physics {
 
 class RayCastHit;
+struct QueryResults;
 class Engine {
   public:
     ///< Available physics engines
-    enum Type { NONE = 0, BOX2D, BULLET };
+    enum Type { NONE = 0, BOX2D, BULLET, SWARM };
 
     Engine(Type type);
     virtual ~Engine() = default;
@@ -26,20 +29,59 @@ class Engine {
 
     virtual std::vector<component::EntityId> getEntityCollisions(component::EntityId eid);
     virtual std::vector<RayCastHit> rayCast(vec3 begin, vec3 end, bool onlyFirst = false);
+    virtual size_t rayCast(vec3 begin, vec3 end, Span<RayCastHit> hits, bool onlyFirst = false);
     virtual bool areColliding(component::EntityId eid0, component::EntityId eid1);
 
+    //---------- Queries ----------//
+    // Single queries append the results to the output vector
+    /// Entities with colliders overlapping the box
+    virtual void overlapAabb(vec3 lower, vec3 upper, std::vector<component::EntityId>& entities);
+    /// Entities with colliders overlapping the sphere
+    virtual void overlapSphere(vec3 center, float radius, std::vector<component::EntityId>& entities);
+    /// Sweep a sphere from begin to end, the hits are sorted by the distance traveled by the sphere
+    virtual void sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst, std::vector<RayCastHit>& hits);
+    /// Up to k entities overlapping the sphere of radius maxDistance, sorted by the distance of their origin to the point
+    virtual void nearest(vec3 point, unsigned k, float maxDistance, std::vector<component::EntityId>& entities);
+
+    // Batched queries, the results of query i are results[i]. Engines can override them to amortize the query setup
+    virtual void overlapAabbBatch(Span<const bnd3> boxes, QueryResults& results);
+    virtual void overlapSphereBatch(Span<const vec3> centers, float radius, QueryResults& results);
+    virtual void nearestBatch(Span<const vec3> points, unsigned k, float maxDistance, QueryResults& results);
+    /// Closest hit of each ray, the entity is -1 if the ray did not hit anything
+    /** Runs on worker threads when the engine ray cast is thread safe **/
+    virtual void rayCastBatch(Span<const vec3> begins, Span<const vec3> ends, Span<RayCastHit> hits);
+    /// Closest hit of each sphere sweep, the entity is -1 if the sphere did not hit anything
+    virtual void sphereCastBatch(Span<const vec3> begins, Span<const vec3> ends, float radius, Span<RayCastHit> hits);
+
     /// Physics engine should update the gravity with the new value in Manager::getGravity()
     virtual void updateGravity() {}
 
+    /// Save/restore rigid body state (used by component::Checkpoint)
+    /** Only bodies that still exist when restoring are updated **/
+    virtual void saveState(std::vector<uint8_t>& state) {}
+    virtual void restoreState(const std::vector<uint8_t>& state) {}
+
     Type getType() const { return _type; }
     bool getRunning() const { return _running; }
+    /// Contacts found in the last step
+    const ContactList& getContactList() const { return _contacts; }
 
     static const std::unordered_map<Type, std::string> typeToString;
     static const std::unordered_map<std::string, Type> stringToType;
 
   protected:
-    Type _type;    ///< Physics engine type
-    bool _running; ///< If physics engine is performing simulations
+    static constexpr int PARALLEL_BATCH_GRAIN = 64; ///< Rays per worker chunk in the parallel batched ray cast
+
+    /// Sort the hits appended after first by distance, keeping only the closest one if onlyFirst
+    static void sortHits(std::vector<RayCastHit>& hits, size_t first, bool onlyFirst);
+    /// If the span rayCast can be called from several threads at the same time (read-only world queries)
+    virtual bool isRayCastThreadSafe() const { return false; }
+
+    Type _type;                             ///< Physics engine type
+    bool _running;                          ///< If physics engine is performing simulations
+    ContactList _contacts;                  ///< Rebuilt by the engine after each step
+    std::vector<RayCastHit> _batchHits;     ///< Buffer reused by the batched casts
+    std::shared_ptr<WorkerPool> _queryPool; ///< Set by the first parallel batched query, physics::getWorkerPool by default
 };
 
 } // namespace atta::physics
@@ -1,21 +1,212 @@
 // SPDX-License-Identifier: MIT
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/boxCollider.h>
+#include <atta/component/components/boxCollider2D.h>
+#include <atta/component/components/circleCollider2D.h>
+#include <atta/component/components/cylinderCollider.h>
+#include <atta/component/components/meshCollider.h>
+#include <atta/component/components/polygonCollider2D.h>
+#include <atta/component/components/sphereCollider.h>
+#include <atta/component/components/transform.h>
+#include <atta/event/events/meshDestroy.h>
+#include <atta/event/events/meshLoad.h>
+#include <atta/event/events/meshUpdate.h>
+#include <atta/event/interface.h>
 #include <atta/physics/engines/noneEngine.h>
 #include <atta/physics/interface.h>
+#include <atta/resource/interface.h>
+#include <atta/resource/meshOptimizer.h>
+#include <atta/resource/resources/mesh.h>
 
 namespace atta::physics {
 
-NoneEngine::NoneEngine() : Engine(Engine::NONE) {}
+NoneEngine::NoneEngine() : Engine(Engine::NONE) {
+    event::subscribe<event::MeshLoad>(BIND_EVENT_FUNC(NoneEngine::onMeshChange));
+    event::subscribe<event::MeshUpdate>(BIND_EVENT_FUNC(NoneEngine::onMeshChange));
+    event::subscribe<event::MeshDestroy>(BIND_EVENT_FUNC(NoneEngine::onMeshChange));
+}
 
 NoneEngine::~NoneEngine() {
     if (_running)
         stop();
+    event::unsubscribe<event::MeshLoad>(BIND_EVENT_FUNC(NoneEngine::onMeshChange));
+    event::unsubscribe<event::MeshUpdate>(BIND_EVENT_FUNC(NoneEngine::onMeshChange));
+    event::unsubscribe<event::MeshDestroy>(BIND_EVENT_FUNC(NoneEngine::onMeshChange));
+}
+
+void NoneEngine::start() {
+    _running = true;
+    updateIndex();
+}
+
+void NoneEngine::step(float dt) { updateIndex(); }
+
+void NoneEngine::stop() {
+    _running = false;
+    _index.clear();
+    _index.build();
+    _meshBounds.clear();
+}
+
+/// Bounding box of a box with half size h centered at the offset, in world coordinates
+static bnd3 getBoxAabb(const cmp::Transform& t, vec3 offset, vec3 h) {
+    vec3 center = t.position + t.orientation * (offset * t.scale);
+    h = h * t.scale;
+    vec3 ex = t.orientation * vec3(h.x, 0.0f, 0.0f);
+    vec3 ey = t.orientation * vec3(0.0f, h.y, 0.0f);
+    vec3 ez = t.orientation * vec3(0.0f, 0.0f, h.z);
+    vec3 extent(std::abs(ex.x) + std::abs(ey.x) + std::abs(ez.x), std::abs(ex.y) + std::abs(ey.y) + std::abs(ez.y),
+                 std::abs(ex.z) + std::abs(ey.z) + std::abs(ez.z));
+    return bnd3(center - extent, center + extent);
+}
+
+void NoneEngine::updateIndex() {
+    PROFILE();
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    _index.clear();
+    for (component::EntityId entity : component::getNoPrototypeView()) {
+        if (!cmp::getComponent<cmp::Transform>(entity))
+            continue;
+        cmp::Transform t = cmp::Transform::getEntityWorldTransform(entity);
+        bnd3 aabb;
+        if (auto box = cmp::getComponent<cmp::BoxCollider>(entity))
+            aabb = getBoxAabb(t, box->offset, box->size * 0.5f);
+        else if (auto sphere = cmp::getComponent<cmp::SphereCollider>(entity)) {
+            float r = sphere->radius * std::max(t.scale.x, std::max(t.scale.y, t.scale.z));
+            vec3 center = t.position + t.orientation * (sphere->offset * t.scale);
+            aabb = bnd3(center - vec3(r), center + vec3(r));
+        } else if (auto cylinder = cmp::getComponent<cmp::CylinderCollider>(entity))
+            aabb = getBoxAabb(t, cylinder->offset, vec3(cylinder->radius, cylinder->radius, cylinder->height * 0.5f));
+        else if (auto mesh = cmp::getComponent<cmp::MeshCollider>(entity)) {
+            bnd3 bounds = getMeshBounds(mesh->sid);
+            aabb = getBoxAabb(t, mesh->offset + (bounds.pMin + bounds.pMax) * 0.5f, (bounds.pMax - bounds.pMin) * 0.5f);
+        }
+        else if (auto box2D = cmp::getComponent<cmp::BoxCollider2D>(entity)) {
+            // 2D colliders extend infinitely along z
+            aabb = getBoxAabb(t, vec3(box2D->offset, 0.0f), vec3(box2D->size * 0.5f, 0.0f));
+            aabb.pMin.z = -inf;
+            aabb.pMax.z = inf;
+        } else if (auto circle = cmp::getComponent<cmp::CircleCollider2D>(entity)) {
+            float r = circle->radius * std::max(t.scale.x, t.scale.y);
+            vec3 center = t.position + t.orientation * (vec3(circle->offset, 0.0f) * t.scale);
+            aabb = bnd3(vec3(center.x - r, center.y - r, -inf), vec3(center.x + r, center.y + r, inf));
+        } else if (auto polygon = cmp::getComponent<cmp::PolygonCollider2D>(entity)) {
+            if (polygon->points.empty())
+                continue;
+            aabb = bnd3(vec3(inf), vec3(-inf));
+            for (vec2 p : polygon->points) {
+                vec3 w = t.position + t.orientation * (vec3(p + polygon->offset, 0.0f) * t.scale);
+                aabb.pMin = min(aabb.pMin, w);
+                aabb.pMax = max(aabb.pMax, w);
+            }
+            aabb.pMin.z = -inf;
+            aabb.pMax.z = inf;
+        } else
+            continue;
+        _index.add(entity, aabb);
+    }
+    _index.build();
 }
 
-void NoneEngine::start() { _running = true; }
+bnd3 NoneEngine::getMeshBounds(StringId sid) {
+    auto it = _meshBounds.find(sid.getId());
+    if (it != _meshBounds.end())
+        return it->second;
 
-void NoneEngine::step(float dt) {}
+    bnd3 bounds(vec3(-0.5f), vec3(0.5f));
+    resource::Mesh* mesh = resource::get<resource::Mesh>(sid.getString());
+    int positionOffset = mesh ? resource::MeshOptimizer::getPositionOffset(mesh->getVertexLayout()) : -1;
+    if (mesh && !mesh->getVertices().empty() && positionOffset != -1) {
+        const std::vector<uint8_t>& vertices = mesh->getVertices();
+        size_t vertexSize = resource::MeshOptimizer::getVertexSize(mesh->getVertexLayout());
+        bounds = bnd3(vec3(std::numeric_limits<float>::infinity()), vec3(-std::numeric_limits<float>::infinity()));
+        for (size_t i = 0; i + vertexSize <= vertices.size(); i += vertexSize) {
+            vec3 p;
+            std::memcpy(&p, vertices.data() + i + positionOffset, sizeof(vec3));
+            bounds.pMin = min(bounds.pMin, p);
+            bounds.pMax = max(bounds.pMax, p);
+        }
+    } else
+        LOG_WARN("physics::NoneEngine", "Mesh [w]$0[] is not loaded or has no vertex positions, its collider is assumed to be a unit box", sid);
+    _meshBounds[sid.getId()] = bounds;
+    return bounds;
+}
+
+void NoneEngine::onMeshChange(event::Event& event) {
+    StringId sid;
+    switch (event.getType()) {
+        case event::MeshLoad::type:
+            sid = reinterpret_cast<event::MeshLoad&>(event).sid;
+            break;
+        case event::MeshUpdate::type:
+            sid = reinterpret_cast<event::MeshUpdate&>(event).sid;
+            break;
+        default:
+            sid = reinterpret_cast<event::MeshDestroy&>(event).sid;
+            break;
+    }
+    _meshBounds.erase(sid.getId());
+}
+
+void NoneEngine::overlapAabb(vec3 lower, vec3 upper, std::vector<component::EntityId>& entities) {
+    _items.clear();
+    _index.query(bnd3(lower, upper), _items);
+    for (uint32_t item : _items)
+        entities.push_back(_index.getEntity(item));
+}
 
-void NoneEngine::stop() { _running = false; }
+void NoneEngine::overlapSphere(vec3 center, float radius, std::vector<component::EntityId>& entities) {
+    _items.clear();
+    _index.query(bnd3(center - vec3(radius), center + vec3(radius)), _items);
+    for (uint32_t item : _items) {
+        // Distance from the sphere center to the box
+        const bnd3& aabb = _index.getAabb(item);
+        vec3 closest = max(aabb.pMin, min(center, aabb.pMax));
+        if ((closest - center).squareLength() <= radius * radius)
+            entities.push_back(_index.getEntity(item));
+    }
+}
+
+void NoneEngine::sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst, std::vector<RayCastHit>& hits) {
+    _items.clear();
+    _index.query(bnd3(min(begin, end) - vec3(radius), max(begin, end) + vec3(radius)), _items);
+
+    // Ray against the boxes inflated by the radius
+    vec3 d = end - begin;
+    size_t first = hits.size();
+    for (uint32_t item : _items) {
+        const bnd3& aabb = _index.getAabb(item);
+        float t0 = 0.0f, t1 = 1.0f;
+        int axis = -1;
+        for (int i = 0; i < 3 && t0 <= t1; i++) {
+            float lo = aabb.pMin[i] - radius;
+            float hi = aabb.pMax[i] + radius;
+            if (d[i] == 0.0f) {
+                if (begin[i] < lo || begin[i] > hi)
+                    t0 = 2.0f;
+                continue;
+            }
+            float ta = (lo - begin[i]) / d[i];
+            float tb = (hi - begin[i]) / d[i];
+            if (ta > tb)
+                std::swap(ta, tb);
+            if (ta > t0) {
+                t0 = ta;
+                axis = i;
+            }
+            t1 = std::min(t1, tb);
+        }
+        if (t0 > t1)
+            continue;
+
+        RayCastHit hit;
+        hit.entity = _index.getEntity(item);
+        hit.distance = t0 * d.length();
+        if (axis != -1)
+            hit.normal[axis] = d[axis] > 0.0f ? -1.0f : 1.0f;
+        hits.push_back(hit);
+    }
+    sortHits(hits, first, onlyFirst);
+}
 
 } // namespace atta::physics
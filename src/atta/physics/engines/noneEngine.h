@@ -2,10 +2,14 @@
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #pragma once
 
+#include <atta/event/event.h>
 #include <atta/physics/engines/engine.h>
+#include <atta/physics/spatialIndex.h>
 
 namespace atta::physics {
 
+/// Engine without dynamics
+/** The queries are answered with the bounding boxes of the colliders, rebuilt every step **/
 class NoneEngine : public Engine {
   public:
     NoneEngine();
@@ -14,6 +18,20 @@ class NoneEngine : public Engine {
     void start() override;
     void step(float dt) override;
     void stop() override;
+
+    void overlapAabb(vec3 lower, vec3 upper, std::vector<component::EntityId>& entities) override;
+    void overlapSphere(vec3 center, float radius, std::vector<component::EntityId>& entities) override;
+    void sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst, std::vector<RayCastHit>& hits) override;
+
+  private:
+    void updateIndex();
+    /// Bounding box of the mesh vertices in the mesh space, a unit box if the mesh has no vertex positions
+    bnd3 getMeshBounds(StringId sid);
+    void onMeshChange(event::Event& event);
+
+    SpatialIndex _index;
+    std::vector<uint32_t> _items;                     ///< Buffer reused by the queries
+    std::unordered_map<StringHash, bnd3> _meshBounds; ///< Computed the first time each mesh collider is indexed
 };
 
 } // namespace atta::physics
@@ -0,0 +1,353 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/boxCollider2D.h>
+#include <atta/component/components/circleCollider2D.h>
+#include <atta/component/components/polygonCollider2D.h>
+#include <atta/component/components/relationship.h>
+#include <atta/physics/engines/swarmEngine.h>
+#include <atta/physics/interface.h>
+#include <atta/utils/config.h>
+
+namespace atta::physics {
+
+SwarmEngine::SwarmEngine() : Engine(Engine::SWARM), _numThreads(0), _numIterations(_world.getNumIterations()) {}
+
+SwarmEngine::~SwarmEngine() {
+    if (_running)
+        stop();
+}
+
+void SwarmEngine::start() {
+    PROFILE();
+    _running = true;
+    _world.setGravity(vec2(physics::getGravity()));
+    _world.setNumThreads(_numThreads);
+    _world.setNumIterations(_numIterations);
+
+    for (component::EntityId entity : component::getNoPrototypeView())
+        if (component::getComponent<component::RigidBody2D>(entity))
+            createRigidBody(entity);
+
+    LOG_DEBUG("physics::SwarmEngine", "Started with [w]$0[] bodies and [w]$1[] threads", _world.getNumBodies(), _world.getNumThreads());
+}
+
+void SwarmEngine::step(float dt) {
+    PROFILE();
+    //----- Update swarm bodies -----//
+    for (SwarmWorld::BodyIndex i = 0; i < _entities.size(); i++) {
+        component::Transform* t = _transforms[i];
+        component::RigidBody2D* rb2d = _rigidBodies[i];
+
+        if (_world.getType(i) != SwarmWorld::Type(rb2d->type))
+            _world.setType(i, SwarmWorld::Type(rb2d->type));
+
+        // Only copy the transform if it was changed since the last step (e.g. by a script or the UI)
+        vec2 position = vec2(t->position);
+        quat orientation = t->orientation;
+        if (_hasParent[i]) {
+            component::Transform worldT = t->getWorldTransform(_entities[i]);
+            position = vec2(worldT.position);
+            orientation = worldT.orientation;
+        }
+        if (position != _syncedPositions[i] || orientation != _syncedOrientations[i]) {
+            _world.setPosition(i, position);
+            _world.setAngle(i, orientation.get2DAngle());
+            _syncedPositions[i] = position;
+            _syncedOrientations[i] = orientation;
+        }
+    }
+
+    //----- Step simulation -----//
+    _world.step(dt);
+    updateContacts();
+
+    //----- Update atta components -----//
+    for (SwarmWorld::BodyIndex i = 0; i < _entities.size(); i++) {
+        if (_world.getType(i) == SwarmWorld::STATIC)
+            continue;
+        component::Transform* t = _transforms[i];
+        vec2 position = _world.getPosition(i);
+        quat orientation;
+        orientation.set2DAngle(_world.getAngle(i));
+        if (_hasParent[i]) {
+            component::Transform worldT = t->getWorldTransform(_entities[i]);
+            worldT.position = vec3(position.x, position.y, worldT.position.z);
+            worldT.orientation = orientation;
+            t->setWorldTransform(_entities[i], worldT);
+        } else {
+            t->position.x = position.x;
+            t->position.y = position.y;
+            t->orientation = orientation;
+        }
+        _syncedPositions[i] = position;
+        _syncedOrientations[i] = orientation;
+    }
+}
+
+void SwarmEngine::stop() {
+    _running = false;
+    _world.clear();
+    _world.setNumThreads(1);
+    _entities.clear();
+    _transforms.clear();
+    _rigidBodies.clear();
+    _hasParent.clear();
+    _syncedPositions.clear();
+    _syncedOrientations.clear();
+    _bodies.clear();
+    _componentToEntity.clear();
+    _contacts.clear();
+}
+
+void SwarmEngine::createRigidBody(component::EntityId entity) {
+    if (_bodies.find(entity) != _bodies.end())
+        deleteRigidBody(entity);
+
+    auto t = component::getComponent<component::Transform>(entity);
+    auto rb2d = component::getComponent<component::RigidBody2D>(entity);
+    auto box2d = component::getComponent<component::BoxCollider2D>(entity);
+    auto circle2d = component::getComponent<component::CircleCollider2D>(entity);
+    auto polygon2d = component::getComponent<component::PolygonCollider2D>(entity);
+    if (!rb2d)
+        return;
+    if (!t) {
+        LOG_WARN("physics::SwarmEngine", "Entity [w]$0[] is a rigid body but does not have a transform component", entity);
+        return;
+    }
+    if (polygon2d)
+        LOG_WARN("physics::SwarmEngine", "Entity [w]$0[] has a polygon collider, it is not supported by the swarm engine", entity);
+    // The collider may be created after the rigid body, the body is created by createColliders in this case
+    if ((box2d != nullptr) + (circle2d != nullptr) != 1) {
+        if (box2d && circle2d)
+            LOG_WARN("physics::SwarmEngine", "Entity [w]$0[] must have only one collider", entity);
+        return;
+    }
+
+    component::Transform worldT = t->getWorldTransform(entity);
+    vec3 scale = worldT.scale;
+
+    SwarmWorld::BodyInfo info;
+    info.type = SwarmWorld::Type(rb2d->type);
+    if (box2d) {
+        info.shape = SwarmWorld::BOX;
+        info.size = vec2(scale.x * box2d->size.x / 2.0f, scale.y * box2d->size.y / 2.0f);
+    } else {
+        info.shape = SwarmWorld::CIRCLE;
+        info.size = vec2(std::max(scale.x, scale.y) * circle2d->radius, 0.0f);
+    }
+    info.position = vec2(worldT.position);
+    info.angle = worldT.orientation.get2DAngle();
+    info.linearVelocity = rb2d->linearVelocity;
+    info.angularVelocity = rb2d->angularVelocity;
+    info.mass = rb2d->mass;
+    info.restitution = rb2d->restitution;
+    info.linearDamping = rb2d->linearDamping;
+    info.angularDamping = rb2d->angularDamping;
+
+    component::Relationship* relationship = component::getComponent<component::Relationship>(entity);
+    SwarmWorld::BodyIndex body = _world.addBody(info);
+    _entities.push_back(entity);
+    _transforms.push_back(t);
+    _rigidBodies.push_back(rb2d);
+    _hasParent.push_back(relationship && relationship->getParent().getId() != -1);
+    _syncedPositions.push_back(info.position);
+    _syncedOrientations.push_back(worldT.orientation);
+    _bodies[entity] = body;
+    _componentToEntity[rb2d] = entity;
+}
+
+void SwarmEngine::deleteRigidBody(component::EntityId entity) {
+    SwarmWorld::BodyIndex body;
+    if (!getBody(entity, body))
+        return;
+
+    // The world moves the last body to the removed index
+    SwarmWorld::BodyIndex last = SwarmWorld::BodyIndex(_entities.size() - 1);
+    _world.removeBody(body);
+    _bodies[_entities[last]] = body;
+    _componentToEntity.erase(_rigidBodies[body]);
+    auto swapRemove = [body](auto& v) {
+        v[body] = v.back();
+        v.pop_back();
+    };
+    swapRemove(_entities);
+    swapRemove(_transforms);
+    swapRemove(_rigidBodies);
+    swapRemove(_hasParent);
+    swapRemove(_syncedPositions);
+    swapRemove(_syncedOrientations);
+    _bodies.erase(entity);
+}
+
+void SwarmEngine::createColliders(component::EntityId entity) {
+    // Each body has exactly one collider, the body is recreated with the new collider
+    createRigidBody(entity);
+}
+
+void SwarmEngine::deleteColliders(component::EntityId entity) { deleteRigidBody(entity); }
+
+bool SwarmEngine::getBody(component::EntityId entity, SwarmWorld::BodyIndex& body) const {
+    auto it = _bodies.find(entity);
+    if (it == _bodies.end())
+        return false;
+    body = it->second;
+    return true;
+}
+
+void SwarmEngine::updateContacts() {
+    _contacts.clear();
+    for (const SwarmWorld::Contact& c : _world.getContacts()) {
+        // Point in the middle of the penetration, on the line between the centers for box-box contacts
+        vec2 point;
+        if (_world.getShape(c.a) == SwarmWorld::CIRCLE)
+            point = _world.getPosition(c.a) + c.normal * (_world.getSize(c.a).x - c.depth * 0.5f);
+        else if (_world.getShape(c.b) == SwarmWorld::CIRCLE)
+            point = _world.getPosition(c.b) - c.normal * (_world.getSize(c.b).x - c.depth * 0.5f);
+        else
+            point = (_world.getPosition(c.a) + _world.getPosition(c.b)) * 0.5f;
+        _contacts.add(_entities[c.a], _entities[c.b], vec3(point.x, point.y, 0.0f), vec3(c.normal.x, c.normal.y, 0.0f));
+    }
+    _contacts.build();
+}
+
+std::vector<RayCastHit> SwarmEngine::rayCast(vec3 begin, vec3 end, bool onlyFirst) {
+    _world.rayCast(vec2(begin), vec2(end), onlyFirst, _rayHits);
+
+    std::vector<RayCastHit> hits;
+    hits.reserve(_rayHits.size());
+    for (const SwarmWorld::RayHit& rayHit : _rayHits)
+        hits.push_back({_entities[rayHit.body], rayHit.distance, vec3(rayHit.normal.x, rayHit.normal.y, 0.0f)});
+    return hits;
+}
+
+size_t SwarmEngine::rayCast(vec3 begin, vec3 end, Span<RayCastHit> hits, bool onlyFirst) {
+    if (hits.empty())
+        return 0;
+    _world.rayCast(vec2(begin), vec2(end), onlyFirst, _rayHits);
+
+    size_t numHits = std::min(hits.size(), _rayHits.size());
+    for (size_t i = 0; i < numHits; i++) {
+        const SwarmWorld::RayHit& rayHit = _rayHits[i];
+        hits[i] = {_entities[rayHit.body], rayHit.distance, vec3(rayHit.normal.x, rayHit.normal.y, 0.0f)};
+    }
+    return numHits;
+}
+
+void SwarmEngine::overlapAabb(vec3 lower, vec3 upper, std::vector<component::EntityId>& entities) {
+    _overlapBodies.clear();
+    _world.overlapAabb(vec2(lower), vec2(upper), _overlapBodies);
+    for (SwarmWorld::BodyIndex body : _overlapBodies)
+        entities.push_back(_entities[body]);
+}
+
+void SwarmEngine::overlapSphere(vec3 center, float radius, std::vector<component::EntityId>& entities) {
+    _overlapBodies.clear();
+    _world.overlapCircle(vec2(center), radius, _overlapBodies);
+    for (SwarmWorld::BodyIndex body : _overlapBodies)
+        entities.push_back(_entities[body]);
+}
+
+void SwarmEngine::sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst, std::vector<RayCastHit>& hits) {
+    _world.circleCast(vec2(begin), vec2(end), radius, onlyFirst, _rayHits);
+    for (const SwarmWorld::RayHit& rayHit : _rayHits)
+        hits.push_back({_entities[rayHit.body], rayHit.distance, vec3(rayHit.normal.x, rayHit.normal.y, 0.0f)});
+}
+
+void SwarmEngine::updateGravity() { _world.setGravity(vec2(physics::getGravity())); }
+
+struct SwarmBodyState {
+    component::EntityId entity;
+    vec2 position;
+    float angle;
+    vec2 linearVelocity;
+    float angularVelocity;
+};
+
+void SwarmEngine::saveState(std::vector<uint8_t>& state) {
+    state.resize(_entities.size() * sizeof(SwarmBodyState));
+    SwarmBodyState* bodyStates = reinterpret_cast<SwarmBodyState*>(state.data());
+    for (SwarmWorld::BodyIndex i = 0; i < _entities.size(); i++)
+        *bodyStates++ = {_entities[i], _world.getPosition(i), _world.getAngle(i), _world.getLinearVelocity(i), _world.getAngularVelocity(i)};
+}
+
+void SwarmEngine::restoreState(const std::vector<uint8_t>& state) {
+    const SwarmBodyState* bodyStates = reinterpret_cast<const SwarmBodyState*>(state.data());
+    for (size_t i = 0; i < state.size() / sizeof(SwarmBodyState); i++) {
+        const SwarmBodyState& s = bodyStates[i];
+        SwarmWorld::BodyIndex body;
+        if (!getBody(s.entity, body))
+            continue;
+        _world.setPosition(body, s.position);
+        _world.setAngle(body, s.angle);
+        _world.setLinearVelocity(body, s.linearVelocity);
+        _world.setAngularVelocity(body, s.angularVelocity);
+    }
+}
+
+//---------- RigidBody2D interface ----------//
+void SwarmEngine::setTransform(component::RigidBody2D* rb2d, vec2 position, float angle) {
+    if (Config::getState() != Config::State::IDLE) {
+        SwarmWorld::BodyIndex body = _bodies[_componentToEntity[rb2d]];
+        _world.setPosition(body, position);
+        _world.setAngle(body, angle);
+    }
+}
+
+void SwarmEngine::setLinearVelocity(component::RigidBody2D* rb2d, vec2 vel) {
+    if (Config::getState() != Config::State::IDLE)
+        _world.setLinearVelocity(_bodies[_componentToEntity[rb2d]], vel);
+}
+
+void SwarmEngine::setAngularVelocity(component::RigidBody2D* rb2d, float omega) {
+    if (Config::getState() != Config::State::IDLE)
+        _world.setAngularVelocity(_bodies[_componentToEntity[rb2d]], omega);
+}
+
+void SwarmEngine::applyForce(component::RigidBody2D* rb2d, vec2 force, vec2 point) {
+    if (Config::getState() != Config::State::IDLE)
+        _world.applyForce(_bodies[_componentToEntity[rb2d]], force, point);
+}
+
+void SwarmEngine::applyForceToCenter(component::RigidBody2D* rb2d, vec2 force) {
+    if (Config::getState() != Config::State::IDLE)
+        _world.applyForceToCenter(_bodies[_componentToEntity[rb2d]], force);
+}
+
+void SwarmEngine::applyTorque(component::RigidBody2D* rb2d, float torque) {
+    if (Config::getState() != Config::State::IDLE)
+        _world.applyTorque(_bodies[_componentToEntity[rb2d]], torque);
+}
+
+//---------- Differential drive ----------//
+void SwarmEngine::setDriveVelocity(component::EntityId entity, float forward, float angular) {
+    SwarmWorld::BodyIndex body;
+    if (!getBody(entity, body)) {
+        LOG_WARN("physics::SwarmEngine", "Could not set drive velocity, entity [w]$0[] is not a swarm body", entity);
+        return;
+    }
+    _world.setDrive(body, forward, angular);
+}
+
+void SwarmEngine::setWheelVelocities(component::EntityId entity, float left, float right, float axleLength) {
+    DASSERT(axleLength > 0.0f, "Axle length should be greater than zero");
+    setDriveVelocity(entity, (left + right) / 2.0f, (right - left) / axleLength);
+}
+
+void SwarmEngine::clearDrive(component::EntityId entity) {
+    SwarmWorld::BodyIndex body;
+    if (getBody(entity, body))
+        _world.clearDrive(body);
+}
+
+void SwarmEngine::setNumThreads(int numThreads) {
+    _numThreads = numThreads;
+    if (_running)
+        _world.setNumThreads(numThreads);
+}
+
+void SwarmEngine::setNumIterations(unsigned numIterations) {
+    _numIterations = std::max(numIterations, 1u);
+    _world.setNumIterations(_numIterations);
+}
+
+} // namespace atta::physics
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/components/rigidBody2D.h>
+#include <atta/component/components/transform.h>
+#include <atta/physics/engines/engine.h>
+#include <atta/physics/engines/swarmWorld.h>
+
+namespace atta::physics {
+
+/// Lightweight 2D physics engine for simulations with many simple agents
+/** Entities with RigidBody2D and one CircleCollider2D or BoxCollider2D are simulated by a SwarmWorld. Joints, polygon
+ * colliders, friction, and sleeping are not supported, use the Box2D engine when they are needed.
+ *
+ * Agents can be driven as differential-drive robots with setDriveVelocity or setWheelVelocities, the drive command is
+ * integrated exactly and is not changed by collisions with other bodies (only the position is corrected)
+ **/
+class SwarmEngine : public Engine {
+  public:
+    SwarmEngine();
+    ~SwarmEngine();
+
+    void start() override;
+    void step(float dt) override;
+    void stop() override;
+
+    void createRigidBody(component::EntityId entity) override;
+    void deleteRigidBody(component::EntityId entity) override;
+    void createColliders(component::EntityId entity) override;
+    void deleteColliders(component::EntityId entity) override;
+
+    std::vector<RayCastHit> rayCast(vec3 begin, vec3 end, bool onlyFirst) override;
+    size_t rayCast(vec3 begin, vec3 end, Span<RayCastHit> hits, bool onlyFirst) override;
+    void overlapAabb(vec3 lower, vec3 upper, std::vector<component::EntityId>& entities) override;
+    void overlapSphere(vec3 center, float radius, std::vector<component::EntityId>& entities) override;
+    void sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst, std::vector<RayCastHit>& hits) override;
+
+    void updateGravity() override;
+    void saveState(std::vector<uint8_t>& state) override;
+    void restoreState(const std::vector<uint8_t>& state) override;
+
+    // component::RigidBody2D interface
+    void setTransform(component::RigidBody2D* rb2d, vec2 position, float angle);
+    void setLinearVelocity(component::RigidBody2D* rb2d, vec2 vel);
+    void setAngularVelocity(component::RigidBody2D* rb2d, float omega);
+    void applyForce(component::RigidBody2D* rb2d, vec2 force, vec2 point);
+    void applyForceToCenter(component::RigidBody2D* rb2d, vec2 force);
+    void applyTorque(component::RigidBody2D* rb2d, float torque);
+
+    //---------- Differential drive ----------//
+    /// Move the entity forward (local x axis) and rotate it with constant velocities until clearDrive is called
+    void setDriveVelocity(component::EntityId entity, float forward, float angular);
+    /// Drive the entity as a differential-drive robot with the given wheel linear velocities
+    void setWheelVelocities(component::EntityId entity, float left, float right, float axleLength);
+    void clearDrive(component::EntityId entity);
+
+    int getNumThreads() const { return _numThreads; }
+    void setNumThreads(int numThreads); ///< 0 uses all hardware threads, applied when the simulation starts
+    unsigned getNumIterations() const { return _numIterations; }
+    void setNumIterations(unsigned numIterations);
+
+    bool hasBody(component::EntityId entity) const { return _bodies.find(entity) != _bodies.end(); }
+    const SwarmWorld& getWorld() const { return _world; }
+
+  private:
+    bool getBody(component::EntityId entity, SwarmWorld::BodyIndex& body) const;
+    /// Rebuild the contact list from the world contacts
+    void updateContacts();
+
+    SwarmWorld _world;
+    int _numThreads;         ///< Number of threads, 0 uses all hardware threads
+    unsigned _numIterations; ///< Position solver iterations
+
+    // Data of each body, same index as in the world
+    std::vector<component::EntityId> _entities;
+    std::vector<component::Transform*> _transforms;
+    std::vector<component::RigidBody2D*> _rigidBodies;
+    std::vector<uint8_t> _hasParent;       ///< If the transform is relative to a parent transform
+    std::vector<vec2> _syncedPositions;    ///< World position written to the transform in the last step
+    std::vector<quat> _syncedOrientations; ///< World orientation written to the transform in the last step
+    std::unordered_map<component::EntityId, SwarmWorld::BodyIndex> _bodies;
+    std::unordered_map<component::RigidBody2D*, component::EntityId> _componentToEntity;
+
+    std::vector<SwarmWorld::RayHit> _rayHits;
+    std::vector<SwarmWorld::BodyIndex> _overlapBodies;
+};
+
+} // namespace atta::physics
@@ -0,0 +1,782 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/physics/engines/swarmWorld.h>
+
+namespace atta::physics {
+
+constexpr int BODY_GRAIN = 256;          ///< Bodies processed by each parallel chunk
+constexpr float LARGE_BODY_FACTOR = 2.0f; ///< Bodies with radius greater than this times the median radius are not in the grid
+constexpr float LINEAR_SLOP = 0.001f;    ///< Allowed penetration, avoids jitter of resting contacts
+constexpr float RELAXATION = 0.8f;       ///< Fraction of the penetration resolved by each position iteration
+
+inline vec2 rotate(vec2 v, float c, float s) { return vec2(c * v.x - s * v.y, s * v.x + c * v.y); }
+inline vec2 rotateInv(vec2 v, float c, float s) { return vec2(c * v.x + s * v.y, -s * v.x + c * v.y); }
+
+SwarmWorld::SwarmWorld()
+    : _gravity(0.0f, 0.0f), _numIterations(4), _pool(1), _cellSizeDirty(true), _gridDirty(true), _cellSize(1.0f), _cellMask(0),
+      _queryStamp(0) {}
+
+SwarmWorld::BodyIndex SwarmWorld::addBody(const BodyInfo& info) {
+    BodyIndex body = BodyIndex(_positions.size());
+    float radius = info.shape == CIRCLE ? info.size.x : info.size.length();
+    float mass = info.type == DYNAMIC ? std::max(info.mass, 1e-6f) : 0.0f;
+    float inertia = 0.0f;
+    if (info.shape == CIRCLE)
+        inertia = 0.5f * mass * info.size.x * info.size.x;
+    else
+        inertia = mass * (info.size.x * info.size.x + info.size.y * info.size.y) / 3.0f;
+
+    _types.push_back(info.type);
+    _shapes.push_back(info.shape);
+    _sizes.push_back(info.size);
+    _radii.push_back(radius);
+    _positions.push_back(info.position);
+    _angles.push_back(info.angle);
+    _linearVelocities.push_back(info.type == STATIC ? vec2(0.0f) : info.linearVelocity);
+    _angularVelocities.push_back(info.type == STATIC ? 0.0f : info.angularVelocity);
+    _forces.push_back(vec2(0.0f));
+    _torques.push_back(0.0f);
+    _masses.push_back(std::max(info.mass, 1e-6f));
+    _invMasses.push_back(mass > 0.0f ? 1.0f / mass : 0.0f);
+    _invInertias.push_back(inertia > 0.0f ? 1.0f / inertia : 0.0f);
+    _restitutions.push_back(info.restitution);
+    _linearDampings.push_back(info.linearDamping);
+    _angularDampings.push_back(info.angularDamping);
+    _driven.push_back(0);
+    _drives.push_back(vec2(0.0f));
+    _cells.push_back(LARGE_BODY);
+    _queryStamps.push_back(0);
+    _deltas.push_back(vec2(0.0f));
+
+    // The new body has no contacts until the next step
+    if (_bodyContactStart.empty())
+        _bodyContactStart.push_back(0);
+    _bodyContactStart.push_back(_bodyContactStart.back());
+
+    _cellSizeDirty = true;
+    _gridDirty = true;
+    return body;
+}
+
+void SwarmWorld::removeBody(BodyIndex body) {
+    DASSERT(body < getNumBodies(), "Trying to remove swarm body that does not exist");
+    auto swapRemove = [body](auto& v) {
+        v[body] = v.back();
+        v.pop_back();
+    };
+    swapRemove(_types);
+    swapRemove(_shapes);
+    swapRemove(_sizes);
+    swapRemove(_radii);
+    swapRemove(_positions);
+    swapRemove(_angles);
+    swapRemove(_linearVelocities);
+    swapRemove(_angularVelocities);
+    swapRemove(_forces);
+    swapRemove(_torques);
+    swapRemove(_masses);
+    swapRemove(_invMasses);
+    swapRemove(_invInertias);
+    swapRemove(_restitutions);
+    swapRemove(_linearDampings);
+    swapRemove(_angularDampings);
+    swapRemove(_driven);
+    swapRemove(_drives);
+    swapRemove(_cells);
+    swapRemove(_queryStamps);
+    swapRemove(_deltas);
+
+    // Contacts reference body indices, they are invalid until the next step
+    _contacts.clear();
+    _bodyContacts.clear();
+    _bodyContactStart.assign(getNumBodies() + 1, 0);
+
+    _cellSizeDirty = true;
+    _gridDirty = true;
+}
+
+void SwarmWorld::clear() {
+    while (getNumBodies())
+        removeBody(BodyIndex(getNumBodies() - 1));
+}
+
+void SwarmWorld::setType(BodyIndex body, Type type) {
+    if (_types[body] == type)
+        return;
+    _types[body] = type;
+    float mass = type == DYNAMIC ? _masses[body] : 0.0f;
+    float inertia = 0.0f;
+    vec2 size = _sizes[body];
+    if (_shapes[body] == CIRCLE)
+        inertia = 0.5f * mass * size.x * size.x;
+    else
+        inertia = mass * (size.x * size.x + size.y * size.y) / 3.0f;
+    _invMasses[body] = mass > 0.0f ? 1.0f / mass : 0.0f;
+    _invInertias[body] = inertia > 0.0f ? 1.0f / inertia : 0.0f;
+    if (type == STATIC) {
+        _linearVelocities[body] = vec2(0.0f);
+        _angularVelocities[body] = 0.0f;
+    }
+}
+
+void SwarmWorld::setPosition(BodyIndex body, vec2 position) {
+    _positions[body] = position;
+    _gridDirty = true;
+}
+
+void SwarmWorld::applyForce(BodyIndex body, vec2 force, vec2 point) {
+    _forces[body] += force;
+    vec2 r = point - _positions[body];
+    _torques[body] += r.x * force.y - r.y * force.x;
+}
+
+void SwarmWorld::applyForceToCenter(BodyIndex body, vec2 force) { _forces[body] += force; }
+
+void SwarmWorld::applyTorque(BodyIndex body, float torque) { _torques[body] += torque; }
+
+void SwarmWorld::setDrive(BodyIndex body, float forward, float angular) {
+    _driven[body] = 1;
+    _drives[body] = vec2(forward, angular);
+}
+
+void SwarmWorld::clearDrive(BodyIndex body) { _driven[body] = 0; }
+
+Span<const uint32_t> SwarmWorld::getBodyContacts(BodyIndex body) const {
+    if (body + 1 >= _bodyContactStart.size())
+        return {};
+    return Span<const uint32_t>(_bodyContacts.data() + _bodyContactStart[body], _bodyContactStart[body + 1] - _bodyContactStart[body]);
+}
+
+//---------- Step ----------//
+void SwarmWorld::step(float dt) {
+    PROFILE();
+    if (getNumBodies() == 0)
+        return;
+
+    integrate(dt);
+    updateGrid();
+    findContacts();
+    for (unsigned i = 0; i < _numIterations; i++)
+        solvePositions();
+    solveVelocities();
+    _gridDirty = true;
+}
+
+void SwarmWorld::integrate(float dt) {
+    _pool.parallelFor(0, int(getNumBodies()), BODY_GRAIN, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            if (_types[i] == STATIC)
+                continue;
+
+            vec2& v = _linearVelocities[i];
+            float& w = _angularVelocities[i];
+            if (_types[i] == DYNAMIC) {
+                v += (_gravity + _forces[i] * _invMasses[i]) * dt;
+                w += _torques[i] * _invInertias[i] * dt;
+                v *= 1.0f / (1.0f + dt * _linearDampings[i]);
+                w *= 1.0f / (1.0f + dt * _angularDampings[i]);
+            }
+            _forces[i] = vec2(0.0f);
+            _torques[i] = 0.0f;
+
+            float& angle = _angles[i];
+            if (_driven[i]) {
+                // Exact unicycle integration (arc of a circle with constant forward and angular velocity)
+                float forward = _drives[i].x;
+                w = _drives[i].y;
+                float newAngle = angle + w * dt;
+                if (std::abs(w) > 1e-6f)
+                    _positions[i] += vec2(std::sin(newAngle) - std::sin(angle), std::cos(angle) - std::cos(newAngle)) * (forward / w);
+                else
+                    _positions[i] += vec2(std::cos(angle), std::sin(angle)) * (forward * dt);
+                angle = newAngle;
+                v = vec2(std::cos(angle), std::sin(angle)) * forward;
+            } else {
+                _positions[i] += v * dt;
+                angle += w * dt;
+            }
+        }
+    });
+}
+
+//---------- Broadphase ----------//
+void SwarmWorld::updateCellSize() {
+    // Cell size fits the small bodies, so overlapping small bodies are always in neighbor cells
+    std::vector<float> radii = _radii;
+    std::nth_element(radii.begin(), radii.begin() + radii.size() / 2, radii.end());
+    float largeRadius = radii[radii.size() / 2] * LARGE_BODY_FACTOR;
+
+    float maxRadius = 0.0f;
+    _largeBodies.clear();
+    for (BodyIndex i = 0; i < getNumBodies(); i++) {
+        if (_radii[i] > largeRadius)
+            _largeBodies.push_back(i);
+        else
+            maxRadius = std::max(maxRadius, _radii[i]);
+    }
+    _cellSize = std::max(2.0f * maxRadius, 1e-4f);
+
+    // Hash table with at least two cells per small body
+    size_t numSmall = getNumBodies() - _largeBodies.size();
+    uint32_t tableSize = 64;
+    while (tableSize < 2 * numSmall)
+        tableSize *= 2;
+    _cellMask = tableSize - 1;
+    _cellSizeDirty = false;
+}
+
+uint32_t SwarmWorld::getCell(int cx, int cy) const { return (uint32_t(cx) * 73856093u ^ uint32_t(cy) * 19349663u) & _cellMask; }
+
+void SwarmWorld::updateGrid() {
+    if (_cellSizeDirty)
+        updateCellSize();
+
+    // Cell of each small body
+    std::fill(_cells.begin(), _cells.end(), 0);
+    for (BodyIndex large : _largeBodies)
+        _cells[large] = LARGE_BODY;
+    _pool.parallelFor(0, int(getNumBodies()), BODY_GRAIN, [&](int begin, int end) {
+        for (int i = begin; i < end; i++)
+            if (_cells[i] != LARGE_BODY)
+                _cells[i] = getCell(getCellCoord(_positions[i].x), getCellCoord(_positions[i].y));
+    });
+
+    // Counting sort by cell
+    _cellStart.assign(_cellMask + 2, 0);
+    for (uint32_t cell : _cells)
+        if (cell != LARGE_BODY)
+            _cellStart[cell + 1]++;
+    for (size_t c = 1; c < _cellStart.size(); c++)
+        _cellStart[c] += _cellStart[c - 1];
+    _cellBodies.resize(_cellStart.back());
+    std::vector<uint32_t> next(_cellStart.begin(), _cellStart.end() - 1);
+    for (BodyIndex i = 0; i < getNumBodies(); i++)
+        if (_cells[i] != LARGE_BODY)
+            _cellBodies[next[_cells[i]]++] = i;
+
+    _gridDirty = false;
+}
+
+//---------- Narrowphase ----------//
+// Normal points from the box to the circle
+static bool collideCircleBox(vec2 circle, float radius, vec2 box, float angle, vec2 half, vec2& normal, float& depth) {
+    float c = std::cos(angle), s = std::sin(angle);
+    vec2 local = rotateInv(circle - box, c, s);
+    vec2 clamped(std::clamp(local.x, -half.x, half.x), std::clamp(local.y, -half.y, half.y));
+
+    vec2 localNormal;
+    if (clamped == local) {
+        // Circle center inside the box, push through the closest face
+        float dx = half.x - std::abs(local.x);
+        float dy = half.y - std::abs(local.y);
+        if (dx < dy) {
+            localNormal = vec2(local.x < 0.0f ? -1.0f : 1.0f, 0.0f);
+            depth = dx + radius;
+        } else {
+            localNormal = vec2(0.0f, local.y < 0.0f ? -1.0f : 1.0f);
+            depth = dy + radius;
+        }
+    } else {
+        vec2 diff = local - clamped;
+        float dist2 = dot(diff, diff);
+        if (dist2 >= radius * radius)
+            return false;
+        float dist = std::sqrt(dist2);
+        localNormal = diff / dist;
+        depth = radius - dist;
+    }
+    normal = rotate(localNormal, c, s);
+    return true;
+}
+
+static bool collideBoxBox(vec2 posA, float angleA, vec2 halfA, vec2 posB, float angleB, vec2 halfB, vec2& normal, float& depth) {
+    // Separating axis test with the face normals of both boxes
+    float ca = std::cos(angleA), sa = std::sin(angleA);
+    float cb = std::cos(angleB), sb = std::sin(angleB);
+    vec2 axes[4] = {vec2(ca, sa), vec2(-sa, ca), vec2(cb, sb), vec2(-sb, cb)};
+    vec2 d = posB - posA;
+    depth = std::numeric_limits<float>::max();
+    for (vec2 axis : axes) {
+        float ra = halfA.x * std::abs(dot(axes[0], axis)) + halfA.y * std::abs(dot(axes[1], axis));
+        float rb = halfB.x * std::abs(dot(axes[2], axis)) + halfB.y * std::abs(dot(axes[3], axis));
+        float dist = dot(d, axis);
+        float overlap = ra + rb - std::abs(dist);
+        if (overlap <= 0.0f)
+            return false;
+        if (overlap < depth) {
+            depth = overlap;
+            normal = dist < 0.0f ? -axis : axis;
+        }
+    }
+    return true;
+}
+
+bool SwarmWorld::collide(BodyIndex a, BodyIndex b, vec2& normal, float& depth) const {
+    vec2 d = _positions[b] - _positions[a];
+    float r = _radii[a] + _radii[b];
+    if (dot(d, d) >= r * r)
+        return false;
+
+    if (_shapes[a] == CIRCLE && _shapes[b] == CIRCLE) {
+        float dist = d.length();
+        normal = dist > 1e-6f ? d / dist : vec2(1.0f, 0.0f);
+        depth = r - dist;
+        return true;
+    }
+    if (_shapes[a] == CIRCLE && _shapes[b] == BOX) {
+        if (!collideCircleBox(_positions[a], _sizes[a].x, _positions[b], _angles[b], _sizes[b], normal, depth))
+            return false;
+        normal = -normal;
+        return true;
+    }
+    if (_shapes[a] == BOX && _shapes[b] == CIRCLE)
+        return collideCircleBox(_positions[b], _sizes[b].x, _positions[a], _angles[a], _sizes[a], normal, depth);
+    return collideBoxBox(_positions[a], _angles[a], _sizes[a], _positions[b], _angles[b], _sizes[b], normal, depth);
+}
+
+void SwarmWorld::findContacts() {
+    size_t numBodies = getNumBodies();
+    size_t numChunks = (numBodies + BODY_GRAIN - 1) / BODY_GRAIN;
+    _chunkContacts.resize(numChunks + _largeBodies.size());
+    for (std::vector<Contact>& contacts : _chunkContacts)
+        contacts.clear();
+
+    auto addContact = [this](BodyIndex a, BodyIndex b, std::vector<Contact>& contacts) {
+        if (_types[a] == STATIC && _types[b] == STATIC)
+            return;
+        vec2 normal;
+        float depth;
+        if (collide(a, b, normal, depth))
+            contacts.push_back({a, b, normal, depth});
+    };
+
+    // Small bodies, each pair is tested by the body with the lower index
+    _pool.parallelFor(0, int(numChunks), 1, [&](int begin, int end) {
+        for (int chunk = begin; chunk < end; chunk++) {
+            std::vector<Contact>& contacts = _chunkContacts[chunk];
+            BodyIndex last = BodyIndex(std::min(numBodies, size_t(chunk + 1) * BODY_GRAIN));
+            for (BodyIndex i = BodyIndex(chunk) * BODY_GRAIN; i < last; i++) {
+                if (_cells[i] == LARGE_BODY)
+                    continue;
+                int cx = getCellCoord(_positions[i].x);
+                int cy = getCellCoord(_positions[i].y);
+                uint32_t visited[9];
+                int numVisited = 0;
+                for (int y = cy - 1; y <= cy + 1; y++)
+                    for (int x = cx - 1; x <= cx + 1; x++) {
+                        // Different cells can have the same hash, each bucket is visited once
+                        uint32_t cell = getCell(x, y);
+                        if (std::find(visited, visited + numVisited, cell) != visited + numVisited)
+                            continue;
+                        visited[numVisited++] = cell;
+                        for (uint32_t k = _cellStart[cell]; k < _cellStart[cell + 1]; k++)
+                            if (_cellBodies[k] > i)
+                                addContact(i, _cellBodies[k], contacts);
+                    }
+            }
+        }
+    });
+
+    // Large bodies are tested against all bodies
+    _pool.parallelFor(0, int(_largeBodies.size()), 1, [&](int begin, int end) {
+        for (int l = begin; l < end; l++) {
+            BodyIndex large = _largeBodies[l];
+            std::vector<Contact>& contacts = _chunkContacts[numChunks + l];
+            for (BodyIndex i = 0; i < numBodies; i++) {
+                // Pairs of large bodies are tested by the lower index
+                if (i == large || (_cells[i] == LARGE_BODY && i < large))
+                    continue;
+                if (i < large)
+                    addContact(i, large, contacts);
+                else
+                    addContact(large, i, contacts);
+            }
+        }
+    });
+
+    // Merge contacts and index them by body
+    _contacts.clear();
+    for (const std::vector<Contact>& contacts : _chunkContacts)
+        _contacts.insert(_contacts.end(), contacts.begin(), contacts.end());
+    _bodyContactStart.assign(numBodies + 1, 0);
+    for (const Contact& c : _contacts) {
+        _bodyContactStart[c.a + 1]++;
+        _bodyContactStart[c.b + 1]++;
+    }
+    for (size_t i = 1; i < _bodyContactStart.size(); i++)
+        _bodyContactStart[i] += _bodyContactStart[i - 1];
+    _bodyContacts.resize(_bodyContactStart.back());
+    std::vector<uint32_t> next(_bodyContactStart.begin(), _bodyContactStart.end() - 1);
+    for (uint32_t k = 0; k < _contacts.size(); k++) {
+        _bodyContacts[next[_contacts[k].a]++] = k;
+        _bodyContacts[next[_contacts[k].b]++] = k;
+    }
+}
+
+//---------- Solver ----------//
+void SwarmWorld::solvePositions() {
+    // Each body computes its own correction from the current positions, then all corrections are applied
+    _pool.parallelFor(0, int(getNumBodies()), BODY_GRAIN, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            _deltas[i] = vec2(0.0f);
+            if (_invMasses[i] == 0.0f && _types[i] != KINEMATIC)
+                continue;
+            for (uint32_t k : getBodyContacts(i)) {
+                const Contact& c = _contacts[k];
+                BodyIndex other = c.a == BodyIndex(i) ? c.b : c.a;
+                float invMassSum = _invMasses[i] + _invMasses[other];
+                if (invMassSum == 0.0f)
+                    continue;
+                vec2 normal;
+                float depth;
+                if (!collide(i, other, normal, depth) || depth <= LINEAR_SLOP)
+                    continue;
+                _deltas[i] -= normal * ((depth - LINEAR_SLOP) * RELAXATION * _invMasses[i] / invMassSum);
+            }
+        }
+    });
+    _pool.parallelFor(0, int(getNumBodies()), BODY_GRAIN, [&](int begin, int end) {
+        for (int i = begin; i < end; i++)
+            _positions[i] += _deltas[i];
+    });
+}
+
+void SwarmWorld::solveVelocities() {
+    // Remove the approaching normal velocity of each contact (with restitution)
+    _pool.parallelFor(0, int(getNumBodies()), BODY_GRAIN, [&](int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            _deltas[i] = vec2(0.0f);
+            if (_invMasses[i] == 0.0f)
+                continue;
+            for (uint32_t k : getBodyContacts(i)) {
+                const Contact& c = _contacts[k];
+                BodyIndex other = c.a == BodyIndex(i) ? c.b : c.a;
+                vec2 normal = c.a == BodyIndex(i) ? c.normal : -c.normal;
+                float vn = dot(_linearVelocities[other] - _linearVelocities[i], normal);
+                if (vn >= 0.0f)
+                    continue;
+                float restitution = std::max(_restitutions[i], _restitutions[other]);
+                float impulse = -(1.0f + restitution) * vn / (_invMasses[i] + _invMasses[other]);
+                _deltas[i] -= normal * (impulse * _invMasses[i]);
+            }
+        }
+    });
+    _pool.parallelFor(0, int(getNumBodies()), BODY_GRAIN, [&](int begin, int end) {
+        for (int i = begin; i < end; i++)
+            _linearVelocities[i] += _deltas[i];
+    });
+}
+
+//---------- Ray cast ----------//
+bool SwarmWorld::rayCastBody(BodyIndex body, vec2 begin, vec2 d, float& t, vec2& normal) const {
+    vec2 center = _positions[body];
+    if (_shapes[body] == CIRCLE) {
+        float radius = _sizes[body].x;
+        vec2 f = begin - center;
+        float a = dot(d, d);
+        float b = dot(f, d);
+        float c = dot(f, f) - radius * radius;
+        float disc = b * b - a * c;
+        if (a == 0.0f || c < 0.0f || disc < 0.0f)
+            return false;
+        t = (-b - std::sqrt(disc)) / a;
+        if (t < 0.0f || t > 1.0f)
+            return false;
+        normal = (f + d * t) / radius;
+        return true;
+    }
+
+    // Slab test in the box frame
+    float co = std::cos(_angles[body]), si = std::sin(_angles[body]);
+    vec2 o = rotateInv(begin - center, co, si);
+    vec2 ld = rotateInv(d, co, si);
+    vec2 half = _sizes[body];
+    if (std::abs(o.x) <= half.x && std::abs(o.y) <= half.y)
+        return false;
+    float tMin = 0.0f, tMax = 1.0f;
+    vec2 localNormal(0.0f);
+    for (int axis = 0; axis < 2; axis++) {
+        float oa = axis == 0 ? o.x : o.y;
+        float da = axis == 0 ? ld.x : ld.y;
+        float ha = axis == 0 ? half.x : half.y;
+        if (std::abs(da) < 1e-12f) {
+            if (std::abs(oa) > ha)
+                return false;
+            continue;
+        }
+        float t0 = (-ha - oa) / da;
+        float t1 = (ha - oa) / da;
+        float sign = -1.0f;
+        if (t0 > t1) {
+            std::swap(t0, t1);
+            sign = 1.0f;
+        }
+        if (t0 > tMin) {
+            tMin = t0;
+            localNormal = axis == 0 ? vec2(sign, 0.0f) : vec2(0.0f, sign);
+        }
+        tMax = std::min(tMax, t1);
+        if (tMin > tMax)
+            return false;
+    }
+    t = tMin;
+    normal = rotate(localNormal, co, si);
+    return true;
+}
+
+void SwarmWorld::rayCastTest(BodyIndex body, vec2 begin, vec2 end, bool onlyFirst, std::vector<RayHit>& hits) {
+    if (!stampBody(body))
+        return;
+
+    float t;
+    vec2 normal;
+    if (!rayCastBody(body, begin, end - begin, t, normal))
+        return;
+    addRayHit({body, t * (end - begin).length(), normal}, onlyFirst, hits);
+}
+
+void SwarmWorld::addRayHit(const RayHit& hit, bool onlyFirst, std::vector<RayHit>& hits) {
+    if (onlyFirst) {
+        if (hits.empty())
+            hits.push_back(hit);
+        else if (hit.distance < hits[0].distance)
+            hits[0] = hit;
+    } else
+        hits.push_back(hit);
+}
+
+void SwarmWorld::rayCast(vec2 begin, vec2 end, bool onlyFirst, std::vector<RayHit>& hits) {
+    hits.clear();
+    if (getNumBodies() == 0)
+        return;
+    if (_gridDirty)
+        updateGrid();
+    nextQueryStamp();
+
+    for (BodyIndex large : _largeBodies)
+        rayCastTest(large, begin, end, onlyFirst, hits);
+
+    // Walk the cells crossed by the ray (DDA), bodies can overlap the neighbor cells of their cell
+    vec2 d = end - begin;
+    int cx = getCellCoord(begin.x), cy = getCellCoord(begin.y);
+    int endX = getCellCoord(end.x), endY = getCellCoord(end.y);
+    size_t numCells = size_t(std::abs(endX - cx) + std::abs(endY - cy)) + 1;
+    if (numCells * 9 > getNumBodies()) {
+        // Long ray, cheaper to test all bodies
+        for (BodyIndex i = 0; i < getNumBodies(); i++)
+            rayCastTest(i, begin, end, onlyFirst, hits);
+    } else {
+        int stepX = d.x > 0.0f ? 1 : -1;
+        int stepY = d.y > 0.0f ? 1 : -1;
+        float tDeltaX = d.x != 0.0f ? _cellSize / std::abs(d.x) : std::numeric_limits<float>::max();
+        float tDeltaY = d.y != 0.0f ? _cellSize / std::abs(d.y) : std::numeric_limits<float>::max();
+        float nextX = (stepX > 0 ? cx + 1 : cx) * _cellSize;
+        float nextY = (stepY > 0 ? cy + 1 : cy) * _cellSize;
+        float tMaxX = d.x != 0.0f ? (nextX - begin.x) / d.x : std::numeric_limits<float>::max();
+        float tMaxY = d.y != 0.0f ? (nextY - begin.y) / d.y : std::numeric_limits<float>::max();
+        for (size_t n = 0; n < numCells; n++) {
+            for (int y = cy - 1; y <= cy + 1; y++)
+                for (int x = cx - 1; x <= cx + 1; x++) {
+                    uint32_t cell = getCell(x, y);
+                    for (uint32_t k = _cellStart[cell]; k < _cellStart[cell + 1]; k++)
+                        rayCastTest(_cellBodies[k], begin, end, onlyFirst, hits);
+                }
+            if (tMaxX < tMaxY) {
+                cx += stepX;
+                tMaxX += tDeltaX;
+            } else {
+                cy += stepY;
+                tMaxY += tDeltaY;
+            }
+        }
+    }
+
+    std::sort(hits.begin(), hits.end(), [](const RayHit& a, const RayHit& b) { return a.distance < b.distance; });
+}
+
+void SwarmWorld::nextQueryStamp() {
+    if (++_queryStamp == 0) {
+        std::fill(_queryStamps.begin(), _queryStamps.end(), 0);
+        _queryStamp = 1;
+    }
+}
+
+bool SwarmWorld::stampBody(BodyIndex body) {
+    if (_queryStamps[body] == _queryStamp)
+        return false;
+    _queryStamps[body] = _queryStamp;
+    return true;
+}
+
+template <typename Func>
+void SwarmWorld::queryRange(vec2 lower, vec2 upper, Func&& func) {
+    if (_gridDirty)
+        updateGrid();
+    nextQueryStamp();
+
+    for (BodyIndex large : _largeBodies)
+        if (stampBody(large))
+            func(large);
+
+    // Bodies can overlap the neighbor cells of their cell. The number of cells is computed before the conversion to int
+    // because the range may be huge
+    float numX = std::floor(upper.x / _cellSize) - std::floor(lower.x / _cellSize) + 3.0f;
+    float numY = std::floor(upper.y / _cellSize) - std::floor(lower.y / _cellSize) + 3.0f;
+    if (numX * numY > float(getNumBodies())) {
+        // Large range, cheaper to test all bodies
+        for (BodyIndex i = 0; i < getNumBodies(); i++)
+            if (stampBody(i))
+                func(i);
+        return;
+    }
+    for (int y = getCellCoord(lower.y) - 1; y <= getCellCoord(upper.y) + 1; y++)
+        for (int x = getCellCoord(lower.x) - 1; x <= getCellCoord(upper.x) + 1; x++) {
+            uint32_t cell = getCell(x, y);
+            for (uint32_t k = _cellStart[cell]; k < _cellStart[cell + 1]; k++)
+                if (stampBody(_cellBodies[k]))
+                    func(_cellBodies[k]);
+        }
+}
+
+void SwarmWorld::overlapAabb(vec2 lower, vec2 upper, std::vector<BodyIndex>& bodies) {
+    if (getNumBodies() == 0)
+        return;
+    vec2 center = (lower + upper) * 0.5f;
+    vec2 half = (upper - lower) * 0.5f;
+    queryRange(lower, upper, [&](BodyIndex body) {
+        vec2 d = _positions[body] - center;
+        if (_shapes[body] == CIRCLE) {
+            // Closest point of the box to the circle center
+            vec2 closest(std::clamp(d.x, -half.x, half.x), std::clamp(d.y, -half.y, half.y));
+            if ((d - closest).squareLength() <= _sizes[body].x * _sizes[body].x)
+                bodies.push_back(body);
+            return;
+        }
+        // Separating axis test with the axes of both boxes
+        float c = std::abs(std::cos(_angles[body])), s = std::abs(std::sin(_angles[body]));
+        vec2 h = _sizes[body];
+        if (std::abs(d.x) > half.x + c * h.x + s * h.y || std::abs(d.y) > half.y + s * h.x + c * h.y)
+            return;
+        vec2 local = rotateInv(d, std::cos(_angles[body]), std::sin(_angles[body]));
+        if (std::abs(local.x) > h.x + c * half.x + s * half.y || std::abs(local.y) > h.y + s * half.x + c * half.y)
+            return;
+        bodies.push_back(body);
+    });
+}
+
+void SwarmWorld::overlapCircle(vec2 center, float radius, std::vector<BodyIndex>& bodies) {
+    if (getNumBodies() == 0)
+        return;
+    queryRange(center - vec2(radius), center + vec2(radius), [&](BodyIndex body) {
+        vec2 d = center - _positions[body];
+        if (_shapes[body] == CIRCLE) {
+            float r = _sizes[body].x + radius;
+            if (d.squareLength() <= r * r)
+                bodies.push_back(body);
+            return;
+        }
+        // Closest point of the box to the circle center, in the box frame
+        vec2 local = rotateInv(d, std::cos(_angles[body]), std::sin(_angles[body]));
+        vec2 h = _sizes[body];
+        vec2 closest(std::clamp(local.x, -h.x, h.x), std::clamp(local.y, -h.y, h.y));
+        if ((local - closest).squareLength() <= radius * radius)
+            bodies.push_back(body);
+    });
+}
+
+/// Time of the first intersection of the ray begin + d * t with the circle, the ray must start outside the circle
+static bool rayCastCircle(vec2 begin, vec2 d, vec2 center, float radius, float& t) {
+    vec2 f = begin - center;
+    float a = dot(d, d);
+    float b = dot(f, d);
+    float c = dot(f, f) - radius * radius;
+    float disc = b * b - a * c;
+    if (a == 0.0f || disc < 0.0f)
+        return false;
+    t = (-b - std::sqrt(disc)) / a;
+    return t >= 0.0f && t <= 1.0f;
+}
+
+bool SwarmWorld::circleCastBody(BodyIndex body, vec2 begin, vec2 d, float radius, float& t, vec2& normal) const {
+    vec2 center = _positions[body];
+    if (_shapes[body] == CIRCLE) {
+        // Ray cast against the circle grown by the radius
+        float r = _sizes[body].x + radius;
+        if ((begin - center).squareLength() <= r * r) {
+            t = 0.0f;
+            normal = vec2(0.0f);
+            return true;
+        }
+        if (!rayCastCircle(begin, d, center, r, t))
+            return false;
+        normal = (begin + d * t - center) / r;
+        return true;
+    }
+
+    // Ray cast against the box grown by the radius (rounded box) in the box frame
+    float co = std::cos(_angles[body]), si = std::sin(_angles[body]);
+    vec2 o = rotateInv(begin - center, co, si);
+    vec2 ld = rotateInv(d, co, si);
+    vec2 half = _sizes[body];
+    vec2 closest(std::clamp(o.x, -half.x, half.x), std::clamp(o.y, -half.y, half.y));
+    if ((o - closest).squareLength() <= radius * radius) {
+        t = 0.0f;
+        normal = vec2(0.0f);
+        return true;
+    }
+    float tMin = 0.0f, tMax = 1.0f;
+    vec2 localNormal(0.0f);
+    for (int axis = 0; axis < 2; axis++) {
+        float oa = axis == 0 ? o.x : o.y;
+        float da = axis == 0 ? ld.x : ld.y;
+        float ha = (axis == 0 ? half.x : half.y) + radius;
+        if (std::abs(da) < 1e-12f) {
+            if (std::abs(oa) > ha)
+                return false;
+            continue;
+        }
+        float t0 = (-ha - oa) / da;
+        float t1 = (ha - oa) / da;
+        float sign = -1.0f;
+        if (t0 > t1) {
+            std::swap(t0, t1);
+            sign = 1.0f;
+        }
+        if (t0 > tMin) {
+            tMin = t0;
+            localNormal = axis == 0 ? vec2(sign, 0.0f) : vec2(0.0f, sign);
+        }
+        tMax = std::min(tMax, t1);
+        if (tMin > tMax)
+            return false;
+    }
+    t = tMin;
+
+    // The grown box is rounded at the corners, if the ray enters a corner region it must hit the corner circle
+    vec2 p = o + ld * t;
+    if (std::abs(p.x) > half.x && std::abs(p.y) > half.y) {
+        vec2 corner(p.x > 0.0f ? half.x : -half.x, p.y > 0.0f ? half.y : -half.y);
+        if (!rayCastCircle(o, ld, corner, radius, t))
+            return false;
+        localNormal = (o + ld * t - corner) / radius;
+    }
+    normal = rotate(localNormal, co, si);
+    return true;
+}
+
+void SwarmWorld::circleCast(vec2 begin, vec2 end, float radius, bool onlyFirst, std::vector<RayHit>& hits) {
+    hits.clear();
+    if (getNumBodies() == 0)
+        return;
+    vec2 d = end - begin;
+    float length = d.length();
+    queryRange(min(begin, end) - vec2(radius), max(begin, end) + vec2(radius), [&](BodyIndex body) {
+        float t;
+        vec2 normal;
+        if (circleCastBody(body, begin, d, radius, t, normal))
+            addRayHit({body, t * length, normal}, onlyFirst, hits);
+    });
+    std::sort(hits.begin(), hits.end(), [](const RayHit& a, const RayHit& b) { return a.distance < b.distance; });
+}
+
+} // namespace atta::physics
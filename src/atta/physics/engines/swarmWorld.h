@@ -0,0 +1,183 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/physics/workerPool.h>
+#include <atta/utils/math/vector.h>
+#include <atta/utils/span.h>
+
+namespace atta::physics {
+
+/** Lightweight 2D world for many simple agents
+ *
+ * Bodies are circles or oriented boxes stored as structure of arrays and addressed by index. Each step:
+ * - integrates the velocities and positions (gravity, forces, and damping only affect dynamic bodies);
+ * - bins the bodies in a hashed uniform grid (counting sort, the cell size fits the small bodies);
+ * - finds the contacts in the 3x3 cell neighborhood of each body, bodies much larger than the cell (e.g. walls) are
+ *   tested against all bodies;
+ * - resolves the penetrations and approaching velocities with a few Jacobi iterations.
+ *
+ * Contacts do not change the body rotation. The parallel parts of the step run on a WorkerPool
+ **/
+class SwarmWorld final {
+  public:
+    using BodyIndex = uint32_t;
+    enum Type : uint8_t { DYNAMIC = 0, KINEMATIC, STATIC }; ///< Same values as component::RigidBody2D::Type
+    enum Shape : uint8_t { CIRCLE = 0, BOX };
+
+    struct BodyInfo {
+        Type type = DYNAMIC;
+        Shape shape = CIRCLE;
+        vec2 size = {0.5f, 0.5f}; ///< Radius (x) for circles, half extents for boxes
+        vec2 position = {0.0f, 0.0f};
+        float angle = 0.0f;
+        vec2 linearVelocity = {0.0f, 0.0f};
+        float angularVelocity = 0.0f;
+        float mass = 1.0f;
+        float restitution = 0.0f;
+        float linearDamping = 0.0f;
+        float angularDamping = 0.0f;
+    };
+
+    struct Contact {
+        BodyIndex a;
+        BodyIndex b;
+        vec2 normal; ///< From a to b
+        float depth;
+    };
+
+    struct RayHit {
+        BodyIndex body;
+        float distance;
+        vec2 normal;
+    };
+
+    SwarmWorld();
+
+    BodyIndex addBody(const BodyInfo& info);
+    /// Remove body, the last body is moved to its index
+    void removeBody(BodyIndex body);
+    void clear();
+    size_t getNumBodies() const { return _positions.size(); }
+
+    void step(float dt);
+
+    //---------- Configuration ----------//
+    vec2 getGravity() const { return _gravity; }
+    void setGravity(vec2 gravity) { _gravity = gravity; }
+    unsigned getNumIterations() const { return _numIterations; }
+    void setNumIterations(unsigned numIterations) { _numIterations = std::max(numIterations, 1u); }
+    int getNumThreads() const { return _pool.getNumThreads(); }
+    void setNumThreads(int numThreads) { _pool.setNumThreads(numThreads); } ///< 0 uses all hardware threads
+
+    //---------- Body state ----------//
+    Type getType(BodyIndex body) const { return _types[body]; }
+    void setType(BodyIndex body, Type type);
+    Shape getShape(BodyIndex body) const { return _shapes[body]; }
+    vec2 getSize(BodyIndex body) const { return _sizes[body]; }
+    vec2 getPosition(BodyIndex body) const { return _positions[body]; }
+    void setPosition(BodyIndex body, vec2 position);
+    float getAngle(BodyIndex body) const { return _angles[body]; }
+    void setAngle(BodyIndex body, float angle) { _angles[body] = angle; }
+    vec2 getLinearVelocity(BodyIndex body) const { return _linearVelocities[body]; }
+    void setLinearVelocity(BodyIndex body, vec2 velocity) { _linearVelocities[body] = velocity; }
+    float getAngularVelocity(BodyIndex body) const { return _angularVelocities[body]; }
+    void setAngularVelocity(BodyIndex body, float velocity) { _angularVelocities[body] = velocity; }
+
+    void applyForce(BodyIndex body, vec2 force, vec2 point);
+    void applyForceToCenter(BodyIndex body, vec2 force);
+    void applyTorque(BodyIndex body, float torque);
+
+    /// Differential-drive command, the body moves forward along its local x axis and rotates with the angular velocity
+    /** The command is kept until clearDrive. With a constant command the body follows the exact arc during the step **/
+    void setDrive(BodyIndex body, float forward, float angular);
+    void clearDrive(BodyIndex body);
+
+    //---------- Queries ----------//
+    /// Contacts found in the last step
+    const std::vector<Contact>& getContacts() const { return _contacts; }
+    /// Indices (in getContacts) of the contacts of the body found in the last step
+    Span<const uint32_t> getBodyContacts(BodyIndex body) const;
+    /// Ray cast from begin to end, the hits are sorted by distance. Bodies that contain begin are not reported
+    void rayCast(vec2 begin, vec2 end, bool onlyFirst, std::vector<RayHit>& hits);
+    /// Bodies overlapping the axis-aligned box, appended to bodies
+    void overlapAabb(vec2 lower, vec2 upper, std::vector<BodyIndex>& bodies);
+    /// Bodies overlapping the circle, appended to bodies
+    void overlapCircle(vec2 center, float radius, std::vector<BodyIndex>& bodies);
+    /// Sweep a circle from begin to end, the hits are sorted by the distance traveled. Bodies overlapping the circle at begin
+    /// are hit at distance 0
+    void circleCast(vec2 begin, vec2 end, float radius, bool onlyFirst, std::vector<RayHit>& hits);
+
+  private:
+    static constexpr uint32_t LARGE_BODY = 0xFFFFFFFF; ///< Cell of bodies that are not in the grid
+
+    void integrate(float dt);
+    void updateCellSize();
+    void updateGrid();
+    void findContacts();
+    void solvePositions();
+    void solveVelocities();
+
+    uint32_t getCell(int cx, int cy) const;
+    int getCellCoord(float x) const { return int(std::floor(x / _cellSize)); }
+    /// Collide two bodies, the normal points from a to b
+    bool collide(BodyIndex a, BodyIndex b, vec2& normal, float& depth) const;
+    bool rayCastBody(BodyIndex body, vec2 begin, vec2 d, float& t, vec2& normal) const;
+    void rayCastTest(BodyIndex body, vec2 begin, vec2 end, bool onlyFirst, std::vector<RayHit>& hits);
+    bool circleCastBody(BodyIndex body, vec2 begin, vec2 d, float radius, float& t, vec2& normal) const;
+    static void addRayHit(const RayHit& hit, bool onlyFirst, std::vector<RayHit>& hits);
+
+    /// Start a new query, each body is tested at most once by a query even if it is found in several cells
+    void nextQueryStamp();
+    bool stampBody(BodyIndex body);
+    /// Call func once for each body that may overlap the box
+    template <typename Func>
+    void queryRange(vec2 lower, vec2 upper, Func&& func);
+
+    // Bodies
+    std::vector<Type> _types;
+    std::vector<Shape> _shapes;
+    std::vector<vec2> _sizes;
+    std::vector<float> _radii; ///< Bounding circle radius
+    std::vector<vec2> _positions;
+    std::vector<float> _angles;
+    std::vector<vec2> _linearVelocities;
+    std::vector<float> _angularVelocities;
+    std::vector<vec2> _forces;
+    std::vector<float> _torques;
+    std::vector<float> _masses;
+    std::vector<float> _invMasses; ///< 0 for kinematic and static bodies
+    std::vector<float> _invInertias;
+    std::vector<float> _restitutions;
+    std::vector<float> _linearDampings;
+    std::vector<float> _angularDampings;
+    std::vector<uint8_t> _driven;
+    std::vector<vec2> _drives; ///< Forward and angular velocity commands
+
+    vec2 _gravity;
+    unsigned _numIterations; ///< Position solver iterations
+    WorkerPool _pool;
+
+    // Broadphase
+    bool _cellSizeDirty; ///< Bodies were added or removed since the cell size was computed
+    bool _gridDirty;     ///< Bodies moved since the grid was built
+    float _cellSize;
+    uint32_t _cellMask;                 ///< Hash table size minus one (power of two)
+    std::vector<uint32_t> _cells;       ///< Cell hash of each body
+    std::vector<uint32_t> _cellStart;   ///< First index in _cellBodies of each cell
+    std::vector<BodyIndex> _cellBodies; ///< Bodies sorted by cell
+    std::vector<BodyIndex> _largeBodies;
+
+    // Contacts
+    std::vector<std::vector<Contact>> _chunkContacts; ///< Contacts found by each parallel chunk
+    std::vector<Contact> _contacts;
+    std::vector<uint32_t> _bodyContactStart; ///< First index in _bodyContacts of each body
+    std::vector<uint32_t> _bodyContacts;
+    std::vector<vec2> _deltas; ///< Jacobi corrections
+
+    // Queries
+    std::vector<uint32_t> _queryStamps; ///< Last query that tested each body
+    uint32_t _queryStamp;
+};
+
+} // namespace atta::physics
@@ -24,10 +24,53 @@ bool getShowContacts() { return Manager::getInstance()._showContacts; }
 void setShowContacts(bool showContacts) { Manager::getInstance()._showContacts = showContacts; }
 bool getShowJoints() { return Manager::getInstance()._showJoints; }
 void setShowJoints(bool showJoints) { Manager::getInstance()._showJoints = showJoints; }
+std::shared_ptr<WorkerPool> getWorkerPool() {
+    Manager& manager = Manager::getInstance();
+    if (!manager._workerPool)
+        manager._workerPool = std::make_shared<WorkerPool>();
+    return manager._workerPool;
+}
 
 //---------- Queries ----------//
 std::vector<component::EntityId> getEntityCollisions(component::EntityId eid) { return Manager::getInstance()._engine->getEntityCollisions(eid); }
 std::vector<RayCastHit> rayCast(vec3 begin, vec3 end, bool onlyFirst) { return Manager::getInstance()._engine->rayCast(begin, end, onlyFirst); }
+size_t rayCast(vec3 begin, vec3 end, Span<RayCastHit> hits, bool onlyFirst) {
+    return Manager::getInstance()._engine->rayCast(begin, end, hits, onlyFirst);
+}
 bool areColliding(component::EntityId eid0, component::EntityId eid1) { return Manager::getInstance()._engine->areColliding(eid0, eid1); }
+std::vector<component::EntityId> overlapAabb(vec3 lower, vec3 upper) {
+    std::vector<component::EntityId> entities;
+    Manager::getInstance()._engine->overlapAabb(lower, upper, entities);
+    return entities;
+}
+std::vector<component::EntityId> overlapSphere(vec3 center, float radius) {
+    std::vector<component::EntityId> entities;
+    Manager::getInstance()._engine->overlapSphere(center, radius, entities);
+    return entities;
+}
+std::vector<RayCastHit> sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst) {
+    std::vector<RayCastHit> hits;
+    Manager::getInstance()._engine->sphereCast(begin, end, radius, onlyFirst, hits);
+    return hits;
+}
+std::vector<component::EntityId> nearest(vec3 point, unsigned k, float maxDistance) {
+    std::vector<component::EntityId> entities;
+    Manager::getInstance()._engine->nearest(point, k, maxDistance, entities);
+    return entities;
+}
+void overlapAabb(Span<const bnd3> boxes, QueryResults& results) { Manager::getInstance()._engine->overlapAabbBatch(boxes, results); }
+void overlapSphere(Span<const vec3> centers, float radius, QueryResults& results) {
+    Manager::getInstance()._engine->overlapSphereBatch(centers, radius, results);
+}
+void nearest(Span<const vec3> points, unsigned k, float maxDistance, QueryResults& results) {
+    Manager::getInstance()._engine->nearestBatch(points, k, maxDistance, results);
+}
+void rayCast(Span<const vec3> begins, Span<const vec3> ends, Span<RayCastHit> hits) {
+    Manager::getInstance()._engine->rayCastBatch(begins, ends, hits);
+}
+void sphereCast(Span<const vec3> begins, Span<const vec3> ends, float radius, Span<RayCastHit> hits) {
+    Manager::getInstance()._engine->sphereCastBatch(begins, ends, radius, hits);
+}
+Span<const Contact> getContacts(component::EntityId eid) { return Manager::getInstance()._engine->getContactList().getContacts(eid); }
 
 } // namespace atta::physics
@@ -28,10 +28,15 @@ bool getShowContacts();
 void setShowContacts(bool showContacts);
 bool getShowJoints();
 void setShowJoints(bool showJoints);
+/// Worker threads shared by the parallel batched queries and the sensor module
+/** Only one parallelFor can run at a time, so the pool is only used from the main thread **/
+std::shared_ptr<WorkerPool> getWorkerPool();
 
 //---------- Queries ----------//
 std::vector<component::EntityId> getEntityCollisions(component::EntityId eid);
 bool areColliding(component::EntityId eid0, component::EntityId eid1);
+/// Contact points of the entity found in the last step (no allocation), valid until the next step
+Span<const Contact> getContacts(component::EntityId eid);
 
 struct RayCastHit {
     cmp::Entity entity = -1;
@@ -39,6 +44,40 @@ struct RayCastHit {
     vec3 normal = vec3(0.0f);
 };
 std::vector<RayCastHit> rayCast(vec3 begin, vec3 end, bool onlyFirst = false);
+// Write hits to caller-provided memory (no heap allocation), return number of hits written
+size_t rayCast(vec3 begin, vec3 end, Span<RayCastHit> hits, bool onlyFirst = false);
+
+std::vector<component::EntityId> overlapAabb(vec3 lower, vec3 upper);
+std::vector<component::EntityId> overlapSphere(vec3 center, float radius);
+/// Sweep a sphere from begin to end, the hit distance is how much the sphere traveled until the hit
+std::vector<RayCastHit> sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst = false);
+/// Up to k entities with colliders closer than maxDistance, sorted by the distance of their position to the point
+std::vector<component::EntityId> nearest(vec3 point, unsigned k, float maxDistance);
+
+/// Results of a batch of queries
+/** The entities found by the query i are entities[offsets[i]..offsets[i+1]). The vectors keep their capacity when the
+ * results are reused, so batches of the same size do not allocate
+ **/
+struct QueryResults {
+    std::vector<component::EntityId> entities;
+    std::vector<uint32_t> offsets = {0};
+
+    void clear() {
+        entities.clear();
+        offsets.assign(1, 0);
+    }
+    size_t size() const { return offsets.size() - 1; }
+    Span<const component::EntityId> operator[](size_t i) const {
+        return Span<const component::EntityId>(entities.data() + offsets[i], offsets[i + 1] - offsets[i]);
+    }
+};
+void overlapAabb(Span<const bnd3> boxes, QueryResults& results);
+void overlapSphere(Span<const vec3> centers, float radius, QueryResults& results);
+void nearest(Span<const vec3> points, unsigned k, float maxDistance, QueryResults& results);
+/// Closest hit of each ray (entity is -1 if nothing was hit)
+void rayCast(Span<const vec3> begins, Span<const vec3> ends, Span<RayCastHit> hits);
+/// Closest hit of each sphere sweep (entity is -1 if nothing was hit)
+void sphereCast(Span<const vec3> begins, Span<const vec3> ends, float radius, Span<RayCastHit> hits);
 
 } // namespace atta::physics
 
@@ -56,6 +95,8 @@ std::shared_ptr<T> getEngine() {
         return Manager::getInstance()._bulletEngine;
     else if constexpr (std::is_same_v<T, Box2DEngine>)
         return Manager::getInstance()._box2DEngine;
+    else if constexpr (std::is_same_v<T, SwarmEngine>)
+        return Manager::getInstance()._swarmEngine;
     return nullptr;
 }
 
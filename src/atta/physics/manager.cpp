@@ -5,7 +5,11 @@
 #include <atta/physics/engines/box2DEngine.h>
 #include <atta/physics/engines/bulletEngine.h>
 #include <atta/physics/engines/noneEngine.h>
+#include <atta/physics/engines/swarmEngine.h>
 
+#include <atta/event/events/checkpointRestore.h>
+#include <atta/event/events/checkpointSave.h>
+#include <atta/event/events/createClones.h>
 #include <atta/event/events/createComponent.h>
 #include <atta/event/events/deleteComponent.h>
 #include <atta/event/events/simulationStart.h>
@@ -16,6 +20,7 @@
 #include <atta/component/components/boxCollider2D.h>
 #include <atta/component/components/circleCollider2D.h>
 #include <atta/component/components/cylinderCollider.h>
+#include <atta/component/components/meshCollider.h>
 #include <atta/component/components/rigidBody.h>
 #include <atta/component/components/rigidBody2D.h>
 #include <atta/component/components/sphereCollider.h>
@@ -32,10 +37,14 @@ void Manager::startUpImpl() {
     event::subscribe<event::SimulationStop>(BIND_EVENT_FUNC(Manager::onSimulationStateChange));
     event::subscribe<event::CreateComponent>(BIND_EVENT_FUNC(Manager::onComponentChange));
     event::subscribe<event::DeleteComponent>(BIND_EVENT_FUNC(Manager::onComponentChange));
+    event::subscribe<event::CreateClones>(BIND_EVENT_FUNC(Manager::onComponentChange));
+    event::subscribe<event::CheckpointSave>(BIND_EVENT_FUNC(Manager::onCheckpoint));
+    event::subscribe<event::CheckpointRestore>(BIND_EVENT_FUNC(Manager::onCheckpoint));
 
     _noneEngine = std::make_shared<NoneEngine>();
     _box2DEngine = std::make_shared<Box2DEngine>();
     _bulletEngine = std::make_shared<BulletEngine>();
+    _swarmEngine = std::make_shared<SwarmEngine>();
     _engine = _bulletEngine;
 
     _plane2D = Plane2D::Z;
@@ -69,6 +78,9 @@ void Manager::setEngineTypeImpl(Engine::Type type) {
         case Engine::BULLET:
             _engine = _bulletEngine;
             break;
+        case Engine::SWARM:
+            _engine = _swarmEngine;
+            break;
         default:
             LOG_WARN("physics::Manager", "Trying to select unknown physics engine");
     }
@@ -107,7 +119,37 @@ bool is2DPhysicsColliderComponent(cmp::ComponentId cmpId) {
 }
 
 bool is3DPhysicsColliderComponent(cmp::ComponentId cmpId) {
-    return cmpId == cmp::getId<cmp::BoxCollider>() || cmpId == cmp::getId<cmp::SphereCollider>() || cmpId == cmp::getId<cmp::CylinderCollider>();
+    return cmpId == cmp::getId<cmp::BoxCollider>() || cmpId == cmp::getId<cmp::SphereCollider>() || cmpId == cmp::getId<cmp::CylinderCollider>() ||
+           cmpId == cmp::getId<cmp::MeshCollider>();
+}
+
+void Manager::onCheckpoint(event::Event& event) {
+    if (!_engine->getRunning())
+        return;
+
+    // First byte stores the engine type, the state is only restored to the same engine
+    switch (event.getType()) {
+        case event::CheckpointSave::type: {
+            event::CheckpointSave& e = reinterpret_cast<event::CheckpointSave&>(event);
+            std::vector<uint8_t> engineState;
+            _engine->saveState(engineState);
+            std::vector<uint8_t>& state = e.state[SID("physics")];
+            state.resize(1 + engineState.size());
+            state[0] = uint8_t(_engine->getType());
+            std::copy(engineState.begin(), engineState.end(), state.begin() + 1);
+            break;
+        }
+        case event::CheckpointRestore::type: {
+            event::CheckpointRestore& e = reinterpret_cast<event::CheckpointRestore&>(event);
+            auto it = e.state.find(SID("physics"));
+            if (it == e.state.end() || it->second.empty() || it->second[0] != uint8_t(_engine->getType()))
+                return;
+            _engine->restoreState(std::vector<uint8_t>(it->second.begin() + 1, it->second.end()));
+            break;
+        }
+        default:
+            break;
+    }
 }
 
 void Manager::onComponentChange(event::Event& event) {
@@ -115,7 +157,7 @@ void Manager::onComponentChange(event::Event& event) {
     switch (event.getType()) {
         case event::CreateComponent::type: {
             event::CreateComponent& e = reinterpret_cast<event::CreateComponent&>(event);
-            if (_engine->getType() == Engine::BOX2D && _engine->getRunning()) {
+            if ((_engine->getType() == Engine::BOX2D || _engine->getType() == Engine::SWARM) && _engine->getRunning()) {
                 if (e.componentId == cmp::getId<cmp::RigidBody2D>())
                     _engine->createRigidBody(e.entityId);
                 if (is2DPhysicsColliderComponent(e.componentId))
@@ -126,9 +168,22 @@ void Manager::onComponentChange(event::Event& event) {
             }
             break;
         }
+        case event::CreateClones::type: {
+            event::CreateClones& e = reinterpret_cast<event::CreateClones&>(event);
+            if ((_engine->getType() == Engine::BOX2D || _engine->getType() == Engine::SWARM) && _engine->getRunning()) {
+                for (cmp::EntityId eid = e.firstClone; eid < e.firstClone + cmp::EntityId(e.numClones); eid++) {
+                    cmp::Entity entity(eid);
+                    if (entity.get<cmp::RigidBody2D>())
+                        _engine->createRigidBody(eid);
+                    if (entity.get<cmp::BoxCollider2D>() || entity.get<cmp::CircleCollider2D>())
+                        _engine->createColliders(eid);
+                }
+            }
+            break;
+        }
         case event::DeleteComponent::type: {
             event::DeleteComponent& e = reinterpret_cast<event::DeleteComponent&>(event);
-            if (_engine->getType() == Engine::BOX2D && _engine->getRunning()) {
+            if ((_engine->getType() == Engine::BOX2D || _engine->getType() == Engine::SWARM) && _engine->getRunning()) {
                 if (e.componentId == cmp::getId<cmp::RigidBody2D>())
                     _engine->deleteRigidBody(e.entityId);
                 if (is2DPhysicsColliderComponent(e.componentId))
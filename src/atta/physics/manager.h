@@ -6,6 +6,7 @@
 #include <atta/physics/engines/box2DEngine.h>
 #include <atta/physics/engines/bulletEngine.h>
 #include <atta/physics/engines/noneEngine.h>
+#include <atta/physics/engines/swarmEngine.h>
 
 namespace atta::physics {
 
@@ -32,10 +33,22 @@ class Manager final {
     friend void setShowContacts(bool showContacts);
     friend bool getShowJoints();
     friend void setShowJoints(bool showJoints);
+    friend std::shared_ptr<WorkerPool> getWorkerPool();
 
     friend std::vector<component::EntityId> getEntityCollisions(component::EntityId eid);
     friend std::vector<RayCastHit> rayCast(vec3 begin, vec3 end, bool onlyFirst);
+    friend size_t rayCast(vec3 begin, vec3 end, Span<RayCastHit> hits, bool onlyFirst);
     friend bool areColliding(component::EntityId eid0, component::EntityId eid1);
+    friend Span<const Contact> getContacts(component::EntityId eid);
+    friend std::vector<component::EntityId> overlapAabb(vec3 lower, vec3 upper);
+    friend std::vector<component::EntityId> overlapSphere(vec3 center, float radius);
+    friend std::vector<RayCastHit> sphereCast(vec3 begin, vec3 end, float radius, bool onlyFirst);
+    friend std::vector<component::EntityId> nearest(vec3 point, unsigned k, float maxDistance);
+    friend void overlapAabb(Span<const bnd3> boxes, QueryResults& results);
+    friend void overlapSphere(Span<const vec3> centers, float radius, QueryResults& results);
+    friend void nearest(Span<const vec3> points, unsigned k, float maxDistance, QueryResults& results);
+    friend void rayCast(Span<const vec3> begins, Span<const vec3> ends, Span<RayCastHit> hits);
+    friend void sphereCast(Span<const vec3> begins, Span<const vec3> ends, float radius, Span<RayCastHit> hits);
 
   private:
     void startUpImpl();
@@ -48,16 +61,19 @@ class Manager final {
 
     void onSimulationStateChange(event::Event& event);
     void onComponentChange(event::Event& event);
+    void onCheckpoint(event::Event& event);
 
     std::shared_ptr<Engine> _engine;             ///< Current physics engine
     std::shared_ptr<NoneEngine> _noneEngine;     ///< None physics engine
     std::shared_ptr<Box2DEngine> _box2DEngine;   ///< Box2D physics engine
     std::shared_ptr<BulletEngine> _bulletEngine; ///< Bullet physics engine
+    std::shared_ptr<SwarmEngine> _swarmEngine;   ///< Swarm physics engine
     Plane2D _plane2D;                            ///< Plane that is used when performing 2D simulations
     vec3 _gravity;                               ///< Gravity vector
     bool _showColliders;                         ///< UI collider rendering
     bool _showContacts;                          ///< UI contacts rendering
     bool _showJoints;                            ///< UI joints rendering
+    std::shared_ptr<WorkerPool> _workerPool;     ///< Created by the first getWorkerPool
 };
 
 } // namespace atta::physics
@@ -0,0 +1,120 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/physics/spatialIndex.h>
+
+namespace atta::physics {
+
+inline bool overlaps(const bnd3& a, const bnd3& b) {
+    return a.pMin.x <= b.pMax.x && a.pMax.x >= b.pMin.x && a.pMin.y <= b.pMax.y && a.pMax.y >= b.pMin.y && a.pMin.z <= b.pMax.z &&
+           a.pMax.z >= b.pMin.z;
+}
+
+SpatialIndex::SpatialIndex() : _cellSize(1.0f), _cellMask(0), _stamp(0) {}
+
+void SpatialIndex::clear() {
+    _entities.clear();
+    _aabbs.clear();
+    _cellStart.clear();
+    _cellItems.clear();
+    _largeItems.clear();
+}
+
+void SpatialIndex::add(component::EntityId entity, const bnd3& aabb) {
+    _entities.push_back(entity);
+    _aabbs.push_back(aabb);
+}
+
+uint32_t SpatialIndex::getCell(int cx, int cy) const { return (uint32_t(cx) * 73856093u ^ uint32_t(cy) * 19349663u) & _cellMask; }
+
+size_t SpatialIndex::getNumCells(const bnd3& box) const {
+    // Computed in float, query boxes can be very large
+    float nx = std::floor(box.pMax.x / _cellSize) - std::floor(box.pMin.x / _cellSize) + 1.0f;
+    float ny = std::floor(box.pMax.y / _cellSize) - std::floor(box.pMin.y / _cellSize) + 1.0f;
+    return nx * ny > float(std::numeric_limits<uint32_t>::max()) ? std::numeric_limits<uint32_t>::max() : size_t(nx * ny);
+}
+
+void SpatialIndex::build() {
+    PROFILE();
+    _stamps.assign(_entities.size(), 0);
+    _stamp = 0;
+
+    // Cell size of twice the average box size in the xy plane
+    float sizeSum = 0.0f;
+    size_t numFinite = 0;
+    for (const bnd3& aabb : _aabbs) {
+        float size = std::max(aabb.pMax.x - aabb.pMin.x, aabb.pMax.y - aabb.pMin.y);
+        if (std::isfinite(size)) {
+            sizeSum += size;
+            numFinite++;
+        }
+    }
+    _cellSize = numFinite ? std::max(2.0f * sizeSum / numFinite, 1e-3f) : 1.0f;
+
+    uint32_t tableSize = 64;
+    while (tableSize < 2 * _entities.size())
+        tableSize *= 2;
+    _cellMask = tableSize - 1;
+
+    // Count items of each cell, then write them sorted by cell
+    _largeItems.clear();
+    _cellStart.assign(tableSize + 1, 0);
+    for (int pass = 0; pass < 2; pass++) {
+        std::vector<uint32_t> next;
+        if (pass == 1) {
+            for (size_t c = 1; c < _cellStart.size(); c++)
+                _cellStart[c] += _cellStart[c - 1];
+            _cellItems.resize(_cellStart.back());
+            next.assign(_cellStart.begin(), _cellStart.end() - 1);
+        }
+        for (uint32_t i = 0; i < _aabbs.size(); i++) {
+            const bnd3& aabb = _aabbs[i];
+            if (getNumCells(aabb) > MAX_ITEM_CELLS) {
+                if (pass == 0)
+                    _largeItems.push_back(i);
+                continue;
+            }
+            for (int cy = getCellCoord(aabb.pMin.y); cy <= getCellCoord(aabb.pMax.y); cy++)
+                for (int cx = getCellCoord(aabb.pMin.x); cx <= getCellCoord(aabb.pMax.x); cx++) {
+                    if (pass == 0)
+                        _cellStart[getCell(cx, cy) + 1]++;
+                    else
+                        _cellItems[next[getCell(cx, cy)]++] = i;
+                }
+        }
+    }
+}
+
+void SpatialIndex::test(uint32_t item, const bnd3& box, std::vector<uint32_t>& items) {
+    if (_stamps[item] == _stamp)
+        return;
+    _stamps[item] = _stamp;
+    if (overlaps(_aabbs[item], box))
+        items.push_back(item);
+}
+
+void SpatialIndex::query(const bnd3& box, std::vector<uint32_t>& items) {
+    if (_entities.empty())
+        return;
+    if (++_stamp == 0) {
+        std::fill(_stamps.begin(), _stamps.end(), 0);
+        _stamp = 1;
+    }
+
+    // Large query box, cheaper to test all items
+    if (getNumCells(box) > _entities.size()) {
+        for (uint32_t i = 0; i < _entities.size(); i++)
+            test(i, box, items);
+        return;
+    }
+
+    for (uint32_t large : _largeItems)
+        test(large, box, items);
+    for (int cy = getCellCoord(box.pMin.y); cy <= getCellCoord(box.pMax.y); cy++)
+        for (int cx = getCellCoord(box.pMin.x); cx <= getCellCoord(box.pMax.x); cx++) {
+            uint32_t cell = getCell(cx, cy);
+            for (uint32_t k = _cellStart[cell]; k < _cellStart[cell + 1]; k++)
+                test(_cellItems[k], box, items);
+        }
+}
+
+} // namespace atta::physics
@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/base.h>
+#include <atta/utils/math/bounds.h>
+
+namespace atta::physics {
+
+/** Uniform grid of entity bounding boxes
+ *
+ * Used to answer physics queries when the engine does not have a broadphase. The grid divides the xy plane in hashed
+ * cells of the size of the typical box, each box is added to all cells it overlaps. Boxes that cover many cells are
+ * kept in a separate list and tested by all queries. The index is rebuilt from scratch with clear/add/build
+ **/
+class SpatialIndex final {
+  public:
+    SpatialIndex();
+
+    void clear();
+    void add(component::EntityId entity, const bnd3& aabb);
+    void build();
+
+    size_t getSize() const { return _entities.size(); }
+    component::EntityId getEntity(uint32_t item) const { return _entities[item]; }
+    const bnd3& getAabb(uint32_t item) const { return _aabbs[item]; }
+
+    /// Append the items whose box overlaps the query box
+    void query(const bnd3& box, std::vector<uint32_t>& items);
+
+  private:
+    static constexpr uint32_t MAX_ITEM_CELLS = 16; ///< Boxes that cover more cells are not added to the grid
+
+    int getCellCoord(float x) const { return int(std::floor(x / _cellSize)); }
+    uint32_t getCell(int cx, int cy) const;
+    size_t getNumCells(const bnd3& box) const;
+    void test(uint32_t item, const bnd3& box, std::vector<uint32_t>& items);
+
+    std::vector<component::EntityId> _entities;
+    std::vector<bnd3> _aabbs;
+
+    float _cellSize;
+    uint32_t _cellMask;                ///< Hash table size minus one (power of two)
+    std::vector<uint32_t> _cellStart;  ///< First index in _cellItems of each cell
+    std::vector<uint32_t> _cellItems;  ///< Items sorted by cell
+    std::vector<uint32_t> _largeItems; ///< Items that are not in the grid
+    std::vector<uint32_t> _stamps;     ///< Last query that tested each item
+    uint32_t _stamp;
+};
+
+} // namespace atta::physics
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/relationship.h>
+#include <atta/physics/syncedTransform.h>
+
+namespace atta::physics {
+
+SyncedTransform::Parents::Parent* SyncedTransform::Parents::get(component::EntityId entity) {
+    auto it = _parents.find(entity);
+    if (it == _parents.end())
+        it = _parents.emplace(entity, Parent{entity, _step, false, component::Transform::getEntityWorldTransform(entity)}).first;
+    return &it->second;
+}
+
+bool SyncedTransform::Parents::moved(Parent* parent) {
+    if (parent->step != _step) {
+        component::Transform world = component::Transform::getEntityWorldTransform(parent->entity);
+        parent->moved = world.position != parent->world.position || world.orientation != parent->world.orientation ||
+                        world.scale != parent->world.scale;
+        parent->world = world;
+        parent->step = _step;
+    }
+    return parent->moved;
+}
+
+SyncedTransform::SyncedTransform(component::EntityId entity, component::Transform* transform, Parents& parents)
+    : _entity(entity), _transform(transform), _parents(&parents), _parent(nullptr) {
+    component::Relationship* relationship = component::getComponent<component::Relationship>(entity);
+    if (relationship && relationship->getParent() >= 0)
+        _parent = parents.get(relationship->getParent());
+    component::Transform world = transform->getWorldTransform(entity);
+    _position = world.position;
+    _orientation = world.orientation;
+    storeLocal();
+}
+
+bool SyncedTransform::changed(vec3& position, quat& orientation) {
+    // The parent is checked first so its world transform is up to date in the next step
+    bool parentMoved = _parent && _parents->moved(_parent);
+    if (!parentMoved && _transform->position == _localPosition && _transform->orientation == _localOrientation)
+        return false;
+    storeLocal();
+
+    vec3 p = _transform->position;
+    quat o = _transform->orientation;
+    if (_parent) {
+        component::Transform world = _parent->world * *_transform;
+        p = world.position;
+        o = world.orientation;
+    }
+    if (p == _position && o == _orientation)
+        return false;
+    _position = position = p;
+    _orientation = orientation = o;
+    return true;
+}
+
+void SyncedTransform::write(vec3 position, quat orientation) {
+    if (_parent) {
+        component::Transform world = _transform->getWorldTransform(_entity);
+        world.position = position;
+        world.orientation = orientation;
+        _transform->setWorldTransform(_entity, world);
+        // Store the world transform computed from the local transform, otherwise rounding errors would be detected as changes
+        world = _transform->getWorldTransform(_entity);
+        _position = world.position;
+        _orientation = world.orientation;
+    } else {
+        _position = _transform->position = position;
+        _orientation = _transform->orientation = orientation;
+    }
+    storeLocal();
+}
+
+void SyncedTransform::storeLocal() {
+    _localPosition = _transform->position;
+    _localOrientation = _transform->orientation;
+}
+
+} // namespace atta::physics
@@ -0,0 +1,64 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/components/transform.h>
+
+namespace atta::physics {
+
+/// Last transform exchanged between a physics body and its Transform component
+/** Only the bodies in ChangedBodies are checked. Comparing the local values of the component with the last synced values
+ * ignores updates that did not change the transform. The world transform is only computed when the local transform or the
+ * parent world transform changed, the parent world transform is checked at most once per step
+ **/
+class SyncedTransform final {
+  public:
+    /// World transform of the parents of the synced bodies, shared between the bodies with the same parent
+    class Parents final {
+      public:
+        /// Must be called before the bodies are checked, the parents are checked again after it
+        void nextStep() { _step++; }
+        void clear() { _parents.clear(); }
+        /// If the entity is the parent of a synced body
+        bool contains(component::EntityId entity) const { return _parents.find(entity) != _parents.end(); }
+
+      private:
+        friend SyncedTransform;
+        struct Parent {
+            component::EntityId entity;
+            uint32_t step;              ///< Step of the last check
+            bool moved;                 ///< If the world transform changed in the last check
+            component::Transform world; ///< World transform after the last check
+        };
+        Parent* get(component::EntityId entity);
+        bool moved(Parent* parent);
+
+        uint32_t _step = 0;
+        std::unordered_map<component::EntityId, Parent> _parents;
+    };
+
+    SyncedTransform(component::EntityId entity, component::Transform* transform, Parents& parents);
+
+    /// Check if the component was changed since the last sync, the new world position/orientation are output if it was
+    bool changed(vec3& position, quat& orientation);
+    /// Write the world position/orientation computed by the engine to the component
+    void write(vec3 position, quat orientation);
+
+    component::EntityId getEntity() const { return _entity; }
+    /// World position after the last sync
+    vec3 getPosition() const { return _position; }
+
+  private:
+    void storeLocal();
+
+    component::EntityId _entity;
+    component::Transform* _transform;
+    Parents* _parents;
+    Parents::Parent* _parent; ///< Parent whose world transform is used to compute the world transform, nullptr if no parent
+    vec3 _localPosition;      ///< Component position after the last sync
+    quat _localOrientation;   ///< Component orientation after the last sync
+    vec3 _position;           ///< World position after the last sync
+    quat _orientation;        ///< World orientation after the last sync
+};
+
+} // namespace atta::physics
@@ -0,0 +1,93 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/physics/engines/bulletTaskScheduler.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::physics;
+
+namespace {
+
+struct CountBody : public btIParallelForBody {
+    std::vector<std::atomic<int>>* counts;
+    void forLoop(int iBegin, int iEnd) const override {
+        for (int i = iBegin; i < iEnd; i++)
+            (*counts)[i]++;
+    }
+};
+
+struct IndexBody : public btIParallelForBody {
+    std::vector<std::atomic<int>>* indices;
+    void forLoop(int iBegin, int iEnd) const override {
+        for (int i = iBegin; i < iEnd; i++)
+            (*indices)[i] = int(btGetCurrentThreadIndex());
+    }
+};
+
+struct SumBody : public btIParallelSumBody {
+    btScalar sumLoop(int iBegin, int iEnd) const override {
+        btScalar sum = 0;
+        for (int i = iBegin; i < iEnd; i++)
+            sum += btScalar(i);
+        return sum;
+    }
+};
+
+TEST(Physics_BulletTaskScheduler, ParallelFor) {
+    BulletTaskScheduler scheduler(4);
+    EXPECT_EQ(scheduler.getNumThreads(), 4);
+
+    std::vector<std::atomic<int>> counts(10000);
+    CountBody body;
+    body.counts = &counts;
+    for (int it = 0; it < 100; it++)
+        scheduler.parallelFor(0, counts.size(), 7, body);
+    for (const std::atomic<int>& c : counts)
+        ASSERT_EQ(c, 100);
+}
+
+TEST(Physics_BulletTaskScheduler, ParallelSum) {
+    BulletTaskScheduler scheduler(4);
+    SumBody body;
+    EXPECT_EQ(scheduler.parallelSum(0, 1000, 10, body), btScalar(999 * 1000 / 2));
+    EXPECT_EQ(scheduler.parallelSum(0, 5, 10, body), btScalar(10)); // Smaller than one chunk
+    EXPECT_EQ(scheduler.parallelSum(3, 3, 10, body), btScalar(0));
+}
+
+TEST(Physics_BulletTaskScheduler, SetNumThreads) {
+    BulletTaskScheduler scheduler(2);
+    std::vector<std::atomic<int>> counts(1000);
+    CountBody body;
+    body.counts = &counts;
+    scheduler.parallelFor(0, counts.size(), 1, body);
+
+    scheduler.setNumThreads(8);
+    EXPECT_EQ(scheduler.getNumThreads(), 8);
+    scheduler.parallelFor(0, counts.size(), 1, body);
+
+    scheduler.setNumThreads(1);
+    EXPECT_EQ(scheduler.getNumThreads(), 1);
+    scheduler.parallelFor(0, counts.size(), 1, body);
+
+    for (const std::atomic<int>& c : counts)
+        ASSERT_EQ(c, 3);
+}
+
+TEST(Physics_BulletTaskScheduler, ThreadIndices) {
+    BulletTaskScheduler scheduler(2);
+    std::vector<std::atomic<int>> indices(1000);
+    IndexBody body;
+    body.indices = &indices;
+
+    // Each change replaces the workers, the indices must stay below the number of threads
+    for (int it = 0; it < 4 * BT_MAX_THREAD_COUNT; it++) {
+        int numThreads = it % 2 ? 8 : 3;
+        scheduler.setNumThreads(numThreads);
+        scheduler.parallelFor(0, indices.size(), 1, body);
+        for (const std::atomic<int>& index : indices)
+            ASSERT_LT(index, numThreads);
+    }
+    EXPECT_EQ(btGetCurrentThreadIndex(), 0u);
+}
+
+} // namespace
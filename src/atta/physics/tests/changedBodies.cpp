@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/name.h>
+#include <atta/component/components/relationship.h>
+#include <atta/component/components/rigidBody.h>
+#include <atta/component/components/transform.h>
+#include <atta/component/tests/common.h>
+#include <atta/physics/changedBodies.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::physics;
+
+namespace {
+
+class Physics_ChangedBodies : public ::testing::Test {
+  public:
+    void SetUp() override {
+        component::test::startUp();
+        _parent = component::createEntity();
+        _parent.add<component::Transform>();
+        _parent.add<component::RigidBody>();
+        _parent.add<component::Name>();
+        _child = component::createEntity();
+        _child.add<component::Transform>();
+        component::Relationship::setParent(_parent, _child);
+        _grandchild = component::createEntity();
+        _grandchild.add<component::Transform>();
+        component::Relationship::setParent(_child, _grandchild);
+    }
+
+  protected:
+    component::Entity _parent;
+    component::Entity _child;
+    component::Entity _grandchild;
+};
+
+TEST_F(Physics_ChangedBodies, UpdateComponent) {
+    ChangedBodies changed;
+    changed.start();
+
+    // Transform updates also change the world transform of the descendants
+    _parent.update<component::Transform>();
+    EXPECT_EQ(changed.get(), (std::vector<component::EntityId>{_parent, _child, _grandchild}));
+    changed.clear();
+    _child.update<component::Transform>();
+    EXPECT_EQ(changed.get(), (std::vector<component::EntityId>{_child, _grandchild}));
+    changed.clear();
+
+    // Rigid body updates only change the entity
+    _parent.update<component::RigidBody>();
+    EXPECT_EQ(changed.get(), (std::vector<component::EntityId>{_parent}));
+    changed.clear();
+
+    // Other components are ignored
+    _parent.update<component::Name>();
+    EXPECT_TRUE(changed.get().empty());
+}
+
+TEST_F(Physics_ChangedBodies, Stop) {
+    ChangedBodies changed;
+    changed.start();
+    _parent.update<component::Transform>();
+    changed.stop();
+    EXPECT_TRUE(changed.get().empty());
+
+    // Updates are only listened while started
+    _parent.update<component::Transform>();
+    EXPECT_TRUE(changed.get().empty());
+    changed.start();
+    _child.update<component::Transform>();
+    EXPECT_EQ(changed.get(), (std::vector<component::EntityId>{_child, _grandchild}));
+}
+
+} // namespace
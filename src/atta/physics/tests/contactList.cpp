@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/physics/contactList.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::physics;
+
+namespace {
+
+TEST(Physics_ContactList, Query) {
+    ContactList contacts;
+    contacts.add(5, 2, vec3(1.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f), 3.0f);
+    contacts.add(5, 2, vec3(2.0f, 0.0f, 0.0f), vec3(0.0f, 1.0f, 0.0f), 1.0f);
+    contacts.add(0, 5, vec3(0.0f), vec3(1.0f, 0.0f, 0.0f));
+    contacts.build();
+
+    EXPECT_EQ(contacts.getContacts().size(), 6);
+    ASSERT_EQ(contacts.getContacts(5).size(), 3);
+    EXPECT_EQ(contacts.getContacts(5)[0].other, 0);
+    EXPECT_EQ(contacts.getContacts(5)[1].other, 2);
+    EXPECT_EQ(contacts.getContacts(5)[1].entity, 5);
+    EXPECT_EQ(contacts.getContacts(5)[1].normal, vec3(0.0f, 1.0f, 0.0f));
+    ASSERT_EQ(contacts.getContacts(2).size(), 2);
+    EXPECT_EQ(contacts.getContacts(2)[0].normal, vec3(0.0f, -1.0f, 0.0f));
+    EXPECT_EQ(contacts.getContacts(2)[0].impulse + contacts.getContacts(2)[1].impulse, 4.0f);
+
+    EXPECT_EQ(contacts.getEntities(5), (std::vector<component::EntityId>{0, 2}));
+    EXPECT_EQ(contacts.getEntities(2), (std::vector<component::EntityId>{5}));
+    EXPECT_TRUE(contacts.areColliding(2, 5));
+    EXPECT_TRUE(contacts.areColliding(5, 0));
+    EXPECT_FALSE(contacts.areColliding(0, 2));
+
+    // Entities without contacts
+    EXPECT_TRUE(contacts.getContacts(1).empty());
+    EXPECT_TRUE(contacts.getContacts(100).empty());
+    EXPECT_TRUE(contacts.getContacts(-1).empty());
+}
+
+TEST(Physics_ContactList, Rebuild) {
+    ContactList contacts;
+    contacts.add(10, 11, vec3(0.0f), vec3(1.0f, 0.0f, 0.0f));
+    contacts.build();
+    EXPECT_TRUE(contacts.areColliding(10, 11));
+
+    contacts.clear();
+    contacts.add(1, 2, vec3(0.0f), vec3(1.0f, 0.0f, 0.0f));
+    contacts.build();
+    EXPECT_FALSE(contacts.areColliding(10, 11));
+    EXPECT_TRUE(contacts.getContacts(10).empty());
+    EXPECT_TRUE(contacts.areColliding(1, 2));
+
+    contacts.clear();
+    contacts.build();
+    EXPECT_TRUE(contacts.getContacts().empty());
+    EXPECT_TRUE(contacts.getContacts(1).empty());
+}
+
+} // namespace
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/physics/spatialIndex.h>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace atta;
+using namespace atta::physics;
+
+namespace {
+
+bnd3 box(vec3 center, float halfSize) { return bnd3(center - vec3(halfSize), center + vec3(halfSize)); }
+
+// Entities of the items found by the index, sorted
+std::vector<component::EntityId> query(SpatialIndex& index, const bnd3& b) {
+    std::vector<uint32_t> items;
+    index.query(b, items);
+    std::vector<component::EntityId> entities;
+    for (uint32_t item : items)
+        entities.push_back(index.getEntity(item));
+    std::sort(entities.begin(), entities.end());
+    return entities;
+}
+
+// Entities overlapping the box, testing all of them
+std::vector<component::EntityId> bruteForce(const SpatialIndex& index, const bnd3& b) {
+    std::vector<component::EntityId> entities;
+    for (uint32_t i = 0; i < index.getSize(); i++) {
+        const bnd3& a = index.getAabb(i);
+        if (a.pMin.x <= b.pMax.x && a.pMax.x >= b.pMin.x && a.pMin.y <= b.pMax.y && a.pMax.y >= b.pMin.y && a.pMin.z <= b.pMax.z &&
+            a.pMax.z >= b.pMin.z)
+            entities.push_back(index.getEntity(i));
+    }
+    std::sort(entities.begin(), entities.end());
+    return entities;
+}
+
+TEST(Physics_SpatialIndex, Query) {
+    SpatialIndex index;
+    index.add(3, box(vec3(0.0f), 0.5f));
+    index.add(7, box(vec3(2.0f, 0.0f, 0.0f), 0.5f));
+    index.add(9, box(vec3(0.0f, 0.0f, 3.0f), 0.5f));
+    index.build();
+
+    EXPECT_EQ(query(index, box(vec3(0.0f), 0.1f)), (std::vector<component::EntityId>{3}));
+    EXPECT_EQ(query(index, box(vec3(1.0f, 0.0f, 0.0f), 0.6f)), (std::vector<component::EntityId>{3, 7}));
+    EXPECT_EQ(query(index, box(vec3(0.0f), 10.0f)), (std::vector<component::EntityId>{3, 7, 9}));
+    EXPECT_TRUE(query(index, box(vec3(-5.0f), 1.0f)).empty());
+
+    // Boxes overlapping in xy but not in z
+    EXPECT_EQ(query(index, box(vec3(0.0f, 0.0f, 2.0f), 0.6f)), (std::vector<component::EntityId>{9}));
+}
+
+TEST(Physics_SpatialIndex, LargeAndInfinite) {
+    constexpr float inf = std::numeric_limits<float>::infinity();
+    SpatialIndex index;
+    for (int i = 0; i < 20; i++)
+        index.add(i, box(vec3(float(i), 0.0f, 0.0f), 0.4f));
+    index.add(100, bnd3(vec3(-50.0f, -50.0f, -1.0f), vec3(50.0f, -49.0f, 1.0f))); // Wall
+    index.add(101, bnd3(vec3(4.0f, 4.0f, -inf), vec3(5.0f, 5.0f, inf)));        // 2D collider
+    index.build();
+
+    EXPECT_EQ(query(index, box(vec3(0.0f, -49.5f, 0.0f), 0.1f)), (std::vector<component::EntityId>{100}));
+    EXPECT_EQ(query(index, box(vec3(4.5f, 4.5f, 1000.0f), 0.1f)), (std::vector<component::EntityId>{101}));
+    EXPECT_EQ(query(index, box(vec3(10.0f, 0.0f, 0.0f), 0.5f)), (std::vector<component::EntityId>{10}));
+}
+
+TEST(Physics_SpatialIndex, MatchesBruteForce) {
+    SpatialIndex index;
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+    std::uniform_real_distribution<float> size(0.1f, 3.0f);
+    for (int i = 0; i < 2000; i++)
+        index.add(i, box(vec3(pos(gen), pos(gen), pos(gen) * 0.1f), size(gen)));
+    index.build();
+
+    for (int i = 0; i < 200; i++) {
+        bnd3 b = box(vec3(pos(gen), pos(gen), pos(gen) * 0.1f), size(gen) * (i % 10 == 0 ? 20.0f : 1.0f));
+        EXPECT_EQ(query(index, b), bruteForce(index, b));
+    }
+
+    // Rebuild with fewer items
+    index.clear();
+    index.add(1, box(vec3(0.0f), 1.0f));
+    index.build();
+    EXPECT_EQ(index.getSize(), 1);
+    EXPECT_EQ(query(index, box(vec3(0.5f), 0.1f)), (std::vector<component::EntityId>{1}));
+}
+
+//---------- Speed ----------//
+// Small box queries among objects scattered in a large area, like the sensor queries of many robots
+class Physics_QuerySpeed : public ::testing::Test {
+  public:
+    static constexpr int NUM_QUERIES = 1000;
+
+    void SetUp() override {
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<float> pos(-500.0f, 500.0f);
+        for (int i = 0; i < 100000; i++)
+            _index.add(i, box(vec3(pos(gen), pos(gen), 0.0f), 0.5f));
+        _index.build();
+        for (int i = 0; i < NUM_QUERIES; i++)
+            _queries.push_back(box(vec3(pos(gen), pos(gen), 0.0f), 2.0f));
+    }
+
+    template <typename Query>
+    void run(Query q) {
+        std::vector<uint32_t> items;
+        size_t numFound = 0;
+        auto begin = std::chrono::steady_clock::now();
+        for (const bnd3& b : _queries) {
+            items.clear();
+            q(b, items);
+            numFound += items.size();
+        }
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - begin;
+        RecordProperty("queriesPerSecond", int(NUM_QUERIES / seconds.count()));
+        EXPECT_GT(numFound, 0);
+    }
+
+  protected:
+    SpatialIndex _index;
+    std::vector<bnd3> _queries;
+};
+
+TEST_F(Physics_QuerySpeed, BruteForce) {
+    run([&](const bnd3& b, std::vector<uint32_t>& items) {
+        for (uint32_t i = 0; i < _index.getSize(); i++) {
+            const bnd3& a = _index.getAabb(i);
+            if (a.pMin.x <= b.pMax.x && a.pMax.x >= b.pMin.x && a.pMin.y <= b.pMax.y && a.pMax.y >= b.pMin.y)
+                items.push_back(i);
+        }
+    });
+}
+
+TEST_F(Physics_QuerySpeed, Index) {
+    run([&](const bnd3& b, std::vector<uint32_t>& items) { _index.query(b, items); });
+}
+
+} // namespace
@@ -0,0 +1,346 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/boxCollider.h>
+#include <atta/component/components/boxCollider2D.h>
+#include <atta/component/components/rigidBody.h>
+#include <atta/component/components/rigidBody2D.h>
+#include <atta/component/components/transform.h>
+#include <atta/component/tests/common.h>
+#include <atta/physics/engines/box2DEngine.h>
+#include <atta/physics/engines/bulletEngine.h>
+#include <atta/physics/engines/noneEngine.h>
+#include <atta/physics/interface.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <cstdlib>
+#include <random>
+
+using namespace atta;
+using namespace atta::physics;
+
+namespace {
+constexpr int NUM_STEPS = 60;
+constexpr int NUM_LAYERS = 10;
+
+// Compare the single-threaded and multithreaded BulletEngine worlds with stacks of boxes in contact, including the component sync
+class Physics_Speed : public ::testing::Test {
+  public:
+    void SetUp() override { component::test::startUp(); }
+    void TearDown() override { component::clear(); }
+
+    void run(bool multithreaded, int numBodies) {
+        createBodies(numBodies);
+
+        BulletEngine engine;
+        engine.setMultithreaded(multithreaded);
+        engine.start();
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < NUM_STEPS; i++)
+            engine.step(1.0f / 60.0f);
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - begin;
+        engine.stop();
+        RecordProperty("stepsPerSecond", int(NUM_STEPS / seconds.count()));
+    }
+
+  private:
+    void createBodies(int numBodies) {
+        // Ground
+        addBody(component::RigidBody::STATIC, vec3(0.0f, 0.0f, -0.5f), vec3(2000.0f, 2000.0f, 1.0f));
+
+        // Boxes in a square grid with NUM_LAYERS layers
+        int side = int(std::ceil(std::sqrt(float(numBodies) / NUM_LAYERS)));
+        for (int i = 0; i < numBodies; i++) {
+            int layer = i / (side * side);
+            int x = (i % (side * side)) % side;
+            int y = (i % (side * side)) / side;
+            addBody(component::RigidBody::DYNAMIC, vec3(x - side * 0.5f, y - side * 0.5f, 0.5f + layer * 1.01f), vec3(1.0f));
+        }
+    }
+
+    void addBody(component::RigidBody::Type type, vec3 position, vec3 scale) {
+        component::Entity e = component::createEntity();
+        component::Transform* t = e.add<component::Transform>();
+        t->position = position;
+        t->scale = scale;
+        e.add<component::RigidBody>()->type = type;
+        e.add<component::BoxCollider>();
+    }
+};
+
+// The number of bodies is limited by the number of entities (component::maxEntities)
+TEST_F(Physics_Speed, Sequential250) { run(false, 250); }
+TEST_F(Physics_Speed, Multithreaded250) { run(true, 250); }
+TEST_F(Physics_Speed, Sequential1k) { run(false, 1000); }
+TEST_F(Physics_Speed, Multithreaded1k) { run(true, 1000); }
+
+// Same comparison with the bullet worlds only, without the entity limit and the component sync of the engine
+class Physics_WorldSpeed : public ::testing::Test {
+  public:
+    void TearDown() override {
+        for (int i = _world->getNumCollisionObjects() - 1; i >= 0; i--) {
+            btCollisionObject* obj = _world->getCollisionObjectArray()[i];
+            btRigidBody* body = btRigidBody::upcast(obj);
+            if (body && body->getMotionState())
+                delete body->getMotionState();
+            _world->removeCollisionObject(obj);
+            delete obj;
+        }
+        _world.reset();
+        _solver.reset();
+        _solverPool.reset();
+        _dispatcher.reset();
+        _broadPhase.reset();
+        _collisionConfiguration.reset();
+        btSetTaskScheduler(btGetSequentialTaskScheduler());
+        _taskScheduler.reset();
+    }
+
+    void run(bool multithreaded, int numBodies) {
+        createWorld(multithreaded);
+        createBodies(numBodies);
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < NUM_STEPS; i++)
+            _world->stepSimulation(1.0f / 60.0f, 1, 1.0f / 60.0f);
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - begin;
+        RecordProperty("stepsPerSecond", int(NUM_STEPS / seconds.count()));
+    }
+
+  private:
+    void createWorld(bool multithreaded) {
+        _collisionConfiguration = std::make_unique<btDefaultCollisionConfiguration>();
+        _broadPhase = std::make_unique<btDbvtBroadphase>();
+        if (multithreaded) {
+            _taskScheduler = std::make_unique<BulletTaskScheduler>();
+            btSetTaskScheduler(_taskScheduler.get());
+            _dispatcher = std::make_unique<btCollisionDispatcherMt>(_collisionConfiguration.get());
+            _solverPool = std::make_unique<btConstraintSolverPoolMt>(_taskScheduler->getNumThreads());
+            _solver = std::make_unique<btSequentialImpulseConstraintSolverMt>();
+            _world = std::make_unique<btDiscreteDynamicsWorldMt>(_dispatcher.get(), _broadPhase.get(), _solverPool.get(), _solver.get(),
+                                                                 _collisionConfiguration.get());
+        } else {
+            _dispatcher = std::make_unique<btCollisionDispatcher>(_collisionConfiguration.get());
+            _solver = std::make_unique<btSequentialImpulseConstraintSolver>();
+            _world = std::make_unique<btDiscreteDynamicsWorld>(_dispatcher.get(), _broadPhase.get(), _solver.get(), _collisionConfiguration.get());
+        }
+        _world->setGravity(btVector3(0.0f, 0.0f, -9.81f));
+    }
+
+    void createBodies(int numBodies) {
+        // Ground
+        addBody(&_groundShape, 0.0f, btVector3(0.0f, 0.0f, -0.5f));
+
+        // Boxes in a square grid with NUM_LAYERS layers
+        int side = int(std::ceil(std::sqrt(float(numBodies) / NUM_LAYERS)));
+        for (int i = 0; i < numBodies; i++) {
+            int layer = i / (side * side);
+            int x = (i % (side * side)) % side;
+            int y = (i % (side * side)) / side;
+            addBody(&_boxShape, 1.0f, btVector3(x - side * 0.5f, y - side * 0.5f, 0.5f + layer * 1.01f));
+        }
+    }
+
+    void addBody(btCollisionShape* shape, btScalar mass, btVector3 position) {
+        btVector3 localInertia(0.0f, 0.0f, 0.0f);
+        if (mass > 0.0f)
+            shape->calculateLocalInertia(mass, localInertia);
+        btDefaultMotionState* motionState = new btDefaultMotionState(btTransform(btQuaternion::getIdentity(), position));
+        _world->addRigidBody(new btRigidBody(btRigidBody::btRigidBodyConstructionInfo(mass, motionState, shape, localInertia)));
+    }
+
+    btBoxShape _boxShape{btVector3(0.5f, 0.5f, 0.5f)};
+    btBoxShape _groundShape{btVector3(1000.0f, 1000.0f, 0.5f)};
+    std::unique_ptr<BulletTaskScheduler> _taskScheduler;
+    std::unique_ptr<btDefaultCollisionConfiguration> _collisionConfiguration;
+    std::unique_ptr<btBroadphaseInterface> _broadPhase;
+    std::unique_ptr<btCollisionDispatcher> _dispatcher;
+    std::unique_ptr<btConstraintSolverPoolMt> _solverPool;
+    std::unique_ptr<btSequentialImpulseConstraintSolver> _solver;
+    std::unique_ptr<btDiscreteDynamicsWorld> _world;
+};
+
+TEST_F(Physics_WorldSpeed, Sequential1k) { run(false, 1000); }
+TEST_F(Physics_WorldSpeed, Multithreaded1k) { run(true, 1000); }
+TEST_F(Physics_WorldSpeed, Sequential5k) { run(false, 5000); }
+TEST_F(Physics_WorldSpeed, Multithreaded5k) { run(true, 5000); }
+TEST_F(Physics_WorldSpeed, Sequential20k) { run(false, 20000); }
+TEST_F(Physics_WorldSpeed, Multithreaded20k) { run(true, 20000); }
+
+// Bytes allocated by Bullet (btAlignedAlloc), the collision shapes and their BVHs are allocated with it
+std::atomic<size_t> bulletBytes{0};
+void* countingAlloc(size_t size) {
+    bulletBytes += size;
+    return std::malloc(size);
+}
+void countingFree(void* memory) { std::free(memory); }
+
+// Compare one triangle mesh shape per body (BulletEngine without the shape cache) with one shape shared by all bodies
+class Physics_ShapeCache : public ::testing::Test {
+  public:
+    static constexpr int GRID = 32; ///< Mesh is a GRID x GRID grid of quads
+
+    void SetUp() override {
+        btAlignedAllocSetCustom(countingAlloc, countingFree);
+        _collisionConfiguration = std::make_unique<btDefaultCollisionConfiguration>();
+        _broadPhase = std::make_unique<btDbvtBroadphase>();
+        _dispatcher = std::make_unique<btCollisionDispatcher>(_collisionConfiguration.get());
+        _solver = std::make_unique<btSequentialImpulseConstraintSolver>();
+        _world = std::make_unique<btDiscreteDynamicsWorld>(_dispatcher.get(), _broadPhase.get(), _solver.get(), _collisionConfiguration.get());
+    }
+
+    void TearDown() override {
+        for (int i = _world->getNumCollisionObjects() - 1; i >= 0; i--) {
+            btCollisionObject* obj = _world->getCollisionObjectArray()[i];
+            btRigidBody* body = btRigidBody::upcast(obj);
+            if (body && body->getMotionState())
+                delete body->getMotionState();
+            _world->removeCollisionObject(obj);
+            delete obj;
+        }
+        _world.reset();
+        _solver.reset();
+        _dispatcher.reset();
+        _broadPhase.reset();
+        _collisionConfiguration.reset();
+        _shapes.clear();
+        _meshes.clear();
+        btAlignedAllocSetCustom(nullptr, nullptr);
+    }
+
+    void run(bool shared, int numBodies) {
+        // Static meshes in a grid, with a box falling on each of them
+        size_t bytes = bulletBytes;
+        int side = int(std::ceil(std::sqrt(float(numBodies))));
+        for (int i = 0; i < numBodies; i++) {
+            btVector3 position((i % side) * 5.0f, (i / side) * 5.0f, 0.0f);
+            if (shared && !_shapes.empty())
+                addBody(_shapes.front().get(), 0.0f, position);
+            else
+                addBody(createMeshShape(), 0.0f, position);
+            addBody(&_boxShape, 1.0f, position + btVector3(0.0f, 0.0f, 1.0f));
+        }
+        size_t meshBytes = 0;
+        for (const Mesh& mesh : _meshes)
+            meshBytes += mesh.vertices.size() * sizeof(btScalar) + mesh.indices.size() * sizeof(int);
+        RecordProperty("shapeKiB", int((bulletBytes - bytes + meshBytes) / 1024));
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < NUM_STEPS; i++) {
+            _world->updateAabbs();
+            _world->computeOverlappingPairs();
+        }
+        std::chrono::duration<double, std::micro> us = std::chrono::steady_clock::now() - begin;
+        RecordProperty("broadphaseMicroseconds", int(us.count() / NUM_STEPS));
+    }
+
+  private:
+    struct Mesh {
+        std::vector<btScalar> vertices;
+        std::vector<int> indices;
+        std::unique_ptr<btTriangleIndexVertexArray> array;
+    };
+
+    btCollisionShape* createMeshShape() {
+        Mesh& mesh = _meshes.emplace_back();
+        for (int y = 0; y <= GRID; y++)
+            for (int x = 0; x <= GRID; x++)
+                mesh.vertices.insert(mesh.vertices.end(), {x * 4.0f / GRID - 2.0f, y * 4.0f / GRID - 2.0f, 0.1f * std::sin(float(x + y))});
+        for (int y = 0; y < GRID; y++)
+            for (int x = 0; x < GRID; x++) {
+                int v = y * (GRID + 1) + x;
+                mesh.indices.insert(mesh.indices.end(), {v, v + 1, v + GRID + 2, v, v + GRID + 2, v + GRID + 1});
+            }
+        mesh.array = std::make_unique<btTriangleIndexVertexArray>(int(mesh.indices.size() / 3), mesh.indices.data(), int(3 * sizeof(int)),
+                                                                  int(mesh.vertices.size() / 3), mesh.vertices.data(), int(3 * sizeof(btScalar)));
+        _shapes.push_back(std::make_unique<btBvhTriangleMeshShape>(mesh.array.get(), true));
+        return _shapes.back().get();
+    }
+
+    void addBody(btCollisionShape* shape, btScalar mass, btVector3 position) {
+        btVector3 localInertia(0.0f, 0.0f, 0.0f);
+        if (mass > 0.0f)
+            shape->calculateLocalInertia(mass, localInertia);
+        btDefaultMotionState* motionState = new btDefaultMotionState(btTransform(btQuaternion::getIdentity(), position));
+        _world->addRigidBody(new btRigidBody(btRigidBody::btRigidBodyConstructionInfo(mass, motionState, shape, localInertia)));
+    }
+
+    btBoxShape _boxShape{btVector3(0.5f, 0.5f, 0.5f)};
+    std::vector<Mesh> _meshes;
+    std::vector<std::unique_ptr<btCollisionShape>> _shapes;
+    std::unique_ptr<btDefaultCollisionConfiguration> _collisionConfiguration;
+    std::unique_ptr<btBroadphaseInterface> _broadPhase;
+    std::unique_ptr<btCollisionDispatcher> _dispatcher;
+    std::unique_ptr<btSequentialImpulseConstraintSolver> _solver;
+    std::unique_ptr<btDiscreteDynamicsWorld> _world;
+};
+
+TEST_F(Physics_ShapeCache, Unique1k) { run(false, 1000); }
+TEST_F(Physics_ShapeCache, Shared1k) { run(true, 1000); }
+
+// Query throughput of the engines with the same static boxes, like the sensor queries of many robots. The NoneEngine
+// queries the SpatialIndex directly
+class Physics_EngineQuerySpeed : public ::testing::Test {
+  public:
+    static constexpr int NUM_BODIES = 1000;
+    static constexpr int NUM_QUERIES = 10000;
+    static constexpr float RADIUS = 3.0f;
+
+    void SetUp() override {
+        component::test::startUp();
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<float> pos(-50.0f, 50.0f);
+        for (int i = 0; i < NUM_BODIES; i++) {
+            // Both 2D and 3D components, each engine uses its own
+            component::Entity e = component::createEntity();
+            e.add<component::Transform>()->position = vec3(pos(gen), pos(gen), 0.0f);
+            e.add<component::RigidBody>()->type = component::RigidBody::STATIC;
+            e.add<component::BoxCollider>();
+            e.add<component::RigidBody2D>()->type = component::RigidBody2D::STATIC;
+            e.add<component::BoxCollider2D>();
+        }
+        for (int i = 0; i < NUM_QUERIES; i++) {
+            vec3 center(pos(gen), pos(gen), 0.0f);
+            _boxes.push_back(bnd3(center - vec3(RADIUS), center + vec3(RADIUS)));
+            _centers.push_back(center);
+        }
+    }
+    void TearDown() override { component::clear(); }
+
+    void run(Engine& engine) {
+        engine.start();
+        QueryResults results;
+        auto begin = std::chrono::steady_clock::now();
+        engine.overlapAabbBatch(_boxes, results);
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - begin;
+        RecordProperty("aabbQueriesPerSecond", int(NUM_QUERIES / seconds.count()));
+        EXPECT_FALSE(results.entities.empty());
+
+        begin = std::chrono::steady_clock::now();
+        engine.overlapSphereBatch(_centers, RADIUS, results);
+        seconds = std::chrono::steady_clock::now() - begin;
+        RecordProperty("sphereQueriesPerSecond", int(NUM_QUERIES / seconds.count()));
+        EXPECT_FALSE(results.entities.empty());
+        engine.stop();
+    }
+
+  private:
+    std::vector<bnd3> _boxes;
+    std::vector<vec3> _centers;
+};
+
+TEST_F(Physics_EngineQuerySpeed, None) {
+    NoneEngine engine;
+    run(engine);
+}
+
+TEST_F(Physics_EngineQuerySpeed, Box2D) {
+    Box2DEngine engine;
+    run(engine);
+}
+
+TEST_F(Physics_EngineQuerySpeed, Bullet) {
+    BulletEngine engine;
+    run(engine);
+}
+
+} // namespace
@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/physics/engines/swarmWorld.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::physics;
+
+namespace {
+
+SwarmWorld::BodyInfo circle(vec2 position, float radius = 0.5f) {
+    SwarmWorld::BodyInfo info;
+    info.position = position;
+    info.size = vec2(radius, 0.0f);
+    return info;
+}
+
+SwarmWorld::BodyInfo box(vec2 position, vec2 halfSize, SwarmWorld::Type type = SwarmWorld::STATIC) {
+    SwarmWorld::BodyInfo info;
+    info.type = type;
+    info.shape = SwarmWorld::BOX;
+    info.position = position;
+    info.size = halfSize;
+    return info;
+}
+
+TEST(Physics_SwarmWorld, CircleCircle) {
+    SwarmWorld world;
+    SwarmWorld::BodyIndex a = world.addBody(circle(vec2(0.0f, 0.0f)));
+    SwarmWorld::BodyIndex b = world.addBody(circle(vec2(0.6f, 0.0f)));
+    world.step(0.01f);
+
+    ASSERT_EQ(world.getContacts().size(), 1);
+    EXPECT_EQ(world.getBodyContacts(a).size(), 1);
+    EXPECT_EQ(world.getBodyContacts(b).size(), 1);
+    EXPECT_NEAR(world.getContacts()[0].normal.x, 1.0f, 1e-5f);
+
+    // Penetration is resolved symmetrically after a few steps
+    for (int i = 0; i < 20; i++)
+        world.step(0.01f);
+    float distance = world.getPosition(b).x - world.getPosition(a).x;
+    EXPECT_NEAR(distance, 1.0f, 0.01f);
+    EXPECT_NEAR(world.getPosition(a).x + world.getPosition(b).x, 0.6f, 1e-4f);
+}
+
+TEST(Physics_SwarmWorld, CircleBox) {
+    // Wall is much larger than the agents, it is not in the grid
+    SwarmWorld world;
+    for (int i = 0; i < 10; i++)
+        world.addBody(circle(vec2(float(i) * 3.0f, 10.0f)));
+    SwarmWorld::BodyIndex wall = world.addBody(box(vec2(0.0f, 0.0f), vec2(50.0f, 1.0f)));
+    SwarmWorld::BodyIndex agent = world.addBody(circle(vec2(2.0f, 1.3f)));
+    for (int i = 0; i < 20; i++)
+        world.step(0.01f);
+
+    // Static wall does not move, agent is pushed out
+    EXPECT_EQ(world.getPosition(wall), vec2(0.0f, 0.0f));
+    EXPECT_NEAR(world.getPosition(agent).y, 1.5f, 0.01f);
+    EXPECT_NEAR(world.getPosition(agent).x, 2.0f, 1e-5f);
+}
+
+TEST(Physics_SwarmWorld, BoxBox) {
+    SwarmWorld world;
+    world.addBody(box(vec2(0.0f, 0.0f), vec2(0.5f, 0.5f)));
+    SwarmWorld::BodyIndex b = world.addBody(box(vec2(0.9f, 0.1f), vec2(0.5f, 0.5f), SwarmWorld::DYNAMIC));
+    for (int i = 0; i < 20; i++)
+        world.step(0.01f);
+    EXPECT_NEAR(world.getPosition(b).x, 1.0f, 0.01f);
+    EXPECT_NEAR(world.getPosition(b).y, 0.1f, 1e-5f);
+}
+
+TEST(Physics_SwarmWorld, Drive) {
+    SwarmWorld world;
+    SwarmWorld::BodyIndex robot = world.addBody(circle(vec2(1.0f, 0.0f), 0.1f));
+    world.setAngle(robot, float(M_PI) / 2.0f);
+
+    // Half circle of radius 1 around the origin in one second
+    world.setDrive(robot, float(M_PI), float(M_PI));
+    for (int i = 0; i < 100; i++)
+        world.step(0.01f);
+    EXPECT_NEAR(world.getPosition(robot).x, -1.0f, 1e-3f);
+    EXPECT_NEAR(world.getPosition(robot).y, 0.0f, 1e-3f);
+
+    world.clearDrive(robot);
+    world.setLinearVelocity(robot, vec2(0.0f));
+    world.step(0.01f);
+    EXPECT_NEAR(world.getPosition(robot).x, -1.0f, 1e-3f);
+}
+
+TEST(Physics_SwarmWorld, RayCast) {
+    SwarmWorld world;
+    SwarmWorld::BodyIndex a = world.addBody(circle(vec2(2.0f, 0.0f)));
+    SwarmWorld::BodyIndex b = world.addBody(circle(vec2(5.0f, 0.0f)));
+    world.addBody(circle(vec2(5.0f, 5.0f)));
+    SwarmWorld::BodyIndex wall = world.addBody(box(vec2(10.0f, 0.0f), vec2(1.0f, 20.0f)));
+
+    std::vector<SwarmWorld::RayHit> hits;
+    world.rayCast(vec2(0.0f, 0.0f), vec2(20.0f, 0.0f), false, hits);
+    ASSERT_EQ(hits.size(), 3);
+    EXPECT_EQ(hits[0].body, a);
+    EXPECT_NEAR(hits[0].distance, 1.5f, 1e-4f);
+    EXPECT_NEAR(hits[0].normal.x, -1.0f, 1e-4f);
+    EXPECT_EQ(hits[1].body, b);
+    EXPECT_EQ(hits[2].body, wall);
+    EXPECT_NEAR(hits[2].distance, 9.0f, 1e-4f);
+
+    world.rayCast(vec2(20.0f, 0.0f), vec2(0.0f, 0.0f), true, hits);
+    ASSERT_EQ(hits.size(), 1);
+    EXPECT_EQ(hits[0].body, wall);
+    EXPECT_NEAR(hits[0].normal.x, 1.0f, 1e-4f);
+
+    world.rayCast(vec2(0.0f, 1.0f), vec2(8.0f, 1.0f), false, hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+TEST(Physics_SwarmWorld, Overlap) {
+    SwarmWorld world;
+    SwarmWorld::BodyIndex a = world.addBody(circle(vec2(0.0f, 0.0f)));
+    SwarmWorld::BodyIndex b = world.addBody(circle(vec2(3.0f, 0.0f)));
+    SwarmWorld::BodyIndex rotated = world.addBody(box(vec2(0.0f, 3.0f), vec2(1.0f, 0.1f)));
+    world.setAngle(rotated, 3.1415926f / 4.0f);
+
+    std::vector<SwarmWorld::BodyIndex> bodies;
+    world.overlapAabb(vec2(0.4f, -0.1f), vec2(2.6f, 0.1f), bodies);
+    std::sort(bodies.begin(), bodies.end());
+    EXPECT_EQ(bodies, (std::vector<SwarmWorld::BodyIndex>{a, b}));
+
+    // Inside the box bounding box, but outside the rotated box
+    bodies.clear();
+    world.overlapAabb(vec2(0.55f, 3.15f), vec2(0.65f, 3.25f), bodies);
+    EXPECT_TRUE(bodies.empty());
+    world.overlapAabb(vec2(0.3f, 3.3f), vec2(0.4f, 3.4f), bodies);
+    EXPECT_EQ(bodies, (std::vector<SwarmWorld::BodyIndex>{rotated}));
+
+    bodies.clear();
+    world.overlapCircle(vec2(1.4f, 0.0f), 1.0f, bodies);
+    EXPECT_EQ(bodies, (std::vector<SwarmWorld::BodyIndex>{a}));
+    bodies.clear();
+    world.overlapCircle(vec2(0.6f, 3.0f), 0.2f, bodies);
+    EXPECT_TRUE(bodies.empty());
+}
+
+TEST(Physics_SwarmWorld, CircleCast) {
+    SwarmWorld world;
+    SwarmWorld::BodyIndex a = world.addBody(circle(vec2(3.0f, 0.0f)));
+    SwarmWorld::BodyIndex wall = world.addBody(box(vec2(10.0f, 0.0f), vec2(1.0f, 1.0f)));
+
+    std::vector<SwarmWorld::RayHit> hits;
+    world.circleCast(vec2(0.0f, 0.0f), vec2(20.0f, 0.0f), 0.5f, false, hits);
+    ASSERT_EQ(hits.size(), 2);
+    EXPECT_EQ(hits[0].body, a);
+    EXPECT_NEAR(hits[0].distance, 2.0f, 1e-4f);
+    EXPECT_NEAR(hits[0].normal.x, -1.0f, 1e-4f);
+    EXPECT_EQ(hits[1].body, wall);
+    EXPECT_NEAR(hits[1].distance, 8.5f, 1e-4f);
+
+    // Passes next to the circle and hits the rounded corner of the box
+    world.circleCast(vec2(0.0f, 1.3f), vec2(20.0f, 1.3f), 0.5f, true, hits);
+    ASSERT_EQ(hits.size(), 1);
+    EXPECT_EQ(hits[0].body, wall);
+    EXPECT_NEAR(hits[0].distance, 9.0f - 0.4f, 1e-4f);
+    EXPECT_NEAR(hits[0].normal.x, -0.8f, 1e-4f);
+    EXPECT_NEAR(hits[0].normal.y, 0.6f, 1e-4f);
+
+    // Overlapping at the beginning
+    world.circleCast(vec2(3.0f, 0.9f), vec2(3.0f, 5.0f), 0.5f, true, hits);
+    ASSERT_EQ(hits.size(), 1);
+    EXPECT_EQ(hits[0].body, a);
+    EXPECT_EQ(hits[0].distance, 0.0f);
+
+    world.circleCast(vec2(0.0f, 1.6f), vec2(20.0f, 1.6f), 0.5f, false, hits);
+    EXPECT_TRUE(hits.empty());
+}
+
+TEST(Physics_SwarmWorld, RemoveBody) {
+    SwarmWorld world;
+    world.addBody(circle(vec2(0.0f, 0.0f)));
+    world.addBody(circle(vec2(10.0f, 0.0f)));
+    SwarmWorld::BodyIndex last = world.addBody(circle(vec2(20.0f, 0.0f)));
+    world.step(0.01f);
+
+    // Last body is moved to the removed index
+    world.removeBody(0);
+    EXPECT_EQ(world.getNumBodies(), 2);
+    EXPECT_EQ(world.getPosition(0), vec2(20.0f, 0.0f));
+    EXPECT_TRUE(world.getBodyContacts(last - 1).empty());
+    world.step(0.01f);
+    EXPECT_TRUE(world.getContacts().empty());
+}
+
+// Dense grid of agents, the result does not depend on the number of threads
+TEST(Physics_SwarmWorld, Multithreaded) {
+    auto run = [](int numThreads) {
+        SwarmWorld world;
+        world.setNumThreads(numThreads);
+        for (int i = 0; i < 2000; i++)
+            world.addBody(circle(vec2(float(i % 50) * 0.9f, float(i / 50) * 0.9f)));
+        for (int i = 0; i < 10; i++)
+            world.step(0.01f);
+        std::vector<vec2> positions;
+        for (SwarmWorld::BodyIndex i = 0; i < world.getNumBodies(); i++)
+            positions.push_back(world.getPosition(i));
+        return positions;
+    };
+    EXPECT_EQ(run(1), run(4));
+}
+
+//---------- Speed ----------//
+constexpr int NUM_STEPS = 60;
+
+// Agents driving in a square arena
+class Physics_SwarmSpeed : public ::testing::Test {
+  public:
+    void run(int numThreads, int numAgents) {
+        SwarmWorld world;
+        world.setNumThreads(numThreads);
+        int side = int(std::ceil(std::sqrt(float(numAgents))));
+        float arena = side * 2.0f;
+        world.addBody(box(vec2(arena * 0.5f, -1.0f), vec2(arena * 0.5f + 2.0f, 1.0f)));
+        world.addBody(box(vec2(arena * 0.5f, arena + 1.0f), vec2(arena * 0.5f + 2.0f, 1.0f)));
+        world.addBody(box(vec2(-1.0f, arena * 0.5f), vec2(1.0f, arena * 0.5f)));
+        world.addBody(box(vec2(arena + 1.0f, arena * 0.5f), vec2(1.0f, arena * 0.5f)));
+        for (int i = 0; i < numAgents; i++) {
+            SwarmWorld::BodyIndex agent = world.addBody(circle(vec2((i % side) * 2.0f + 1.0f, (i / side) * 2.0f + 1.0f), 0.4f));
+            world.setAngle(agent, float(i));
+            world.setDrive(agent, 1.0f, float(i % 7) * 0.2f - 0.6f);
+        }
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < NUM_STEPS; i++)
+            world.step(1.0f / 60.0f);
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - begin;
+        RecordProperty("stepsPerSecond", int(NUM_STEPS / seconds.count()));
+    }
+};
+
+TEST_F(Physics_SwarmSpeed, Sequential10k) { run(1, 10000); }
+TEST_F(Physics_SwarmSpeed, Multithreaded10k) { run(0, 10000); }
+TEST_F(Physics_SwarmSpeed, Sequential100k) { run(1, 100000); }
+TEST_F(Physics_SwarmSpeed, Multithreaded100k) { run(0, 100000); }
+
+} // namespace
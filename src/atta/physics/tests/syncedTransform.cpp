@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/relationship.h>
+#include <atta/component/tests/common.h>
+#include <atta/physics/syncedTransform.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::physics;
+
+namespace {
+
+class Physics_SyncedTransform : public ::testing::Test {
+  public:
+    void SetUp() override {
+        component::test::startUp();
+        _parent = component::createEntity();
+        _parentT = _parent.add<component::Transform>();
+        _parentT->position = vec3(1.0f, 0.0f, 0.0f);
+        _child = component::createEntity();
+        _childT = _child.add<component::Transform>();
+        component::Relationship::setParent(_parent, _child);
+        _childT->position = vec3(0.0f, 2.0f, 0.0f);
+    }
+
+  protected:
+    component::Entity _parent;
+    component::Entity _child;
+    component::Transform* _parentT;
+    component::Transform* _childT;
+};
+
+TEST_F(Physics_SyncedTransform, LocalChange) {
+    SyncedTransform::Parents parents;
+    SyncedTransform synced(_parent, _parentT, parents);
+    vec3 position;
+    quat orientation;
+
+    parents.nextStep();
+    EXPECT_FALSE(synced.changed(position, orientation));
+
+    _parentT->position = vec3(3.0f, 0.0f, 0.0f);
+    parents.nextStep();
+    ASSERT_TRUE(synced.changed(position, orientation));
+    EXPECT_EQ(position, vec3(3.0f, 0.0f, 0.0f));
+    parents.nextStep();
+    EXPECT_FALSE(synced.changed(position, orientation));
+}
+
+TEST_F(Physics_SyncedTransform, ParentMoved) {
+    SyncedTransform::Parents parents;
+    SyncedTransform synced(_child, _childT, parents);
+    vec3 position;
+    quat orientation;
+    EXPECT_EQ(synced.getPosition(), vec3(1.0f, 2.0f, 0.0f));
+
+    parents.nextStep();
+    EXPECT_FALSE(synced.changed(position, orientation));
+
+    // The component did not change, but the world transform did
+    _parentT->position = vec3(2.0f, 0.0f, 0.0f);
+    parents.nextStep();
+    ASSERT_TRUE(synced.changed(position, orientation));
+    EXPECT_EQ(position, vec3(2.0f, 2.0f, 0.0f));
+    parents.nextStep();
+    EXPECT_FALSE(synced.changed(position, orientation));
+}
+
+TEST_F(Physics_SyncedTransform, Write) {
+    SyncedTransform::Parents parents;
+    SyncedTransform synced(_child, _childT, parents);
+    _parentT->orientation.set2DAngle(0.3f);
+    _parentT->scale = vec3(2.0f);
+    vec3 position;
+    quat orientation;
+    parents.nextStep();
+    EXPECT_TRUE(synced.changed(position, orientation));
+
+    // Values written by the engine are not detected as changes
+    quat written;
+    written.set2DAngle(0.1f);
+    synced.write(vec3(0.1f, 0.2f, 0.3f), written);
+    component::Transform world = _childT->getWorldTransform(_child);
+    EXPECT_NEAR((world.position - vec3(0.1f, 0.2f, 0.3f)).length(), 0.0f, 1e-5f);
+    for (int i = 0; i < 3; i++) {
+        parents.nextStep();
+        EXPECT_FALSE(synced.changed(position, orientation));
+    }
+}
+
+} // namespace
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/physics/workerPool.h>
+
+namespace atta::physics {
+
+WorkerPool::WorkerPool(int numThreads) : _stop(false), _jobId(0), _numWorking(0), _func(nullptr), _end(0), _grainSize(1), _next(0) {
+    setNumThreads(numThreads);
+}
+
+WorkerPool::~WorkerPool() { stopWorkers(); }
+
+int WorkerPool::getNumThreads() const { return int(_workers.size()) + 1; }
+
+void WorkerPool::setNumThreads(int numThreads) {
+    if (numThreads <= 0)
+        numThreads = std::max(int(std::thread::hardware_concurrency()), 1);
+    if (numThreads == getNumThreads())
+        return;
+    stopWorkers();
+    startWorkers(numThreads - 1);
+}
+
+void WorkerPool::parallelFor(int iBegin, int iEnd, int grainSize, const Func& func) {
+    grainSize = std::max(grainSize, 1);
+    if (_workers.empty() || iEnd - iBegin <= grainSize) {
+        if (iBegin < iEnd)
+            func(iBegin, iEnd);
+        return;
+    }
+
+    // Publish job
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _func = &func;
+        _end = iEnd;
+        _grainSize = grainSize;
+        _next.store(iBegin, std::memory_order_relaxed);
+        _numWorking = _workers.size();
+        _jobId++;
+    }
+    _jobCv.notify_all();
+
+    // Help the workers and wait for them, the job can only be released after all workers left it
+    runChunks();
+    std::unique_lock<std::mutex> lock(_mutex);
+    _doneCv.wait(lock, [this] { return _numWorking == 0; });
+    _func = nullptr;
+}
+
+void WorkerPool::runChunks() {
+    while (true) {
+        int begin = _next.fetch_add(_grainSize, std::memory_order_relaxed);
+        if (begin >= _end)
+            break;
+        (*_func)(begin, std::min(begin + _grainSize, _end));
+    }
+}
+
+void WorkerPool::workerLoop(uint64_t lastJobId) {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _jobCv.wait(lock, [&] { return _stop || _jobId != lastJobId; });
+            if (_stop)
+                return;
+            lastJobId = _jobId;
+        }
+
+        runChunks();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (--_numWorking == 0)
+                _doneCv.notify_one();
+        }
+    }
+}
+
+void WorkerPool::startWorkers(int numWorkers) {
+    // Workers only start running jobs published after they were created
+    _stop = false;
+    for (int i = 0; i < numWorkers; i++)
+        _workers.emplace_back(&WorkerPool::workerLoop, this, _jobId);
+}
+
+void WorkerPool::stopWorkers() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _jobCv.notify_all();
+    for (std::thread& worker : _workers)
+        worker.join();
+    _workers.clear();
+}
+
+} // namespace atta::physics
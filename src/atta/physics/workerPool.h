@@ -0,0 +1,53 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace atta::physics {
+
+/** Worker threads used to run the parallel parts of the physics step
+ *
+ * The range of each parallelFor is split in chunks of grainSize that are consumed by the workers and by the calling
+ * thread, which blocks until the whole range is processed. Ranges smaller than one chunk run inline. Only one
+ * parallelFor can run at a time
+ **/
+class WorkerPool final {
+  public:
+    using Func = std::function<void(int, int)>;
+
+    WorkerPool(int numThreads = 0); ///< Uses the number of hardware threads if numThreads is 0
+    ~WorkerPool();
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    int getNumThreads() const; ///< Workers plus the calling thread
+    void setNumThreads(int numThreads);
+
+    /// Execute func(chunkBegin, chunkEnd) for all chunks of [iBegin,iEnd)
+    void parallelFor(int iBegin, int iEnd, int grainSize, const Func& func);
+
+  private:
+    void runChunks();
+    void workerLoop(uint64_t lastJobId);
+    void startWorkers(int numWorkers);
+    void stopWorkers();
+
+    std::vector<std::thread> _workers;
+    std::mutex _mutex;
+    std::condition_variable _jobCv;
+    std::condition_variable _doneCv;
+    bool _stop;
+    uint64_t _jobId;    ///< Incremented for each job, so the workers know when there is a new one
+    size_t _numWorking; ///< Workers that did not finish the current job yet
+
+    // Current job, only written by the calling thread while the workers are idle
+    const Func* _func;
+    int _end;
+    int _grainSize;
+    std::atomic<int> _next; ///< Begin of the next chunk
+};
+
+} // namespace atta::physics
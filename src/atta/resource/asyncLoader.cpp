@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/resource/asyncLoader.h>
+
+namespace atta::resource {
+
+AsyncLoader::AsyncLoader(size_t numWorkers) : _stop(false), _numPending(0) {
+    if (numWorkers == 0)
+        numWorkers = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    for (size_t i = 0; i < numWorkers; i++)
+        _workers.emplace_back(&AsyncLoader::workerLoop, this);
+}
+
+AsyncLoader::~AsyncLoader() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+        _jobs.clear();
+    }
+    _jobCv.notify_all();
+    for (std::thread& worker : _workers)
+        worker.join();
+}
+
+void AsyncLoader::push(Job job) {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _jobs.push_back(std::move(job));
+    }
+    _numPending++;
+    _jobCv.notify_one();
+}
+
+size_t AsyncLoader::update() {
+    std::vector<Finish> finished;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        finished.swap(_finished);
+    }
+    // Executed without the lock because finish functions may push new jobs
+    for (Finish& finish : finished)
+        if (finish)
+            finish();
+    _numPending -= finished.size();
+    return finished.size();
+}
+
+void AsyncLoader::wait() {
+    while (_numPending > 0) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _finishedCv.wait(lock, [this] { return !_finished.empty(); });
+        }
+        update();
+    }
+}
+
+void AsyncLoader::workerLoop() {
+    while (true) {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _jobCv.wait(lock, [this] { return _stop || !_jobs.empty(); });
+            if (_stop)
+                return;
+            job = std::move(_jobs.front());
+            _jobs.pop_front();
+        }
+
+        Finish finish = job();
+
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _finished.push_back(std::move(finish));
+        }
+        _finishedCv.notify_one();
+    }
+}
+
+} // namespace atta::resource
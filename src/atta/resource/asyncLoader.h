@@ -0,0 +1,49 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace atta::resource {
+
+/** Load resources on worker threads
+ *
+ * Each job is executed on a worker thread (file reading and decoding) and returns a function that is executed on the
+ * main thread by update() (publishing the resource). Only the returned function can access non thread-safe state, like
+ * StringId, events, and the resource map
+ **/
+class AsyncLoader final {
+  public:
+    using Finish = std::function<void()>;
+    using Job = std::function<Finish()>;
+
+    AsyncLoader(size_t numWorkers = 0); ///< Uses the number of hardware threads minus one if numWorkers is 0
+    ~AsyncLoader();
+    AsyncLoader(const AsyncLoader&) = delete;
+    AsyncLoader& operator=(const AsyncLoader&) = delete;
+
+    void push(Job job);
+    /// Execute the finish functions of the finished jobs, returns how many were executed (main thread only)
+    size_t update();
+    /// Block until all pushed jobs finish and execute their finish functions (main thread only)
+    void wait();
+
+    size_t getNumPending() const { return _numPending; } ///< Jobs pushed that were not finished yet
+    size_t getNumWorkers() const { return _workers.size(); }
+
+  private:
+    void workerLoop();
+
+    std::vector<std::thread> _workers;
+    std::deque<Job> _jobs;
+    std::vector<Finish> _finished;
+    std::mutex _mutex;
+    std::condition_variable _jobCv;
+    std::condition_variable _finishedCv;
+    bool _stop;
+    size_t _numPending; ///< Only modified by the main thread
+};
+
+} // namespace atta::resource
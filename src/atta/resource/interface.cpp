@@ -7,5 +7,6 @@ namespace atta::resource {
 void startUp() { Manager::getInstance().startUpImpl(); }
 void shutDown() { Manager::getInstance().shutDownImpl(); }
 void update() { Manager::getInstance().updateImpl(); }
+LoadProgress getLoadProgress() { return Manager::getInstance().getLoadProgressImpl(); }
 
 } // namespace atta::resource
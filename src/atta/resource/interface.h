@@ -21,6 +21,14 @@ void destroyResources();
 template <typename R>
 std::vector<StringId> getResources();
 
+// Meshes and images found when a project is opened are loaded by worker threads. Until they are loaded, get<R> returns
+// a placeholder resource (empty mesh/image), and the MeshLoad/ImageLoad events are published when each one finishes
+struct LoadProgress {
+    size_t numLoaded; ///< Resources loaded since the last project open
+    size_t numTotal;  ///< Resources found when the project was opened
+};
+LoadProgress getLoadProgress();
+
 } // namespace atta::resource
 
 #include <atta/resource/manager.h>
@@ -12,6 +12,7 @@
 #include <atta/event/events/projectOpen.h>
 #include <atta/file/manager.h>
 #include <atta/memory/interface.h>
+#include <atta/resource/meshCache.h>
 
 namespace atta::resource {
 
@@ -28,19 +29,32 @@ void Manager::startUpImpl() {
     // Alloc memory inside main memory
     uint8_t* resourceMemory = static_cast<uint8_t*>(mainAllocator->allocBytes(size, sizeof(uint8_t)));
     _allocator = new memory::BitmapAllocator(resourceMemory, size);
-    memory::registerAllocator(SSID("ResourceAllocator"), static_cast<memory::Allocator*>(_allocator));
+    _lockedAllocator = new memory::LockedAllocator(_allocator);
+    memory::registerAllocator(SSID("ResourceAllocator"), static_cast<memory::Allocator*>(_lockedAllocator));
 
     // Subscribe to project open (load project events when opened)
     event::subscribe<event::ProjectOpen>(BIND_EVENT_FUNC(Manager::onProjectOpen));
 
-    // Default resources
+    // Default resources (loaded synchronously because they are used by the UI)
+    _asyncLoader = std::make_unique<AsyncLoader>();
+    _numLoaded = 0;
+    _numLoadTotal = 0;
     for (auto& resourcePath : file::getResourcePaths())
-        loadResourcesRecursively(resourcePath);
+        loadResourcesRecursively(resourcePath, false);
 }
 
-void Manager::shutDownImpl() {}
+void Manager::shutDownImpl() { _asyncLoader.reset(); }
 
 void Manager::updateImpl() {
+    // Publish resources loaded by the worker threads
+    if (_asyncLoader->getNumPending() > 0) {
+        _numLoaded += _asyncLoader->update();
+        if (_asyncLoader->getNumPending() == 0) {
+            float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - _loadStart).count();
+            LOG_INFO("resource::Manager", "Loaded $0 resources in $1 ms ($2 threads)", _numLoadTotal, ms, _asyncLoader->getNumWorkers());
+        }
+    }
+
     // Publish material update events
     for (StringId sid : _resourcesByType[typeid(Material).hash_code()]) {
         Material* m = reinterpret_cast<Material*>(_resourceMap[sid.getId()]);
@@ -52,11 +66,82 @@ void Manager::updateImpl() {
 }
 
 void Manager::onProjectOpen(event::Event& event) {
+    if (_asyncLoader->getNumPending() == 0) {
+        _numLoaded = 0;
+        _numLoadTotal = 0;
+        _loadStart = std::chrono::steady_clock::now();
+    }
     for (auto& resourcePath : file::getResourcePaths())
-        loadResourcesRecursively(resourcePath);
+        loadResourcesRecursively(resourcePath, true);
+}
+
+LoadProgress Manager::getLoadProgressImpl() const { return {_numLoaded, _numLoadTotal}; }
+
+void Manager::loadMeshAsync(const fs::path& filename) {
+    StringId sid = StringId(filename.string());
+    if (_resourceMap.find(sid.getId()) != _resourceMap.end())
+        return;
+
+    // The placeholder is only published (resource list and load event) after the data is loaded
+    Mesh* mesh = new Mesh(filename, Mesh::CreateInfo{});
+    _resourceMap[sid.getId()] = reinterpret_cast<uint8_t*>(mesh);
+    _numLoadTotal++;
+
+    fs::path absolutePath = file::solveResourcePath(filename);
+    fs::path cacheDirectory = MeshCache::getDirectory();
+    _asyncLoader->push([this, mesh, sid, absolutePath, cacheDirectory]() -> AsyncLoader::Finish {
+        auto info = std::make_shared<Mesh::CreateInfo>();
+        Mesh::decode(absolutePath, cacheDirectory, *info);
+        return [this, mesh, sid, info]() {
+            // Check if the placeholder was not destroyed while loading
+            auto it = _resourceMap.find(sid.getId());
+            if (it == _resourceMap.end() || it->second != reinterpret_cast<uint8_t*>(mesh))
+                return;
+            mesh->_vertices = std::move(info->vertices);
+            mesh->_vertexLayout = std::move(info->vertexLayout);
+            mesh->_indices = std::move(info->indices);
+            mesh->_lods = std::move(info->lods);
+            _resourcesByType[typeid(Mesh).hash_code()].push_back(sid);
+            createLoadEvent<Mesh>(mesh, sid);
+        };
+    });
+}
+
+void Manager::loadImageAsync(const fs::path& filename) {
+    StringId sid = StringId(filename.string());
+    if (_resourceMap.find(sid.getId()) != _resourceMap.end())
+        return;
+
+    Image* image = new Image(filename, Image::CreateInfo{1, 1, Image::Format::RGBA8});
+    _resourceMap[sid.getId()] = reinterpret_cast<uint8_t*>(image);
+    _numLoadTotal++;
+
+    fs::path absolutePath = file::solveResourcePath(filename);
+    _asyncLoader->push([this, image, sid, absolutePath]() -> AsyncLoader::Finish {
+        Image::CreateInfo info;
+        uint32_t channels = 0;
+        uint8_t* data = Image::decode(absolutePath, info, channels);
+        return [this, image, sid, info, channels, data]() {
+            auto it = _resourceMap.find(sid.getId());
+            if (it == _resourceMap.end() || it->second != reinterpret_cast<uint8_t*>(image)) {
+                delete[] data;
+                return;
+            }
+            if (data) {
+                delete[] image->_data;
+                image->_data = data;
+                image->_width = info.width;
+                image->_height = info.height;
+                image->_channels = channels;
+                image->_format = info.format;
+            }
+            _resourcesByType[typeid(Image).hash_code()].push_back(sid);
+            createLoadEvent<Image>(image, sid);
+        };
+    });
 }
 
-void Manager::loadResourcesRecursively(fs::path directory) {
+void Manager::loadResourcesRecursively(fs::path directory, bool async) {
     static const std::vector<std::string> meshExtensions{".obj", ".fbx", ".FBX", ".fbx", ".stl", ".ply"};
     static const std::vector<std::string> imageExtensions{".jpg", ".jpeg", ".png", ".hdr", ".tga"};
 
@@ -67,13 +152,19 @@ void Manager::loadResourcesRecursively(fs::path directory) {
         // Load as mesh
         for (auto& extension : meshExtensions)
             if (extension == file.extension().string()) {
-                resource::get<Mesh>(file.string());
+                if (async)
+                    loadMeshAsync(file.string());
+                else
+                    resource::get<Mesh>(file.string());
                 break;
             }
         // Load as image
         for (auto& extension : imageExtensions)
             if (extension == file.extension().string()) {
-                resource::get<Image>(file.string());
+                if (async)
+                    loadImageAsync(file.string());
+                else
+                    resource::get<Image>(file.string());
                 break;
             }
     }
@@ -4,10 +4,15 @@
 
 #include <atta/event/interface.h>
 #include <atta/memory/allocators/bitmapAllocator.h>
+#include <atta/memory/allocators/lockedAllocator.h>
+#include <atta/resource/asyncLoader.h>
+#include <chrono>
 #include <atta/resource/resources/resources.h>
 
 namespace atta::resource {
 
+struct LoadProgress;
+
 class Manager final {
   public:
     using ResourceType = size_t;
@@ -27,13 +32,19 @@ class Manager final {
     friend void destroyResources();
     template <typename R>
     friend std::vector<StringId> getResources();
+    friend LoadProgress getLoadProgress();
 
   private:
     void startUpImpl();
     void shutDownImpl();
     void updateImpl();
-    void loadResourcesRecursively(fs::path directory);
+    void loadResourcesRecursively(fs::path directory, bool async);
     void onProjectOpen(event::Event& event);
+    LoadProgress getLoadProgressImpl() const;
+
+    // Create placeholder and load resource data on worker thread
+    void loadMeshAsync(const fs::path& filename);
+    void loadImageAsync(const fs::path& filename);
 
     template <typename R, typename... Args>
     R* createImpl(const fs::path& filename, Args... args);
@@ -53,8 +64,14 @@ class Manager final {
     void createDestroyEvent(StringId sid);
 
     memory::BitmapAllocator* _allocator;
+    memory::LockedAllocator* _lockedAllocator; // Resources can be created from worker threads
     std::unordered_map<StringHash, uint8_t*> _resourceMap;
     std::unordered_map<ResourceType, std::vector<StringId>> _resourcesByType;
+
+    std::unique_ptr<AsyncLoader> _asyncLoader;
+    size_t _numLoaded;    ///< Resources loaded asynchronously since the last project open
+    size_t _numLoadTotal; ///< Resources that started loading asynchronously since the last project open
+    std::chrono::time_point<std::chrono::steady_clock> _loadStart;
 };
 
 } // namespace atta::resource
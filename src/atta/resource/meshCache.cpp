@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/file/interface.h>
+#include <atta/file/serializer/binarySerializer.h>
+#include <atta/resource/meshCache.h>
+
+namespace atta::resource {
+
+constexpr size_t BUFFER_ALIGNMENT = 16;
+
+// Source file information used to invalidate the cache
+struct SourceInfo {
+    int64_t modificationTime;
+    uint64_t size;
+};
+
+static bool getSourceInfo(const fs::path& absolutePath, SourceInfo& info) {
+    std::error_code ec;
+    fs::file_time_type time = fs::last_write_time(absolutePath, ec);
+    if (ec)
+        return false;
+    info.size = fs::file_size(absolutePath, ec);
+    info.modificationTime = time.time_since_epoch().count();
+    return !ec;
+}
+
+fs::path MeshCache::getDirectory() {
+    std::shared_ptr<file::Project> project = file::getProject();
+    fs::path build = project ? project->getBuildDirectory() : file::getBuildPath();
+    return build / "cache" / "meshes";
+}
+
+fs::path MeshCache::getCacheFile(const fs::path& directory, const fs::path& absolutePath) {
+    std::stringstream ss;
+    ss << std::hex << SID(absolutePath.string().c_str()) << ".attamesh";
+    return directory / ss.str();
+}
+
+bool MeshCache::load(const fs::path& directory, const fs::path& absolutePath, uint32_t importFlags, Mesh::CreateInfo& info) {
+    SourceInfo source;
+    fs::path cacheFile = getCacheFile(directory, absolutePath);
+    if (!getSourceInfo(absolutePath, source) || !fs::exists(cacheFile))
+        return false;
+
+    file::MappedFile mapped(cacheFile);
+    if (!mapped.isOpen())
+        return false;
+    file::BinaryReader reader(mapped.getData(), mapped.getSize());
+
+    // Header
+    const uint8_t* magic = reader.readBytes(sizeof(MAGIC));
+    uint32_t version = 0, flags = 0;
+    SourceInfo cached{};
+    std::string path;
+    reader.read(version);
+    reader.read(flags);
+    reader.read(cached.modificationTime);
+    reader.read(cached.size);
+    reader.readString(path);
+    if (!reader.isValid() || std::memcmp(magic, MAGIC, sizeof(MAGIC)) != 0 || version != VERSION || flags != importFlags ||
+        cached.modificationTime != source.modificationTime || cached.size != source.size || path != absolutePath.string())
+        return false;
+
+    // Vertex layout
+    uint32_t numElements = 0;
+    reader.read(numElements);
+    info.vertexLayout.resize(numElements);
+    for (Mesh::VertexElement& element : info.vertexLayout) {
+        uint32_t type = 0;
+        reader.read(type);
+        reader.readString(element.name);
+        element.type = Mesh::VertexElement::Type(type);
+    }
+
+    // Buffers
+    uint64_t verticesSize = 0, numIndices = 0;
+    reader.read(verticesSize);
+    reader.read(numIndices);
+    reader.align(BUFFER_ALIGNMENT);
+    const uint8_t* vertices = reader.readBytes(verticesSize);
+    reader.align(BUFFER_ALIGNMENT);
+    const uint8_t* indices = reader.readBytes(numIndices * sizeof(Mesh::Index));
+    if (!reader.isValid()) {
+        LOG_WARN("resource::MeshCache", "Mesh cache [w]$0[] is corrupted, [w]$1[] will be imported again", cacheFile, absolutePath);
+        info = {};
+        return false;
+    }
+    info.vertices.assign(vertices, vertices + verticesSize);
+    info.indices.resize(numIndices);
+    std::memcpy(info.indices.data(), indices, numIndices * sizeof(Mesh::Index));
+
+    // LODs
+    uint32_t numLods = 0;
+    reader.read(numLods);
+    info.lods.resize(numLods);
+    for (Mesh::Lod& lod : info.lods) {
+        reader.read(verticesSize);
+        reader.read(numIndices);
+        reader.align(BUFFER_ALIGNMENT);
+        vertices = reader.readBytes(verticesSize);
+        reader.align(BUFFER_ALIGNMENT);
+        indices = reader.readBytes(numIndices * sizeof(Mesh::Index));
+        if (!reader.isValid())
+            break;
+        lod.vertices.assign(vertices, vertices + verticesSize);
+        lod.indices.resize(numIndices);
+        std::memcpy(lod.indices.data(), indices, numIndices * sizeof(Mesh::Index));
+    }
+    if (!reader.isValid()) {
+        LOG_WARN("resource::MeshCache", "Mesh cache [w]$0[] is corrupted, [w]$1[] will be imported again", cacheFile, absolutePath);
+        info = {};
+        return false;
+    }
+    return true;
+}
+
+bool MeshCache::save(const fs::path& directory, const fs::path& absolutePath, uint32_t importFlags, const Mesh::CreateInfo& info) {
+    SourceInfo source;
+    if (!getSourceInfo(absolutePath, source))
+        return false;
+
+    file::BinaryWriter writer;
+    writer.writeBytes(MAGIC, sizeof(MAGIC));
+    writer.write<uint32_t>(VERSION);
+    writer.write<uint32_t>(importFlags);
+    writer.write(source.modificationTime);
+    writer.write(source.size);
+    writer.writeString(absolutePath.string());
+
+    writer.write<uint32_t>(info.vertexLayout.size());
+    for (const Mesh::VertexElement& element : info.vertexLayout) {
+        writer.write<uint32_t>(element.type);
+        writer.writeString(element.name);
+    }
+
+    writer.write<uint64_t>(info.vertices.size());
+    writer.write<uint64_t>(info.indices.size());
+    writer.align(BUFFER_ALIGNMENT);
+    writer.writeBytes(info.vertices.data(), info.vertices.size());
+    writer.align(BUFFER_ALIGNMENT);
+    writer.writeBytes(info.indices.data(), info.indices.size() * sizeof(Mesh::Index));
+
+    writer.write<uint32_t>(info.lods.size());
+    for (const Mesh::Lod& lod : info.lods) {
+        writer.write<uint64_t>(lod.vertices.size());
+        writer.write<uint64_t>(lod.indices.size());
+        writer.align(BUFFER_ALIGNMENT);
+        writer.writeBytes(lod.vertices.data(), lod.vertices.size());
+        writer.align(BUFFER_ALIGNMENT);
+        writer.writeBytes(lod.indices.data(), lod.indices.size() * sizeof(Mesh::Index));
+    }
+
+    fs::path cacheFile = getCacheFile(directory, absolutePath);
+    std::error_code ec;
+    fs::create_directories(cacheFile.parent_path(), ec);
+    return writer.saveToFile(cacheFile);
+}
+
+} // namespace atta::resource
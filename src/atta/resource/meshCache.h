@@ -0,0 +1,30 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/resource/resources/mesh.h>
+
+namespace atta::resource {
+
+/** Cache of processed mesh files
+ *
+ * Stores the optimized vertex/index buffers and LODs generated from a mesh file in the cache directory of the project
+ * (<project>/build/cache/meshes), so the importer is not executed again when the mesh is loaded. The cache file is memory
+ * mapped when loading. It is invalid when the source path, size, modification time, import flags, or cache version changed
+ *
+ * load and save can be used from worker threads, the directory is solved on the main thread with getDirectory
+ **/
+class MeshCache final {
+  public:
+    static constexpr char MAGIC[8] = {'A', 'T', 'T', 'A', 'M', 'E', 'S', 'H'};
+    static constexpr uint32_t VERSION = 2;
+
+    /// Load mesh from cache, returns false if there is no valid cache for the source file
+    static bool load(const fs::path& directory, const fs::path& absolutePath, uint32_t importFlags, Mesh::CreateInfo& info);
+    static bool save(const fs::path& directory, const fs::path& absolutePath, uint32_t importFlags, const Mesh::CreateInfo& info);
+
+    /// Cache directory of the open project, or of the engine build if no project is open
+    static fs::path getDirectory();
+    static fs::path getCacheFile(const fs::path& directory, const fs::path& absolutePath);
+};
+
+} // namespace atta::resource
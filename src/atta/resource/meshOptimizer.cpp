@@ -0,0 +1,279 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/resource/meshOptimizer.h>
+
+namespace atta::resource {
+
+using Index = Mesh::Index;
+
+size_t MeshOptimizer::getVertexSize(const Mesh::VertexLayout& layout) {
+    size_t size = 0;
+    for (const Mesh::VertexElement& element : layout)
+        size += (element.type + 1) * sizeof(float);
+    return size;
+}
+
+int MeshOptimizer::getPositionOffset(const Mesh::VertexLayout& layout) {
+    size_t offset = 0;
+    for (const Mesh::VertexElement& element : layout) {
+        if (element.name == "iPosition" && element.type == Mesh::VertexElement::VEC3)
+            return offset;
+        offset += (element.type + 1) * sizeof(float);
+    }
+    return -1;
+}
+
+//---------- Weld ----------//
+size_t MeshOptimizer::weld(Mesh::CreateInfo& info) {
+    const size_t vertexSize = getVertexSize(info.vertexLayout);
+    if (vertexSize == 0)
+        return 0;
+    const size_t numVertices = info.vertices.size() / vertexSize;
+
+    // Hash vertex bytes (FNV-1a), equal hashes are checked with memcmp
+    auto hashVertex = [&](size_t v) {
+        uint64_t h = 14695981039346656037ull;
+        const uint8_t* data = &info.vertices[v * vertexSize];
+        for (size_t i = 0; i < vertexSize; i++)
+            h = (h ^ data[i]) * 1099511628211ull;
+        return h;
+    };
+
+    std::vector<uint8_t> vertices;
+    vertices.reserve(info.vertices.size());
+    std::vector<Index> remap(numVertices);
+    std::unordered_multimap<uint64_t, Index> unique;
+    unique.reserve(numVertices);
+    for (size_t v = 0; v < numVertices; v++) {
+        const uint8_t* data = &info.vertices[v * vertexSize];
+        uint64_t h = hashVertex(v);
+        Index found = Index(-1);
+        auto range = unique.equal_range(h);
+        for (auto it = range.first; it != range.second; it++)
+            if (std::memcmp(&vertices[size_t(it->second) * vertexSize], data, vertexSize) == 0) {
+                found = it->second;
+                break;
+            }
+        if (found == Index(-1)) {
+            found = Index(vertices.size() / vertexSize);
+            vertices.insert(vertices.end(), data, data + vertexSize);
+            unique.insert({h, found});
+        }
+        remap[v] = found;
+    }
+
+    for (Index& index : info.indices)
+        index = remap[index];
+    size_t removed = numVertices - vertices.size() / vertexSize;
+    info.vertices = std::move(vertices);
+    return removed;
+}
+
+//---------- Vertex cache ----------//
+namespace {
+constexpr int CACHE_SIZE = 32;
+constexpr float CACHE_DECAY_POWER = 1.5f;
+constexpr float LAST_TRI_SCORE = 0.75f;
+constexpr float VALENCE_BOOST_SCALE = 2.0f;
+constexpr float VALENCE_BOOST_POWER = 0.5f;
+
+float vertexScore(int cachePos, uint32_t numActiveTris) {
+    if (numActiveTris == 0)
+        return -1.0f; // No triangles left to use this vertex
+    float score = 0.0f;
+    if (cachePos >= 0) {
+        if (cachePos < 3)
+            score = LAST_TRI_SCORE; // Used by the last triangle, fixed score to avoid favouring any of the 3 vertices
+        else
+            score = std::pow(1.0f - float(cachePos - 3) / (CACHE_SIZE - 3), CACHE_DECAY_POWER);
+    }
+    // Boost vertices with few triangles left, so they are finished and leave the cache
+    return score + VALENCE_BOOST_SCALE * std::pow(float(numActiveTris), -VALENCE_BOOST_POWER);
+}
+} // namespace
+
+void MeshOptimizer::optimizeVertexCache(std::vector<Index>& indices, size_t numVertices) {
+    const size_t numTris = indices.size() / 3;
+    if (numTris == 0)
+        return;
+
+    // Triangles that use each vertex
+    std::vector<uint32_t> triStart(numVertices + 1, 0);
+    for (Index i : indices)
+        triStart[i + 1]++;
+    for (size_t v = 0; v < numVertices; v++)
+        triStart[v + 1] += triStart[v];
+    std::vector<uint32_t> vertexTris(indices.size());
+    std::vector<uint32_t> fill(triStart.begin(), triStart.end() - 1);
+    for (size_t i = 0; i < indices.size(); i++)
+        vertexTris[fill[indices[i]]++] = uint32_t(i / 3);
+
+    std::vector<uint32_t> numActive(numVertices);
+    std::vector<int> cachePos(numVertices, -1);
+    std::vector<float> score(numVertices);
+    for (size_t v = 0; v < numVertices; v++) {
+        numActive[v] = triStart[v + 1] - triStart[v];
+        score[v] = vertexScore(-1, numActive[v]);
+    }
+    std::vector<float> triScore(numTris);
+    std::vector<bool> emitted(numTris, false);
+    for (size_t t = 0; t < numTris; t++)
+        triScore[t] = score[indices[t * 3]] + score[indices[t * 3 + 1]] + score[indices[t * 3 + 2]];
+
+    std::vector<Index> result;
+    result.reserve(indices.size());
+    std::vector<Index> cache;
+    size_t cursor = 0; // Used to find the next triangle when the cache has no candidates
+    int64_t bestTri = -1;
+    while (result.size() < indices.size()) {
+        if (bestTri < 0) {
+            // Best score over all triangles is not necessary, the first remaining one is good enough
+            while (emitted[cursor])
+                cursor++;
+            bestTri = cursor;
+        }
+
+        // Emit triangle
+        emitted[bestTri] = true;
+        std::vector<Index> newCache;
+        newCache.reserve(CACHE_SIZE + 3);
+        for (int k = 0; k < 3; k++) {
+            Index v = indices[bestTri * 3 + k];
+            result.push_back(v);
+            newCache.push_back(v);
+            // Remove triangle from vertex active list
+            uint32_t* tris = &vertexTris[triStart[v]];
+            for (uint32_t i = 0; i < numActive[v]; i++)
+                if (tris[i] == uint32_t(bestTri)) {
+                    std::swap(tris[i], tris[numActive[v] - 1]);
+                    break;
+                }
+            numActive[v]--;
+        }
+        for (Index v : cache)
+            if (v != newCache[0] && v != newCache[1] && v != newCache[2])
+                newCache.push_back(v);
+
+        // Update scores of the vertices in the cache (and the ones that left it)
+        for (size_t i = 0; i < newCache.size(); i++) {
+            Index v = newCache[i];
+            cachePos[v] = i < CACHE_SIZE ? int(i) : -1;
+            score[v] = vertexScore(cachePos[v], numActive[v]);
+        }
+        newCache.resize(std::min<size_t>(newCache.size(), CACHE_SIZE));
+        cache.swap(newCache);
+
+        // Best triangle that uses a cached vertex
+        bestTri = -1;
+        float bestScore = -1.0f;
+        for (Index v : cache)
+            for (uint32_t i = 0; i < numActive[v]; i++) {
+                uint32_t t = vertexTris[triStart[v] + i];
+                triScore[t] = score[indices[t * 3]] + score[indices[t * 3 + 1]] + score[indices[t * 3 + 2]];
+                if (triScore[t] > bestScore) {
+                    bestScore = triScore[t];
+                    bestTri = t;
+                }
+            }
+    }
+    indices.swap(result);
+}
+
+//---------- LODs ----------//
+Mesh::Lod MeshOptimizer::simplify(const Mesh::CreateInfo& info, size_t targetTriangles) {
+    const size_t vertexSize = getVertexSize(info.vertexLayout);
+    const int positionOffset = getPositionOffset(info.vertexLayout);
+    const size_t numVertices = vertexSize ? info.vertices.size() / vertexSize : 0;
+    if (positionOffset < 0 || numVertices == 0)
+        return {info.vertices, info.indices};
+    auto position = [&](size_t v) {
+        vec3 p;
+        std::memcpy(&p, &info.vertices[v * vertexSize + positionOffset], sizeof(vec3));
+        return p;
+    };
+
+    vec3 pMin = position(0), pMax = position(0);
+    for (size_t v = 1; v < numVertices; v++) {
+        pMin = min(pMin, position(v));
+        pMax = max(pMax, position(v));
+    }
+    vec3 extent = pMax - pMin;
+    float maxExtent = std::max(std::max(extent.x, extent.y), std::max(extent.z, 1e-6f));
+
+    // Cluster vertices in a grid with the given number of cells along the largest axis
+    auto cluster = [&](uint32_t grid) {
+        Mesh::Lod lod;
+        float cellSize = maxExtent / grid;
+        std::unordered_map<uint64_t, Index> cells;
+        std::vector<Index> remap(numVertices);
+        std::vector<vec3> sums;
+        std::vector<uint32_t> counts;
+        for (size_t v = 0; v < numVertices; v++) {
+            vec3 c = (position(v) - pMin) / cellSize;
+            uint64_t key = (uint64_t(std::min<uint32_t>(c.x, grid)) << 42) | (uint64_t(std::min<uint32_t>(c.y, grid)) << 21) |
+                           uint64_t(std::min<uint32_t>(c.z, grid));
+            auto [it, inserted] = cells.insert({key, Index(sums.size())});
+            if (inserted) {
+                // First vertex of the cell gives the other attributes
+                lod.vertices.insert(lod.vertices.end(), &info.vertices[v * vertexSize], &info.vertices[(v + 1) * vertexSize]);
+                sums.push_back(vec3(0.0f));
+                counts.push_back(0);
+            }
+            sums[it->second] += position(v);
+            counts[it->second]++;
+            remap[v] = it->second;
+        }
+        for (size_t c = 0; c < sums.size(); c++) {
+            vec3 p = sums[c] / float(counts[c]);
+            std::memcpy(&lod.vertices[c * vertexSize + positionOffset], &p, sizeof(vec3));
+        }
+        for (size_t i = 0; i + 2 < info.indices.size(); i += 3) {
+            Index a = remap[info.indices[i]], b = remap[info.indices[i + 1]], c = remap[info.indices[i + 2]];
+            if (a != b && b != c && a != c) {
+                lod.indices.push_back(a);
+                lod.indices.push_back(b);
+                lod.indices.push_back(c);
+            }
+        }
+        return lod;
+    };
+
+    // Binary search the finest grid that satisfies the target
+    uint32_t lo = 1, hi = 1024;
+    Mesh::Lod best = cluster(lo);
+    while (lo + 1 < hi) {
+        uint32_t mid = (lo + hi) / 2;
+        Mesh::Lod lod = cluster(mid);
+        if (lod.indices.size() / 3 <= targetTriangles) {
+            lo = mid;
+            best = std::move(lod);
+        } else
+            hi = mid;
+    }
+    return best;
+}
+
+std::vector<Mesh::Lod> MeshOptimizer::generateLods(const Mesh::CreateInfo& info) {
+    std::vector<Mesh::Lod> lods;
+    size_t numTriangles = info.indices.size() / 3;
+    if (numTriangles < MIN_LOD_TRIANGLES || getPositionOffset(info.vertexLayout) < 0)
+        return lods;
+
+    const size_t vertexSize = getVertexSize(info.vertexLayout);
+    size_t prevTriangles = numTriangles;
+    for (size_t i = 1; i <= MAX_LODS; i++) {
+        Mesh::Lod lod = simplify(info, numTriangles >> i);
+        size_t lodTriangles = lod.indices.size() / 3;
+        // Stop when the simplification is not reducing enough
+        if (lodTriangles == 0 || lodTriangles > prevTriangles * 3 / 4)
+            break;
+        optimizeVertexCache(lod.indices, lod.vertices.size() / vertexSize);
+        prevTriangles = lodTriangles;
+        lods.push_back(std::move(lod));
+        if (lodTriangles < MIN_LOD_TRIANGLES / 2)
+            break;
+    }
+    return lods;
+}
+
+} // namespace atta::resource
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+#include <atta/resource/resources/mesh.h>
+
+namespace atta::resource {
+
+/** Import-time mesh optimization
+ *
+ * - weld: merges vertices with identical data and remaps the indices
+ * - optimizeVertexCache: reorders triangles for post-transform vertex cache locality (Forsyth's linear-speed algorithm)
+ * - generateLods: simplified meshes by vertex clustering, each with about half the triangles of the previous one
+ *
+ * The vertex layout must have a VEC3 iPosition element. Can be used from worker threads
+ **/
+class MeshOptimizer final {
+  public:
+    static constexpr size_t MAX_LODS = 4;
+    static constexpr size_t MIN_LOD_TRIANGLES = 256; ///< Meshes with fewer triangles do not have LODs
+
+    /// Returns the number of removed vertices
+    static size_t weld(Mesh::CreateInfo& info);
+    static void optimizeVertexCache(std::vector<Mesh::Index>& indices, size_t numVertices);
+    static std::vector<Mesh::Lod> generateLods(const Mesh::CreateInfo& info);
+
+    /// Simplify mesh to have at most targetTriangles (when possible)
+    static Mesh::Lod simplify(const Mesh::CreateInfo& info, size_t targetTriangles);
+
+    static size_t getVertexSize(const Mesh::VertexLayout& layout);
+    static int getPositionOffset(const Mesh::VertexLayout& layout); ///< -1 if there is no position element
+};
+
+} // namespace atta::resource
@@ -103,63 +103,64 @@ void Image::saveToFile() {
 uint32_t Image::getBytesPerChannel(Format format) { return format == Format::RGB32F ? 4 : 1; }
 
 void Image::load() {
-    fs::path absolutePath = file::solveResourcePath(_filename);
-    std::string extension = _filename.extension().string();
+    CreateInfo info;
+    _data = decode(file::solveResourcePath(_filename), info, _channels);
+    _width = _data ? info.width : 0;
+    _height = _data ? info.height : 0;
+    _format = _data ? info.format : Format::NONE;
+    if (!_data)
+        _channels = 0;
+}
+
+uint8_t* Image::decode(const fs::path& absolutePath, CreateInfo& info, uint32_t& channels) {
+    std::string extension = absolutePath.extension().string();
 
     uint8_t* data = nullptr;
-    int width, height, channels;
+    int width, height, numChannels;
     if (extension != ".hdr") {
-        data = stbi_load(absolutePath.string().c_str(), &width, &height, &channels, 0);
+        data = stbi_load(absolutePath.string().c_str(), &width, &height, &numChannels, 0);
     } else {
-        stbi_set_flip_vertically_on_load(true);
-        data = reinterpret_cast<uint8_t*>(stbi_loadf(absolutePath.string().c_str(), &width, &height, &channels, 0));
-        stbi_set_flip_vertically_on_load(false);
+        // Thread local flip, images can be decoded by multiple threads
+        stbi_set_flip_vertically_on_load_thread(true);
+        data = reinterpret_cast<uint8_t*>(stbi_loadf(absolutePath.string().c_str(), &width, &height, &numChannels, 0));
+        stbi_set_flip_vertically_on_load_thread(false);
     }
 
-    if (data) {
-        _width = width;
-        _height = height;
-        _channels = channels;
-
-        if (extension != ".hdr") {
-            if (_channels == 1)
-                _format = Format::RED8;
-            else if (_channels == 3)
-                _format = Format::RGB8;
-            else if (_channels == 4)
-                _format = Format::RGBA8;
-            else {
-                LOG_WARN("resource::Image", "Image with $0 channels are not supported", _channels);
-                _width = 0;
-                _height = 0;
-                _channels = 0;
-                return;
-            }
-        } else {
-            if (_channels != 3) {
-                LOG_WARN("resource::Image", "Only hdr with 3 channels are supported");
-                _width = 0;
-                _height = 0;
-                _channels = 0;
-                return;
-            }
-            _format = Format::RGB32F;
-        }
+    if (!data) {
+        LOG_ERROR("resource::Image", "Failed to load image [w]$0[]", absolutePath);
+        return nullptr;
+    }
 
-        // Copy temp data to _data
-        uint32_t size = _width * _height * _channels * getBytesPerChannel(_format);
-        _data = new uint8_t[size];
-        for (size_t i = 0; i < size; i++)
-            _data[i] = data[i];
-        stbi_image_free(data);
-        // LOG_INFO("resource::Image", "[w]$3[] -> w:$0, h:$1, c:$2", _width, _height, _channels, absolutePath);
+    info.width = width;
+    info.height = height;
+    channels = numChannels;
+    if (extension != ".hdr") {
+        if (channels == 1)
+            info.format = Format::RED8;
+        else if (channels == 3)
+            info.format = Format::RGB8;
+        else if (channels == 4)
+            info.format = Format::RGBA8;
+        else {
+            LOG_WARN("resource::Image", "Image with $0 channels are not supported", channels);
+            stbi_image_free(data);
+            return nullptr;
+        }
     } else {
-        _width = 0;
-        _height = 0;
-        _channels = 0;
-        _format = Format::NONE;
-        LOG_ERROR("resource::Image", "Failed to load image [w]$0[]", absolutePath);
+        if (channels != 3) {
+            LOG_WARN("resource::Image", "Only hdr with 3 channels are supported");
+            stbi_image_free(data);
+            return nullptr;
+        }
+        info.format = Format::RGB32F;
     }
+
+    // Copy temp data to memory allocated with new[]
+    uint32_t size = info.width * info.height * channels * getBytesPerChannel(info.format);
+    uint8_t* pixels = new uint8_t[size];
+    std::memcpy(pixels, data, size);
+    stbi_image_free(data);
+    return pixels;
 }
 
 } // namespace atta::resource
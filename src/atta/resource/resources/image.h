@@ -7,6 +7,8 @@
 
 namespace atta::resource {
 
+class Manager;
+
 class Image : public Resource, public memory::AllocatedObject<Image, SID("ResourceAllocator")> {
   public:
     enum class Format {
@@ -36,12 +38,16 @@ class Image : public Resource, public memory::AllocatedObject<Image, SID("Resour
     uint32_t getChannels() const { return _channels; }
     Format getFormat() const { return _format; }
 
+    /// Read image file, can be called from worker threads. Returns the pixels allocated with new[] (nullptr on failure)
+    static uint8_t* decode(const fs::path& absolutePath, CreateInfo& info, uint32_t& channels);
+
     static uint32_t getBytesPerChannel(Format format);
     static const std::unordered_map<Format, std::string> formatToString;
     static const std::unordered_map<std::string, Format> stringToFormat;
 
   private:
     void load();
+    friend Manager;
 
     uint32_t _width;
     uint32_t _height;
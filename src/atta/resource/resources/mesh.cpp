@@ -5,6 +5,8 @@
 #include <assimp/scene.h>
 #include <atta/event/events/meshUpdate.h>
 #include <atta/file/manager.h>
+#include <atta/resource/meshCache.h>
+#include <atta/resource/meshOptimizer.h>
 #include <atta/resource/resources/mesh.h>
 
 namespace atta::resource {
@@ -15,10 +17,18 @@ Mesh::Mesh(const fs::path& filename, const CreateInfo& info) : Resource(filename
     _vertices = info.vertices;
     _vertexLayout = info.vertexLayout;
     _indices = info.indices;
+    _lods = info.lods;
 }
 
 void Mesh::updateVertices(const std::vector<uint8_t>& vertices) {
     _vertices = vertices;
+    _lods.clear(); // Simplified from the old vertices
+    update();
+}
+
+void Mesh::updateVertices(const uint8_t* data, size_t size) {
+    _vertices.assign(data, data + size);
+    _lods.clear(); // Simplified from the old vertices
     update();
 }
 
@@ -30,41 +40,67 @@ void Mesh::update() const {
 const std::vector<uint8_t>& Mesh::getVertices() const { return _vertices; }
 const std::vector<Mesh::Index>& Mesh::getIndices() const { return _indices; }
 const Mesh::VertexLayout& Mesh::getVertexLayout() const { return _vertexLayout; }
+const std::vector<Mesh::Lod>& Mesh::getLods() const { return _lods; }
 
 //---------- Assimp mesh loading ----------//
 void Mesh::load() {
-    _assimpVertexIdx = 0;
-    _vertexLayout.resize(3);
-    _vertexLayout[0] = {VertexElement::VEC3, "iPosition"};
-    _vertexLayout[1] = {VertexElement::VEC3, "iNormal"};
-    _vertexLayout[2] = {VertexElement::VEC2, "iUV"};
+    CreateInfo info;
+    decode(file::solveResourcePath(_filename), MeshCache::getDirectory(), info);
+    _vertices = std::move(info.vertices);
+    _vertexLayout = std::move(info.vertexLayout);
+    _indices = std::move(info.indices);
+    _lods = std::move(info.lods);
+}
+
+bool Mesh::decode(const fs::path& absolutePath, const fs::path& cacheDirectory, CreateInfo& info) {
+    constexpr uint32_t importFlags = aiProcess_Triangulate | aiProcess_FlipUVs;
+    if (MeshCache::load(cacheDirectory, absolutePath, importFlags, info))
+        return true;
 
-    fs::path absolutePath = file::solveResourcePath(_filename);
+    info.vertexLayout.resize(3);
+    info.vertexLayout[0] = {VertexElement::VEC3, "iPosition"};
+    info.vertexLayout[1] = {VertexElement::VEC3, "iNormal"};
+    info.vertexLayout[2] = {VertexElement::VEC2, "iUV"};
 
     Assimp::Importer importer;
-    const aiScene* scene = importer.ReadFile(absolutePath.string().c_str(), aiProcess_Triangulate | aiProcess_FlipUVs);
+    const aiScene* scene = importer.ReadFile(absolutePath.string().c_str(), importFlags);
 
     if (!scene || scene->mFlags & AI_SCENE_FLAGS_INCOMPLETE || !scene->mRootNode) {
-        LOG_ERROR("resource::Mesh", "Failed to load mesh [w]$0. Assimp Error: $1", fs::absolute(_filename).string(), importer.GetErrorString());
-        return;
+        LOG_ERROR("resource::Mesh", "Failed to load mesh [w]$0. Assimp Error: $1", absolutePath.string(), importer.GetErrorString());
+        return false;
     }
 
-    processNode(scene->mRootNode, scene);
+    processNode(scene->mRootNode, scene, info);
+
+    // Optimize
+    size_t numVertices = info.vertices.size() / sizeof(AssimpVertex);
+    size_t numTriangles = info.indices.size() / 3;
+    MeshOptimizer::weld(info);
+    MeshOptimizer::optimizeVertexCache(info.indices, info.vertices.size() / sizeof(AssimpVertex));
+    info.lods = MeshOptimizer::generateLods(info);
+    std::string lodTriangles;
+    for (const Lod& lod : info.lods)
+        lodTriangles += " " + std::to_string(lod.indices.size() / 3);
+    LOG_DEBUG("resource::Mesh", "Optimized [w]$0[]: $1 -> $2 vertices, $3 triangles, LODs:$4", absolutePath.filename().string(), numVertices,
+              info.vertices.size() / sizeof(AssimpVertex), numTriangles, lodTriangles.empty() ? " none" : lodTriangles);
+
+    MeshCache::save(cacheDirectory, absolutePath, importFlags, info);
+    return true;
 }
 
-void Mesh::processNode(aiNode* node, const aiScene* scene) {
+void Mesh::processNode(aiNode* node, const aiScene* scene, CreateInfo& info) {
     // LOG_DEBUG("resource::Mesh", "Process node $0", std::string(node->mName.C_Str()));
 
     // Process all the node's meshes (if any)
     for (uint32_t i = 0; i < node->mNumMeshes; i++) {
         aiMesh* mesh = scene->mMeshes[node->mMeshes[i]];
-        processMesh(mesh, scene);
+        processMesh(mesh, scene, info);
         // LOG_DEBUG("resource::Mesh", " - Process mesh $0", std::string(mesh->mName.C_Str()));
     }
 
     // Then do the same for each of its children
     for (uint32_t i = 0; i < node->mNumChildren; i++) {
-        processNode(node->mChildren[i], scene);
+        processNode(node->mChildren[i], scene, info);
     }
 }
 
@@ -74,8 +110,8 @@ struct AssimpVertex {
     vec2 uv;
 };
 
-void Mesh::processMesh(aiMesh* mesh, const aiScene* scene) {
-    unsigned startIndex = _assimpVertexIdx;
+void Mesh::processMesh(aiMesh* mesh, const aiScene* scene, CreateInfo& info) {
+    unsigned startIndex = info.vertices.size() / sizeof(AssimpVertex);
     for (uint32_t i = 0; i < mesh->mNumVertices; i++) {
         AssimpVertex vertex;
         // Process vertex positions, normals and texture coordinates
@@ -91,14 +127,13 @@ void Mesh::processMesh(aiMesh* mesh, const aiScene* scene) {
         // Push assimp vertex
         uint8_t* data = (uint8_t*)&vertex;
         for (size_t i = 0; i < sizeof(AssimpVertex); i++)
-            _vertices.push_back(data[i]);
-        _assimpVertexIdx++;
+            info.vertices.push_back(data[i]);
     }
     // Process indices
     for (uint32_t i = 0; i < mesh->mNumFaces; i++) {
         aiFace face = mesh->mFaces[i];
         for (uint32_t j = 0; j < face.mNumIndices; j++)
-            _indices.push_back(startIndex + face.mIndices[j]);
+            info.indices.push_back(startIndex + face.mIndices[j]);
     }
 }
 
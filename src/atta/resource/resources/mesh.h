@@ -12,6 +12,8 @@ struct aiScene;
 
 namespace atta::resource {
 
+class Manager;
+
 class Mesh : public Resource, public memory::AllocatedObject<Mesh, SID("ResourceAllocator")> {
   public:
     struct VertexElement {
@@ -22,34 +24,51 @@ class Mesh : public Resource, public memory::AllocatedObject<Mesh, SID("Resource
     using VertexLayout = std::vector<VertexElement>;
     using Index = uint32_t;
 
+    /// Simplified mesh with the same vertex layout
+    struct Lod {
+        std::vector<uint8_t> vertices;
+        std::vector<Index> indices;
+    };
+
     struct CreateInfo {
         std::vector<uint8_t> vertices;
         VertexLayout vertexLayout;
         std::vector<Index> indices;
+        std::vector<Lod> lods; ///< Optional, from most to least detailed
     };
 
+    /// Projected size (pixels) below which LOD 1 is rendered, each next LOD is used when the size halves again
+    static constexpr float LOD_SCREEN_SIZE = 256.0f;
+
     Mesh(const fs::path& filename);
     Mesh(const fs::path& filename, const CreateInfo& info);
 
-    void updateVertices(const std::vector<uint8_t>& vertices); ///< Update vertex data
+    /// Update vertex data, the LODs are removed because they do not match the new vertices
+    void updateVertices(const std::vector<uint8_t>& vertices);
+    void updateVertices(const uint8_t* data, size_t size); ///< Update vertex data reusing the vertex memory
 
     const std::vector<uint8_t>& getVertices() const;
     const std::vector<Index>& getIndices() const;
     const VertexLayout& getVertexLayout() const;
+    const std::vector<Lod>& getLods() const;
+
+    /// Read mesh file (or its cache in cacheDirectory), can be called from worker threads
+    static bool decode(const fs::path& absolutePath, const fs::path& cacheDirectory, CreateInfo& info);
 
   private:
     void update() const;
+    friend Manager;
 
     // Assimp mesh loading
     void load();
-    void processNode(aiNode* node, const aiScene* scene);
-    void processMesh(aiMesh* mesh, const aiScene* scene);
-    unsigned _assimpVertexIdx; ///< Used only to keep track of indices while processing the meshes
+    static void processNode(aiNode* node, const aiScene* scene, CreateInfo& info);
+    static void processMesh(aiMesh* mesh, const aiScene* scene, CreateInfo& info);
 
     /// Draw vertex data following the format specified in the vertex layout
     std::vector<uint8_t> _vertices;
     VertexLayout _vertexLayout;
     std::vector<Index> _indices;
+    std::vector<Lod> _lods;
 };
 
 } // namespace atta::resource
@@ -0,0 +1,170 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/tests/common.h>
+#include <atta/event/events/imageLoad.h>
+#include <atta/event/events/projectOpen.h>
+#include <atta/resource/asyncLoader.h>
+#include <atta/resource/resources/image.h>
+#include <gtest/gtest.h>
+#include <atomic>
+#include <fstream>
+
+using namespace atta;
+using namespace atta::resource;
+
+namespace {
+
+//---------- AsyncLoader ----------//
+TEST(Resource_AsyncLoader, FinishOnMainThread) {
+    constexpr int numJobs = 100;
+    const std::thread::id mainThread = std::this_thread::get_id();
+    std::atomic<int> numOnWorkers = 0;
+    int numFinished = 0;
+    bool finishedOnMain = true;
+
+    AsyncLoader loader(4);
+    for (int i = 0; i < numJobs; i++)
+        loader.push([&]() -> AsyncLoader::Finish {
+            if (std::this_thread::get_id() != mainThread)
+                numOnWorkers++;
+            return [&]() {
+                finishedOnMain &= std::this_thread::get_id() == mainThread;
+                numFinished++;
+            };
+        });
+    EXPECT_EQ(loader.getNumPending(), size_t(numJobs));
+    loader.wait();
+
+    EXPECT_EQ(numOnWorkers, numJobs);
+    EXPECT_EQ(numFinished, numJobs);
+    EXPECT_TRUE(finishedOnMain);
+    EXPECT_EQ(loader.getNumPending(), 0u);
+}
+
+TEST(Resource_AsyncLoader, FinishPushesJob) {
+    AsyncLoader loader(2);
+    int numFinished = 0;
+    // Each finish function loads the next job, like a resource that depends on another
+    std::function<AsyncLoader::Finish()> job = [&]() -> AsyncLoader::Finish {
+        return [&]() {
+            if (++numFinished < 10)
+                loader.push(job);
+        };
+    };
+    loader.push(job);
+    loader.wait();
+    EXPECT_EQ(numFinished, 10);
+    EXPECT_EQ(loader.getNumPending(), 0u);
+}
+
+//---------- Manager ----------//
+// Images of a temporary project loaded by the resource manager when the project is opened
+class Resource_AsyncLoad : public ::testing::Test {
+  public:
+    void SetUp() override {
+        component::test::startUp();
+        _directory = fs::temp_directory_path() / "atta_async_load_test";
+        fs::remove_all(_directory);
+        fs::create_directories(_directory / "resources");
+        event::subscribe<event::ImageLoad>(this, [this](event::Event& event) {
+            _loadEvents.push_back(reinterpret_cast<event::ImageLoad&>(event).sid);
+            _eventsOnMain &= std::this_thread::get_id() == _mainThread;
+        });
+    }
+    void TearDown() override {
+        event::unsubscribe<event::ImageLoad>(this, [](event::Event&) {});
+        file::closeProject();
+        for (const std::string& name : _images)
+            resource::destroy<Image>(name);
+        fs::remove_all(_directory);
+    }
+
+  protected:
+    /// Uncompressed 32 bit TGA filled with one color
+    void writeImage(const std::string& name, uint16_t width, uint16_t height) {
+        std::ofstream file(_directory / "resources" / name, std::ios::binary);
+        uint8_t header[18] = {0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, uint8_t(width), uint8_t(width >> 8), uint8_t(height), uint8_t(height >> 8), 32, 8};
+        file.write(reinterpret_cast<const char*>(header), sizeof(header));
+        const uint8_t pixel[4] = {255, 0, 0, 255};
+        for (int i = 0; i < width * height; i++)
+            file.write(reinterpret_cast<const char*>(pixel), sizeof(pixel));
+        _images.push_back(name);
+    }
+    void writeCorruptedImage(const std::string& name) {
+        std::ofstream(_directory / "resources" / name, std::ios::binary) << "not an image";
+        _images.push_back(name);
+    }
+
+    void openProject() { ASSERT_TRUE(file::openProject(_directory / "asyncLoad.atta")); }
+    /// Execute the finish functions until all resources are loaded
+    void waitLoad() {
+        auto begin = std::chrono::steady_clock::now();
+        while (resource::getLoadProgress().numLoaded < resource::getLoadProgress().numTotal &&
+               std::chrono::steady_clock::now() - begin < std::chrono::seconds(10)) {
+            resource::update();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+    size_t countLoadEvents(StringId sid) const { return std::count(_loadEvents.begin(), _loadEvents.end(), sid); }
+
+    fs::path _directory;
+    std::vector<std::string> _images;
+    std::vector<StringId> _loadEvents;
+    const std::thread::id _mainThread = std::this_thread::get_id();
+    bool _eventsOnMain = true;
+};
+
+TEST_F(Resource_AsyncLoad, SameResource) {
+    writeImage("a.tga", 4, 2);
+    writeImage("b.tga", 8, 8);
+
+    // The resources are found again while they are being loaded, they are loaded only once
+    openProject();
+    event::ProjectOpen projectOpen;
+    event::publish(projectOpen);
+    EXPECT_EQ(resource::getLoadProgress().numTotal, 2u);
+    waitLoad();
+
+    EXPECT_EQ(resource::getLoadProgress().numLoaded, 2u);
+    EXPECT_EQ(countLoadEvents(StringId("a.tga")), 1u);
+    EXPECT_EQ(countLoadEvents(StringId("b.tga")), 1u);
+    std::vector<StringId> images = resource::getResources<Image>();
+    EXPECT_EQ(std::count(images.begin(), images.end(), StringId("a.tga")), 1);
+    EXPECT_EQ(resource::get<Image>("a.tga")->getWidth(), 4u);
+    EXPECT_EQ(resource::get<Image>("a.tga")->getHeight(), 2u);
+    EXPECT_EQ(resource::get<Image>("b.tga")->getWidth(), 8u);
+
+    // Loaded resources are not loaded again
+    _loadEvents.clear();
+    event::publish(projectOpen);
+    waitLoad();
+    EXPECT_TRUE(_loadEvents.empty());
+}
+
+TEST_F(Resource_AsyncLoad, Failure) {
+    writeImage("good.tga", 4, 4);
+    writeCorruptedImage("corrupted.png");
+
+    // The image that failed to load is published as the placeholder
+    openProject();
+    waitLoad();
+    EXPECT_EQ(resource::getLoadProgress().numLoaded, 2u);
+    EXPECT_EQ(resource::getLoadProgress().numTotal, 2u);
+    EXPECT_EQ(countLoadEvents(StringId("corrupted.png")), 1u);
+    EXPECT_EQ(countLoadEvents(StringId("good.tga")), 1u);
+    ASSERT_NE(resource::get<Image>("corrupted.png"), nullptr);
+    EXPECT_EQ(resource::get<Image>("corrupted.png")->getWidth(), 1u);
+    EXPECT_EQ(resource::get<Image>("good.tga")->getWidth(), 4u);
+}
+
+TEST_F(Resource_AsyncLoad, EventsOnMainThread) {
+    for (int i = 0; i < 8; i++)
+        writeImage("image" + std::to_string(i) + ".tga", 16, 16);
+
+    openProject();
+    waitLoad();
+    EXPECT_EQ(_loadEvents.size(), 8u);
+    EXPECT_TRUE(_eventsOnMain);
+}
+
+} // namespace
@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/resource/meshCache.h>
+#include <gtest/gtest.h>
+#include <fstream>
+
+using namespace atta;
+using namespace atta::resource;
+
+namespace {
+
+constexpr uint32_t FLAGS = 3;
+
+class Resource_MeshCache : public ::testing::Test {
+  public:
+    void SetUp() override {
+        _directory = fs::temp_directory_path() / "atta_mesh_cache_test";
+        fs::remove_all(_directory);
+        fs::create_directories(_directory);
+        _source = _directory / "mesh.obj";
+        _cacheDirectory = _directory / "cache";
+        writeSource("v 0 0 0\n");
+
+        // The cache does not parse the source, any buffers can be stored
+        _info.vertexLayout = {{Mesh::VertexElement::VEC3, "iPosition"}};
+        _info.vertices.resize(3 * sizeof(vec3));
+        for (size_t i = 0; i < _info.vertices.size(); i++)
+            _info.vertices[i] = uint8_t(i);
+        _info.indices = {0, 1, 2};
+        Mesh::Lod lod;
+        lod.vertices = std::vector<uint8_t>(_info.vertices.begin(), _info.vertices.begin() + sizeof(vec3));
+        lod.indices = {0, 0, 0};
+        _info.lods.push_back(lod);
+    }
+    void TearDown() override { fs::remove_all(_directory); }
+
+  protected:
+    void writeSource(const std::string& content) { std::ofstream(_source, std::ios::binary) << content; }
+
+    fs::path _directory;
+    fs::path _source;
+    fs::path _cacheDirectory;
+    Mesh::CreateInfo _info;
+};
+
+TEST_F(Resource_MeshCache, Hit) {
+    Mesh::CreateInfo info;
+    EXPECT_FALSE(MeshCache::load(_cacheDirectory, _source, FLAGS, info));
+    ASSERT_TRUE(MeshCache::save(_cacheDirectory, _source, FLAGS, _info));
+    EXPECT_TRUE(fs::exists(MeshCache::getCacheFile(_cacheDirectory, _source)));
+
+    ASSERT_TRUE(MeshCache::load(_cacheDirectory, _source, FLAGS, info));
+    ASSERT_EQ(info.vertexLayout.size(), 1u);
+    EXPECT_EQ(info.vertexLayout[0].type, Mesh::VertexElement::VEC3);
+    EXPECT_EQ(info.vertexLayout[0].name, "iPosition");
+    EXPECT_EQ(info.vertices, _info.vertices);
+    EXPECT_EQ(info.indices, _info.indices);
+    ASSERT_EQ(info.lods.size(), 1u);
+    EXPECT_EQ(info.lods[0].vertices, _info.lods[0].vertices);
+    EXPECT_EQ(info.lods[0].indices, _info.lods[0].indices);
+
+    // Each directory has its own cache, and the import flags are part of the key
+    EXPECT_FALSE(MeshCache::load(_directory / "otherProject", _source, FLAGS, info));
+    EXPECT_FALSE(MeshCache::load(_cacheDirectory, _source, FLAGS + 1, info));
+}
+
+TEST_F(Resource_MeshCache, InvalidateModificationTime) {
+    ASSERT_TRUE(MeshCache::save(_cacheDirectory, _source, FLAGS, _info));
+    fs::last_write_time(_source, fs::last_write_time(_source) + std::chrono::seconds(1));
+    Mesh::CreateInfo info;
+    EXPECT_FALSE(MeshCache::load(_cacheDirectory, _source, FLAGS, info));
+}
+
+TEST_F(Resource_MeshCache, InvalidateContent) {
+    ASSERT_TRUE(MeshCache::save(_cacheDirectory, _source, FLAGS, _info));
+    fs::file_time_type time = fs::last_write_time(_source);
+    Mesh::CreateInfo info;
+
+    // Same modification time with a different size
+    writeSource("v 0 0 0\nv 1 0 0\n");
+    fs::last_write_time(_source, time);
+    EXPECT_FALSE(MeshCache::load(_cacheDirectory, _source, FLAGS, info));
+
+    // Saved again after the change
+    ASSERT_TRUE(MeshCache::save(_cacheDirectory, _source, FLAGS, _info));
+    EXPECT_TRUE(MeshCache::load(_cacheDirectory, _source, FLAGS, info));
+}
+
+TEST_F(Resource_MeshCache, Corrupted) {
+    ASSERT_TRUE(MeshCache::save(_cacheDirectory, _source, FLAGS, _info));
+    fs::path cacheFile = MeshCache::getCacheFile(_cacheDirectory, _source);
+    Mesh::CreateInfo info;
+
+    // Truncated buffers
+    fs::resize_file(cacheFile, fs::file_size(cacheFile) - 8);
+    EXPECT_FALSE(MeshCache::load(_cacheDirectory, _source, FLAGS, info));
+    EXPECT_TRUE(info.vertices.empty());
+    EXPECT_TRUE(info.lods.empty());
+
+    // Wrong magic
+    std::ofstream(cacheFile, std::ios::binary) << "NOTAMESH with some more bytes after the magic";
+    EXPECT_FALSE(MeshCache::load(_cacheDirectory, _source, FLAGS, info));
+
+    // Empty
+    std::ofstream(cacheFile, std::ios::binary).close();
+    EXPECT_FALSE(MeshCache::load(_cacheDirectory, _source, FLAGS, info));
+}
+
+} // namespace
@@ -0,0 +1,152 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/resource/meshOptimizer.h>
+#include <gtest/gtest.h>
+#include <numeric>
+#include <random>
+
+using namespace atta;
+using namespace atta::resource;
+
+namespace {
+
+struct Vertex {
+    vec3 position;
+    vec3 normal;
+};
+
+// UV sphere with three vertices per triangle, as the meshes before welding
+Mesh::CreateInfo createSphere(uint32_t rings, uint32_t sectors) {
+    auto point = [&](uint32_t r, uint32_t s) {
+        float theta = float(M_PI) * r / rings;
+        float phi = 2.0f * float(M_PI) * (s % sectors) / sectors;
+        vec3 p(std::sin(theta) * std::cos(phi), std::sin(theta) * std::sin(phi), std::cos(theta));
+        if (r == 0 || r == rings)
+            p = vec3(0.0f, 0.0f, r == 0 ? 1.0f : -1.0f); // Same bytes for all the pole vertices
+        return Vertex{p, p};
+    };
+    std::vector<Vertex> vertices;
+    for (uint32_t r = 0; r < rings; r++)
+        for (uint32_t s = 0; s < sectors; s++) {
+            if (r != 0)
+                vertices.insert(vertices.end(), {point(r, s), point(r + 1, s), point(r, s + 1)});
+            if (r != rings - 1)
+                vertices.insert(vertices.end(), {point(r, s + 1), point(r + 1, s), point(r + 1, s + 1)});
+        }
+
+    Mesh::CreateInfo info;
+    info.vertexLayout = {{Mesh::VertexElement::VEC3, "iPosition"}, {Mesh::VertexElement::VEC3, "iNormal"}};
+    info.vertices.resize(vertices.size() * sizeof(Vertex));
+    std::memcpy(info.vertices.data(), vertices.data(), info.vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++)
+        info.indices.push_back(Mesh::Index(i));
+    return info;
+}
+
+vec3 getPosition(const std::vector<uint8_t>& vertices, Mesh::Index i) {
+    vec3 p;
+    std::memcpy(&p, vertices.data() + i * sizeof(Vertex), sizeof(vec3));
+    return p;
+}
+
+// Triangles as sorted position triplets, independent of the vertex and triangle order
+std::vector<std::array<float, 9>> getTriangles(const std::vector<uint8_t>& vertices, const std::vector<Mesh::Index>& indices) {
+    std::vector<std::array<float, 9>> triangles;
+    for (size_t i = 0; i < indices.size(); i += 3) {
+        std::array<vec3, 3> t = {getPosition(vertices, indices[i]), getPosition(vertices, indices[i + 1]), getPosition(vertices, indices[i + 2])};
+        // Rotate the smallest vertex first to keep the winding
+        size_t first = 0;
+        for (size_t k = 1; k < 3; k++)
+            if (std::tie(t[k].x, t[k].y, t[k].z) < std::tie(t[first].x, t[first].y, t[first].z))
+                first = k;
+        std::array<float, 9> tri;
+        for (size_t k = 0; k < 3; k++) {
+            vec3 p = t[(first + k) % 3];
+            tri[k * 3 + 0] = p.x;
+            tri[k * 3 + 1] = p.y;
+            tri[k * 3 + 2] = p.z;
+        }
+        triangles.push_back(tri);
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+}
+
+// Average cache miss ratio (vertex transforms per triangle) with a FIFO cache
+float getAcmr(const std::vector<Mesh::Index>& indices, size_t cacheSize) {
+    std::deque<Mesh::Index> cache;
+    size_t misses = 0;
+    for (Mesh::Index i : indices)
+        if (std::find(cache.begin(), cache.end(), i) == cache.end()) {
+            misses++;
+            cache.push_back(i);
+            if (cache.size() > cacheSize)
+                cache.pop_front();
+        }
+    return float(misses) / float(indices.size() / 3);
+}
+
+TEST(Resource_MeshOptimizer, Weld) {
+    Mesh::CreateInfo info = createSphere(16, 32);
+    auto triangles = getTriangles(info.vertices, info.indices);
+    size_t numVertices = info.vertices.size() / sizeof(Vertex);
+
+    size_t removed = MeshOptimizer::weld(info);
+    // Poles are one vertex, the seam vertices are shared
+    EXPECT_EQ(info.vertices.size() / sizeof(Vertex), 15 * 32 + 2);
+    EXPECT_EQ(removed, numVertices - (15 * 32 + 2));
+    EXPECT_EQ(getTriangles(info.vertices, info.indices), triangles);
+}
+
+TEST(Resource_MeshOptimizer, VertexCache) {
+    Mesh::CreateInfo info = createSphere(32, 64);
+    MeshOptimizer::weld(info);
+    size_t numVertices = info.vertices.size() / sizeof(Vertex);
+
+    // Shuffle the triangles
+    std::vector<size_t> order(info.indices.size() / 3);
+    std::iota(order.begin(), order.end(), 0);
+    std::shuffle(order.begin(), order.end(), std::mt19937(42));
+    std::vector<Mesh::Index> shuffled;
+    for (size_t t : order)
+        shuffled.insert(shuffled.end(), info.indices.begin() + t * 3, info.indices.begin() + t * 3 + 3);
+    info.indices = shuffled;
+    auto triangles = getTriangles(info.vertices, info.indices);
+    float before = getAcmr(info.indices, 32);
+
+    MeshOptimizer::optimizeVertexCache(info.indices, numVertices);
+    EXPECT_EQ(getTriangles(info.vertices, info.indices), triangles);
+    float after = getAcmr(info.indices, 32);
+    EXPECT_LT(after, 1.0f);
+    EXPECT_LT(after, before * 0.5f);
+}
+
+TEST(Resource_MeshOptimizer, Lods) {
+    Mesh::CreateInfo info = createSphere(32, 64);
+    MeshOptimizer::weld(info);
+    size_t numTriangles = info.indices.size() / 3;
+
+    std::vector<Mesh::Lod> lods = MeshOptimizer::generateLods(info);
+    ASSERT_FALSE(lods.empty());
+    EXPECT_LE(lods.size(), MeshOptimizer::MAX_LODS);
+    size_t prevTriangles = numTriangles;
+    for (const Mesh::Lod& lod : lods) {
+        size_t lodVertices = lod.vertices.size() / sizeof(Vertex);
+        size_t lodTriangles = lod.indices.size() / 3;
+        EXPECT_GT(lodTriangles, 0);
+        EXPECT_LE(lodTriangles, prevTriangles * 3 / 4);
+        for (Mesh::Index i : lod.indices)
+            ASSERT_LT(i, lodVertices);
+        // Simplified vertices stay close to the sphere
+        for (Mesh::Index i = 0; i < lodVertices; i++)
+            EXPECT_NEAR(getPosition(lod.vertices, i).length(), 1.0f, 0.35f);
+        prevTriangles = lodTriangles;
+    }
+
+    // Small meshes do not have LODs
+    Mesh::CreateInfo small = createSphere(4, 8);
+    EXPECT_LT(small.indices.size() / 3, MeshOptimizer::MIN_LOD_TRIANGLES);
+    EXPECT_TRUE(MeshOptimizer::generateLods(small).empty());
+}
+
+} // namespace
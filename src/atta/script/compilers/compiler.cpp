@@ -14,48 +14,87 @@ std::vector<StringId> Compiler::getTargets() const {
     return targets;
 }
 
+std::vector<StringId> Compiler::getFileTargets(const fs::path& file) const {
+    auto it = _fileTargets.find(file);
+    if (it == _fileTargets.end())
+        return {};
+    return std::vector<StringId>(it->second.begin(), it->second.end());
+}
+
+void Compiler::setTargetFiles(StringId target, std::vector<fs::path> files) {
+    // Remove old files from the reverse map
+    if (_targetFiles.find(target) != _targetFiles.end())
+        for (const fs::path& file : _targetFiles[target])
+            _fileTargets[file].erase(target);
+
+    for (const fs::path& file : files)
+        _fileTargets[file].insert(target);
+    _targetFiles[target] = std::move(files);
+}
+
+void Compiler::clearTargetFiles() {
+    _targetFiles.clear();
+    _fileTargets.clear();
+}
+
 std::vector<fs::path> Compiler::getIncludedFiles(fs::path file) {
-    fs::path projectDir = file::getProject()->getDirectory();
-    fs::path projectDirSrc0 = projectDir / "src";
-    fs::path projectDirSrc1 = projectDir / "source";
-    std::vector<fs::path> possibleBases = {file.parent_path(), projectDirSrc0, projectDirSrc1, projectDir};
-    std::unordered_set<std::string> allFiles;
+    std::set<fs::path> allFiles;
     std::stack<fs::path> s;
     s.push(file);
 
     while (!s.empty()) {
         file = s.top();
         s.pop();
-        std::ifstream in(file);
-        std::string line;
-        // For each file
-        while (std::getline(in, line)) {
-            if (line[0] == '#' && line.find("#include") != std::string::npos) {
-                // If found #include, get file name
-                size_t posBegin = line.find('"') != std::string::npos ? line.find('"') : line.find('<');
-                if (posBegin != std::string::npos) {
-                    size_t posEnd = line.find('"', posBegin + 1) != std::string::npos ? line.find('"', posBegin + 1) : line.find('>', posBegin + 1);
-                    if (posEnd != std::string::npos) {
-                        std::string possibleFile = line.substr(posBegin + 1, posEnd - posBegin - 1);
-                        for (auto base : possibleBases) {
-                            fs::path possiblePath = base / possibleFile;
-                            // Check if file exists
-                            if (fs::exists(possiblePath)) {
-                                if (allFiles.find(possiblePath.string()) == allFiles.end()) {
-                                    allFiles.insert(possiblePath.string());
-                                    s.push(possiblePath);
-                                }
-                                break;
-                            }
+        for (const fs::path& include : getDirectIncludes(file))
+            if (allFiles.insert(include).second)
+                s.push(include);
+    }
+
+    return std::vector<fs::path>(allFiles.begin(), allFiles.end());
+}
+
+const std::vector<fs::path>& Compiler::getDirectIncludes(const fs::path& file) {
+    // Use cached includes if the file was not modified
+    std::error_code ec;
+    fs::file_time_type writeTime = fs::last_write_time(file, ec);
+    auto it = _fileIncludes.find(file);
+    if (it != _fileIncludes.end() && !ec && it->second.writeTime == writeTime)
+        return it->second.includes;
+
+    fs::path projectDir = file::getProject()->getDirectory();
+    fs::path projectDirSrc0 = projectDir / "src";
+    fs::path projectDirSrc1 = projectDir / "source";
+    std::vector<fs::path> possibleBases = {file.parent_path(), projectDirSrc0, projectDirSrc1, projectDir};
+
+    FileIncludes& fileIncludes = _fileIncludes[file];
+    fileIncludes.writeTime = writeTime;
+    fileIncludes.includes.clear();
+
+    std::ifstream in(file);
+    std::string line;
+    while (std::getline(in, line)) {
+        if (line[0] == '#' && line.find("#include") != std::string::npos) {
+            // If found #include, get file name
+            size_t posBegin = line.find('"') != std::string::npos ? line.find('"') : line.find('<');
+            if (posBegin != std::string::npos) {
+                size_t posEnd = line.find('"', posBegin + 1) != std::string::npos ? line.find('"', posBegin + 1) : line.find('>', posBegin + 1);
+                if (posEnd != std::string::npos) {
+                    std::string possibleFile = line.substr(posBegin + 1, posEnd - posBegin - 1);
+                    for (auto base : possibleBases) {
+                        fs::path possiblePath = base / possibleFile;
+                        // Check if file exists
+                        if (fs::exists(possiblePath)) {
+                            fileIncludes.includes.push_back(possiblePath);
+                            break;
                         }
                     }
                 }
             }
         }
-        in.close();
     }
+    in.close();
 
-    return std::vector<fs::path>(allFiles.begin(), allFiles.end());
+    return fileIncludes.includes;
 }
 
 } // namespace atta::script
@@ -12,15 +12,36 @@ class Compiler {
     virtual ~Compiler() = default;
 
     virtual void compileAll() = 0;
-    virtual void compileTarget(StringId target) = 0;
+    /// Compile the targets with one build, independent targets are compiled and linked in parallel
+    virtual void compileTargets(const std::vector<StringId>& targets) = 0;
+    /// Only run the build of compileTargets, the target files are not updated so it can run in another thread
+    virtual void buildTargets(const std::vector<StringId>& targets) = 0;
+    /// Update the files of the targets after buildTargets, must be called from the main thread
+    virtual void updateTargetFiles(const std::vector<StringId>& targets) = 0;
 
     std::vector<StringId> getTargets() const;
     std::map<StringId, std::vector<fs::path>> getTargetFiles() const { return _targetFiles; };
+    std::vector<StringId> getFileTargets(const fs::path& file) const; ///< Targets that depend on the file (source or included header)
 
   protected:
-    static std::vector<fs::path> getIncludedFiles(fs::path file);
+    /// Files included by the file, directly or indirectly
+    /** The includes of each file are cached and only parsed again after the file is modified **/
+    std::vector<fs::path> getIncludedFiles(fs::path file);
+    void setTargetFiles(StringId target, std::vector<fs::path> files);
+    void clearTargetFiles();
 
     std::map<StringId, std::vector<fs::path>> _targetFiles;
+
+  private:
+    /// Files directly included by the file
+    const std::vector<fs::path>& getDirectIncludes(const fs::path& file);
+
+    struct FileIncludes {
+        fs::file_time_type writeTime;
+        std::vector<fs::path> includes;
+    };
+    std::map<fs::path, FileIncludes> _fileIncludes;      ///< Dependency graph of the parsed files
+    std::map<fs::path, std::set<StringId>> _fileTargets; ///< Targets that depend on each file
 };
 
 } // namespace atta::script
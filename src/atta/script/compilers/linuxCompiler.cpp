@@ -6,13 +6,20 @@
 #include <atta/script/compilers/linuxCompiler.h>
 
 #include <chrono>
+#include <thread>
 
 namespace atta::script {
 
-LinuxCompiler::LinuxCompiler() : _compiler("g++") {
+LinuxCompiler::LinuxCompiler() : _compiler("g++"), _useCcache(false), _numJobs(std::max(1u, std::thread::hardware_concurrency())) {
     // Prefer to use clang++ because it is faster
     if (std::system("clang++ 2> /dev/null") == 0)
         _compiler = "clang++";
+
+    // Use ccache if installed. The sloppiness allows cache hits for translation units that use the precompiled header
+    if (std::system("ccache --version > /dev/null 2>&1") == 0) {
+        _useCcache = true;
+        setenv("CCACHE_SLOPPINESS", "pch_defines,time_macros,include_file_mtime,include_file_ctime", 0);
+    }
 }
 
 LinuxCompiler::~LinuxCompiler() {}
@@ -20,96 +27,118 @@ LinuxCompiler::~LinuxCompiler() {}
 void LinuxCompiler::compileAll() {
     std::chrono::time_point<std::chrono::system_clock> begin = std::chrono::system_clock::now();
 
-    fs::path projectDir = file::getProject()->getDirectory();
-    fs::path buildDir = projectDir / "build";
-
-    // Create build directory if does not exists
-    if (!fs::exists(buildDir))
-        fs::create_directory(buildDir);
+    fs::path buildDir = fs::absolute(file::getProject()->getDirectory() / "build");
 
     // Create makefiles
-    fs::path prevPath = fs::current_path();
-    fs::current_path(buildDir);
-
-#ifdef ATTA_DEBUG_BUILD
-    std::string buildCommand = "cmake -DCMAKE_BUILD_TYPE=Debug -DCMAKE_CXX_COMPILER=" + _compiler + " ..";
-#else
-    std::string buildCommand = "cmake -DCMAKE_BUILD_TYPE=Release -DCMAKE_CXX_COMPILER=" + _compiler + " ..";
-#endif
-    runCommand(buildCommand, true, true);
+    configure(buildDir);
+    std::chrono::time_point<std::chrono::system_clock> configured = std::chrono::system_clock::now();
 
-    // Build makefile
-    std::string makeCommand = "make -j";
+    // Build all targets
+    std::string makeCommand = "cmake --build \"" + buildDir.string() + "\" --parallel " + std::to_string(_numJobs);
     runCommand(makeCommand, true, true);
-    fs::current_path(prevPath);
+    std::chrono::time_point<std::chrono::system_clock> built = std::chrono::system_clock::now();
 
     // Update files related to all targets
     updateTargets();
 
     // Show time
     std::chrono::time_point<std::chrono::system_clock> end = std::chrono::system_clock::now();
-    auto micro = std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
-    LOG_INFO("script::LinuxCompiler", "Time to compile all: [w]$0[] ms", micro.count() / 1000.0f);
+    auto ms = [](auto duration) { return std::chrono::duration_cast<std::chrono::microseconds>(duration).count() / 1000.0f; };
+    LOG_INFO("script::LinuxCompiler", "Time to compile all: [w]$0[] ms (configure [w]$1[] ms, build [w]$2[] ms, dependencies [w]$3[] ms)",
+             ms(end - begin), ms(configured - begin), ms(built - configured), ms(end - built));
 }
 
-void LinuxCompiler::compileTarget(StringId target) {
+void LinuxCompiler::compileTargets(const std::vector<StringId>& targets) {
     std::chrono::time_point<std::chrono::system_clock> begin = std::chrono::system_clock::now();
 
-    //  Check target
-    if (_targetFiles.find(target) == _targetFiles.end()) {
-        LOG_WARN("script::LinuxCompiler", "Could not find target $0", target);
-        return;
+    //  Check targets
+    std::vector<StringId> validTargets;
+    for (StringId target : targets) {
+        if (_targetFiles.find(target) == _targetFiles.end())
+            LOG_WARN("script::LinuxCompiler", "Could not find target $0", target);
+        else
+            validTargets.push_back(target);
     }
+    if (validTargets.empty())
+        return;
 
-    fs::path projectDir = file::getProject()->getDirectory();
-    fs::path buildDir = projectDir / "build";
-
-    // Compile all if never compiled
-    if (!fs::exists(buildDir)) {
+    // Compile all if never compiled (or empty build directory)
+    fs::path buildDir = fs::absolute(file::getProject()->getDirectory() / "build");
+    if (!fs::exists(buildDir / "CMakeFiles" / "Makefile2")) {
         compileAll();
         return;
     }
 
-    // Compile target
-    fs::path prevPath = fs::current_path();
-    fs::current_path(buildDir);
-    std::string command = "cmake --build . --parallel --target " + target.getString();
-    std::string output = runCommand(command, true, true);
-    fs::current_path(prevPath);
+    buildTargets(validTargets);
+    std::chrono::time_point<std::chrono::system_clock> built = std::chrono::system_clock::now();
+    updateTargetFiles(validTargets);
 
-    if (output.find("Error: could not load cache") != std::string::npos) {
-        // Empty build directory, should recompile all targets
-        compileAll();
+    // Show time
+    std::chrono::time_point<std::chrono::system_clock> end = std::chrono::system_clock::now();
+    auto ms = [](auto duration) { return std::chrono::duration_cast<std::chrono::microseconds>(duration).count() / 1000.0f; };
+    LOG_INFO("script::LinuxCompiler", "Time to compile [w]$0[] targets: [w]$1[] ms (build [w]$2[] ms, dependencies [w]$3[] ms)",
+             validTargets.size(), ms(end - begin), ms(built - begin), ms(end - built));
+}
+
+void LinuxCompiler::buildTargets(const std::vector<StringId>& targets) {
+    // Each target goal of the inner makefile runs its own recursive make for the dependencies, so the dependencies shared by the
+    // targets (e.g. the reused precompiled header) would be built concurrently. The "<target>.dir/all" goals only build the target
+    // and are scheduled by one make, but the build system must be checked before (regenerated if a CMakeLists.txt changed)
+    std::string targetGoals;
+    for (StringId target : targets)
+        targetGoals += " CMakeFiles/" + target.getString() + ".dir/all";
+    if (targetGoals.empty())
+        return;
+
+    fs::path buildDir = fs::absolute(file::getProject()->getDirectory() / "build");
+    if (!fs::exists(buildDir / "CMakeFiles" / "Makefile2"))
+        configure(buildDir);
+    std::string make = "make -C \"" + buildDir.string() + "\"";
+    runCommand(make + " cmake_check_build_system", true, true);
+
+    // Compile all targets with one build, only the translation units affected by the change are compiled again and independent
+    // targets are compiled and linked in parallel
+    runCommand(make + " -f CMakeFiles/Makefile2 -j" + std::to_string(_numJobs) + targetGoals, true, true);
+}
+
+void LinuxCompiler::updateTargetFiles(const std::vector<StringId>& targets) {
+    // Build directory was configured by buildTargets, all targets are new
+    if (_targetFiles.empty()) {
+        updateTargets();
         return;
     }
 
-    // Update files related to this target
-    findTargetFiles(target);
+    // Update files related to these targets (only modified files are parsed again)
+    for (StringId target : targets)
+        if (_targetFiles.find(target) != _targetFiles.end())
+            findTargetFiles(target);
+}
 
-    // Show time
-    std::chrono::time_point<std::chrono::system_clock> end = std::chrono::system_clock::now();
-    auto micro = std::chrono::duration_cast<std::chrono::microseconds>(end - begin);
-    LOG_INFO("script::LinuxCompiler", "Time to compile target [*w]$1[]: [w]$0[] ms", micro.count() / 1000.0f, target);
+void LinuxCompiler::configure(const fs::path& buildDir) {
+    // Create build directory if does not exists
+    if (!fs::exists(buildDir))
+        fs::create_directory(buildDir);
+
+#ifdef ATTA_DEBUG_BUILD
+    std::string buildCommand = "cmake -DCMAKE_BUILD_TYPE=Debug -DCMAKE_CXX_COMPILER=" + _compiler;
+#else
+    std::string buildCommand = "cmake -DCMAKE_BUILD_TYPE=Release -DCMAKE_CXX_COMPILER=" + _compiler;
+#endif
+    if (_useCcache)
+        buildCommand += " -DCMAKE_CXX_COMPILER_LAUNCHER=ccache";
+    runCommand(buildCommand + " -S \"" + buildDir.parent_path().string() + "\" -B \"" + buildDir.string() + "\"", true, true);
 }
 
 void LinuxCompiler::updateTargets() {
-    fs::path projectDir = file::getProject()->getDirectory();
-    fs::path buildDir = projectDir / "build";
-    fs::path tempFile = buildDir / "atta.temp";
+    fs::path buildDir = fs::absolute(file::getProject()->getDirectory() / "build");
 
     //---------- Get targets ----------//
-    _targetFiles.clear();
-    std::string getTargetCommand = "cmake --build . --target help > " + fs::absolute(tempFile).string();
-    fs::path prevPath = fs::current_path();
-    fs::current_path(buildDir);
-    std::system(getTargetCommand.c_str());
-    fs::current_path(prevPath);
-
-    std::ifstream tempIn(tempFile.string());
-    std::string line;
+    clearTargetFiles();
+    std::istringstream help(runCommand("cmake --build \"" + buildDir.string() + "\" --target help"));
 
+    std::string line;
     bool isTarget = false;
-    while (std::getline(tempIn, line)) {
+    while (std::getline(help, line)) {
         if (line == "... rebuild_cache") {
             isTarget = true;
             continue;
@@ -127,7 +156,6 @@ void LinuxCompiler::updateTargets() {
             findTargetFiles(target);
         }
     }
-    tempIn.close();
 }
 
 void LinuxCompiler::findTargetFiles(StringId target) {
@@ -179,9 +207,7 @@ void LinuxCompiler::findTargetFiles(StringId target) {
     }
 
     // Update files related to this target
-    _targetFiles[target] = {};
-    for (fs::path file : targetFiles)
-        _targetFiles[target].push_back(file);
+    setTargetFiles(target, std::vector<fs::path>(targetFiles.begin(), targetFiles.end()));
 }
 
 std::string LinuxCompiler::runCommand(std::string cmd, bool print, bool keepColors) {
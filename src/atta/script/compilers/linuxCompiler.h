@@ -13,14 +13,20 @@ class LinuxCompiler : public Compiler {
     ~LinuxCompiler();
 
     void compileAll() override;
-    void compileTarget(StringId target) override;
+    void compileTargets(const std::vector<StringId>& targets) override;
+    void buildTargets(const std::vector<StringId>& targets) override;
+    void updateTargetFiles(const std::vector<StringId>& targets) override;
 
   private:
+    /// Generate the makefiles, the commands use absolute paths because the targets may be built in another thread
+    void configure(const fs::path& buildDir);
     void updateTargets();
     void findTargetFiles(StringId target);
     std::string runCommand(std::string cmd, bool print = false, bool keepColors = false);
 
     std::string _compiler;
+    bool _useCcache;   ///< Reuse object files from previous builds (and from other projects) with ccache
+    unsigned _numJobs; ///< Number of parallel compile and link jobs
 };
 
 } // namespace atta::script
@@ -11,7 +11,9 @@ class NullCompiler : public Compiler {
     NullCompiler() = default;
 
     void compileAll() override {}
-    void compileTarget(StringId target) override {}
+    void compileTargets(const std::vector<StringId>& targets) override {}
+    void buildTargets(const std::vector<StringId>& targets) override {}
+    void updateTargetFiles(const std::vector<StringId>& targets) override {}
 };
 
 } // namespace atta::script
@@ -27,17 +27,18 @@ void Manager::updateImpl(float dt) {
         factory.runScripts(dt);
 
     // Get entityIds that are clones
+    memory::Scratch scratch;
     const auto& factories = component::getFactories();
-    std::vector<std::pair<component::EntityId, component::EntityId>> beginEndClones(factories.size());
-    for (const auto& factory : factories) {
-        component::EntityId firstClone = factory.getFirstClone().getId();
-        uint64_t numClones = factory.getNumEntitiesCloned() * factory.getMaxClones();
-        beginEndClones.push_back({firstClone, firstClone + numClones});
+    Span<std::pair<component::EntityId, component::EntityId>> beginEndClones =
+        scratch.alloc<std::pair<component::EntityId, component::EntityId>>(factories.size());
+    for (size_t i = 0; i < beginEndClones.size(); i++) {
+        component::EntityId firstClone = factories[i].getFirstClone().getId();
+        uint64_t numClones = factories[i].getNumEntitiesCloned() * factories[i].getMaxClones();
+        beginEndClones[i] = {firstClone, component::EntityId(firstClone + numClones)};
     }
 
     // Run base entity scripts (not clones)
-    std::vector<component::EntityId> entities = component::getScriptView();
-    for (component::EntityId entity : entities) {
+    for (component::EntityId entity : component::getScriptView(scratch)) {
         // Check if it has script component
         component::Script* scriptComponent = component::getComponent<component::Script>(entity);
         if (!scriptComponent)
@@ -51,7 +52,7 @@ void Manager::updateImpl(float dt) {
         // Check if it it not clone entity
         bool isClone = false;
         for (auto [begin, end] : beginEndClones)
-            if (entity >= begin && entity <= end) {
+            if (entity >= begin && entity < end) {
                 isClone = true;
                 break;
             }
@@ -66,6 +67,12 @@ void Manager::updateImpl(float dt) {
 
     if (project)
         project->onUpdateAfter(dt);
+
+#ifndef ATTA_STATIC_PROJECT
+    // Scripts compiled in the background are swapped between steps
+    if (_compiling.valid())
+        swapCompiledTargets(false);
+#endif
 }
 
 Script* Manager::getScriptImpl(StringId target) const {
@@ -7,6 +7,7 @@
 #ifndef ATTA_STATIC_PROJECT
 #include <atta/event/event.h>
 #include <atta/script/compilers/compiler.h>
+#include <future>
 #include <atta/script/linkers/linker.h>
 #endif
 
@@ -45,16 +46,28 @@ class Manager final {
     void onFileChange(event::Event& event);
     void onProjectBeforeDeserialize(event::Event& event);
     void onProjectClose(event::Event& event);
+    void onSimulationStateChange(event::Event& event);
 
     void updateAllTargets();
-    void updateTarget(StringId target);
+    void updateTargets(const std::vector<StringId>& targets);
     void linkTarget(StringId target);
     void releaseTarget(StringId target);
 
+    //----- Hot reload -----//
+    /// Compile the targets in the background while the simulation is running
+    void compileTargetsAsync(std::vector<StringId> targets);
+    /// Link the targets compiled in the background, called at the end of the step
+    /** If wait is false, only links when the compilation has finished **/
+    void swapCompiledTargets(bool wait);
+
     bool _projectDeserialized;
     std::shared_ptr<Compiler> _compiler;
     std::shared_ptr<Linker> _linker;
     std::map<StringId, StringId> _targetToScript; // Convert target name to script name
+
+    std::future<void> _compiling;            ///< Background compilation of the targets below
+    std::vector<StringId> _compilingTargets;
+    std::set<fs::path> _changedFiles;        ///< Files changed during the background compilation
 #endif
 
     std::unordered_map<StringId, Script*> _scripts;
@@ -5,10 +5,15 @@
 #include <atta/event/events/projectBeforeDeserialize.h>
 #include <atta/event/events/projectClose.h>
 #include <atta/event/events/projectOpen.h>
+#include <atta/event/events/simulationPause.h>
+#include <atta/event/events/simulationStop.h>
 #include <atta/script/compilers/linuxCompiler.h>
 #include <atta/script/compilers/nullCompiler.h>
 #include <atta/script/linkers/linuxLinker.h>
 #include <atta/script/linkers/nullLinker.h>
+#include <atta/utils/config.h>
+
+#include <chrono>
 
 namespace atta::script {
 
@@ -25,25 +30,44 @@ void Manager::startUpImpl() {
     event::subscribe<event::ProjectBeforeDeserialize>(BIND_EVENT_FUNC(Manager::onProjectBeforeDeserialize));
     event::subscribe<event::ProjectOpen>(BIND_EVENT_FUNC(Manager::onProjectOpen));
     event::subscribe<event::ProjectClose>(BIND_EVENT_FUNC(Manager::onProjectClose));
+    event::subscribe<event::SimulationPause>(BIND_EVENT_FUNC(Manager::onSimulationStateChange));
+    event::subscribe<event::SimulationStop>(BIND_EVENT_FUNC(Manager::onSimulationStateChange));
 
     _projectDeserialized = false;
     _projectScript = std::make_pair(StringId(), nullptr);
 }
 
-void Manager::shutDownImpl() {}
+void Manager::shutDownImpl() {
+    if (_compiling.valid())
+        _compiling.get();
+}
 
 void Manager::onFileChange(event::Event& event) {
     event::FileWatch& e = reinterpret_cast<event::FileWatch&>(event);
 
     if (e.file.filename() == "CMakeLists.txt") {
+        if (_compiling.valid())
+            swapCompiledTargets(true);
         updateAllTargets();
         return;
     }
 
-    for (auto target : _compiler->getTargetFiles())
-        for (auto file : target.second)
-            if (file == e.file)
-                updateTarget(target.first);
+    // The compiler is busy, the file is compiled after the current compilation
+    if (_compiling.valid()) {
+        _changedFiles.insert(e.file);
+        return;
+    }
+
+    // Rebuild all targets that depend on the file at once
+    std::vector<StringId> targets = _compiler->getFileTargets(e.file);
+    if (Config::getState() == Config::State::RUNNING) {
+        // Keep the simulation running while compiling, the new scripts are swapped at the end of a step
+        if (!targets.empty())
+            compileTargetsAsync(targets);
+        return;
+    }
+    if (!targets.empty())
+        updateTargets(targets);
 
     // Publish event
     event::ScriptTarget evt;
@@ -54,6 +78,9 @@ void Manager::onFileChange(event::Event& event) {
 void Manager::onProjectBeforeDeserialize(event::Event& event) {
     // Load scripts and components. It is necessary to do it before deserializing
     // the project to be able to deserialize custom components
+    if (_compiling.valid())
+        _compiling.get();
+    _changedFiles.clear();
     _projectDeserialized = false;
     updateAllTargets();
 
@@ -72,33 +99,103 @@ void Manager::onProjectOpen(event::Event& event) {
 }
 
 void Manager::onProjectClose(event::Event& event) {
+    if (_compiling.valid())
+        _compiling.get();
+    _changedFiles.clear();
+
     // Release all targets
     for (auto target : _compiler->getTargets())
         releaseTarget(target);
 }
 
+void Manager::onSimulationStateChange(event::Event& event) {
+    // Scripts being compiled are swapped before pausing or stopping the simulation
+    if (_compiling.valid())
+        swapCompiledTargets(true);
+}
+
 void Manager::updateAllTargets() {
+    std::chrono::time_point<std::chrono::system_clock> begin = std::chrono::system_clock::now();
+
     // Release all targets
     for (auto target : _compiler->getTargets())
         releaseTarget(target);
 
     // Recompile all targets
     _compiler->compileAll();
+    std::chrono::time_point<std::chrono::system_clock> compiled = std::chrono::system_clock::now();
 
     // Link each target in the project
     for (auto target : _compiler->getTargets())
         linkTarget(target);
+
+    std::chrono::time_point<std::chrono::system_clock> end = std::chrono::system_clock::now();
+    auto ms = [](auto duration) { return std::chrono::duration_cast<std::chrono::microseconds>(duration).count() / 1000.0f; };
+    LOG_INFO("script::Manager", "Time to reload all targets: [w]$0[] ms (compile [w]$1[] ms, link [w]$2[] ms)", ms(end - begin),
+             ms(compiled - begin), ms(end - compiled));
+}
+
+void Manager::updateTargets(const std::vector<StringId>& targets) {
+    std::chrono::time_point<std::chrono::system_clock> begin = std::chrono::system_clock::now();
+
+    // Delete all scripts related to these targets
+    for (StringId target : targets)
+        releaseTarget(target);
+
+    // Compile targets
+    _compiler->compileTargets(targets);
+    std::chrono::time_point<std::chrono::system_clock> compiled = std::chrono::system_clock::now();
+
+    // Link targets
+    for (StringId target : targets)
+        linkTarget(target);
+
+    std::chrono::time_point<std::chrono::system_clock> end = std::chrono::system_clock::now();
+    auto ms = [](auto duration) { return std::chrono::duration_cast<std::chrono::microseconds>(duration).count() / 1000.0f; };
+    LOG_INFO("script::Manager", "Time to reload [w]$0[] targets: [w]$1[] ms (compile [w]$2[] ms, link [w]$3[] ms)", targets.size(),
+             ms(end - begin), ms(compiled - begin), ms(end - compiled));
 }
 
-void Manager::updateTarget(StringId target) {
-    // Delete all scripts related to this target
-    releaseTarget(target);
+void Manager::compileTargetsAsync(std::vector<StringId> targets) {
+    // Only the build runs in the background, the compiler state (target files) is updated in the main thread when swapping
+    _compilingTargets = std::move(targets);
+    _compiling = std::async(std::launch::async, [this]() { _compiler->buildTargets(_compilingTargets); });
+}
 
-    // Compile and link specific target
-    _compiler->compileTarget(target);
+void Manager::swapCompiledTargets(bool wait) {
+    if (!wait && _compiling.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return;
+    _compiling.get();
+    _compiler->updateTargetFiles(_compilingTargets);
 
-    // Link target
-    linkTarget(target);
+    // Swap scripts, the components of reloaded libraries are kept or migrated when the ScriptTarget event is handled
+    std::chrono::time_point<std::chrono::system_clock> begin = std::chrono::system_clock::now();
+    for (StringId target : _compilingTargets)
+        releaseTarget(target);
+    for (StringId target : _compilingTargets)
+        linkTarget(target);
+    event::ScriptTarget evt;
+    evt.scriptSids = getScriptSidsImpl();
+    event::publish(evt);
+    std::chrono::time_point<std::chrono::system_clock> end = std::chrono::system_clock::now();
+    float ms = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count() / 1000.0f;
+    LOG_INFO("script::Manager", "Hot reloaded [w]$0[] targets, simulation paused for [w]$1[] ms", _compilingTargets.size(), ms);
+    _compilingTargets.clear();
+
+    // Compile files that changed during the compilation
+    std::set<StringId> changedTargets;
+    for (const fs::path& file : _changedFiles)
+        for (StringId target : _compiler->getFileTargets(file))
+            changedTargets.insert(target);
+    _changedFiles.clear();
+    if (changedTargets.empty())
+        return;
+    if (wait) {
+        updateTargets(std::vector<StringId>(changedTargets.begin(), changedTargets.end()));
+        evt.scriptSids = getScriptSidsImpl();
+        event::publish(evt);
+    } else
+        compileTargetsAsync(std::vector<StringId>(changedTargets.begin(), changedTargets.end()));
 }
 
 void Manager::linkTarget(StringId target) {
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#ifdef ATTA_OS_LINUX
+
+#include <atta/component/tests/common.h>
+#include <atta/file/interface.h>
+#include <atta/script/compilers/linuxCompiler.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::script;
+
+namespace {
+constexpr int NUM_TARGETS = 4;
+
+// Project with script targets that share the precompiled header, like the projects that use atta_add_target
+class Script_Speed : public ::testing::Test {
+  public:
+    void SetUp() override {
+        component::test::startUp();
+        _dir = fs::temp_directory_path() / "atta_script_speed";
+        fs::remove_all(_dir);
+        fs::create_directories(_dir / "src");
+
+        std::ofstream(_dir / "pch.h") << "#include <iostream>\n#include <map>\n#include <string>\n#include <vector>\n";
+        std::ofstream(_dir / "src" / "common.h") << "#pragma once\ninline int common() { return 1; }\n";
+        std::ofstream cmake(_dir / "CMakeLists.txt");
+        cmake << "cmake_minimum_required(VERSION 3.16)\nproject(atta_script_speed CXX)\n"
+                 "macro(add_script target sources)\n"
+                 "    add_library(${target} SHARED ${sources})\n"
+                 "    set_target_properties(${target} PROPERTIES DEFINE_SYMBOL \"\")\n"
+                 "    get_property(pchTarget GLOBAL PROPERTY PCH_TARGET)\n"
+                 "    if(pchTarget)\n"
+                 "        target_precompile_headers(${target} REUSE_FROM ${pchTarget})\n"
+                 "    else()\n"
+                 "        target_precompile_headers(${target} PRIVATE \"${CMAKE_CURRENT_LIST_DIR}/pch.h\")\n"
+                 "        set_property(GLOBAL PROPERTY PCH_TARGET ${target})\n"
+                 "    endif()\n"
+                 "endmacro()\n";
+        for (int i = 0; i < NUM_TARGETS; i++) {
+            std::string name = "script" + std::to_string(i);
+            cmake << "add_script(" << name << " \"src/" << name << ".cpp\")\n";
+            writeSource(i, 0);
+        }
+        cmake.close();
+        file::createProject(_dir / "speed.atta");
+    }
+    void TearDown() override {
+        file::closeProject();
+        fs::remove_all(_dir);
+    }
+
+  protected:
+    void writeSource(int i, int version) {
+        std::ofstream(_dir / "src" / ("script" + std::to_string(i) + ".cpp"))
+            << "#include \"common.h\"\nint script" << i << "() { return common() + " << version << "; }\n";
+    }
+    fs::file_time_type getLibraryTime(int i) {
+        std::error_code ec;
+        return fs::last_write_time(_dir / "build" / ("libscript" + std::to_string(i) + ".so"), ec);
+    }
+
+    fs::path _dir;
+};
+
+// Time to rebuild the targets after a change to one target source or to the header that all targets include
+TEST_F(Script_Speed, ReloadTargets) {
+    if (std::system("cmake --version > /dev/null 2>&1") != 0 || std::system("make --version > /dev/null 2>&1") != 0)
+        GTEST_SKIP() << "cmake and make are necessary to compile the scripts";
+
+    auto ms = [](auto begin) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin).count() / 1000.0f;
+    };
+    LinuxCompiler compiler;
+    auto begin = std::chrono::steady_clock::now();
+    compiler.compileAll();
+    float allMs = ms(begin);
+    ASSERT_EQ(compiler.getTargets().size(), NUM_TARGETS);
+
+    // Change one source, only its target is rebuilt
+    fs::file_time_type before = getLibraryTime(1);
+    writeSource(0, 1);
+    std::vector<StringId> targets = compiler.getFileTargets(_dir / "src" / "script0.cpp");
+    ASSERT_EQ(targets, std::vector<StringId>({StringId("script0")}));
+    begin = std::chrono::steady_clock::now();
+    compiler.compileTargets(targets);
+    float oneMs = ms(begin);
+    EXPECT_EQ(getLibraryTime(1), before);
+
+    // Change the common header, all targets are rebuilt with one build (the shared precompiled header is built only once)
+    std::ofstream(_dir / "src" / "common.h") << "#pragma once\ninline int common() { return 2; }\n";
+    targets = compiler.getFileTargets(_dir / "src" / "common.h");
+    ASSERT_EQ(targets.size(), NUM_TARGETS);
+    std::vector<fs::file_time_type> times;
+    for (int i = 0; i < NUM_TARGETS; i++)
+        times.push_back(getLibraryTime(i));
+    begin = std::chrono::steady_clock::now();
+    compiler.compileTargets(targets);
+    float commonMs = ms(begin);
+    for (int i = 0; i < NUM_TARGETS; i++)
+        EXPECT_GT(getLibraryTime(i), times[i]) << "script" << i << " was not rebuilt";
+
+    RecordProperty("compileAllMs", std::to_string(allMs));
+    RecordProperty("reloadOneTargetMs", std::to_string(oneMs));
+    RecordProperty("reloadAllTargetsMs", std::to_string(commonMs));
+}
+
+} // namespace
+
+#endif // ATTA_OS_LINUX
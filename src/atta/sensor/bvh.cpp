@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/sensor/bvh.h>
+
+namespace atta::sensor {
+
+void Bvh::build(const std::vector<bnd3>& bounds) {
+    _nodes.clear();
+    _order.resize(bounds.size());
+    if (bounds.empty())
+        return;
+
+    std::vector<vec3> centroids(bounds.size());
+    for (uint32_t i = 0; i < bounds.size(); i++) {
+        _order[i] = i;
+        centroids[i] = (bounds[i].pMin + bounds[i].pMax) * 0.5f;
+    }
+    _nodes.reserve(2 * (bounds.size() / MAX_LEAF_PRIMITIVES + 1));
+    buildNode(0, bounds.size(), bounds, centroids);
+}
+
+bnd3 Bvh::getBounds() const { return _nodes.empty() ? bnd3(vec3(0.0f)) : _nodes[0].bounds; }
+
+void Bvh::buildNode(uint32_t begin, uint32_t end, const std::vector<bnd3>& bounds, const std::vector<vec3>& centroids) {
+    uint32_t node = _nodes.size();
+    _nodes.push_back({});
+
+    // Node bounds and centroid bounds
+    bnd3 box(bounds[_order[begin]].pMin, bounds[_order[begin]].pMax);
+    bnd3 centroidBox(centroids[_order[begin]]);
+    for (uint32_t i = begin + 1; i < end; i++) {
+        box = unionb(box, bounds[_order[i]]);
+        centroidBox = unionb(centroidBox, centroids[_order[i]]);
+    }
+    _nodes[node].bounds = box;
+
+    // Leaf if there are few primitives or if they can not be split
+    vec3 extent = centroidBox.pMax - centroidBox.pMin;
+    unsigned axis = extent.x > extent.y ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+    if (end - begin <= MAX_LEAF_PRIMITIVES || extent[axis] <= 0.0f) {
+        _nodes[node].first = begin;
+        _nodes[node].count = end - begin;
+        return;
+    }
+
+    // Median split
+    uint32_t mid = (begin + end) / 2;
+    std::nth_element(_order.begin() + begin, _order.begin() + mid, _order.begin() + end,
+                     [&](uint32_t a, uint32_t b) { return centroids[a][axis] < centroids[b][axis]; });
+    buildNode(begin, mid, bounds, centroids);
+    _nodes[node].first = _nodes.size();
+    _nodes[node].count = 0;
+    buildNode(mid, end, bounds, centroids);
+}
+
+} // namespace atta::sensor
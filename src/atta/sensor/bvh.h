@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/utils/math/bounds.h>
+
+namespace atta::sensor {
+
+/** Bounding volume hierarchy used by the CPU ray tracer
+ *
+ * Built from the bounds of the primitives with median splits along the largest axis of the centroid bounds. The
+ * build computes a new primitive order, the caller reorders its primitives with getOrder so that each leaf references
+ * a contiguous range. Nodes are stored in depth-first order, the left child of an internal node is the next node
+ **/
+class Bvh final {
+  public:
+    static constexpr uint32_t MAX_LEAF_PRIMITIVES = 4;
+
+    void build(const std::vector<bnd3>& bounds);
+
+    /// Primitive index of each position in the leaf ranges
+    const std::vector<uint32_t>& getOrder() const { return _order; }
+    bnd3 getBounds() const;
+    size_t getNumNodes() const { return _nodes.size(); }
+
+    /// Find the closest hit along the ray
+    /** Calls testPrimitives(first, count, t) for each leaf hit by the ray before t, the callback should reduce t
+     * when it finds a closer hit
+     **/
+    template <typename F>
+    void traverse(const vec3& origin, const vec3& invDirection, float& t, F&& testPrimitives) const;
+
+    /// Slab test, returns the ray entry distance or a negative value if the box is missed before t
+    static float intersect(const bnd3& box, const vec3& origin, const vec3& invDirection, float t);
+
+  private:
+    struct Node {
+        bnd3 bounds;
+        uint32_t first; ///< First primitive (leaf) or right child (internal)
+        uint32_t count; ///< Number of primitives, zero for internal nodes
+    };
+    static constexpr size_t MAX_DEPTH = 64;
+
+    void buildNode(uint32_t begin, uint32_t end, const std::vector<bnd3>& bounds, const std::vector<vec3>& centroids);
+
+    std::vector<Node> _nodes;
+    std::vector<uint32_t> _order;
+};
+
+} // namespace atta::sensor
+
+#include <atta/sensor/bvh.inl>
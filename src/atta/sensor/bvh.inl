@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+
+namespace atta::sensor {
+
+inline float Bvh::intersect(const bnd3& box, const vec3& origin, const vec3& invDirection, float t) {
+    float t0 = 0.0f;
+    float t1 = t;
+    for (unsigned i = 0; i < 3; i++) {
+        float tNear = (box.pMin[i] - origin[i]) * invDirection[i];
+        float tFar = (box.pMax[i] - origin[i]) * invDirection[i];
+        if (tNear > tFar)
+            std::swap(tNear, tFar);
+        t0 = tNear > t0 ? tNear : t0;
+        t1 = tFar < t1 ? tFar : t1;
+        if (t0 > t1)
+            return -1.0f;
+    }
+    return t0;
+}
+
+template <typename F>
+void Bvh::traverse(const vec3& origin, const vec3& invDirection, float& t, F&& testPrimitives) const {
+    if (_nodes.empty() || intersect(_nodes[0].bounds, origin, invDirection, t) < 0.0f)
+        return;
+
+    uint32_t stack[MAX_DEPTH];
+    size_t stackSize = 0;
+    uint32_t node = 0;
+    while (true) {
+        const Node& n = _nodes[node];
+        if (n.count > 0) {
+            testPrimitives(n.first, n.count, t);
+        } else {
+            // Visit the closest child first, the other one is visited later if it is still closer than the hit
+            uint32_t left = node + 1;
+            uint32_t right = n.first;
+            float tLeft = intersect(_nodes[left].bounds, origin, invDirection, t);
+            float tRight = intersect(_nodes[right].bounds, origin, invDirection, t);
+            if (tLeft >= 0.0f && tRight >= 0.0f) {
+                if (tRight < tLeft)
+                    std::swap(left, right);
+                stack[stackSize++] = right;
+                node = left;
+                continue;
+            }
+            if (tLeft >= 0.0f) {
+                node = left;
+                continue;
+            }
+            if (tRight >= 0.0f) {
+                node = right;
+                continue;
+            }
+        }
+        if (stackSize == 0)
+            break;
+        node = stack[--stackSize];
+    }
+}
+
+} // namespace atta::sensor
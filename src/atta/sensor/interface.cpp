@@ -14,13 +14,24 @@ void update(float dt) {
     Manager::getInstance().updateImpl(dt);
 }
 
-std::vector<CameraInfo>& getCameraInfos() { return Manager::getInstance()._cameras; }
-std::vector<InfraredInfo>& getInfraredInfos() { return Manager::getInstance()._infrareds; }
+std::vector<CameraInfo>& getCameraInfos() { return Manager::getInstance()._cameras.getInfos(); }
+std::vector<InfraredInfo>& getInfraredInfos() { return Manager::getInstance()._infrareds.getInfos(); }
+std::vector<LidarInfo>& getLidarInfos() { return Manager::getInstance()._lidars.getInfos(); }
+CameraInfo* getCameraInfo(const cmp::CameraSensor* camera) { return Manager::getInstance()._cameras.get(camera); }
+LidarInfo* getLidarInfo(const cmp::LidarSensor* lidar) { return Manager::getInstance()._lidars.get(lidar); }
+
+bool addStream(std::string name, StreamType type, cmp::Entity entity, cmp::ComponentId component, uint32_t numSlots) {
+    return Manager::getInstance().addStreamImpl(name, type, entity, component, numSlots);
+}
+void removeStream(std::string name) { Manager::getInstance().removeStreamImpl(name); }
+std::vector<StreamInfo>& getStreamInfos() { return Manager::getInstance()._streams; }
 
 bool getShowCameras() { return Manager::getInstance()._showCameras; }
 void setShowCameras(bool showCameras) { Manager::getInstance()._showCameras = showCameras; }
 bool getShowInfrareds() { return Manager::getInstance()._showInfrareds; }
 void setShowInfrareds(bool showInfrareds) { Manager::getInstance()._showInfrareds = showInfrareds; }
+bool getShowLidars() { return Manager::getInstance()._showLidars; }
+void setShowLidars(bool showLidars) { Manager::getInstance()._showLidars = showLidars; }
 
 void* getEntityCameraImGuiTexture(cmp::Entity eid) { return Manager::getInstance().getEntityCameraImGuiTextureImpl(eid); }
 
@@ -5,8 +5,10 @@
 #include <atta/component/base.h>
 #include <atta/component/components/cameraSensor.h>
 #include <atta/component/components/infraredSensor.h>
+#include <atta/component/components/lidarSensor.h>
 #include <atta/graphics/cameras/camera.h>
 #include <atta/graphics/renderers/renderer.h>
+#include <atta/sensor/streamBuffer.h>
 
 namespace atta::sensor {
 
@@ -27,6 +29,32 @@ struct InfraredInfo {
     cmp::InfraredSensor* component;
 };
 
+// Lidar
+struct LidarInfo {
+    cmp::Entity entity;
+    cmp::LidarSensor* component;
+    std::vector<float> ranges;    ///< Last scan, one row of horizontal beams for each vertical beam
+    vec3 origin;                  ///< World position of the last scan
+    std::vector<vec3> directions; ///< World direction of each beam of the last scan
+};
+
+// Stream
+enum class StreamType {
+    SENSOR = 0, ///< Sensor output (camera image, infrared measurement, lidar ranges) written when a new output is available
+    COMPONENT,  ///< Component memory written every step
+    ACTION,     ///< Component memory read every step, written by the external process
+};
+struct StreamInfo {
+    std::string name; ///< Shared memory name
+    StreamType type;
+    cmp::Entity entity;
+    cmp::ComponentId component;
+    uint32_t numSlots;
+    std::shared_ptr<StreamBuffer> buffer; ///< Created when the size of the sensor output is known
+    float lastTime;                       ///< Sensor time of the last sample written
+    uint64_t lastSequence;                ///< Sequence of the last action applied
+};
+
 /// Sensor module start up
 void startUp();
 
@@ -41,11 +69,29 @@ void* getEntityCameraImGuiTexture(cmp::Entity eid);
 
 std::vector<CameraInfo>& getCameraInfos();
 std::vector<InfraredInfo>& getInfraredInfos();
+std::vector<LidarInfo>& getLidarInfos();
+/// Info of the sensor component (constant time), nullptr if the sensor is not registered
+CameraInfo* getCameraInfo(const cmp::CameraSensor* camera);
+LidarInfo* getLidarInfo(const cmp::LidarSensor* lidar);
+
+//----- Streaming -----//
+/// Stream to a shared memory ring buffer that can be read by external processes
+/** Sensor streams accept the camera, infrared, and lidar components, the payload is the camera image, the float
+ * measurement, or the lidar ranges. Component and action streams have the component memory up to the end of its
+ * attributes, actions only write the described attributes. Components that own memory (not trivially destructible)
+ * can not be streamed. If the size of a sensor output changes, the buffer is created again and the readers must open
+ * it again. Return false if the stream could not be created
+ **/
+bool addStream(std::string name, StreamType type, cmp::Entity entity, cmp::ComponentId component, uint32_t numSlots = 4);
+void removeStream(std::string name);
+std::vector<StreamInfo>& getStreamInfos();
 
 //----- UI rendering -----//
 bool getShowCameras();
 void setShowCameras(bool showCameras);
 bool getShowInfrareds();
 void setShowInfrareds(bool showInfrareds);
+bool getShowLidars();
+void setShowLidars(bool showLidars);
 
 } // namespace atta::sensor
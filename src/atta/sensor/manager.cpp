@@ -7,6 +7,7 @@
 #include <atta/component/components/transform.h>
 #include <atta/component/interface.h>
 
+#include <atta/event/events/createClones.h>
 #include <atta/event/events/createComponent.h>
 #include <atta/event/events/deleteComponent.h>
 #include <atta/event/events/projectOpen.h>
@@ -42,6 +43,7 @@ void Manager::startUpImpl() {
     // Subscribe to component events
     evt::subscribe<evt::CreateComponent>(BIND_EVENT_FUNC(Manager::onComponentChange));
     evt::subscribe<evt::DeleteComponent>(BIND_EVENT_FUNC(Manager::onComponentChange));
+    evt::subscribe<evt::CreateClones>(BIND_EVENT_FUNC(Manager::onComponentChange));
 
     // Subscribe to component ui events
     evt::subscribe<evt::UiCameraComponent>(BIND_EVENT_FUNC(Manager::onComponentUi));
@@ -52,20 +54,27 @@ void Manager::startUpImpl() {
     // Initialize sensors (component events generated before startup were not received)
     registerCameras();
     registerInfrareds();
+    registerLidars();
 
     _showCameras = true;
     _showInfrareds = true;
+    _showLidars = true;
 }
 
 void Manager::shutDownImpl() {
     // Destroy sensors
     unregisterCameras();
     unregisterInfrareds();
+    unregisterLidars();
+    _streams.clear();
+    _rayTracer.reset();
 }
 
 void Manager::updateImpl(float dt) {
     updateCameras(dt);
     updateInfrareds(dt);
+    updateLidars(dt);
+    updateStreams();
 }
 
 void Manager::onSimulationStateChange(event::Event& event) {
@@ -75,6 +84,8 @@ void Manager::onSimulationStateChange(event::Event& event) {
                 initializeCamera(cameraInfo);
             for (InfraredInfo& infraredInfo : _infrareds)
                 initializeInfrared(infraredInfo);
+            for (LidarInfo& lidarInfo : _lidars)
+                initializeLidar(lidarInfo);
             break;
         }
         case event::SimulationStop::type: {
@@ -90,6 +101,11 @@ void Manager::onProjectOpen(evt::Event& event) {
 
     unregisterInfrareds();
     registerInfrareds();
+
+    unregisterLidars();
+    registerLidars();
+
+    _streams.clear();
 }
 
 void Manager::onComponentChange(evt::Event& event) {
@@ -101,6 +117,23 @@ void Manager::onComponentChange(evt::Event& event) {
                 registerCamera(e.entityId, static_cast<cmp::CameraSensor*>(e.component));
             else if (e.componentId == cmp::getId<cmp::InfraredSensor>())
                 registerInfrared(e.entityId, static_cast<cmp::InfraredSensor*>(e.component));
+            else if (e.componentId == cmp::getId<cmp::LidarSensor>())
+                registerLidar(e.entityId, static_cast<cmp::LidarSensor*>(e.component));
+
+            break;
+        }
+        case evt::CreateClones::type: {
+            evt::CreateClones& e = reinterpret_cast<evt::CreateClones&>(event);
+
+            for (cmp::EntityId eid = e.firstClone; eid < e.firstClone + cmp::EntityId(e.numClones); eid++) {
+                cmp::Entity entity(eid);
+                if (cmp::CameraSensor* camera = entity.get<cmp::CameraSensor>())
+                    registerCamera(entity, camera);
+                if (cmp::InfraredSensor* infrared = entity.get<cmp::InfraredSensor>())
+                    registerInfrared(entity, infrared);
+                if (cmp::LidarSensor* lidar = entity.get<cmp::LidarSensor>())
+                    registerLidar(entity, lidar);
+            }
 
             break;
         }
@@ -111,6 +144,9 @@ void Manager::onComponentChange(evt::Event& event) {
                 unregisterCamera(e.entityId);
             else if (e.componentId == cmp::getId<cmp::InfraredSensor>())
                 unregisterInfrared(e.entityId);
+            else if (e.componentId == cmp::getId<cmp::LidarSensor>())
+                unregisterLidar(e.entityId);
+            removeStreams(e.entityId, e.componentId);
 
             break;
         }
@@ -125,3 +161,5 @@ void Manager::onComponentUi(evt::Event& event) { cameraCheckUiEvents(event); }
 
 #include <atta/sensor/managerCamera.cpp>
 #include <atta/sensor/managerInfrared.cpp>
+#include <atta/sensor/managerLidar.cpp>
+#include <atta/sensor/managerStream.cpp>
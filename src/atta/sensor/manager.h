@@ -3,8 +3,11 @@
 #pragma once
 
 #include <atta/sensor/interface.h>
+#include <atta/sensor/rayTracer.h>
+#include <atta/sensor/sensorList.h>
 
 #include <atta/event/interface.h>
+#include <atta/physics/interface.h>
 
 namespace atta::sensor {
 
@@ -18,10 +21,18 @@ class Manager final {
     friend void* sensor::getEntityCameraImGuiTexture(cmp::Entity eid);
     friend std::vector<CameraInfo>& sensor::getCameraInfos();
     friend std::vector<InfraredInfo>& sensor::getInfraredInfos();
+    friend std::vector<LidarInfo>& sensor::getLidarInfos();
+    friend CameraInfo* sensor::getCameraInfo(const cmp::CameraSensor* camera);
+    friend LidarInfo* sensor::getLidarInfo(const cmp::LidarSensor* lidar);
+    friend bool sensor::addStream(std::string name, StreamType type, cmp::Entity entity, cmp::ComponentId component, uint32_t numSlots);
+    friend void sensor::removeStream(std::string name);
+    friend std::vector<StreamInfo>& sensor::getStreamInfos();
     friend bool getShowCameras();
     friend void setShowCameras(bool showCameras);
     friend bool getShowInfrareds();
     friend void setShowInfrareds(bool showInfrareds);
+    friend bool getShowLidars();
+    friend void setShowLidars(bool showLidars);
 
   private:
     // Interface
@@ -40,9 +51,11 @@ class Manager final {
     void registerCamera(cmp::Entity entity, cmp::CameraSensor* camera);
     void unregisterCameras();
     void unregisterCamera(cmp::Entity entity);
-    void updateCameras(float dt);                   ///< Render cameras when necessary
-    void initializeCamera(CameraInfo& cameraInfo);  ///< Initialize camera renderer and camera
-    void updateCameraModel(CameraInfo& cameraInfo); ///< Update camera poses and parameters
+    void updateCameras(float dt);                             ///< Render cameras when necessary
+    void initializeCamera(CameraInfo& cameraInfo);            ///< Initialize camera renderer and camera
+    void updateCameraModel(CameraInfo& cameraInfo);           ///< Update camera poses and parameters
+    void createCameraRenderer(CameraInfo& cameraInfo);        ///< Create GPU renderer if the renderer type changed
+    RayTracer::View getRayTracerView(CameraInfo& cameraInfo); ///< Ray traced camera parameters and image buffers
     void* getEntityCameraImGuiTextureImpl(cmp::Entity eid);
     void cameraCheckUiEvents(evt::Event& event);
 
@@ -54,10 +67,36 @@ class Manager final {
     void initializeInfrared(InfraredInfo& infraredInfo);
     void updateInfrareds(float dt); ///< Ray-cast sensors when necessary
 
-    std::vector<CameraInfo> _cameras;
-    std::vector<InfraredInfo> _infrareds;
-    bool _showCameras;   ///< UI camera lines rendering
-    bool _showInfrareds; ///< UI infrared lines rendering
+    // Lidar
+    void registerLidars();
+    void registerLidar(cmp::Entity entity, cmp::LidarSensor* lidar);
+    void unregisterLidars();
+    void unregisterLidar(cmp::Entity entity);
+    void initializeLidar(LidarInfo& lidarInfo);
+    void updateLidars(float dt);                               ///< Ray-cast the beams of all lidars that should scan in one batch
+    void computeLidarBeams(LidarInfo& lidarInfo, bool planar); ///< Append beam rays to the batch
+
+    // Stream
+    bool addStreamImpl(std::string name, StreamType type, cmp::Entity entity, cmp::ComponentId component, uint32_t numSlots);
+    void removeStreamImpl(std::string name);
+    void removeStreams(cmp::Entity entity, cmp::ComponentId component); ///< Remove streams of deleted component
+    void updateStreams();                                               ///< Write sensor/component streams and apply actions
+    void writeSensorStream(StreamInfo& streamInfo);
+    cmp::ComponentRegistry* getComponentRegistry(cmp::ComponentId component); ///< nullptr if the component is not registered
+
+    SensorList<CameraInfo> _cameras;
+    std::shared_ptr<RayTracer> _rayTracer; ///< Created when the first ray traced camera is rendered
+    SensorList<InfraredInfo> _infrareds;
+    SensorList<LidarInfo> _lidars;
+    std::vector<vec3> _lidarBegins;          ///< Beam origins of the current batch (kept to avoid allocations)
+    std::vector<vec3> _lidarEnds;            ///< Beam ends of the current batch
+    std::vector<phy::RayCastHit> _lidarHits; ///< Beam hits of the current batch
+    std::vector<LidarInfo*> _lidarScans;     ///< Lidars in the current batch
+    std::vector<StreamInfo> _streams;
+    std::vector<uint8_t> _streamData; ///< Action read buffer
+    bool _showCameras;                ///< UI camera lines rendering
+    bool _showInfrareds;              ///< UI infrared lines rendering
+    bool _showLidars;                 ///< UI lidar lines rendering
 };
 
 } // namespace atta::sensor
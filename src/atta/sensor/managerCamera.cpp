@@ -5,18 +5,9 @@ namespace atta::sensor {
 void Manager::registerCameras() {
     for (cmp::Entity entity : cmp::getEntitiesView()) {
         cmp::CameraSensor* camera = cmp::getComponent<cmp::CameraSensor>(entity);
-        if (camera) {
-            // Check if camera was not registered yet
-            bool found = false;
-            for (auto ci : _cameras)
-                if (ci.entity == entity) {
-                    found = true;
-                    break;
-                }
-            // Register new camera
-            if (!found)
-                registerCamera(entity, camera);
-        }
+        // Register new camera
+        if (camera && _cameras.get(entity) == nullptr)
+            registerCamera(entity, camera);
     }
 }
 
@@ -30,26 +21,21 @@ void Manager::registerCamera(cmp::Entity entity, cmp::CameraSensor* camera) {
     cameraInfo.component = camera;
     cameraInfo.showWindow = false;
     cameraInfo.initialized = false;
-    _cameras.push_back(cameraInfo);
+    _cameras.add(std::move(cameraInfo));
 }
 
 void Manager::unregisterCameras() { _cameras.clear(); }
 
 void Manager::unregisterCamera(cmp::Entity entity) {
-    bool found = false;
-    for (int i = _cameras.size() - 1; i >= 0; i--) {
-        if (_cameras[i].entity == entity) {
-            _cameras.erase(_cameras.begin() + i);
-            found = true;
-            break;
-        }
-    }
-
-    if (!found)
+    if (!_cameras.remove(entity))
         LOG_WARN("sensor::Manager", "Could not unregister camera from entity [w]$0[], camera was not registered before", entity);
 }
 
 void Manager::updateCameras(float dt) {
+    memory::Scratch scratch;
+    Span<RayTracer::View> views = scratch.alloc<RayTracer::View>(_cameras.size());
+    size_t numViews = 0;
+
     for (CameraInfo& cameraInfo : _cameras) {
         // Always update camera model (used to render UI sensor drawer)
         updateCameraModel(cameraInfo);
@@ -62,11 +48,41 @@ void Manager::updateCameras(float dt) {
         float change = Config::getTime() - cameraInfo.component->captureTime;
         float interval = 1.0f / cameraInfo.component->fps;
         if (change >= interval) {
-            cameraInfo.renderer->render(cameraInfo.camera);
-            cameraInfo.data = cameraInfo.renderer->getFramebuffer()->getImage(0)->read();
+            if (cameraInfo.component->rendererType == cmp::CameraSensor::RendererType::RAY_TRACED)
+                views[numViews++] = getRayTracerView(cameraInfo); // Ray traced cameras are rendered together
+            else {
+                cameraInfo.renderer->render(cameraInfo.camera);
+                cameraInfo.data = cameraInfo.renderer->getFramebuffer()->getImage(0)->read();
+            }
             cameraInfo.component->captureTime = Config::getTime();
         }
     }
+
+    if (numViews > 0) {
+        if (!_rayTracer)
+            _rayTracer = std::make_shared<RayTracer>();
+        _rayTracer->update();
+        _rayTracer->render(views.first(numViews));
+    }
+}
+
+RayTracer::View Manager::getRayTracerView(CameraInfo& cameraInfo) {
+    cmp::CameraSensor* camera = cameraInfo.component;
+    size_t numPixels = size_t(camera->width) * camera->height;
+    cameraInfo.data.resize(numPixels * (sizeof(float) + sizeof(cmp::EntityId)));
+
+    RayTracer::View view;
+    view.position = cameraInfo.camera->getPosition();
+    view.front = cameraInfo.camera->getFront();
+    view.up = cameraInfo.camera->getUp();
+    view.perspective = camera->cameraType == cmp::CameraSensor::CameraType::PERSPECTIVE;
+    view.fov = view.perspective ? radians(camera->fov) : camera->fov;
+    view.far = camera->far;
+    view.width = camera->width;
+    view.height = camera->height;
+    view.depth = reinterpret_cast<float*>(cameraInfo.data.data());
+    view.entities = reinterpret_cast<cmp::EntityId*>(cameraInfo.data.data() + numPixels * sizeof(float));
+    return view;
 }
 
 void Manager::initializeCamera(CameraInfo& cameraInfo) {
@@ -81,22 +97,7 @@ void Manager::initializeCamera(CameraInfo& cameraInfo) {
         cameraInfo.initialized = true;
 
         // Create renderer
-        switch (camera->rendererType) {
-            case cmp::CameraSensor::RendererType::FAST:
-                cameraInfo.renderer = std::make_shared<gfx::FastRenderer>();
-                break;
-            case cmp::CameraSensor::RendererType::PHONG:
-                cameraInfo.renderer = std::make_shared<gfx::PhongRenderer>();
-                break;
-            case cmp::CameraSensor::RendererType::PBR:
-                cameraInfo.renderer = std::make_shared<gfx::PbrRenderer>();
-                break;
-            default:
-                LOG_WARN("sensor::Manager", "Invalid camera renderer type $0 for entity $1", (int)camera->rendererType, cameraInfo.entity);
-        }
-        cameraInfo.renderer->setRenderDrawer(false);
-        cameraInfo.renderer->setRenderSelected(false);
-        cameraInfo.renderer->resize(camera->width, camera->height);
+        createCameraRenderer(cameraInfo);
 
         // Create camera (view/projection matrices)
         switch (camera->cameraType) {
@@ -124,6 +125,46 @@ void Manager::initializeCamera(CameraInfo& cameraInfo) {
     }
 }
 
+void Manager::createCameraRenderer(CameraInfo& cameraInfo) {
+    cmp::CameraSensor* camera = cameraInfo.component;
+
+    // Ray traced cameras are rendered on the CPU by the RayTracer
+    if (camera->rendererType == cmp::CameraSensor::RendererType::RAY_TRACED) {
+        cameraInfo.renderer.reset();
+        return;
+    }
+
+    // Create renderer if there is none or if the renderer type changed
+    bool changed = !cameraInfo.renderer;
+    if (!changed) {
+        std::string name = cameraInfo.renderer->getName();
+        changed = (camera->rendererType == cmp::CameraSensor::RendererType::FAST && name != "FastRenderer") ||
+                  (camera->rendererType == cmp::CameraSensor::RendererType::PHONG && name != "PhongRenderer") ||
+                  (camera->rendererType == cmp::CameraSensor::RendererType::PBR && name != "PbrRenderer");
+    }
+    if (changed) {
+        switch (camera->rendererType) {
+            case cmp::CameraSensor::RendererType::FAST:
+                cameraInfo.renderer = std::make_shared<gfx::FastRenderer>();
+                break;
+            case cmp::CameraSensor::RendererType::PHONG:
+                cameraInfo.renderer = std::make_shared<gfx::PhongRenderer>();
+                break;
+            case cmp::CameraSensor::RendererType::PBR:
+                cameraInfo.renderer = std::make_shared<gfx::PbrRenderer>();
+                break;
+            default:
+                LOG_WARN("sensor::Manager", "Invalid camera renderer type $0 for entity $1", (int)camera->rendererType, cameraInfo.entity);
+                return;
+        }
+        cameraInfo.renderer->setRenderDrawer(false);
+        cameraInfo.renderer->setRenderSelected(false);
+    }
+
+    // Update camera width/height
+    cameraInfo.renderer->resize(camera->width, camera->height);
+}
+
 void Manager::updateCameraModel(CameraInfo& cameraInfo) {
     PROFILE();
     //----- Update camera pose and parameters -----//
@@ -164,35 +205,7 @@ void Manager::updateCameraModel(CameraInfo& cameraInfo) {
         }
 
         // Update renderer
-        cmp::CameraSensor::RendererType currRendererType;
-        if (cameraInfo.renderer->getName() == "FastRenderer")
-            currRendererType = cmp::CameraSensor::RendererType::FAST;
-        else if (cameraInfo.renderer->getName() == "PhongRenderer")
-            currRendererType = cmp::CameraSensor::RendererType::PHONG;
-        else if (cameraInfo.renderer->getName() == "PbrRenderer")
-            currRendererType = cmp::CameraSensor::RendererType::PBR;
-
-        if (cameraInfo.component->rendererType != currRendererType) {
-            switch (cameraInfo.component->rendererType) {
-                case cmp::CameraSensor::RendererType::FAST:
-                    cameraInfo.renderer = std::make_shared<gfx::FastRenderer>();
-                    break;
-                case cmp::CameraSensor::RendererType::PHONG:
-                    cameraInfo.renderer = std::make_shared<gfx::PhongRenderer>();
-                    break;
-                case cmp::CameraSensor::RendererType::PBR:
-                    cameraInfo.renderer = std::make_shared<gfx::PbrRenderer>();
-                    break;
-                default:
-                    LOG_WARN("sensor::Manager", "Invalid camera renderer type $0 for entity $1", (int)cameraInfo.component->rendererType,
-                             cameraInfo.entity);
-            }
-            cameraInfo.renderer->setRenderDrawer(false);
-            cameraInfo.renderer->setRenderSelected(false);
-        }
-
-        // Update camera width/height
-        cameraInfo.renderer->resize(cameraInfo.component->width, cameraInfo.component->height);
+        createCameraRenderer(cameraInfo);
 
         // TODO camera projection
     } else {
@@ -201,21 +214,16 @@ void Manager::updateCameraModel(CameraInfo& cameraInfo) {
 }
 
 void* Manager::getEntityCameraImGuiTextureImpl(cmp::Entity eid) {
-    for (size_t i = 0; i < _cameras.size(); i++)
-        if (_cameras[i].entity == eid)
-            return _cameras[i].renderer->getImGuiTexture();
-    return nullptr;
+    CameraInfo* cameraInfo = _cameras.get(eid);
+    return cameraInfo && cameraInfo->renderer ? cameraInfo->renderer->getImGuiTexture() : nullptr;
 }
 
 void Manager::cameraCheckUiEvents(event::Event& event) {
     switch (event.getType()) {
         case event::UiCameraComponent::type: {
             event::UiCameraComponent& e = reinterpret_cast<event::UiCameraComponent&>(event);
-            for (auto& camera : _cameras)
-                if (camera.component == e.component) {
-                    camera.showWindow = true;
-                    break;
-                }
+            if (CameraInfo* cameraInfo = _cameras.get(e.component))
+                cameraInfo->showWindow = true;
             break;
         }
     }
@@ -5,34 +5,16 @@ namespace atta::sensor {
 void Manager::unregisterInfrareds() { _infrareds.clear(); }
 
 void Manager::unregisterInfrared(cmp::Entity entity) {
-    bool found = false;
-    for (int i = _infrareds.size() - 1; i >= 0; i--) {
-        if (_infrareds[i].entity == entity) {
-            _infrareds.erase(_infrareds.begin() + i);
-            found = true;
-            break;
-        }
-    }
-
-    if (!found)
+    if (!_infrareds.remove(entity))
         LOG_WARN("sensor::Manager", "Could not unregister infrared from entity [w]$0[], infrared was not registered before", entity);
 }
 
 void Manager::registerInfrareds() {
     for (cmp::Entity entity : cmp::getEntitiesView()) {
         cmp::InfraredSensor* infrared = cmp::getComponent<cmp::InfraredSensor>(entity);
-        if (infrared) {
-            // Check if infrared was not registered yet
-            bool found = false;
-            for (auto ir : _infrareds)
-                if (ir.entity == entity) {
-                    found = true;
-                    break;
-                }
-            // Register new infrared
-            if (!found)
-                registerInfrared(entity, infrared);
-        }
+        // Register new infrared
+        if (infrared && _infrareds.get(entity) == nullptr)
+            registerInfrared(entity, infrared);
     }
 }
 
@@ -44,7 +26,7 @@ void Manager::registerInfrared(cmp::Entity entity, cmp::InfraredSensor* infrared
     InfraredInfo infraredInfo{};
     infraredInfo.entity = entity;
     infraredInfo.component = infrared;
-    _infrareds.push_back(infraredInfo);
+    _infrareds.add(infraredInfo);
 }
 
 void Manager::initializeInfrared(InfraredInfo& infraredInfo) {
@@ -83,9 +65,9 @@ void Manager::updateInfrareds(float dt) {
             // Perform ray cast
             vec3 begin = worldTrans.position;
             vec3 end = begin + rayDir * ir->upperLimit;
-            std::vector<phy::RayCastHit> hits = phy::rayCast(begin, end, true);
-            if (hits.size())
-                measurement = hits[0].distance;
+            phy::RayCastHit hit;
+            if (phy::rayCast(begin, end, Span<phy::RayCastHit>(&hit, 1), true))
+                measurement = hit.distance;
             else
                 measurement = ir->upperLimit;
 
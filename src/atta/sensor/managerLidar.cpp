@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+namespace atta::sensor {
+
+void Manager::unregisterLidars() { _lidars.clear(); }
+
+void Manager::unregisterLidar(cmp::Entity entity) {
+    if (!_lidars.remove(entity))
+        LOG_WARN("sensor::Manager", "Could not unregister lidar from entity [w]$0[], lidar was not registered before", entity);
+}
+
+void Manager::registerLidars() {
+    for (cmp::Entity entity : cmp::getEntitiesView()) {
+        cmp::LidarSensor* lidar = cmp::getComponent<cmp::LidarSensor>(entity);
+        // Register new lidar
+        if (lidar && _lidars.get(entity) == nullptr)
+            registerLidar(entity, lidar);
+    }
+}
+
+void Manager::registerLidar(cmp::Entity entity, cmp::LidarSensor* lidar) {
+    // Do not register prototype lidar sensors
+    if (cmp::Entity(entity).isPrototype())
+        return;
+
+    LidarInfo lidarInfo{};
+    lidarInfo.entity = entity;
+    lidarInfo.component = lidar;
+    _lidars.add(std::move(lidarInfo));
+}
+
+void Manager::initializeLidar(LidarInfo& lidarInfo) {
+    cmp::LidarSensor* lidar = lidarInfo.component;
+    // Start with random time (used to distribute scans across time)
+    lidar->scanTime = -(rand() / float(RAND_MAX)) / lidar->rate;
+}
+
+void Manager::computeLidarBeams(LidarInfo& lidarInfo, bool planar) {
+    cmp::LidarSensor* lidar = lidarInfo.component;
+    cmp::Transform worldTrans = cmp::Transform::getEntityWorldTransform(lidarInfo.entity);
+    const uint32_t numH = lidar->horizontalBeams;
+    const uint32_t numV = lidar->verticalBeams;
+
+    // A full turn does not repeat the first beam at the end
+    float hFov = radians(lidar->horizontalFov);
+    float hStep = numH > 1 ? hFov / (lidar->horizontalFov >= 360.0f ? numH : numH - 1) : 0.0f;
+    float hStart = numH > 1 ? -hFov / 2 : 0.0f;
+    float vFov = radians(lidar->verticalFov);
+    float vStep = numV > 1 ? vFov / (numV - 1) : 0.0f;
+    float vStart = numV > 1 ? -vFov / 2 : 0.0f;
+
+    vec3 begin = worldTrans.position;
+    lidarInfo.origin = begin;
+    lidarInfo.directions.resize(size_t(numH) * numV);
+    for (uint32_t v = 0; v < numV; v++) {
+        float pitch = vStart + v * vStep;
+        for (uint32_t h = 0; h < numH; h++) {
+            float yaw = hStart + h * hStep;
+            vec3 dir(std::cos(pitch) * std::cos(yaw), std::cos(pitch) * std::sin(yaw), std::sin(pitch));
+            worldTrans.orientation.rotateVector(dir);
+            // 2D engines only detect beams in the xy plane
+            if (planar) {
+                dir.z = 0.0f;
+                float len = dir.length();
+                dir = len > 0.0f ? dir / len : vec3(1.0f, 0.0f, 0.0f);
+            }
+            lidarInfo.directions[v * numH + h] = dir;
+            _lidarBegins.push_back(begin);
+            _lidarEnds.push_back(begin + dir * lidar->upperLimit);
+        }
+    }
+}
+
+void Manager::updateLidars(float dt) {
+    PROFILE();
+    // Collect the beams of all lidars that should scan
+    _lidarBegins.clear();
+    _lidarEnds.clear();
+    _lidarScans.clear();
+    phy::Engine::Type engine = phy::getEngineType();
+    bool planar = engine == phy::Engine::BOX2D || engine == phy::Engine::SWARM;
+    for (LidarInfo& li : _lidars) {
+        cmp::LidarSensor* lidar = li.component;
+
+        // Check if it is enabled
+        if (!lidar->enabled || lidar->horizontalBeams == 0 || lidar->verticalBeams == 0)
+            continue;
+
+        // Check if should take new scan
+        float change = Config::getTime() - lidar->scanTime;
+        float interval = 1.0f / lidar->rate;
+        if (change < interval)
+            continue;
+
+        if (li.entity.get<cmp::Transform>() == nullptr) {
+            LOG_WARN("sensor::Manager", "Could not scan lidar sensor because entity does not have a transform component");
+            continue;
+        }
+
+        computeLidarBeams(li, planar);
+        _lidarScans.push_back(&li);
+    }
+    if (_lidarScans.empty())
+        return;
+
+    // Evaluate all beams in one batched query
+    _lidarHits.resize(_lidarBegins.size());
+    phy::rayCast(Span<const vec3>(_lidarBegins), Span<const vec3>(_lidarEnds), Span<phy::RayCastHit>(_lidarHits));
+
+    //----- Post-process scans -----//
+    size_t beam = 0;
+    std::default_random_engine generator(int(Config::getTime() / Config::getDt()));
+    for (LidarInfo* li : _lidarScans) {
+        cmp::LidarSensor* lidar = li->component;
+        size_t numBeams = size_t(lidar->horizontalBeams) * lidar->verticalBeams;
+        li->ranges.resize(numBeams);
+        for (size_t i = 0; i < numBeams; i++)
+            li->ranges[i] = _lidarHits[beam + i].entity != -1 ? _lidarHits[beam + i].distance : lidar->upperLimit;
+        beam += numBeams;
+
+        // Apply gaussian noise (the distribution requires a positive standard deviation)
+        if (lidar->gaussianStd > 0.0f) {
+            std::normal_distribution<float> noise(0.0f, lidar->gaussianStd);
+            for (float& range : li->ranges)
+                range += noise(generator);
+        }
+
+        // Clip limits
+        for (float& range : li->ranges)
+            range = std::min(std::max(range, lidar->lowerLimit), lidar->upperLimit);
+        lidar->scanTime = Config::getTime();
+    }
+}
+
+} // namespace atta::sensor
@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+namespace atta::sensor {
+
+bool Manager::addStreamImpl(std::string name, StreamType type, cmp::Entity entity, cmp::ComponentId component, uint32_t numSlots) {
+    for (const StreamInfo& si : _streams)
+        if (si.name == name) {
+            LOG_WARN("sensor::Manager", "Could not add stream [w]$0[], there is already a stream with this name", name);
+            return false;
+        }
+
+    if (type == StreamType::SENSOR && component != cmp::getId<cmp::CameraSensor>() && component != cmp::getId<cmp::InfraredSensor>() &&
+        component != cmp::getId<cmp::LidarSensor>()) {
+        LOG_WARN("sensor::Manager", "Could not add stream [w]$0[], the component is not a sensor", name);
+        return false;
+    }
+    cmp::ComponentRegistry* registry = getComponentRegistry(component);
+    if (registry == nullptr) {
+        LOG_WARN("sensor::Manager", "Could not add stream [w]$0[], unknown component", name);
+        return false;
+    }
+    // Component memory is copied to/from the stream, components that own memory (e.g. vectors) can not be streamed
+    if (type != StreamType::SENSOR && !registry->isTriviallyDestructible()) {
+        LOG_WARN("sensor::Manager", "Could not add stream [w]$0[], component [w]$1[] owns memory and can not be streamed", name,
+                 registry->getDescription().name);
+        return false;
+    }
+
+    StreamInfo streamInfo{};
+    streamInfo.name = name;
+    streamInfo.type = type;
+    streamInfo.entity = entity;
+    streamInfo.component = component;
+    streamInfo.numSlots = numSlots;
+    streamInfo.lastTime = -1.0f;
+    streamInfo.lastSequence = 0;
+    // Component streams have the attributes (runtime data after them is not streamed), sensor buffers are created with the first output
+    if (type != StreamType::SENSOR) {
+        streamInfo.buffer = std::make_shared<StreamBuffer>();
+        if (!streamInfo.buffer->create(name, registry->getAttributesEnd(), numSlots))
+            return false;
+    }
+    _streams.push_back(std::move(streamInfo));
+    return true;
+}
+
+void Manager::removeStreamImpl(std::string name) {
+    for (size_t i = 0; i < _streams.size(); i++)
+        if (_streams[i].name == name) {
+            _streams.erase(_streams.begin() + i);
+            return;
+        }
+    LOG_WARN("sensor::Manager", "Could not remove stream [w]$0[], stream was not added before", name);
+}
+
+void Manager::removeStreams(cmp::Entity entity, cmp::ComponentId component) {
+    for (int i = _streams.size() - 1; i >= 0; i--)
+        if (_streams[i].entity == entity && _streams[i].component == component)
+            _streams.erase(_streams.begin() + i);
+}
+
+cmp::ComponentRegistry* Manager::getComponentRegistry(cmp::ComponentId component) {
+    for (cmp::ComponentRegistry* registry : cmp::getComponentRegistries())
+        if (registry->getId() == component)
+            return registry;
+    return nullptr;
+}
+
+void Manager::writeSensorStream(StreamInfo& si) {
+    const void* data = nullptr;
+    size_t size = 0;
+    float time = -1.0f;
+    if (si.component == cmp::getId<cmp::CameraSensor>()) {
+        if (CameraInfo* ci = _cameras.get(si.entity)) {
+            data = ci->data.data();
+            size = ci->data.size();
+            time = ci->component->captureTime;
+        }
+    } else if (si.component == cmp::getId<cmp::InfraredSensor>()) {
+        if (InfraredInfo* iri = _infrareds.get(si.entity)) {
+            data = &iri->component->measurement;
+            size = sizeof(float);
+            time = iri->component->measurementTime;
+        }
+    } else {
+        if (LidarInfo* li = _lidars.get(si.entity)) {
+            data = li->ranges.data();
+            size = li->ranges.size() * sizeof(float);
+            time = li->component->scanTime;
+        }
+    }
+
+    // Only write new outputs
+    if (data == nullptr || size == 0 || time < 0.0f || time == si.lastTime)
+        return;
+
+    if (!si.buffer || si.buffer->getSlotSize() != size) {
+        si.buffer = std::make_shared<StreamBuffer>();
+        if (!si.buffer->create(si.name, size, si.numSlots)) {
+            si.buffer.reset();
+            return;
+        }
+    }
+    si.buffer->write(data, size, time);
+    si.lastTime = time;
+}
+
+void Manager::updateStreams() {
+    PROFILE();
+    for (StreamInfo& si : _streams) {
+        switch (si.type) {
+            case StreamType::SENSOR:
+                writeSensorStream(si);
+                break;
+            case StreamType::COMPONENT: {
+                if (cmp::Component* component = cmp::getComponentById(si.component, si.entity))
+                    si.buffer->write(component, si.buffer->getSlotSize(), Config::getTime());
+                break;
+            }
+            case StreamType::ACTION: {
+                cmp::Component* component = cmp::getComponentById(si.component, si.entity);
+                cmp::ComponentRegistry* registry = getComponentRegistry(si.component);
+                if (component == nullptr || registry == nullptr)
+                    break;
+                _streamData.resize(si.buffer->getSlotSize());
+                StreamBuffer::Sample sample = si.buffer->read(_streamData.data(), si.lastSequence);
+                if (sample.sequence == 0)
+                    break;
+                // Only the described attributes are written, the bytes between them and the runtime data are kept
+                const std::vector<cmp::AttributeDescription>& aDescs = registry->getDescription().attributeDescriptions;
+                unsigned end = std::min<unsigned>({registry->getAttributesEnd(), sample.size, si.buffer->getSlotSize()});
+                uint8_t* dst = reinterpret_cast<uint8_t*>(component);
+                for (size_t i = 0; i < aDescs.size(); i++) {
+                    unsigned offset = aDescs[i].offset;
+                    unsigned size = cmp::getAttributeSize(aDescs, registry->getAttributesEnd(), i);
+                    if (offset < end)
+                        std::memcpy(dst + offset, _streamData.data() + offset, std::min(size, end - offset));
+                }
+                si.lastSequence = sample.sequence;
+                break;
+            }
+        }
+    }
+}
+
+} // namespace atta::sensor
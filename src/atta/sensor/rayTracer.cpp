@@ -0,0 +1,208 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/sensor/rayTracer.h>
+
+#include <atta/component/components/mesh.h>
+#include <atta/component/components/transform.h>
+#include <atta/component/interface.h>
+#include <atta/event/events/meshDestroy.h>
+#include <atta/event/events/meshUpdate.h>
+#include <atta/event/interface.h>
+#include <atta/physics/interface.h>
+#include <atta/resource/interface.h>
+#include <atta/resource/meshOptimizer.h>
+
+namespace atta::sensor {
+
+RayTracer::RayTracer() : _pool(physics::getWorkerPool()), _numRays(0) {
+    event::subscribe<event::MeshUpdate>(BIND_EVENT_FUNC(RayTracer::onMeshChange));
+    event::subscribe<event::MeshDestroy>(BIND_EVENT_FUNC(RayTracer::onMeshChange));
+}
+
+RayTracer::~RayTracer() {
+    event::unsubscribe<event::MeshUpdate>(BIND_EVENT_FUNC(RayTracer::onMeshChange));
+    event::unsubscribe<event::MeshDestroy>(BIND_EVENT_FUNC(RayTracer::onMeshChange));
+}
+
+void RayTracer::update() {
+    PROFILE();
+    std::vector<Instance> instances;
+    std::vector<bnd3> bounds;
+
+    memory::Scratch scratch;
+    for (component::EntityId entity : component::getNoPrototypeView(scratch)) {
+        component::Mesh* mesh = component::getComponent<component::Mesh>(entity);
+        component::Transform* transform = component::getComponent<component::Transform>(entity);
+        if (!mesh || !transform)
+            continue;
+        const MeshBvh* meshBvh = getMesh(mesh->sid);
+        if (!meshBvh || meshBvh->triangles.empty())
+            continue;
+
+        component::Transform world = transform->getWorldTransform(entity);
+        Instance instance;
+        instance.entity = entity;
+        instance.mesh = meshBvh;
+        instance.position = world.position;
+        instance.invOrientation = inverse(world.orientation);
+        instance.invScale = vec3(1.0f) / world.scale;
+        instances.push_back(instance);
+
+        // World bounds from the corners of the mesh bounds
+        bnd3 local = meshBvh->bvh.getBounds();
+        bnd3 box(world.position);
+        for (unsigned c = 0; c < 8; c++) {
+            vec3 corner((c & 1) ? local.pMax.x : local.pMin.x, (c & 2) ? local.pMax.y : local.pMin.y, (c & 4) ? local.pMax.z : local.pMin.z);
+            vec3 p = world.orientation * (corner * world.scale) + world.position;
+            box = c == 0 ? bnd3(p) : unionb(box, p);
+        }
+        bounds.push_back(box);
+    }
+
+    _scene.build(bounds);
+    _instances.resize(instances.size());
+    for (size_t i = 0; i < instances.size(); i++)
+        _instances[i] = instances[_scene.getOrder()[i]];
+}
+
+component::EntityId RayTracer::trace(const vec3& origin, const vec3& direction, float& t) const {
+    component::EntityId hit = -1;
+    vec3 invDirection = vec3(1.0f) / direction;
+    _scene.traverse(origin, invDirection, t, [&](uint32_t first, uint32_t count, float& tScene) {
+        for (uint32_t i = first; i < first + count; i++) {
+            // Ray in mesh space, the distance along the ray is the same
+            const Instance& instance = _instances[i];
+            vec3 o = (instance.invOrientation * (origin - instance.position)) * instance.invScale;
+            vec3 d = (instance.invOrientation * direction) * instance.invScale;
+            vec3 invD = vec3(1.0f) / d;
+
+            const std::vector<Triangle>& triangles = instance.mesh->triangles;
+            instance.mesh->bvh.traverse(o, invD, tScene, [&](uint32_t tFirst, uint32_t tCount, float& tMesh) {
+                // Möller–Trumbore with back face culling, the mesh space ray already undoes a mirroring scale
+                for (uint32_t j = tFirst; j < tFirst + tCount; j++) {
+                    const Triangle& tri = triangles[j];
+                    vec3 p = cross(d, tri.e2);
+                    float det = dot(tri.e1, p);
+                    if (det <= 1e-12f)
+                        continue;
+                    float invDet = 1.0f / det;
+                    vec3 s = o - tri.v0;
+                    float u = dot(s, p) * invDet;
+                    if (u < 0.0f || u > 1.0f)
+                        continue;
+                    vec3 q = cross(s, tri.e1);
+                    float v = dot(d, q) * invDet;
+                    if (v < 0.0f || u + v > 1.0f)
+                        continue;
+                    float tHit = dot(tri.e2, q) * invDet;
+                    if (tHit > 0.0f && tHit < tMesh) {
+                        tMesh = tHit;
+                        hit = instance.entity;
+                    }
+                }
+            });
+        }
+    });
+    return hit;
+}
+
+void RayTracer::render(Span<View> views) {
+    PROFILE();
+    _rowOffsets.resize(views.size() + 1);
+    _rowOffsets[0] = 0;
+    for (size_t v = 0; v < views.size(); v++) {
+        _rowOffsets[v + 1] = _rowOffsets[v] + views[v].height;
+        _numRays += uint64_t(views[v].width) * views[v].height;
+    }
+
+    _pool->parallelFor(0, _rowOffsets.back(), 4, [&](int begin, int end) {
+        size_t v = std::upper_bound(_rowOffsets.begin(), _rowOffsets.end(), uint32_t(begin)) - _rowOffsets.begin() - 1;
+        for (uint32_t row = begin; row < uint32_t(end); row++) {
+            while (row >= _rowOffsets[v + 1])
+                v++;
+            renderRow(views[v], row - _rowOffsets[v]);
+        }
+    });
+}
+
+void RayTracer::renderRow(const View& view, uint32_t row) const {
+    vec3 right = cross(view.front, view.up);
+    float ratio = view.width / float(view.height);
+    float halfHeight = view.perspective ? std::tan(0.5f * view.fov) : 0.5f * view.fov;
+    float halfWidth = halfHeight * ratio;
+
+    // Row 0 is the top of the image
+    float y = 1.0f - 2.0f * (row + 0.5f) / view.height;
+    for (uint32_t col = 0; col < view.width; col++) {
+        float x = 2.0f * (col + 0.5f) / view.width - 1.0f;
+        vec3 origin = view.position;
+        vec3 direction = view.front;
+        if (view.perspective)
+            direction = view.front + right * (x * halfWidth) + view.up * (y * halfHeight);
+        else
+            origin = view.position + right * (x * halfWidth) + view.up * (y * halfHeight);
+
+        // With the unnormalized perspective direction, the ray parameter is already the depth along the front axis
+        float t = view.far;
+        component::EntityId entity = trace(origin, direction, t);
+        size_t pixel = size_t(row) * view.width + col;
+        view.depth[pixel] = t;
+        view.entities[pixel] = entity;
+    }
+}
+
+const RayTracer::MeshBvh* RayTracer::getMesh(StringId sid) {
+    auto it = _meshes.find(sid.getId());
+    if (it != _meshes.end())
+        return &it->second;
+
+    resource::Mesh* m = resource::get<resource::Mesh>(sid.getString());
+    if (!m)
+        return nullptr;
+    int positionOffset = resource::MeshOptimizer::getPositionOffset(m->getVertexLayout());
+    MeshBvh& mesh = _meshes[sid.getId()];
+    if (positionOffset == -1 || m->getIndices().size() < 3) {
+        LOG_WARN("sensor::RayTracer", "Could not trace mesh [w]$0[], it has no vertex positions or triangles", sid);
+        return &mesh;
+    }
+
+    const std::vector<uint8_t>& vertices = m->getVertices();
+    const std::vector<resource::Mesh::Index>& indices = m->getIndices();
+    size_t vertexSize = resource::MeshOptimizer::getVertexSize(m->getVertexLayout());
+    auto getPosition = [&](size_t i) {
+        vec3 p;
+        std::memcpy(&p, vertices.data() + i * vertexSize + positionOffset, sizeof(vec3));
+        return p;
+    };
+
+    size_t numTriangles = indices.size() / 3;
+    std::vector<Triangle> triangles(numTriangles);
+    std::vector<bnd3> bounds(numTriangles);
+    for (size_t i = 0; i < numTriangles; i++) {
+        vec3 v0 = getPosition(indices[i * 3 + 0]);
+        vec3 v1 = getPosition(indices[i * 3 + 1]);
+        vec3 v2 = getPosition(indices[i * 3 + 2]);
+        triangles[i] = {v0, v1 - v0, v2 - v0};
+        bounds[i] = unionb(bnd3(v0, v1), v2);
+    }
+
+    mesh.bvh.build(bounds);
+    mesh.triangles.resize(numTriangles);
+    for (size_t i = 0; i < numTriangles; i++)
+        mesh.triangles[i] = triangles[mesh.bvh.getOrder()[i]];
+    return &mesh;
+}
+
+void RayTracer::onMeshChange(event::Event& event) {
+    // Meshes are rebuilt the next time they are traced, instances are updated before each render
+    StringId sid = event.getType() == event::MeshUpdate::type ? reinterpret_cast<event::MeshUpdate&>(event).sid
+                                                               : reinterpret_cast<event::MeshDestroy&>(event).sid;
+    auto it = _meshes.find(sid.getId());
+    if (it == _meshes.end())
+        return;
+    _meshes.erase(it);
+    _instances.clear();
+    _scene.build({});
+}
+
+} // namespace atta::sensor
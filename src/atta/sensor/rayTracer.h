@@ -0,0 +1,79 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/base.h>
+#include <atta/event/event.h>
+#include <atta/physics/workerPool.h>
+#include <atta/sensor/bvh.h>
+#include <atta/utils/math/quaternion.h>
+#include <atta/utils/span.h>
+
+namespace atta::sensor {
+
+/** CPU ray tracer used by the RAY_TRACED camera sensors
+ *
+ * Renders depth and entity id images without a graphics API. Each mesh resource has a BVH over its triangles that is
+ * built the first time the mesh is traced, and the scene has a BVH over the world bounds of the entities with Mesh and
+ * Transform components, rebuilt by update. Rays are transformed to the mesh space to traverse the mesh BVH. Back faces
+ * are culled in the mesh space, so meshes mirrored by a negative scale still show their outward faces
+ **/
+class RayTracer final {
+  public:
+    /// Camera image to render
+    struct View {
+        vec3 position;
+        vec3 front;
+        vec3 up;
+        bool perspective;
+        float fov; ///< Vertical field of view in radians (perspective) or view height in meters (orthographic)
+        float far;
+        uint32_t width;
+        uint32_t height;
+        float* depth;                  ///< Distance along the front axis, far if nothing was hit
+        component::EntityId* entities; ///< Entity of each pixel, -1 if nothing was hit
+    };
+
+    RayTracer();
+    ~RayTracer();
+
+    /// Update the scene from the entities with Mesh and Transform components
+    void update();
+    /// Render all views, rows of all views are traced in parallel on the physics worker pool
+    void render(Span<View> views);
+    /// Closest hit along the ray (direction does not need to be normalized), t is the maximum distance and is updated
+    component::EntityId trace(const vec3& origin, const vec3& direction, float& t) const;
+
+    uint64_t getNumRays() const { return _numRays; } ///< Rays traced since the ray tracer was created
+
+  private:
+    struct Triangle {
+        vec3 v0;
+        vec3 e1; ///< v1 - v0
+        vec3 e2; ///< v2 - v0
+    };
+    struct MeshBvh {
+        Bvh bvh;
+        std::vector<Triangle> triangles; ///< In the BVH order
+    };
+    struct Instance {
+        component::EntityId entity;
+        const MeshBvh* mesh;
+        vec3 position;
+        quat invOrientation;
+        vec3 invScale;
+    };
+
+    const MeshBvh* getMesh(StringId sid);
+    void renderRow(const View& view, uint32_t row) const;
+    void onMeshChange(event::Event& event);
+
+    std::unordered_map<StringHash, MeshBvh> _meshes;
+    std::vector<Instance> _instances; ///< In the scene BVH order
+    Bvh _scene;
+    std::vector<uint32_t> _rowOffsets; ///< First row of each view in the parallel range
+    std::shared_ptr<physics::WorkerPool> _pool; ///< Shared with the physics queries
+    uint64_t _numRays;
+};
+
+} // namespace atta::sensor
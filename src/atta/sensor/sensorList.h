@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/component/base.h>
+
+namespace atta::sensor {
+
+/// Dense list of sensor infos with constant time lookup, registration, and removal
+/** The infos are kept contiguous for iteration and an index table indexed by entity id points to them. The position
+ * of each info is also stored in its component (sensorHandle), so the component can find its data without searching.
+ * Removal moves the last info to the removed position and updates the handle of its component
+ **/
+template <typename Info>
+class SensorList final {
+  public:
+    static constexpr uint32_t INVALID = UINT32_MAX;
+
+    Info* get(cmp::EntityId entity) {
+        uint32_t index = getIndex(entity);
+        return index == INVALID ? nullptr : &_infos[index];
+    }
+
+    /// Info of a component, nullptr if the component is not registered
+    template <typename T>
+    Info* get(const T* component) {
+        uint32_t handle = component->sensorHandle;
+        if (handle < _infos.size() && _infos[handle].component == component)
+            return &_infos[handle];
+        // The handle may be stale if the component memory was copied (clones, checkpoints)
+        for (uint32_t i = 0; i < _infos.size(); i++)
+            if (_infos[i].component == component) {
+                _infos[i].component->sensorHandle = i;
+                return &_infos[i];
+            }
+        return nullptr;
+    }
+
+    /// Add info, return false if its entity was already registered
+    bool add(Info info) {
+        cmp::EntityId entity = info.entity;
+        if (getIndex(entity) != INVALID)
+            return false;
+        if (size_t(entity) >= _indices.size())
+            _indices.resize(entity + 1, INVALID);
+        _indices[entity] = _infos.size();
+        info.component->sensorHandle = _infos.size();
+        _infos.push_back(std::move(info));
+        return true;
+    }
+
+    /// Remove info of the entity, return false if it was not registered
+    bool remove(cmp::EntityId entity) {
+        uint32_t index = getIndex(entity);
+        if (index == INVALID)
+            return false;
+        if (index != _infos.size() - 1) {
+            _infos[index] = std::move(_infos.back());
+            _indices[cmp::EntityId(_infos[index].entity)] = index;
+            _infos[index].component->sensorHandle = index;
+        }
+        _infos.pop_back();
+        _indices[entity] = INVALID;
+        return true;
+    }
+
+    void clear() {
+        _infos.clear();
+        _indices.clear();
+    }
+
+    std::vector<Info>& getInfos() { return _infos; }
+    size_t size() const { return _infos.size(); }
+    Info& operator[](size_t i) { return _infos[i]; }
+    typename std::vector<Info>::iterator begin() { return _infos.begin(); }
+    typename std::vector<Info>::iterator end() { return _infos.end(); }
+
+  private:
+    uint32_t getIndex(cmp::EntityId entity) const {
+        return entity >= 0 && size_t(entity) < _indices.size() ? _indices[entity] : INVALID;
+    }
+
+    std::vector<Info> _infos;
+    std::vector<uint32_t> _indices; ///< Index in _infos of each entity id
+};
+
+} // namespace atta::sensor
@@ -0,0 +1,190 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/sensor/streamBuffer.h>
+#include <atomic>
+
+#ifdef ATTA_OS_LINUX
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace atta::sensor {
+
+struct alignas(64) StreamBuffer::Header {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slotSize;
+    uint32_t numSlots;
+    std::atomic<uint64_t> sequence;
+};
+
+struct alignas(64) StreamBuffer::SlotHeader {
+    std::atomic<uint64_t> sequence;
+    float time;
+    uint32_t size;
+};
+
+static_assert(std::atomic<uint64_t>::is_always_lock_free, "Stream buffer sequences must be lock free to be shared between processes");
+
+StreamBuffer::~StreamBuffer() { close(); }
+
+#ifdef ATTA_OS_LINUX
+static std::string getShmName(const std::string& name) { return name.empty() || name[0] != '/' ? "/" + name : name; }
+
+bool StreamBuffer::create(const std::string& name, uint32_t slotSize, uint32_t numSlots) {
+    close();
+    if (numSlots == 0) {
+        LOG_WARN("sensor::StreamBuffer", "Could not create [w]$0[], the number of slots must be greater than zero", name);
+        return false;
+    }
+
+    size_t slotStride = (sizeof(SlotHeader) + slotSize + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    size_t size = sizeof(Header) + slotStride * numSlots;
+    std::string shmName = getShmName(name);
+    shm_unlink(shmName.c_str());
+    int fd = shm_open(shmName.c_str(), O_CREAT | O_RDWR | O_EXCL, 0600);
+    if (fd == -1) {
+        LOG_WARN("sensor::StreamBuffer", "Could not create shared memory [w]$0[]: $1", name, strerror(errno));
+        return false;
+    }
+    if (ftruncate(fd, size) == -1) {
+        LOG_WARN("sensor::StreamBuffer", "Could not allocate [w]$0[] bytes of shared memory for [w]$1[]: $2", size, name, strerror(errno));
+        ::close(fd);
+        shm_unlink(shmName.c_str());
+        return false;
+    }
+    void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED) {
+        LOG_WARN("sensor::StreamBuffer", "Could not map shared memory [w]$0[]: $1", name, strerror(errno));
+        shm_unlink(shmName.c_str());
+        return false;
+    }
+
+    // Memory from ftruncate is zeroed, so all sequences start at zero
+    _header = new (memory) Header();
+    _header->slotSize = slotSize;
+    _header->numSlots = numSlots;
+    _header->version = VERSION;
+    _header->sequence.store(0, std::memory_order_relaxed);
+    for (uint32_t i = 0; i < numSlots; i++)
+        new (static_cast<uint8_t*>(memory) + sizeof(Header) + i * slotStride) SlotHeader();
+    // Readers only accept the buffer after the magic is written
+    std::atomic_thread_fence(std::memory_order_release);
+    _header->magic = MAGIC;
+
+    _name = name;
+    _mappedSize = size;
+    _slotStride = slotStride;
+    _owner = true;
+    return true;
+}
+
+bool StreamBuffer::open(const std::string& name) {
+    close();
+    std::string shmName = getShmName(name);
+    int fd = shm_open(shmName.c_str(), O_RDWR, 0);
+    if (fd == -1)
+        return false;
+    struct stat st;
+    if (fstat(fd, &st) == -1 || size_t(st.st_size) < sizeof(Header)) {
+        ::close(fd);
+        return false;
+    }
+    void* memory = mmap(nullptr, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (memory == MAP_FAILED)
+        return false;
+
+    Header* header = static_cast<Header*>(memory);
+    size_t slotStride = (sizeof(SlotHeader) + header->slotSize + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    if (header->magic != MAGIC || header->version != VERSION || sizeof(Header) + slotStride * header->numSlots > size_t(st.st_size)) {
+        LOG_WARN("sensor::StreamBuffer", "Shared memory [w]$0[] is not a stream buffer", name);
+        munmap(memory, st.st_size);
+        return false;
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    _name = name;
+    _header = header;
+    _mappedSize = st.st_size;
+    _slotStride = slotStride;
+    _owner = false;
+    return true;
+}
+
+void StreamBuffer::close() {
+    if (_header == nullptr)
+        return;
+    munmap(_header, _mappedSize);
+    if (_owner)
+        shm_unlink(getShmName(_name).c_str());
+    _header = nullptr;
+    _mappedSize = 0;
+    _slotStride = 0;
+    _owner = false;
+    _name.clear();
+}
+#else
+bool StreamBuffer::create(const std::string& name, uint32_t slotSize, uint32_t numSlots) {
+    LOG_WARN("sensor::StreamBuffer", "Shared memory streams are only supported on Linux, could not create [w]$0[]", name);
+    return false;
+}
+
+bool StreamBuffer::open(const std::string& name) { return false; }
+
+void StreamBuffer::close() {}
+#endif // ATTA_OS_LINUX
+
+uint32_t StreamBuffer::getSlotSize() const { return _header ? _header->slotSize : 0; }
+
+uint32_t StreamBuffer::getNumSlots() const { return _header ? _header->numSlots : 0; }
+
+uint64_t StreamBuffer::getSequence() const { return _header ? _header->sequence.load(std::memory_order_acquire) : 0; }
+
+StreamBuffer::SlotHeader* StreamBuffer::getSlot(uint64_t sequence) const {
+    static_assert(sizeof(Header) == ALIGNMENT && sizeof(SlotHeader) == ALIGNMENT, "Stream buffer layout changed");
+    uint8_t* slots = reinterpret_cast<uint8_t*>(_header) + sizeof(Header);
+    return reinterpret_cast<SlotHeader*>(slots + ((sequence - 1) % _header->numSlots) * _slotStride);
+}
+
+void StreamBuffer::write(const void* data, uint32_t size, float time) {
+    DASSERT(_header != nullptr, "Stream buffer must be open before writing");
+    DASSERT(size <= _header->slotSize, "Stream buffer write is larger than the slot size");
+    uint64_t sequence = _header->sequence.load(std::memory_order_relaxed) + 1;
+    SlotHeader* slot = getSlot(sequence);
+
+    // Invalidate the slot before changing the payload
+    slot->sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot->time = time;
+    slot->size = size;
+    std::memcpy(reinterpret_cast<uint8_t*>(slot) + sizeof(SlotHeader), data, size);
+    slot->sequence.store(sequence, std::memory_order_release);
+    _header->sequence.store(sequence, std::memory_order_release);
+}
+
+StreamBuffer::Sample StreamBuffer::read(void* data, uint64_t lastSequence) const {
+    if (_header == nullptr)
+        return {};
+    // Retry if the writer reused the slot during the copy
+    for (int attempt = 0; attempt < 4; attempt++) {
+        uint64_t sequence = _header->sequence.load(std::memory_order_acquire);
+        if (sequence == 0 || sequence <= lastSequence)
+            return {};
+
+        SlotHeader* slot = getSlot(sequence);
+        if (slot->sequence.load(std::memory_order_acquire) != sequence)
+            continue;
+        Sample sample{sequence, slot->time, std::min(slot->size, _header->slotSize)};
+        std::memcpy(data, reinterpret_cast<const uint8_t*>(slot) + sizeof(SlotHeader), sample.size);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (slot->sequence.load(std::memory_order_relaxed) == sequence)
+            return sample;
+    }
+    return {};
+}
+
+} // namespace atta::sensor
@@ -0,0 +1,69 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+namespace atta::sensor {
+
+/// Ring buffer in named shared memory used to exchange data with external processes
+/** The buffer is created by the writer with shm_open (/dev/shm/<name>) and can be mapped by any process. All fields
+ * are little endian and the layout is:
+ *
+ * Header (64 bytes): uint32 magic ("ATTA"), uint32 version, uint32 slotSize, uint32 numSlots, uint64 sequence
+ * Slot i (at 64 + i * slotStride, slotStride = 64 + slotSize rounded up to 64 bytes):
+ *     uint64 sequence, float time, uint32 size, padding up to 64 bytes, then slotSize bytes of payload
+ *
+ * The header sequence is the last complete write (0 when nothing was written) and the write n (starting at 1) is
+ * stored in the slot (n - 1) % numSlots. While a slot is being written its sequence is 0. A reader loads the header
+ * sequence n, checks that the slot sequence is n, copies the payload, and checks the slot sequence again to detect
+ * writes that happened during the copy. Readers never block the writer, a slow reader skips to the newest write
+ **/
+class StreamBuffer final {
+  public:
+    static constexpr uint32_t MAGIC = 0x41545441; ///< "ATTA"
+    static constexpr uint32_t VERSION = 1;
+
+    struct Sample {
+        uint64_t sequence = 0; ///< Write number, 0 if there is no sample
+        float time = 0.0f;     ///< Simulation time of the write
+        uint32_t size = 0;     ///< Payload size in bytes
+    };
+
+    StreamBuffer() = default;
+    ~StreamBuffer();
+    StreamBuffer(const StreamBuffer&) = delete;
+    StreamBuffer& operator=(const StreamBuffer&) = delete;
+
+    /// Create (or replace) the shared memory as writer, return false if it could not be created
+    bool create(const std::string& name, uint32_t slotSize, uint32_t numSlots);
+    /// Map shared memory created by another StreamBuffer, return false if it does not exist or is not a stream buffer
+    bool open(const std::string& name);
+    /// Unmap the memory, the shared memory is removed if this buffer created it
+    void close();
+
+    bool isOpen() const { return _header != nullptr; }
+    const std::string& getName() const { return _name; }
+    uint32_t getSlotSize() const;
+    uint32_t getNumSlots() const;
+    uint64_t getSequence() const; ///< Sequence of the last complete write
+
+    /// Copy size bytes to the next slot, size must not be greater than the slot size
+    void write(const void* data, uint32_t size, float time);
+    /// Copy newest sample if it is newer than lastSequence
+    /** Return the sample sequence or 0 if there is no newer sample. The data buffer must have slot size bytes **/
+    Sample read(void* data, uint64_t lastSequence = 0) const;
+
+  private:
+    struct Header;
+    struct SlotHeader;
+    static constexpr size_t ALIGNMENT = 64;
+
+    SlotHeader* getSlot(uint64_t sequence) const;
+
+    std::string _name;
+    Header* _header = nullptr;
+    size_t _mappedSize = 0;
+    size_t _slotStride = 0;
+    bool _owner = false; ///< Created by this buffer (unlinked on close)
+};
+
+} // namespace atta::sensor
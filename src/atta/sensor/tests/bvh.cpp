@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/sensor/bvh.h>
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace atta;
+using namespace atta::sensor;
+
+namespace {
+
+struct Triangle {
+    vec3 v0, v1, v2;
+};
+
+// Two-sided Möller–Trumbore, returns the hit distance or t if there is no closer hit
+float intersect(const Triangle& tri, vec3 o, vec3 d, float t) {
+    vec3 e1 = tri.v1 - tri.v0;
+    vec3 e2 = tri.v2 - tri.v0;
+    vec3 p = cross(d, e2);
+    float det = dot(e1, p);
+    if (std::abs(det) < 1e-12f)
+        return t;
+    vec3 s = o - tri.v0;
+    float u = dot(s, p) / det;
+    vec3 q = cross(s, e1);
+    float v = dot(d, q) / det;
+    float tHit = dot(e2, q) / det;
+    return (u >= 0.0f && v >= 0.0f && u + v <= 1.0f && tHit > 0.0f && tHit < t) ? tHit : t;
+}
+
+class Sensor_Bvh : public ::testing::Test {
+  public:
+    static constexpr int NUM_TRIANGLES = 20000;
+    static constexpr int NUM_RAYS = 2000;
+
+    void SetUp() override {
+        std::mt19937 gen(11);
+        std::uniform_real_distribution<float> pos(-10.0f, 10.0f);
+        std::uniform_real_distribution<float> offset(-0.2f, 0.2f);
+        std::vector<Triangle> triangles;
+        std::vector<bnd3> bounds;
+        for (int i = 0; i < NUM_TRIANGLES; i++) {
+            vec3 c(pos(gen), pos(gen), pos(gen));
+            Triangle tri{c + vec3(offset(gen), offset(gen), offset(gen)), c + vec3(offset(gen), offset(gen), offset(gen)),
+                         c + vec3(offset(gen), offset(gen), offset(gen))};
+            triangles.push_back(tri);
+            bounds.push_back(unionb(bnd3(tri.v0, tri.v1), tri.v2));
+        }
+        _bvh.build(bounds);
+        for (uint32_t i : _bvh.getOrder())
+            _triangles.push_back(triangles[i]);
+
+        // Rays from outside the triangles towards random points
+        for (int i = 0; i < NUM_RAYS; i++) {
+            vec3 o(pos(gen), pos(gen), -15.0f);
+            vec3 target(pos(gen) * 0.5f, pos(gen) * 0.5f, pos(gen) * 0.5f);
+            _origins.push_back(o);
+            _directions.push_back(normalize(target - o));
+        }
+    }
+
+    float trace(vec3 o, vec3 d) const {
+        float t = 100.0f;
+        _bvh.traverse(o, vec3(1.0f) / d, t, [&](uint32_t first, uint32_t count, float& tLeaf) {
+            for (uint32_t i = first; i < first + count; i++)
+                tLeaf = intersect(_triangles[i], o, d, tLeaf);
+        });
+        return t;
+    }
+
+    float bruteForce(vec3 o, vec3 d) const {
+        float t = 100.0f;
+        for (const Triangle& tri : _triangles)
+            t = intersect(tri, o, d, t);
+        return t;
+    }
+
+  protected:
+    Bvh _bvh;
+    std::vector<Triangle> _triangles;
+    std::vector<vec3> _origins;
+    std::vector<vec3> _directions;
+};
+
+TEST_F(Sensor_Bvh, Build) {
+    EXPECT_EQ(_bvh.getOrder().size(), NUM_TRIANGLES);
+    std::vector<uint32_t> order = _bvh.getOrder();
+    std::sort(order.begin(), order.end());
+    for (uint32_t i = 0; i < order.size(); i++)
+        ASSERT_EQ(order[i], i);
+
+    Bvh empty;
+    empty.build({});
+    float t = 1.0f;
+    empty.traverse(vec3(0.0f), vec3(1.0f), t, [&](uint32_t, uint32_t, float&) { t = 0.0f; });
+    EXPECT_EQ(t, 1.0f);
+}
+
+TEST_F(Sensor_Bvh, ClosestHit) {
+    int numHits = 0;
+    for (int i = 0; i < NUM_RAYS; i++) {
+        float expected = bruteForce(_origins[i], _directions[i]);
+        ASSERT_FLOAT_EQ(trace(_origins[i], _directions[i]), expected);
+        numHits += expected < 100.0f;
+    }
+    EXPECT_GT(numHits, NUM_RAYS / 2);
+}
+
+TEST_F(Sensor_Bvh, RaysPerSecond) {
+    auto begin = std::chrono::steady_clock::now();
+    float sum = 0.0f;
+    for (int r = 0; r < 50; r++)
+        for (int i = 0; i < NUM_RAYS; i++)
+            sum += trace(_origins[i], _directions[i]);
+    std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - begin;
+    RecordProperty("raysPerSecond", int(50 * NUM_RAYS / seconds.count()));
+    EXPECT_GT(sum, 0.0f);
+}
+
+} // namespace
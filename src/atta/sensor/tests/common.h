@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/resource/resources/mesh.h>
+
+namespace atta::sensor::test {
+
+// Unit cube centered at the origin, front faces are counter-clockwise when seen from outside
+inline resource::Mesh::CreateInfo createCubeMesh() {
+    resource::Mesh::CreateInfo info;
+    info.vertexLayout = {{resource::Mesh::VertexElement::VEC3, "iPosition"}};
+    std::vector<vec3> vertices;
+    for (int axis = 0; axis < 3; axis++)
+        for (float s : {-1.0f, 1.0f}) {
+            vec3 n(0.0f), u(0.0f), v(0.0f);
+            n[axis] = s;
+            u[(axis + 1) % 3] = 1.0f;
+            v[(axis + 2) % 3] = 1.0f;
+            if (s < 0.0f)
+                std::swap(u, v); // Keep cross(u, v) = n
+            auto corner = [&](float i, float j) { return n * 0.5f + u * (i - 0.5f) + v * (j - 0.5f); };
+            uint32_t first = vertices.size();
+            vertices.insert(vertices.end(), {corner(0, 0), corner(1, 0), corner(1, 1), corner(0, 1)});
+            info.indices.insert(info.indices.end(), {first, first + 1, first + 2, first, first + 2, first + 3});
+        }
+    info.vertices.resize(vertices.size() * sizeof(vec3));
+    std::memcpy(info.vertices.data(), vertices.data(), info.vertices.size());
+    return info;
+}
+
+} // namespace atta::sensor::test
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/circleCollider2D.h>
+#include <atta/component/components/lidarSensor.h>
+#include <atta/component/components/rigidBody2D.h>
+#include <atta/component/components/transform.h>
+#include <atta/component/tests/common.h>
+#include <atta/event/events/simulationStart.h>
+#include <atta/event/events/simulationStop.h>
+#include <atta/physics/interface.h>
+#include <atta/sensor/interface.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::sensor;
+
+namespace {
+
+class Sensor_Lidar : public ::testing::Test {
+  public:
+    void SetUp() override {
+        component::test::startUp();
+        static bool started = [] {
+            physics::startUp();
+            sensor::startUp();
+            return true;
+        }();
+        (void)started;
+        physics::setEngineType(physics::Engine::SWARM);
+    }
+    void TearDown() override {
+        event::SimulationStop stop;
+        event::publish(stop);
+        // Deleted one by one so the sensor module unregisters the lidars
+        for (component::EntityId e : component::getEntitiesView())
+            component::deleteEntity(e);
+        component::clear();
+    }
+
+  protected:
+    // Static circle with radius 0.5 in the xy plane
+    component::Entity createCircle(vec2 position) {
+        component::Entity e = component::createEntity();
+        e.add<component::Transform>()->position = vec3(position, 0.0f);
+        e.add<component::RigidBody2D>()->type = component::RigidBody2D::STATIC;
+        e.add<component::CircleCollider2D>();
+        return e;
+    }
+    // Four beams along -x, -y, +x and +y
+    component::LidarSensor* createLidar(vec3 position) {
+        component::Entity e = component::createEntity();
+        e.add<component::Transform>()->position = position;
+        component::LidarSensor* lidar = e.add<component::LidarSensor>();
+        lidar->horizontalBeams = 4;
+        lidar->horizontalFov = 360.0f;
+        lidar->lowerLimit = 0.1f;
+        lidar->upperLimit = 10.0f;
+        return lidar;
+    }
+    // Start the simulation and take one scan
+    void scan(component::LidarSensor* lidar) {
+        event::SimulationStart start;
+        event::publish(start);
+        lidar->scanTime = -1.0f; // The start distributes the first scan across time
+        sensor::update(0.0f);
+    }
+};
+
+TEST_F(Sensor_Lidar, BeamCount) {
+    component::LidarSensor* lidar = createLidar(vec3(0.0f));
+    lidar->verticalBeams = 3;
+    scan(lidar);
+
+    ASSERT_NE(lidar->getRanges(), nullptr);
+    EXPECT_EQ(getLidarInfo(lidar)->ranges.size(), 12u);
+    EXPECT_EQ(getLidarInfo(lidar)->directions.size(), 12u);
+}
+
+TEST_F(Sensor_Lidar, Hits) {
+    createCircle(vec2(2.0f, 0.0f));
+    createCircle(vec2(0.0f, 5.0f));
+    component::LidarSensor* lidar = createLidar(vec3(0.0f));
+    lidar->verticalBeams = 2; // Projected to the plane by the 2D engine
+    scan(lidar);
+
+    // Beams that do not hit measure the upper limit
+    const float* ranges = lidar->getRanges();
+    ASSERT_NE(ranges, nullptr);
+    for (int row = 0; row < 2; row++) {
+        EXPECT_NEAR(ranges[row * 4 + 0], 10.0f, 1e-4f);
+        EXPECT_NEAR(ranges[row * 4 + 1], 10.0f, 1e-4f);
+        EXPECT_NEAR(ranges[row * 4 + 2], 1.5f, 1e-4f);
+        EXPECT_NEAR(ranges[row * 4 + 3], 4.5f, 1e-4f);
+    }
+}
+
+TEST_F(Sensor_Lidar, RangeClamp) {
+    createCircle(vec2(0.6f, 0.0f));
+    createCircle(vec2(0.0f, 5.0f));
+    component::LidarSensor* lidar = createLidar(vec3(0.0f));
+    lidar->lowerLimit = 0.5f;
+    lidar->upperLimit = 3.0f;
+    scan(lidar);
+
+    // The close hit is clipped to the lower limit, the far one is out of range
+    const float* ranges = lidar->getRanges();
+    ASSERT_NE(ranges, nullptr);
+    EXPECT_NEAR(ranges[2], 0.5f, 1e-4f);
+    EXPECT_NEAR(ranges[3], 3.0f, 1e-4f);
+
+    // The noise does not move the ranges out of the limits
+    lidar->gaussianStd = 10.0f;
+    lidar->scanTime = -1.0f;
+    sensor::update(0.0f);
+    for (size_t i = 0; i < 4; i++) {
+        EXPECT_GE(lidar->getRanges()[i], 0.5f);
+        EXPECT_LE(lidar->getRanges()[i], 3.0f);
+    }
+}
+
+} // namespace
@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/cameraSensor.h>
+#include <atta/component/components/mesh.h>
+#include <atta/component/components/transform.h>
+#include <atta/component/tests/common.h>
+#include <atta/resource/resources/mesh.h>
+#include <atta/sensor/interface.h>
+#include <atta/sensor/rayTracer.h>
+#include <atta/sensor/tests/common.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::sensor;
+
+namespace {
+
+const char* CUBE = "meshes/rayTracerCube.obj";
+
+class Sensor_RayTracer : public ::testing::Test {
+  public:
+    void SetUp() override {
+        component::test::startUp();
+        static resource::Mesh* cube = resource::create<resource::Mesh>(CUBE, sensor::test::createCubeMesh());
+        (void)cube;
+    }
+    void TearDown() override { component::clear(); }
+
+  protected:
+    component::Entity createCube(vec3 position, vec3 scale, quat orientation = quat()) {
+        component::Entity e = component::createEntity();
+        component::Transform* t = e.add<component::Transform>();
+        t->position = position;
+        t->orientation = orientation;
+        t->scale = scale;
+        e.add<component::Mesh>()->sid = StringId(CUBE);
+        return e;
+    }
+};
+
+TEST_F(Sensor_RayTracer, MeshSpace) {
+    quat rotation;
+    rotation.setAxisAngle(vec3(0.0f, 0.0f, 1.0f), M_PI / 2.0f);
+    component::Entity scaled = createCube(vec3(0.0f, 0.0f, -5.0f), vec3(2.0f, 1.0f, 1.0f), rotation); // 1x2x1 after the rotation
+    component::Entity mirrored = createCube(vec3(5.0f, 0.0f, -5.0f), vec3(-1.0f, 1.0f, 1.0f));
+    RayTracer rayTracer;
+    rayTracer.update();
+
+    // Scale is applied before the rotation
+    float t = 100.0f;
+    EXPECT_EQ(rayTracer.trace(vec3(0.0f, 0.8f, 0.0f), vec3(0.0f, 0.0f, -1.0f), t), scaled.getId());
+    EXPECT_NEAR(t, 4.5f, 1e-4f);
+    t = 100.0f;
+    EXPECT_EQ(rayTracer.trace(vec3(0.8f, 0.0f, 0.0f), vec3(0.0f, 0.0f, -1.0f), t), -1);
+    EXPECT_EQ(t, 100.0f);
+
+    // The distance is measured in units of the direction length
+    t = 100.0f;
+    EXPECT_EQ(rayTracer.trace(vec3(0.0f), vec3(0.0f, 0.0f, -2.0f), t), scaled.getId());
+    EXPECT_NEAR(t, 2.25f, 1e-4f);
+
+    // Mirrored mesh hits its front faces from both sides, the back faces would give 5.5
+    t = 100.0f;
+    EXPECT_EQ(rayTracer.trace(vec3(5.0f, 0.0f, 0.0f), vec3(0.0f, 0.0f, -1.0f), t), mirrored.getId());
+    EXPECT_NEAR(t, 4.5f, 1e-4f);
+    t = 100.0f;
+    EXPECT_EQ(rayTracer.trace(vec3(5.0f, 0.0f, -10.0f), vec3(0.0f, 0.0f, 1.0f), t), mirrored.getId());
+    EXPECT_NEAR(t, 4.5f, 1e-4f);
+}
+
+TEST_F(Sensor_RayTracer, Orthographic) {
+    component::Entity top = createCube(vec3(0.5f, 0.5f, -5.0f), vec3(1.0f));
+    component::Entity bottom = createCube(vec3(-1.5f, -0.5f, -6.0f), vec3(1.0f));
+    RayTracer rayTracer;
+    rayTracer.update();
+
+    // 4x2 meters, one pixel per meter
+    std::vector<float> depth(8);
+    std::vector<component::EntityId> entities(8);
+    RayTracer::View view{vec3(0.0f), vec3(0.0f, 0.0f, -1.0f), vec3(0.0f, 1.0f, 0.0f), false, 2.0f, 100.0f, 4, 2, depth.data(), entities.data()};
+    rayTracer.render(Span<RayTracer::View>(&view, 1));
+    EXPECT_EQ(rayTracer.getNumRays(), 8u);
+
+    // Row 0 is the top of the image, column 0 is the left
+    for (size_t pixel = 0; pixel < 8; pixel++) {
+        if (pixel == 2) {
+            EXPECT_EQ(entities[pixel], top.getId());
+            EXPECT_NEAR(depth[pixel], 4.5f, 1e-4f);
+        } else if (pixel == 4) {
+            EXPECT_EQ(entities[pixel], bottom.getId());
+            EXPECT_NEAR(depth[pixel], 5.5f, 1e-4f);
+        } else {
+            EXPECT_EQ(entities[pixel], -1) << "pixel " << pixel;
+            EXPECT_EQ(depth[pixel], 100.0f) << "pixel " << pixel;
+        }
+    }
+}
+
+TEST_F(Sensor_RayTracer, CameraSensorLayout) {
+    component::Entity cube = createCube(vec3(-2.5f, 2.5f, -5.0f), vec3(1.0f));
+    component::Entity camera = component::createEntity();
+    component::CameraSensor* cs = camera.add<component::CameraSensor>();
+    cs->width = 2;
+    cs->height = 2;
+    cs->fov = 90.0f;
+    cs->far = 100.0f;
+    cs->cameraType = component::CameraSensor::CameraType::PERSPECTIVE;
+    cs->rendererType = component::CameraSensor::RendererType::RAY_TRACED;
+    cs->captureTime = 0.0f;
+    RayTracer rayTracer;
+    rayTracer.update();
+
+    // Same image layout that the sensor manager uses for ray traced cameras
+    getCameraInfos().push_back(CameraInfo{camera, cs, false, nullptr, nullptr, false, {}});
+    std::vector<uint8_t>& data = getCameraInfos().back().data;
+    data.resize(4 * (sizeof(float) + sizeof(component::EntityId)));
+    RayTracer::View view{vec3(0.0f),
+                         vec3(0.0f, 0.0f, -1.0f),
+                         vec3(0.0f, 1.0f, 0.0f),
+                         true,
+                         radians(cs->fov),
+                         cs->far,
+                         cs->width,
+                         cs->height,
+                         reinterpret_cast<float*>(data.data()),
+                         reinterpret_cast<component::EntityId*>(data.data() + 4 * sizeof(float))};
+    rayTracer.render(Span<RayTracer::View>(&view, 1));
+
+    // Only the top left ray hits the cube, the depth is measured along the front axis
+    const float* depth = cs->getDepth();
+    const component::EntityId* entities = cs->getEntityIds();
+    ASSERT_NE(depth, nullptr);
+    ASSERT_NE(entities, nullptr);
+    EXPECT_NEAR(depth[0], 4.5f, 1e-4f);
+    EXPECT_EQ(entities[0], cube.getId());
+    for (size_t pixel = 1; pixel < 4; pixel++) {
+        EXPECT_EQ(depth[pixel], 100.0f) << "pixel " << pixel;
+        EXPECT_EQ(entities[pixel], -1) << "pixel " << pixel;
+    }
+    getCameraInfos().pop_back();
+}
+
+} // namespace
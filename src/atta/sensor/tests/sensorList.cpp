@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/sensor/sensorList.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+using namespace atta::sensor;
+
+namespace {
+
+struct Sensor {
+    uint32_t sensorHandle = UINT32_MAX;
+};
+
+struct SensorInfo {
+    cmp::EntityId entity;
+    Sensor* component;
+};
+
+TEST(Sensor_SensorList, AddRemove) {
+    Sensor sensors[4];
+    SensorList<SensorInfo> list;
+    for (int i = 0; i < 4; i++)
+        EXPECT_TRUE(list.add({i * 10, &sensors[i]}));
+    EXPECT_FALSE(list.add({10, &sensors[1]}));
+    EXPECT_EQ(list.size(), 4u);
+    for (int i = 0; i < 4; i++) {
+        EXPECT_EQ(sensors[i].sensorHandle, uint32_t(i));
+        EXPECT_EQ(list.get(i * 10)->component, &sensors[i]);
+    }
+
+    // Last info is moved to the removed position
+    EXPECT_TRUE(list.remove(10));
+    EXPECT_FALSE(list.remove(10));
+    EXPECT_EQ(list.size(), 3u);
+    EXPECT_EQ(list.get(10), nullptr);
+    EXPECT_EQ(sensors[3].sensorHandle, 1u);
+    EXPECT_EQ(list.get(&sensors[3])->entity, 30);
+    EXPECT_EQ(list.get(30)->component, &sensors[3]);
+    EXPECT_EQ(list.get(&sensors[1]), nullptr);
+    EXPECT_EQ(list.get(1000), nullptr);
+    EXPECT_EQ(list.get(-1), nullptr);
+
+    EXPECT_TRUE(list.remove(30));
+    EXPECT_TRUE(list.remove(20));
+    EXPECT_TRUE(list.remove(0));
+    EXPECT_EQ(list.size(), 0u);
+}
+
+TEST(Sensor_SensorList, StaleHandle) {
+    Sensor sensors[2];
+    SensorList<SensorInfo> list;
+    list.add({0, &sensors[0]});
+    list.add({1, &sensors[1]});
+
+    // Component memory overwritten (e.g. checkpoint restore)
+    sensors[1].sensorHandle = 0;
+    EXPECT_EQ(list.get(&sensors[1])->entity, 1);
+    EXPECT_EQ(sensors[1].sensorHandle, 1u);
+}
+
+} // namespace
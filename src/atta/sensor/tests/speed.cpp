@@ -0,0 +1,104 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/component/components/mesh.h>
+#include <atta/component/components/transform.h>
+#include <atta/component/tests/common.h>
+#include <atta/graphics/cameras/perspectiveCamera.h>
+#include <atta/graphics/interface.h>
+#include <atta/graphics/renderers/fastRenderer.h>
+#include <atta/sensor/rayTracer.h>
+#include <atta/sensor/tests/common.h>
+#include <gtest/gtest.h>
+#include <cstdlib>
+
+using namespace atta;
+using namespace atta::sensor;
+
+namespace {
+constexpr uint32_t WIDTH = 256;
+constexpr uint32_t HEIGHT = 256;
+constexpr int NUM_FRAMES = 20;
+constexpr int GRID_SIZE = 20;
+const char* CUBE = "meshes/speedCube.obj";
+
+// Compare the rays per second (one per pixel) of the CPU ray tracer with the GPU renderer used by the rasterized camera
+// sensors, including the image read back. Both render a grid of cubes seen from the same camera
+class Sensor_RayTracerSpeed : public ::testing::Test {
+  public:
+    void SetUp() override {
+        component::test::startUp();
+        static resource::Mesh* cube = resource::create<resource::Mesh>(CUBE, sensor::test::createCubeMesh());
+        (void)cube;
+        for (int i = 0; i < GRID_SIZE * GRID_SIZE; i++) {
+            component::Entity e = component::createEntity();
+            component::Transform* t = e.add<component::Transform>();
+            t->position = vec3((i % GRID_SIZE - GRID_SIZE / 2) * 1.5f, (i / GRID_SIZE - GRID_SIZE / 2) * 1.5f, 0.0f);
+            e.add<component::Mesh>()->sid = StringId(CUBE);
+        }
+    }
+    void TearDown() override { component::clear(); }
+
+  protected:
+    // The cubes fill the view
+    static constexpr float FOV = 60.0f;
+    const vec3 _position = vec3(0.0f, 0.0f, 25.0f);
+    const vec3 _front = vec3(0.0f, 0.0f, -1.0f);
+    const vec3 _up = vec3(0.0f, 1.0f, 0.0f);
+
+    void recordRaysPerSecond(std::chrono::steady_clock::time_point begin) {
+        std::chrono::duration<double> seconds = std::chrono::steady_clock::now() - begin;
+        RecordProperty("raysPerSecond", int(double(WIDTH) * HEIGHT * NUM_FRAMES / seconds.count()));
+    }
+};
+
+// GLFW needs a display server to create the OpenGL context
+bool hasGraphicsContext() {
+#ifdef ATTA_OS_LINUX
+    return std::getenv("DISPLAY") != nullptr || std::getenv("WAYLAND_DISPLAY") != nullptr;
+#else
+    return true;
+#endif
+}
+
+TEST_F(Sensor_RayTracerSpeed, RayTracer) {
+    RayTracer rayTracer;
+    rayTracer.update();
+    std::vector<float> depth(WIDTH * HEIGHT);
+    std::vector<component::EntityId> entities(WIDTH * HEIGHT);
+    RayTracer::View view{_position, _front, _up, true, radians(FOV), 100.0f, WIDTH, HEIGHT, depth.data(), entities.data()};
+
+    auto begin = std::chrono::steady_clock::now();
+    for (int i = 0; i < NUM_FRAMES; i++)
+        rayTracer.render(Span<RayTracer::View>(&view, 1));
+    recordRaysPerSecond(begin);
+    EXPECT_NE(entities[WIDTH * HEIGHT / 2 + WIDTH / 2], -1);
+}
+
+TEST_F(Sensor_RayTracerSpeed, Rasterized) {
+    if (!hasGraphicsContext())
+        GTEST_SKIP() << "No graphics context";
+    graphics::startUp();
+    {
+        graphics::PerspectiveCamera::CreateInfo info{};
+        info.position = _position;
+        info.lookAt = _position + _front;
+        info.up = _up;
+        info.fov = FOV;
+        info.ratio = WIDTH / float(HEIGHT);
+        auto camera = std::make_shared<graphics::PerspectiveCamera>(info);
+        graphics::FastRenderer renderer;
+        renderer.setRenderDrawer(false);
+        renderer.setRenderSelected(false);
+        renderer.resize(WIDTH, HEIGHT);
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int i = 0; i < NUM_FRAMES; i++) {
+            renderer.render(camera);
+            EXPECT_FALSE(renderer.getFramebuffer()->getImage(0)->read().empty());
+        }
+        recordRaysPerSecond(begin);
+    }
+    graphics::shutDown();
+}
+
+} // namespace
@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/sensor/streamBuffer.h>
+#include <chrono>
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <thread>
+#include <unistd.h>
+
+using namespace atta;
+using namespace atta::sensor;
+
+namespace {
+
+TEST(Sensor_StreamBuffer, WriteRead) {
+    StreamBuffer writer;
+    ASSERT_TRUE(writer.create("atta_test_stream", 16, 4));
+    StreamBuffer reader;
+    ASSERT_TRUE(reader.open("atta_test_stream"));
+    EXPECT_EQ(reader.getSlotSize(), 16u);
+    EXPECT_EQ(reader.getNumSlots(), 4u);
+
+    float data[4];
+    EXPECT_EQ(reader.read(data).sequence, 0u);
+
+    for (int i = 1; i <= 10; i++) {
+        float values[4] = {float(i), 1.0f, 2.0f, 3.0f};
+        writer.write(values, sizeof(values), i * 0.5f);
+    }
+    StreamBuffer::Sample sample = reader.read(data);
+    EXPECT_EQ(sample.sequence, 10u);
+    EXPECT_EQ(sample.size, 16u);
+    EXPECT_EQ(sample.time, 5.0f);
+    EXPECT_EQ(data[0], 10.0f);
+    EXPECT_EQ(reader.read(data, sample.sequence).sequence, 0u);
+
+    // Reader can also write (action channel)
+    float action = 42.0f;
+    reader.write(&action, sizeof(action), 6.0f);
+    sample = writer.read(data, 10);
+    EXPECT_EQ(sample.sequence, 11u);
+    EXPECT_EQ(data[0], 42.0f);
+
+    writer.close();
+    EXPECT_FALSE(StreamBuffer().open("atta_test_stream"));
+}
+
+TEST(Sensor_StreamBuffer, OwnerOnly) {
+    StreamBuffer writer;
+    ASSERT_TRUE(writer.create("atta_test_stream_mode", 16, 4));
+    int fd = shm_open("/atta_test_stream_mode", O_RDONLY, 0);
+    ASSERT_NE(fd, -1);
+    struct stat st;
+    ASSERT_EQ(fstat(fd, &st), 0);
+    ::close(fd);
+    EXPECT_EQ(st.st_mode & 0777, 0600u);
+}
+
+TEST(Sensor_StreamBuffer, ThroughputLatency) {
+    constexpr uint32_t FRAME_SIZE = 640 * 480 * 4;
+    constexpr int NUM_FRAMES = 500;
+    using Clock = std::chrono::steady_clock;
+
+    StreamBuffer writer;
+    ASSERT_TRUE(writer.create("atta_test_stream_bench", FRAME_SIZE, 4));
+
+    // Local reader polls the newest frame and measures how long it took to arrive
+    std::atomic<bool> done = false;
+    int64_t numRead = 0;
+    double latencySum = 0.0;
+    std::thread readerThread([&]() {
+        StreamBuffer reader;
+        ASSERT_TRUE(reader.open("atta_test_stream_bench"));
+        std::vector<uint8_t> frame(FRAME_SIZE);
+        uint64_t last = 0;
+        while (!done.load() || reader.getSequence() != last) {
+            StreamBuffer::Sample sample = reader.read(frame.data(), last);
+            if (sample.sequence == 0)
+                continue;
+            int64_t sent;
+            std::memcpy(&sent, frame.data(), sizeof(sent));
+            latencySum += (Clock::now().time_since_epoch().count() - sent) * 1e-9;
+            last = sample.sequence;
+            numRead++;
+        }
+    });
+
+    std::vector<uint8_t> frame(FRAME_SIZE, 1);
+    auto begin = Clock::now();
+    for (int i = 0; i < NUM_FRAMES; i++) {
+        int64_t now = Clock::now().time_since_epoch().count();
+        std::memcpy(frame.data(), &now, sizeof(now));
+        writer.write(frame.data(), FRAME_SIZE, float(i));
+    }
+    std::chrono::duration<double> seconds = Clock::now() - begin;
+    done = true;
+    readerThread.join();
+
+    RecordProperty("framesPerSecond", int(NUM_FRAMES / seconds.count()));
+    RecordProperty("megabytesPerSecond", int(NUM_FRAMES * double(FRAME_SIZE) / seconds.count() / 1e6));
+    RecordProperty("meanLatencyMicroseconds", int(latencySum / std::max<int64_t>(numRead, 1) * 1e6));
+    EXPECT_GT(numRead, 0);
+    EXPECT_LE(numRead, NUM_FRAMES);
+}
+
+} // namespace
@@ -6,6 +6,7 @@
 #include <atta/component/components/boxCollider2D.h>
 #include <atta/component/components/circleCollider2D.h>
 #include <atta/component/components/cylinderCollider.h>
+#include <atta/component/components/meshCollider.h>
 #include <atta/component/components/polygonCollider2D.h>
 #include <atta/component/components/prototype.h>
 #include <atta/component/components/rigidBody.h>
@@ -14,30 +15,46 @@
 #include <atta/component/interface.h>
 #include <atta/graphics/drawer.h>
 #include <atta/physics/engines/bulletEngine.h>
+#include <atta/physics/engines/swarmEngine.h>
 #include <atta/physics/interface.h>
 #include <atta/utils/config.h>
 
 namespace atta::ui {
 
+using Shape = graphics::Drawer::Shape;
+
 void PhysicsDrawer::update() {
-    graphics::Drawer::clear<graphics::Drawer::Line>("atta::ui::PhysicsDrawer");
+    graphics::Drawer::clear<graphics::Drawer::Line>(_group);
+    if (physics::getEngineType() == physics::Engine::NONE)
+        return;
 
+    // One entity view is shared by all overlays
+    memory::Scratch scratch;
+    Span<component::EntityId> entities = component::getNoPrototypeView(scratch);
     switch (physics::getEngineType()) {
         case physics::Engine::NONE:
             break;
         case physics::Engine::BULLET:
-            drawBullet();
+            drawBullet(entities);
             break;
         case physics::Engine::BOX2D:
-            drawBox2D();
+        case physics::Engine::SWARM:
+            drawBox2D(entities);
             break;
     }
+
+    // Send all lines to the drawer with one copy per shape
+    for (size_t i = 0; i < NUM_SHAPES; i++) {
+        graphics::Drawer::addInstances(Shape(i), _instances[i], _group);
+        _instances[i].clear();
+    }
+    graphics::Drawer::addLines(_lines, _group);
+    _lines.clear();
 }
 
-void PhysicsDrawer::drawBullet() {
+void PhysicsDrawer::drawBullet(Span<component::EntityId> entities) {
     //---------- Show colliders ----------//
     if (physics::getShowColliders()) {
-        std::vector<component::EntityId> entities = component::getEntitiesView();
         for (auto entity : entities) {
             // Get transform
             auto t = component::getComponent<component::Transform>(entity);
@@ -66,23 +83,33 @@ void PhysicsDrawer::drawBullet() {
             //----- Box collider -----//
             auto box = component::getComponent<component::BoxCollider>(entity);
             if (box)
-                drawBox(pos + box->offset, ori, scale * box->size, color);
+                addShape(Shape::BOX, pos + box->offset, ori, scale * box->size, color);
 
             //----- Sphere collider -----//
             auto sphere = component::getComponent<component::SphereCollider>(entity);
             if (sphere)
-                drawSphere(pos + sphere->offset, ori, scale * sphere->radius, color);
+                addShape(Shape::SPHERE, pos + sphere->offset, ori, scale * sphere->radius, color);
 
             //----- Cylinder collider -----//
             auto cylinder = component::getComponent<component::CylinderCollider>(entity);
             if (cylinder && physics::getEngineType() == physics::Engine::BULLET)
-                drawCylinder(pos + cylinder->offset, ori, vec3(vec2(scale) * cylinder->radius * 2, scale.z * cylinder->height), color);
+                addShape(Shape::CYLINDER, pos + cylinder->offset, ori, vec3(vec2(scale) * cylinder->radius * 2, scale.z * cylinder->height), color);
+
+            //----- Mesh collider -----//
+            // The collision shape only exists while the simulation is running, its bullet aabb is shown
+            auto mesh = component::getComponent<component::MeshCollider>(entity);
+            if (mesh && Config::getState() != Config::State::IDLE) {
+                auto bullet = physics::getEngine<physics::BulletEngine>();
+                if (bullet->getBulletRigidBody(entity)) {
+                    bnd3 aabb = bullet->getAabb(entity);
+                    addShape(Shape::BOX, (aabb.pMin + aabb.pMax) * 0.5f, quat(), aabb.pMax - aabb.pMin, color);
+                }
+            }
         }
     }
 
     //---------- Show joints ----------//
     if (physics::getShowJoints()) {
-        std::vector<component::EntityId> entities = component::getEntitiesView();
         for (auto entity : entities) {
             auto p = component::getComponent<component::PrismaticJoint>(entity);
 
@@ -108,18 +135,18 @@ void PhysicsDrawer::drawBullet() {
                     wAxisB.normalize();
 
                     vec4 color = {0, 0, 1, 1};
-                    graphics::Drawer::add(graphics::Drawer::Line(wAnchorA, wAnchorB, color, color), "atta::ui::PhysicsDrawer");
+                    addLine(wAnchorA, wAnchorB, color);
                     quat oriA;
                     oriA.setRotationFromVectors(wAxisA, vec3(0, 0, 1));
                     quat oriB;
                     oriB.setRotationFromVectors(wAxisB, vec3(0, 0, 1));
 
-                    drawSquare(wAnchorA, oriA, vec3(0.1), color);
-                    drawSquare(wAnchorB, oriB, vec3(0.1), color);
+                    addShape(Shape::SQUARE, wAnchorA, oriA, vec3(0.1), color);
+                    addShape(Shape::SQUARE, wAnchorB, oriB, vec3(0.1), color);
 
                     if (p->enableLimits) {
-                        drawSquare(wAnchorA + wAxisA * p->lowerLimit, oriA, vec3(0.05), color);
-                        drawSquare(wAnchorA + wAxisA * p->upperLimit, oriA, vec3(0.05), color);
+                        addShape(Shape::SQUARE, wAnchorA + wAxisA * p->lowerLimit, oriA, vec3(0.05), color);
+                        addShape(Shape::SQUARE, wAnchorA + wAxisA * p->upperLimit, oriA, vec3(0.05), color);
                     }
                 }
             }
@@ -145,14 +172,14 @@ void PhysicsDrawer::drawBullet() {
                     wAxisB.normalize();
 
                     vec4 color = {0, 0, 1, 1};
-                    graphics::Drawer::add(graphics::Drawer::Line(wAnchorA, wAnchorB, color, color), "atta::ui::PhysicsDrawer");
+                    addLine(wAnchorA, wAnchorB, color);
                     quat oriA;
                     oriA.setRotationFromVectors(wAxisA, vec3(0, 0, 1));
                     quat oriB;
                     oriB.setRotationFromVectors(wAxisB, vec3(0, 0, 1));
 
-                    drawCircle(wAnchorA, oriA, vec3(0.1), color);
-                    drawCircle(wAnchorB, oriB, vec3(0.1), color);
+                    addShape(Shape::CIRCLE, wAnchorA, oriA, vec3(0.1), color);
+                    addShape(Shape::CIRCLE, wAnchorB, oriB, vec3(0.1), color);
                 }
             }
         }
@@ -162,7 +189,6 @@ void PhysicsDrawer::drawBullet() {
         std::shared_ptr<physics::BulletEngine> bullet = std::static_pointer_cast<physics::BulletEngine>(physics::getEngine());
         //---------- Draw AABBs ----------//
         if (bullet->getShowAabb()) {
-            std::vector<component::EntityId> entities = component::getEntitiesView();
             for (auto entity : entities) {
                 if (component::Entity(entity).isPrototype())
                     continue;
@@ -172,55 +198,44 @@ void PhysicsDrawer::drawBullet() {
                     bnd3 aabb = bullet->getAabb(entity);
                     vec3 center = (aabb.pMin + aabb.pMax) / 2.0f;
                     vec3 size = aabb.pMax - aabb.pMin;
-                    drawBox(center, quat(), size, {0.3, 0.8, 1.0, 1.0});
+                    addShape(Shape::BOX, center, quat(), size, {0.3, 0.8, 1.0, 1.0});
                 }
             }
         }
 
         //---------- Draw contacts ----------//
         if (physics::getShowContacts()) {
-            auto contacts = bullet->getCollisions();
-            for (auto [bodyA, bodiesB] : contacts) {
-                for (auto [bodyB, manifold] : bodiesB) {
-                    if (bodyA < bodyB) {
-                        int numContacts = manifold->getNumContacts();
-                        for (int i = 0; i < numContacts; i++) {
-                            const btManifoldPoint& contactPoint = manifold->getContactPoint(i);
-                            btVector3 btp0 = contactPoint.getPositionWorldOnA();
-                            btVector3 btp1 = contactPoint.getPositionWorldOnB();
-                            btVector3 n = contactPoint.m_normalWorldOnB;
-                            vec3 p0(btp0.x(), btp0.y(), btp0.z());
-                            vec3 p1(btp1.x(), btp1.y(), btp1.z());
-                            vec4 color(1, 1, 1, 1);
-                            vec3 normal(n.x(), n.y(), n.z());
-                            quat ori;
-                            ori.setRotationFromVectors(normal, vec3(0, 0, 1));
-                            drawCircle((p0 + p1) / 2, ori, vec3(0.1), color);
-                        }
-                    }
+            // Each contact point is stored for both entities, draw it once
+            for (const physics::Contact& contact : bullet->getContactList().getContacts()) {
+                if (contact.entity < contact.other) {
+                    quat ori;
+                    ori.setRotationFromVectors(contact.normal, vec3(0, 0, 1));
+                    addShape(Shape::CIRCLE, contact.point, ori, vec3(0.1), vec4(1, 1, 1, 1));
                 }
             }
         }
     }
 }
 
-void PhysicsDrawer::drawBox2D() {
+void PhysicsDrawer::drawBox2D(Span<component::EntityId> entities) {
     //---------- Show colliders ----------//
     if (physics::getShowColliders()) {
         // Base color
         vec4 color = {1, 1, 1, 1};
 
-        std::vector<component::EntityId> entities = component::getEntitiesView();
         for (auto entity : entities) {
             if (component::Entity(entity).isPrototype())
                 continue;
 
             // Change color based on box2d rigid body state
             if (Config::getState() != Config::State::IDLE) {
-                auto box2d = physics::getEngine<physics::Box2DEngine>();
-                auto rb = box2d->getBox2DRigidBody(entity);
-                if (rb)
-                    color = rb->IsAwake() ? vec4(0, 1, 0, 1) : vec4(1, 1, 0, 1);
+                if (physics::getEngineType() == physics::Engine::BOX2D) {
+                    auto box2d = physics::getEngine<physics::Box2DEngine>();
+                    auto rb = box2d->getBox2DRigidBody(entity);
+                    if (rb)
+                        color = rb->IsAwake() ? vec4(0, 1, 0, 1) : vec4(1, 1, 0, 1);
+                } else if (physics::getEngine<physics::SwarmEngine>()->hasBody(entity))
+                    color = vec4(0, 1, 0, 1);
             }
 
             // Get transform
@@ -235,21 +250,17 @@ void PhysicsDrawer::drawBox2D() {
             //----- Box collider 2D -----//
             auto box = component::getComponent<component::BoxCollider2D>(entity);
             if (box)
-                drawSquare(pos + vec3(box->offset, 0.0f), ori, scale * vec3(box->size, 1), color);
+                addShape(Shape::SQUARE, pos + vec3(box->offset, 0.0f), ori, scale * vec3(box->size, 1), color);
 
             //----- Circle collider 2D -----//
             auto circle = component::getComponent<component::CircleCollider2D>(entity);
             if (circle)
-                drawCircle(pos + vec3(circle->offset, 0.0f), ori, scale * vec3(vec2(circle->radius), 1), color);
+                addShape(Shape::CIRCLE, pos + vec3(circle->offset, 0.0f), ori, scale * vec3(vec2(circle->radius), 1), color);
 
             //----- Polygon collider 2D -----//
             auto polygon = component::getComponent<component::PolygonCollider2D>(entity);
-            if (polygon && polygon->points.size() >= 2) {
-                std::vector<vec3> points;
-                for (vec2 p : polygon->points)
-                    points.push_back(vec3(p, 0.0f));
-                drawPolygon(points, pos + vec3(polygon->offset, 0.0f), ori, scale, color);
-            }
+            if (polygon && polygon->points.size() >= 2)
+                addPolygon(polygon->points, pos + vec3(polygon->offset, 0.0f), ori, scale, color);
         }
     }
 
@@ -258,116 +269,34 @@ void PhysicsDrawer::drawBox2D() {
     }
 
     //---------- Draw contacts ----------//
-    if (physics::getShowContacts()) {
+    if (physics::getShowContacts() && Config::getState() != Config::State::IDLE) {
+        for (const physics::Contact& contact : physics::getEngine()->getContactList().getContacts()) {
+            if (contact.entity < contact.other) {
+                vec3 normal = contact.normal * 0.2f;
+                addLine(contact.point - normal, contact.point + normal, {1, 1, 1, 1});
+            }
+        }
     }
 }
 
-void PhysicsDrawer::drawSquare(vec3 position, quat orientation, vec3 scale, vec4 color) {
-    std::vector<vec3> vertices = {{0.5, 0.5, 0}, {-0.5, 0.5, 0}, {-0.5, -0.5, 0}, {0.5, -0.5, 0}};
-
-    mat4 mat;
-    mat.setPosOriScale(position, orientation, scale);
-    for (auto& v : vertices)
-        v = vec3(mat * vec4(v, 1));
-
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[0], vertices[1], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[1], vertices[2], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[2], vertices[3], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[3], vertices[0], color, color), "atta::ui::PhysicsDrawer");
-}
-
-void PhysicsDrawer::drawBox(vec3 position, quat orientation, vec3 scale, vec4 color) {
-    std::vector<vec3> vertices = {{0.5, 0.5, 0.5},  {-0.5, 0.5, 0.5},  {-0.5, -0.5, 0.5},  {0.5, -0.5, 0.5},
-                                  {0.5, 0.5, -0.5}, {-0.5, 0.5, -0.5}, {-0.5, -0.5, -0.5}, {0.5, -0.5, -0.5}};
-
-    mat4 mat;
-    mat.setPosOriScale(position, orientation, scale);
-    for (auto& v : vertices)
-        v = vec3(mat * vec4(v, 1));
-
-    // Top
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[0], vertices[1], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[1], vertices[2], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[2], vertices[3], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[3], vertices[0], color, color), "atta::ui::PhysicsDrawer");
-    // Down
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[4], vertices[5], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[5], vertices[6], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[6], vertices[7], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[7], vertices[4], color, color), "atta::ui::PhysicsDrawer");
-    // Connection
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[0], vertices[4], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[1], vertices[5], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[2], vertices[6], color, color), "atta::ui::PhysicsDrawer");
-    graphics::Drawer::add(graphics::Drawer::Line(vertices[3], vertices[7], color, color), "atta::ui::PhysicsDrawer");
+void PhysicsDrawer::addShape(Shape shape, vec3 position, quat orientation, vec3 scale, vec4 color) {
+    graphics::Drawer::Instance instance;
+    instance.transform.setPosOriScale(position, orientation, scale);
+    instance.color = color;
+    _instances[size_t(shape)].push_back(instance);
 }
 
-void PhysicsDrawer::drawCircle(vec3 position, quat orientation, vec3 scale, vec4 color) {
-    const unsigned numVertices = 32;
-    std::vector<vec3> vertices;
-    for (unsigned i = 0; i < numVertices; i++) {
-        float angle = i / float(numVertices) * 2 * M_PI;
-        vertices.push_back(vec3(cos(angle), sin(angle), 0.0f));
-    }
-
+void PhysicsDrawer::addPolygon(const std::vector<vec2>& points, vec3 position, quat orientation, vec3 scale, vec4 color) {
     mat4 mat;
     mat.setPosOriScale(position, orientation, scale);
-    for (auto& v : vertices)
-        v = vec3(mat * vec4(v, 1));
-
-    for (unsigned i = 0; i < numVertices; i++)
-        graphics::Drawer::add(graphics::Drawer::Line(vertices[i], vertices[(i - 1) % numVertices], color, color), "atta::ui::PhysicsDrawer");
-}
-
-void PhysicsDrawer::drawSphere(vec3 position, quat orientation, vec3 scale, vec4 color) {
-    const unsigned numVertices = 32;
-    std::vector<vec3> vertices;
-    for (unsigned i = 0; i < numVertices; i++) {
-        float angle = i / float(numVertices) * 2 * M_PI;
-        vertices.push_back(vec3(0, cos(angle), sin(angle)));
-        vertices.push_back(vec3(cos(angle), 0, sin(angle)));
-        vertices.push_back(vec3(cos(angle), sin(angle), 0));
+    vec3 prev = mat * vec4(points[0], 0.0f, 1.0f);
+    for (unsigned i = 1; i < points.size(); i++) {
+        vec3 curr = mat * vec4(points[i], 0.0f, 1.0f);
+        addLine(prev, curr, color);
+        prev = curr;
     }
-
-    mat4 mat;
-    mat.setPosOriScale(position, orientation, scale);
-    for (auto& v : vertices)
-        v = vec3(mat * vec4(v, 1));
-
-    for (unsigned i = 0; i < (numVertices - 1) * 3; i += 3) {
-        graphics::Drawer::add(graphics::Drawer::Line(vertices[i], vertices[(i + 3) % (numVertices * 3)], color, color), "atta::ui::PhysicsDrawer");
-        graphics::Drawer::add(graphics::Drawer::Line(vertices[i + 1], vertices[(i + 1 + 3) % (numVertices * 3)], color, color),
-                              "atta::ui::PhysicsDrawer");
-        graphics::Drawer::add(graphics::Drawer::Line(vertices[i + 2], vertices[(i + 2 + 3) % (numVertices * 3)], color, color),
-                              "atta::ui::PhysicsDrawer");
-    }
-}
-
-void PhysicsDrawer::drawCylinder(vec3 position, quat orientation, vec3 scale, vec4 color) {
-    vec3 axisX = {1, 0, 0};
-    vec3 axisY = {0, 1, 0};
-    vec3 axisZ = {0, 0, 1};
-    orientation.rotateVector(axisX);
-    orientation.rotateVector(axisY);
-    orientation.rotateVector(axisZ);
-    vec3 top = position + axisZ * scale.z * 0.5;
-    vec3 bottom = position - axisZ * scale.z * 0.5;
-    drawCircle(top, orientation, scale * 0.5, color);
-    drawCircle(bottom, orientation, scale * 0.5, color);
-    for (vec3 axis : std::vector<vec3>{axisX, axisY})
-        for (int i : std::vector<int>{-1, 1})
-            graphics::Drawer::add(graphics::Drawer::Line(bottom + axis * scale.x * 0.5 * i, top + axis * scale.x * 0.5 * i, color, color),
-                                  "atta::ui::PhysicsDrawer");
 }
 
-void PhysicsDrawer::drawPolygon(std::vector<vec3> points, vec3 position, quat orientation, vec3 scale, vec4 color) {
-    mat4 mat;
-    mat.setPosOriScale(position, orientation, scale);
-    for (auto& p : points)
-        p = vec3(mat * vec4(p, 1));
-
-    for (unsigned i = 0; i < points.size() - 1; i++)
-        graphics::Drawer::add(graphics::Drawer::Line(points[i], points[i + 1], color, color), "atta::ui::PhysicsDrawer");
-}
+void PhysicsDrawer::addLine(vec3 p0, vec3 p1, vec4 color) { _lines.push_back(graphics::Drawer::Line(p0, p1, color, color)); }
 
 } // namespace atta::ui
@@ -2,6 +2,9 @@
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #pragma once
 
+#include <atta/component/base.h>
+#include <atta/graphics/drawer.h>
+
 namespace atta::ui {
 
 /// Drawer used to draw physics collider lines
@@ -9,16 +12,18 @@ class PhysicsDrawer {
   public:
     void update(); ///< Update physics collider lines
   private:
-    void drawBullet();
-    void drawBox2D();
+    void drawBullet(Span<component::EntityId> entities);
+    void drawBox2D(Span<component::EntityId> entities);
+
+    /// Queue unit shape instance, the instances of each shape are sent to the drawer at once at the end of the update
+    void addShape(graphics::Drawer::Shape shape, vec3 position, quat orientation, vec3 scale, vec4 color);
+    void addPolygon(const std::vector<vec2>& points, vec3 position, quat orientation, vec3 scale, vec4 color);
+    void addLine(vec3 p0, vec3 p1, vec4 color);
 
-    void drawSquare(vec3 position = {0, 0, 0}, quat orientation = {}, vec3 scale = {1, 1, 1}, vec4 color = {0, 1, 0, 1});
-    void drawBox(vec3 position = {0, 0, 0}, quat orientation = {}, vec3 scale = {1, 1, 1}, vec4 color = {0, 1, 0, 1});
-    void drawCircle(vec3 position = {0, 0, 0}, quat orientation = {}, vec3 scale = {1, 1, 1}, vec4 color = {0, 1, 0, 1});
-    void drawSphere(vec3 position = {0, 0, 0}, quat orientation = {}, vec3 scale = {1, 1, 1}, vec4 color = {0, 1, 0, 1});
-    void drawCylinder(vec3 position = {0, 0, 0}, quat orientation = {}, vec3 scale = {1, 1, 1}, vec4 color = {0, 1, 0, 1});
-    void drawPolygon(std::vector<vec3> points = {0, 0, 0}, vec3 position = {0, 0, 0}, quat orientation = {}, vec3 scale = {1, 1, 1},
-                     vec4 color = {0, 1, 0, 1});
+    static constexpr size_t NUM_SHAPES = size_t(graphics::Drawer::Shape::CYLINDER) + 1;
+    std::array<std::vector<graphics::Drawer::Instance>, NUM_SHAPES> _instances; ///< Instances of each shape, kept to avoid allocations
+    std::vector<graphics::Drawer::Line> _lines;                                 ///< Joint, contact, and polygon lines
+    StringId _group = StringId("atta::ui::PhysicsDrawer");
 };
 
 } // namespace atta::ui
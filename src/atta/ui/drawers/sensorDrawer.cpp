@@ -12,14 +12,17 @@ namespace atta::ui {
 void SensorDrawer::update() {
     updateCameras();
     updateInfrareds();
+    updateLidars();
 }
 
 void SensorDrawer::updateCameras() {
-    graphics::Drawer::clear<graphics::Drawer::Line>("atta::sensor::Camera"_ssid);
+    const StringId group = "atta::sensor::Camera"_ssid;
+    graphics::Drawer::clear<graphics::Drawer::Line>(group);
 
     if (!sensor::getShowCameras())
         return;
 
+    _lines.clear();
     std::vector<sensor::CameraInfo>& cameras = sensor::getCameraInfos();
     for (uint32_t i = 0; i < cameras.size(); i++) {
         if (!cameras[i].initialized)
@@ -50,24 +53,27 @@ void SensorDrawer::updateCameras() {
         vec3 bl = midLeft - midUp;
         vec3 br = -midLeft - midUp;
 
-        graphics::Drawer::add(graphics::Drawer::Line(pos, plane + tl, {1, 1, 0, 1}, {1, 1, 0, 1}), "atta::sensor::Camera"_ssid);
-        graphics::Drawer::add(graphics::Drawer::Line(pos, plane + tr, {1, 1, 0, 1}, {1, 1, 0, 1}), "atta::sensor::Camera"_ssid);
-        graphics::Drawer::add(graphics::Drawer::Line(pos, plane + bl, {1, 1, 0, 1}, {1, 1, 0, 1}), "atta::sensor::Camera"_ssid);
-        graphics::Drawer::add(graphics::Drawer::Line(pos, plane + br, {1, 1, 0, 1}, {1, 1, 0, 1}), "atta::sensor::Camera"_ssid);
+        _lines.push_back(graphics::Drawer::Line(pos, plane + tl, {1, 1, 0, 1}, {1, 1, 0, 1}));
+        _lines.push_back(graphics::Drawer::Line(pos, plane + tr, {1, 1, 0, 1}, {1, 1, 0, 1}));
+        _lines.push_back(graphics::Drawer::Line(pos, plane + bl, {1, 1, 0, 1}, {1, 1, 0, 1}));
+        _lines.push_back(graphics::Drawer::Line(pos, plane + br, {1, 1, 0, 1}, {1, 1, 0, 1}));
 
-        graphics::Drawer::add(graphics::Drawer::Line(plane + tl, plane + tr, {1, 1, 0, 1}, {1, 1, 0, 1}), "atta::sensor::Camera"_ssid);
-        graphics::Drawer::add(graphics::Drawer::Line(plane + tr, plane + br, {1, 1, 0, 1}, {1, 1, 0, 1}), "atta::sensor::Camera"_ssid);
-        graphics::Drawer::add(graphics::Drawer::Line(plane + br, plane + bl, {1, 1, 0, 1}, {1, 1, 0, 1}), "atta::sensor::Camera"_ssid);
-        graphics::Drawer::add(graphics::Drawer::Line(plane + bl, plane + tl, {1, 1, 0, 1}, {1, 1, 0, 1}), "atta::sensor::Camera"_ssid);
+        _lines.push_back(graphics::Drawer::Line(plane + tl, plane + tr, {1, 1, 0, 1}, {1, 1, 0, 1}));
+        _lines.push_back(graphics::Drawer::Line(plane + tr, plane + br, {1, 1, 0, 1}, {1, 1, 0, 1}));
+        _lines.push_back(graphics::Drawer::Line(plane + br, plane + bl, {1, 1, 0, 1}, {1, 1, 0, 1}));
+        _lines.push_back(graphics::Drawer::Line(plane + bl, plane + tl, {1, 1, 0, 1}, {1, 1, 0, 1}));
     }
+    graphics::Drawer::addLines(_lines, group);
 }
 
 void SensorDrawer::updateInfrareds() {
-    graphics::Drawer::clear<graphics::Drawer::Line>("atta::sensor::Infrared"_ssid);
+    const StringId group = "atta::sensor::Infrared"_ssid;
+    graphics::Drawer::clear<graphics::Drawer::Line>(group);
 
     if (!sensor::getShowInfrareds())
         return;
 
+    _lines.clear();
     std::vector<sensor::InfraredInfo>& infrareds = sensor::getInfraredInfos();
     for (uint32_t i = 0; i < infrareds.size(); i++) {
         component::Entity entity = infrareds[i].entity;
@@ -91,8 +97,39 @@ void SensorDrawer::updateInfrareds() {
         vec4 color = hitted ? vec4(1, 0, 0, 1) : vec4(1, 1, 0, 1);
 
         // Draw line
-        graphics::Drawer::add(graphics::Drawer::Line(begin, begin + rayDir * ir->measurement, color, color), "atta::sensor::Infrared"_ssid);
+        _lines.push_back(graphics::Drawer::Line(begin, begin + rayDir * ir->measurement, color, color));
     }
+    graphics::Drawer::addLines(_lines, group);
+}
+
+void SensorDrawer::updateLidars() {
+    const StringId group = "atta::sensor::Lidar"_ssid;
+    graphics::Drawer::clear<graphics::Drawer::Line>(group);
+
+    if (!sensor::getShowLidars())
+        return;
+
+    _lines.clear();
+    for (const sensor::LidarInfo& lidarInfo : sensor::getLidarInfos()) {
+        component::LidarSensor* lidar = lidarInfo.component;
+
+        // Ignore prototypes
+        if (component::Entity(lidarInfo.entity).isPrototype())
+            continue;
+        // Ignore if does not have scan yet
+        if (lidar->scanTime < 0.0f)
+            continue;
+
+        // Draw one line for each beam
+        for (size_t i = 0; i < lidarInfo.ranges.size(); i++) {
+            float range = lidarInfo.ranges[i];
+            bool hitted = range + 0.000001f < lidar->upperLimit;
+            vec4 color = hitted ? vec4(1, 0, 0, 1) : vec4(1, 1, 0, 1);
+            vec3 begin = lidarInfo.origin;
+            _lines.push_back(graphics::Drawer::Line(begin, begin + lidarInfo.directions[i] * range, color, color));
+        }
+    }
+    graphics::Drawer::addLines(_lines, group);
 }
 
 } // namespace atta::ui
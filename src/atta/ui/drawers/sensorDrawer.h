@@ -2,6 +2,8 @@
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #pragma once
 
+#include <atta/graphics/drawer.h>
+
 namespace atta::ui {
 
 /// Drawer used to draw sensor lines
@@ -11,6 +13,9 @@ class SensorDrawer {
   private:
     void updateCameras();
     void updateInfrareds();
+    void updateLidars();
+
+    std::vector<graphics::Drawer::Line> _lines; ///< Lines of the sensor being updated, sent to the drawer at once
 };
 
 } // namespace atta::ui
@@ -13,6 +13,7 @@
 #include <atta/ui/windows/graphicsModuleWindow.h>
 #include <atta/ui/windows/ioModuleWindow.h>
 #include <atta/ui/windows/physicsModuleWindow.h>
+#include <atta/ui/windows/recordingWindow.h>
 #include <atta/ui/windows/sensorModuleWindow.h>
 #include <atta/ui/windows/timeProfiler/timeProfilerWindow.h>
 #include <atta/ui/windows/utils/fileSelectionWindow.h>
@@ -23,9 +24,15 @@
 
 namespace atta::ui {
 
-void Editor::startUp() { _viewportWindows.startUp(); }
+void Editor::startUp() {
+    _entityWindow.startUp();
+    _viewportWindows.startUp();
+}
 
-void Editor::shutDown() { _viewportWindows.shutDown(); }
+void Editor::shutDown() {
+    _viewportWindows.shutDown();
+    _entityWindow.shutDown();
+}
 
 void Editor::renderViewports() { _viewportWindows.renderViewports(); }
 
@@ -58,6 +65,7 @@ void Editor::render() {
     SensorModuleWindow::render();
 
     // Tools
+    RecordingWindow::render();
     TimeProfilerWindow::render();
 
     // Windows utils
@@ -139,8 +147,11 @@ void Editor::renderCameraWindows() {
             std::string windowName = name != nullptr ? name->name : "Camera";
             ImGui::Begin((windowName + "##CameraWindow" + std::to_string(cameras[i].entity)).c_str(), &(cameras[i].showWindow));
             {
-                ImVec2 size = ImVec2(cameras[i].renderer->getWidth(), cameras[i].renderer->getHeight());
-                ImGui::Image((ImTextureID)(intptr_t)cameras[i].renderer->getImGuiTexture(), size);
+                if (cameras[i].renderer) {
+                    ImVec2 size = ImVec2(cameras[i].renderer->getWidth(), cameras[i].renderer->getHeight());
+                    ImGui::Image((ImTextureID)(intptr_t)cameras[i].renderer->getImGuiTexture(), size);
+                } else
+                    ImGui::Text("Ray traced camera (depth and entity id only)");
             }
             ImGui::End();
         }
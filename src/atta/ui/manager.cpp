@@ -173,9 +173,8 @@ void Manager::registerCustomComponentUIs() {
             evt::publish(event);
         }
 
-        const std::vector<cmp::AttributeDescription> aDescs =
-            cmp::TypedComponentRegistry<cmp::CameraSensor>::getInstance().getDescription().attributeDescriptions;
-        renderAttributes(aDescs, comp, sizeof(cmp::CameraSensor));
+        cmp::ComponentRegistry& compReg = cmp::TypedComponentRegistry<cmp::CameraSensor>::getInstance();
+        renderAttributes(compReg.getDescription().attributeDescriptions, comp, compReg.getAttributesEnd());
     });
 
     //---------- Material ----------//
@@ -6,6 +6,8 @@
 #include <atta/event/events/simulationStep.h>
 #include <atta/event/events/simulationStop.h>
 #include <atta/event/interface.h>
+#include <atta/memory/heapStats.h>
+#include <atta/resource/interface.h>
 #include <atta/ui/interface.h>
 #include <atta/ui/panels/toolBar/toolBar.h>
 #include <atta/ui/widgets/button.h>
@@ -157,6 +159,17 @@ void ToolBar::render() {
             int ms = (time - int(time)) * 1000;
             ImGui::SameLine();
             ImGui::Text("%02d:%02d:%02d.%03d - %.3fx", h, m, s, ms, Config::getRealStepSpeed());
+#ifdef ATTA_HEAP_STATS
+            if (ImGui::IsItemHovered())
+                ImGui::SetTooltip("Heap allocations in the last step: %lu", (unsigned long)memory::getStepHeapStats().numAllocs);
+#endif
+        }
+
+        // Resource loading progress
+        resource::LoadProgress progress = resource::getLoadProgress();
+        if (progress.numLoaded < progress.numTotal) {
+            ImGui::SameLine();
+            ImGui::Text("Loading resources %lu/%lu", (unsigned long)progress.numLoaded, (unsigned long)progress.numTotal);
         }
     }
     ImGui::PopStyleColor(3);
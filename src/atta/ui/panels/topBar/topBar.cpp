@@ -23,6 +23,7 @@
 #include <atta/ui/windows/graphicsModuleWindow.h>
 #include <atta/ui/windows/ioModuleWindow.h>
 #include <atta/ui/windows/physicsModuleWindow.h>
+#include <atta/ui/windows/recordingWindow.h>
 #include <atta/ui/windows/sensorModuleWindow.h>
 #include <atta/ui/windows/timeProfiler/timeProfilerWindow.h>
 #include <atta/ui/windows/utils/fileSelectionWindow.h>
@@ -82,9 +83,12 @@ void TopBar::fileMenu() {
         }
 #endif
 
-        if (file::isProjectOpen())
+        if (file::isProjectOpen()) {
             if (ImGui::MenuItem("Save"))
                 file::saveProject();
+            if (ImGui::MenuItem("Save binary snapshot"))
+                file::saveProject(file::Project::Format::BINARY);
+        }
 
 #ifndef ATTA_STATIC_PROJECT
         if (ImGui::MenuItem("Save as"))
@@ -159,6 +163,8 @@ void TopBar::windowMenu() {
             SensorModuleWindow::setOpen(true);
 
         ImGui::Separator();
+        if (ImGui::MenuItem("Recording"))
+            RecordingWindow::setOpen(true);
         if (ImGui::MenuItem("Time Profiler"))
             TimeProfilerWindow::setOpen(true);
 
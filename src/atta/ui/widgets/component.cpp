@@ -330,14 +330,14 @@ void renderAttribute(cmp::AttributeDescription aDesc, void* d, unsigned size) {
     }
 }
 
-void renderAttributes(const std::vector<cmp::AttributeDescription>& aDescs, cmp::Component* comp, unsigned compSizeOf) {
+void renderAttributes(const std::vector<cmp::AttributeDescription>& aDescs, cmp::Component* comp, unsigned attributesEnd) {
     // Render UI for each attribute
     for (unsigned i = 0; i < aDescs.size(); i++) {
         cmp::AttributeDescription aDesc = aDescs[i];
 
         // Calculate data and size
         void* data = (void*)((uint8_t*)comp + aDesc.offset);
-        unsigned size = (i == aDescs.size() - 1) ? compSizeOf - aDesc.offset : aDescs[i + 1].offset - aDesc.offset;
+        unsigned size = cmp::getAttributeSize(aDescs, attributesEnd, i);
 
         // Render attribute
         ImGui::PushID(aDesc.name.c_str());
@@ -364,7 +364,7 @@ void componentDefaultRender(cmp::Entity entity, cmp::ComponentId cid, cmp::Compo
     // Render component attributes
     const cmp::ComponentDescription& description = cmpReg->getDescription();
     const std::vector<cmp::AttributeDescription> attributeDescriptions = description.attributeDescriptions;
-    renderAttributes(attributeDescriptions, comp, cmpReg->getSizeof());
+    renderAttributes(attributeDescriptions, comp, cmpReg->getAttributesEnd());
 }
 
 void componentWidget(cmp::Entity entity, cmp::ComponentId cid, cmp::Component* comp) {
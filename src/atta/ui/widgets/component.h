@@ -10,7 +10,7 @@ namespace atta::ui {
 
 void componentWidget(cmp::Entity entity, cmp::ComponentId cid, cmp::Component* comp);
 
-void renderAttributes(const std::vector<cmp::AttributeDescription>& aDescs, cmp::Component* comp, unsigned compSizeOf);
+void renderAttributes(const std::vector<cmp::AttributeDescription>& aDescs, cmp::Component* comp, unsigned attributesEnd);
 void renderAttribute(cmp::AttributeDescription aDesc, void* d, unsigned size);
 
 } // namespace atta::ui
@@ -63,6 +63,7 @@ bool Gizmo::manipulate(cmp::EntityId entity) {
             cmp::Transform newT;
             transform.getPosOriScale(newT.position, newT.orientation, newT.scale);
             t->setWorldTransform(entity, newT);
+            cmp::updateComponent<cmp::Transform>(entity);
             return true;
         }
     }
@@ -2,6 +2,14 @@
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #include <atta/component/componentRegistry.h>
 #include <atta/component/components/components.h>
+#include <atta/component/factory.h>
+#include <atta/event/events/changeParent.h>
+#include <atta/event/events/checkpointRestore.h>
+#include <atta/event/events/createClones.h>
+#include <atta/event/events/createEntity.h>
+#include <atta/event/events/deleteEntity.h>
+#include <atta/event/events/projectOpen.h>
+#include <atta/event/interface.h>
 #include <atta/resource/interface.h>
 #include <atta/resource/resources/mesh.h>
 #include <atta/script/manager.h>
@@ -12,6 +20,24 @@
 
 namespace atta::ui {
 
+void EntityWindow::startUp() {
+    event::subscribe<event::CreateEntity>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+    event::subscribe<event::DeleteEntity>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+    event::subscribe<event::ChangeParent>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+    event::subscribe<event::CreateClones>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+    event::subscribe<event::CheckpointRestore>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+    event::subscribe<event::ProjectOpen>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+}
+
+void EntityWindow::shutDown() {
+    event::unsubscribe<event::CreateEntity>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+    event::unsubscribe<event::DeleteEntity>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+    event::unsubscribe<event::ChangeParent>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+    event::unsubscribe<event::CreateClones>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+    event::unsubscribe<event::CheckpointRestore>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+    event::unsubscribe<event::ProjectOpen>(BIND_EVENT_FUNC(EntityWindow::onTreeChange));
+}
+
 void EntityWindow::render() {
     ImGui::Begin("Scene");
     {
@@ -28,18 +54,111 @@ void EntityWindow::render() {
     ImGui::End();
 }
 
+void EntityWindow::onTreeChange(event::Event& event) {
+    // Many events can arrive in the same frame (e.g. project load), the tree is rebuilt once when rendered
+    _rootsOutdated = true;
+    if (event.getType() == event::ProjectOpen::type) {
+        _openEntities.clear();
+        _openGroups.clear();
+    }
+}
+
+void EntityWindow::updateRoots() {
+    if (!_rootsOutdated)
+        return;
+    PROFILE();
+
+    _roots.clear();
+    memory::Scratch scratch;
+    for (component::EntityId entity : component::getEntitiesView(scratch)) {
+        component::Relationship* r = component::getComponent<component::Relationship>(entity);
+        if (!r || r->getParent() == -1)
+            _roots.push_back(entity);
+    }
+
+    // Groups only have the live root clones, clones can be deleted or moved to another parent after they are created
+    _cloneGroups.clear();
+    _cloneToGroup.clear();
+    for (component::Factory& factory : component::getFactories()) {
+        if (factory.getNumEntitiesCloned() == 0)
+            continue;
+        CloneGroup group{factory.getPrototype(), {}};
+        component::EntityId first = factory.getFirstClone().getId();
+        for (component::EntityId clone = first; clone < first + component::EntityId(factory.getMaxClones()); clone++) {
+            if (!component::Entity(clone).exists())
+                continue;
+            component::Relationship* r = component::getComponent<component::Relationship>(clone);
+            if (!r || r->getParent() == -1)
+                group.clones.push_back(clone);
+        }
+        if (group.clones.empty())
+            continue;
+        for (component::EntityId clone : group.clones)
+            _cloneToGroup[clone] = group.clones.front();
+        _cloneGroups[group.clones.front()] = std::move(group);
+    }
+
+    _rootsOutdated = false;
+    _rowsOutdated = true;
+}
+
+void EntityWindow::updateRows() {
+    if (!_rowsOutdated)
+        return;
+    PROFILE();
+
+    _rows.clear();
+    addListRows(_roots, 0);
+    _rowsOutdated = false;
+}
+
+template <typename Range>
+void EntityWindow::addListRows(const Range& entities, uint32_t depth) {
+    for (component::EntityId entity : entities) {
+        // Root clones are replaced by the row of their group
+        auto clone = _cloneToGroup.find(entity);
+        if (clone == _cloneToGroup.end()) {
+            addRows(entity, depth);
+            continue;
+        }
+        if (clone->second != entity)
+            continue;
+        const CloneGroup& group = _cloneGroups[entity];
+        _rows.push_back(Row{entity, depth, uint32_t(group.clones.size())});
+        if (_openGroups.count(entity))
+            for (component::EntityId c : group.clones)
+                addRows(c, depth + 1);
+    }
+}
+
+void EntityWindow::addRows(component::EntityId entity, uint32_t depth) {
+    _rows.push_back(Row{entity, depth, 0});
+    if (!_openEntities.count(entity))
+        return;
+    if (component::Relationship* r = component::getComponent<component::Relationship>(entity))
+        addListRows(r->getChildren(), depth + 1);
+}
+
 void EntityWindow::renderTree() {
-    std::vector<component::EntityId> entities = component::getEntitiesView();
-    int i = 0;
+    updateRoots();
+    updateRows();
 
     ImGui::Text("Scene");
 
-    // Render root entities
-    for (component::EntityId entity : entities) {
-        component::Relationship* r = component::getComponent<component::Relationship>(entity);
-        if (!r || (r && r->getParent() == -1))
-            renderTreeNode(entity, i);
+    // Only the visible rows are submitted to ImGui
+    const float rowHeight = ImGui::GetTextLineHeightWithSpacing();
+    const float maxHeight = std::max(ImGui::GetContentRegionAvail().y * 0.5f, rowHeight);
+    const float height = std::min(_rows.size() * rowHeight + ImGui::GetStyle().WindowPadding.y * 2.0f, maxHeight);
+    ImGui::BeginChild("##EntityTree", ImVec2(0.0f, height));
+    {
+        ImGuiListClipper clipper;
+        clipper.Begin(int(_rows.size()), rowHeight);
+        while (clipper.Step())
+            for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++)
+                renderRow(_rows[i]);
+        clipper.End();
     }
+    ImGui::EndChild();
 
     const float size = 100.0f;
     ImVec2 cursor = ImGui::GetCursorPos();
@@ -60,26 +179,63 @@ void EntityWindow::renderTree() {
     _entitiesToCopy.clear();
 }
 
-void EntityWindow::renderTreeNode(component::EntityId entity, int& i) {
-    //----- Name -----//
-    std::string name = "<Entity " + std::to_string(entity) + ">";
+void EntityWindow::renderRow(const Row& row) {
+    const float indent = row.depth * ImGui::GetStyle().IndentSpacing;
+    if (indent > 0.0f)
+        ImGui::Indent(indent);
+    ImGui::PushID(int(row.entity));
+    if (row.numClones > 0)
+        renderGroupRow(row);
+    else
+        renderEntityRow(row);
+    ImGui::PopID();
+    if (indent > 0.0f)
+        ImGui::Unindent(indent);
+}
+
+void EntityWindow::renderGroupRow(const Row& row) {
+    const CloneGroup& group = _cloneGroups[row.entity];
+    component::Name* n = component::getComponent<component::Name>(group.prototype);
+
+    ImGuiTreeNodeFlags nodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_SpanAvailWidth |
+                                   ImGuiTreeNodeFlags_NoTreePushOnOpen;
+    bool open = _openGroups.count(row.entity);
+    ImGui::SetNextItemOpen(open);
+    bool nodeOpen = n ? ImGui::TreeNodeEx("group", nodeFlags, "%s clones (%u)", n->name, row.numClones)
+                      : ImGui::TreeNodeEx("group", nodeFlags, "<Entity %d> clones (%u)", group.prototype, row.numClones);
+    if (nodeOpen != open) {
+        if (nodeOpen)
+            _openGroups.insert(row.entity);
+        else
+            _openGroups.erase(row.entity);
+        _rowsOutdated = true;
+    }
+}
+
+void EntityWindow::renderEntityRow(const Row& row) {
+    component::EntityId entity = row.entity;
     component::Name* n = component::getComponent<component::Name>(entity);
     component::Relationship* r = component::getComponent<component::Relationship>(entity);
-    if (n)
-        name = n->name;
 
     //----- Selected -----//
-    ImGuiTreeNodeFlags nodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_SpanAvailWidth;
+    ImGuiTreeNodeFlags nodeFlags = ImGuiTreeNodeFlags_OpenOnArrow | ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_SpanAvailWidth |
+                                   ImGuiTreeNodeFlags_NoTreePushOnOpen;
     if (entity == component::getSelectedEntity())
         nodeFlags |= ImGuiTreeNodeFlags_Selected;
 
     //----- Leaf/Node -----//
-    if (r) {
-        if (r->getChildren().size() == 0)
-            nodeFlags |= ImGuiTreeNodeFlags_Leaf;
-    } else
+    if (!r || r->getNumChildren() == 0)
         nodeFlags |= ImGuiTreeNodeFlags_Leaf;
-    bool nodeOpen = ImGui::TreeNodeEx((void*)(intptr_t)i++, nodeFlags, name.c_str());
+    bool open = _openEntities.count(entity);
+    ImGui::SetNextItemOpen(open);
+    bool nodeOpen = n ? ImGui::TreeNodeEx("entity", nodeFlags, "%s", n->name) : ImGui::TreeNodeEx("entity", nodeFlags, "<Entity %d>", entity);
+    if (nodeOpen != open) {
+        if (nodeOpen)
+            _openEntities.insert(entity);
+        else
+            _openEntities.erase(entity);
+        _rowsOutdated = true;
+    }
 
     //----- Select entity -----//
     if (ImGui::IsItemClicked())
@@ -98,7 +254,10 @@ void EntityWindow::renderTreeNode(component::EntityId entity, int& i) {
     //----- Drag/Drop entities -----//
     if (ImGui::BeginDragDropSource()) {
         ImGui::SetDragDropPayload("component::EntityId", &entity, sizeof(component::EntityId));
-        ImGui::Text(name.c_str());
+        if (n)
+            ImGui::Text("%s", n->name);
+        else
+            ImGui::Text("<Entity %d>", entity);
         ImGui::EndDragDropSource();
     }
     if (ImGui::BeginDragDropTarget()) {
@@ -109,14 +268,6 @@ void EntityWindow::renderTreeNode(component::EntityId entity, int& i) {
         }
         ImGui::EndDragDropTarget();
     }
-
-    //----- Render children -----//
-    if (nodeOpen) {
-        if (r && r->getChildren().size() > 0)
-            for (auto child : r->getChildren())
-                renderTreeNode(child, i);
-        ImGui::TreePop();
-    }
 }
 
 void EntityWindow::renderComponents() {
@@ -133,8 +284,14 @@ void EntityWindow::renderComponents() {
             std::string name = compReg->getDescription().name;
             if (compReg->getId() != component::TypedComponentRegistry<component::Relationship>::getInstance().getId()) {
                 bool open = true;
-                if (ImGui::CollapsingHeader((name + "##Components" + name + "Header").c_str(), &open))
+                if (ImGui::CollapsingHeader((name + "##Components" + name + "Header").c_str(), &open)) {
+                    // Modules that keep a copy of the component are notified when it is edited
+                    const uint8_t* data = static_cast<const uint8_t*>(component);
+                    std::vector<uint8_t> before(data, data + compReg->getAttributesEnd());
                     componentWidget(cmp::Entity(selected), compReg->getId(), (component::Component*)component);
+                    if (std::memcmp(before.data(), data, before.size()) != 0)
+                        component::updateComponentById(compReg->getId(), selected);
+                }
                 if (!open)
                     component::removeComponentById(compReg->getId(), selected);
             }
@@ -3,20 +3,52 @@
 #pragma once
 
 #include <atta/component/interface.h>
+#include <atta/event/event.h>
 
 namespace atta::ui {
 
 class EntityWindow {
   public:
+    void startUp();
+    void shutDown();
     void render();
 
   private:
+    /// Visible line of the entity tree
+    struct Row {
+        component::EntityId entity; ///< Entity or first root clone of the group
+        uint32_t depth;
+        uint32_t numClones; ///< Number of live root clones if the row is a factory group, 0 otherwise
+    };
+    /// Live root clones of a factory, shown as one row
+    struct CloneGroup {
+        component::EntityId prototype;
+        std::vector<component::EntityId> clones;
+    };
+
+    void onTreeChange(event::Event& event);
+    void updateRoots();                                       ///< Rebuild the cached root list (only after the tree changed)
+    void updateRows();                                        ///< Flatten the open nodes of the tree
+    void addRows(component::EntityId entity, uint32_t depth); ///< Add entity row and the rows of its children if it is open
+    template <typename Range>
+    void addListRows(const Range& entities, uint32_t depth); ///< Add rows of an entity list, root clones are grouped
     void renderTree();
-    void renderTreeNode(component::EntityId entity, int& i);
+    void renderRow(const Row& row);
+    void renderEntityRow(const Row& row);
+    void renderGroupRow(const Row& row);
 
     void renderComponents();
     void textureCombo(std::string comboId, StringId& sid);
 
+    std::vector<component::EntityId> _roots;                                    ///< Root entities in id order
+    std::unordered_map<component::EntityId, CloneGroup> _cloneGroups;           ///< Groups by first root clone
+    std::unordered_map<component::EntityId, component::EntityId> _cloneToGroup; ///< First root clone of the group of each root clone
+    std::unordered_set<component::EntityId> _openEntities;                      ///< Expanded entities
+    std::unordered_set<component::EntityId> _openGroups;                        ///< Expanded groups by first root clone
+    std::vector<Row> _rows;
+    bool _rootsOutdated = true;
+    bool _rowsOutdated = true;
+
     // TODO Move this to undo/redo code
     std::vector<component::EntityId> _entitiesToDelete;
     std::vector<component::EntityId> _entitiesToCopy;
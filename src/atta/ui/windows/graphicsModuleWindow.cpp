@@ -3,6 +3,7 @@
 #include <atta/ui/windows/graphicsModuleWindow.h>
 
 #include <atta/graphics/interface.h>
+#include <atta/utils/config.h>
 
 namespace atta::ui {
 
@@ -55,6 +56,26 @@ void GraphicsModuleWindow::renderImpl() {
     float graphicsFPS = graphics::getGraphicsFPS();
     if (ImGui::DragFloat("Graphics FPS", &graphicsFPS, 0.1f, 10.0f, 60.0f, "%.1f") && graphicsFPS >= 10.0f)
         gfx::setGraphicsFPS(graphicsFPS);
+    bool interpolate = Config::getInterpolateTransforms();
+    if (ImGui::Checkbox("Interpolate transforms", &interpolate))
+        Config::setInterpolateTransforms(interpolate);
+    if (ImGui::IsItemHovered())
+        ImGui::SetTooltip("Render rigid bodies between the last two simulation steps");
+
+    // Main loop timing
+    const StepScheduler& scheduler = Config::getScheduler();
+    ImGui::Text("Real time factor: %.3fx", scheduler.getRealTimeFactor());
+    auto plotHistogram = [](const char* label, const StepScheduler::Histogram& histogram) {
+        std::array<float, StepScheduler::Histogram::NUM_BINS> values;
+        for (unsigned i = 0; i < values.size(); i++)
+            values[i] = float(histogram.counts[i]);
+        std::string overlay = "0-" + std::to_string(int(values.size() * StepScheduler::Histogram::BIN_WIDTH * 1000)) + "ms";
+        ImGui::PlotHistogram(label, values.data(), values.size(), 0, overlay.c_str(), 0.0f, FLT_MAX, ImVec2(0.0f, 60.0f));
+    };
+    plotHistogram("Frame times", scheduler.getFrameTimes());
+    plotHistogram("Step times", scheduler.getStepTimes());
+    if (ImGui::Button("Clear histograms"))
+        Config::getScheduler().clearHistograms();
 }
 
 } // namespace atta::ui
@@ -3,6 +3,7 @@
 #include <atta/ui/windows/physicsModuleWindow.h>
 
 #include <atta/physics/engines/bulletEngine.h>
+#include <atta/physics/engines/swarmEngine.h>
 #include <atta/physics/interface.h>
 
 namespace atta::ui {
@@ -16,7 +17,7 @@ void PhysicsModuleWindow::renderImpl() {
     ImGui::Text("Engine");
 
     ImGui::SameLine();
-    std::vector<std::string> physicsEngines = {"None", "Box2D", "Bullet"};
+    std::vector<std::string> physicsEngines = {"None", "Box2D", "Bullet", "Swarm"};
     physics::Engine::Type selected = physics::getEngineType();
     if (ImGui::BeginCombo(("##" + _name + "SelectEngine").c_str(), physicsEngines[selected].c_str())) {
         for (unsigned i = 0; i < physicsEngines.size(); i++) {
@@ -86,14 +87,53 @@ void PhysicsModuleWindow::renderImpl() {
                     bullet->setNumSubSteps(numSubSteps);
                 }
             }
+            // Multithreading (applied when the simulation starts)
+            {
+                bool multithreaded = bullet->getMultithreaded();
+                if (ImGui::Checkbox("Multithreaded", &multithreaded))
+                    bullet->setMultithreaded(multithreaded);
+                if (multithreaded) {
+                    int numThreads = bullet->getNumThreads();
+                    if (ImGui::DragInt("Threads (0 = all)", &numThreads, 1, 0, BT_MAX_THREAD_COUNT))
+                        bullet->setNumThreads(std::max(numThreads, 0));
+                }
+            }
+            ImGui::Separator();
+
+            // Number of contact points (each one is stored for both entities)
+            ImGui::Text("Num contacts: %u", unsigned(bullet->getContactList().getContacts().size() / 2));
+            break;
+        }
+        case physics::Engine::SWARM: {
+            std::shared_ptr<physics::SwarmEngine> swarm = physics::getEngine<physics::SwarmEngine>();
+
+            bool showColliders = physics::getShowColliders();
+            bool showContacts = physics::getShowContacts();
+            if (ImGui::Checkbox("Show colliders", &showColliders))
+                physics::setShowColliders(showColliders);
+            if (ImGui::Checkbox("Show contacts", &showContacts))
+                physics::setShowContacts(showContacts);
+
+            // Gravity vector
+            {
+                ImGui::Text("Gravity");
+                vec3 g = physics::getGravity();
+                if (ImGui::DragFloat2("Gravity", (float*)(&g), 0.01f))
+                    physics::setGravity(g);
+            }
+            // Solver
+            {
+                int numIterations = swarm->getNumIterations();
+                if (ImGui::DragInt("Iterations", &numIterations, 1, 1, 100))
+                    swarm->setNumIterations(std::max(numIterations, 1));
+                int numThreads = swarm->getNumThreads();
+                if (ImGui::DragInt("Threads (0 = all)", &numThreads, 1, 0, 256))
+                    swarm->setNumThreads(std::max(numThreads, 0));
+            }
             ImGui::Separator();
 
-            // Number of collisions
-            unsigned numCollisions2 = 0;
-            auto collisions = bullet->getCollisions();
-            for (auto [bodyA, bodiesB] : collisions)
-                numCollisions2 += bodiesB.size();
-            ImGui::Text("Num collisions: %u", numCollisions2 / 2);
+            ImGui::Text("Num bodies: %u", unsigned(swarm->getWorld().getNumBodies()));
+            ImGui::Text("Num contacts: %u", unsigned(swarm->getContactList().getContacts().size() / 2));
             break;
         }
     }
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/ui/windows/recordingWindow.h>
+
+#include <atta/file/interface.h>
+#include <atta/file/recording/player.h>
+#include <atta/utils/config.h>
+
+namespace atta::ui {
+
+RecordingWindow::RecordingWindow() : _fileBuffer{}, _stepInterval(1), _playing(false) {
+    setName("Recording");
+    _initialSize = vec2(300.0f, 200.0f);
+    strcpy(_fileBuffer.data(), "recordings/recording.attarec");
+}
+
+void RecordingWindow::renderImpl() {
+    // Relative paths are inside the project directory
+    ImGui::InputText("File", _fileBuffer.data(), _fileBuffer.size());
+    fs::path file = _fileBuffer.data();
+    if (file.is_relative() && file::isProjectOpen())
+        file = file::getProject()->getDirectory() / file;
+
+    //---------- Record ----------//
+    ImGui::Separator();
+    if (!file::isRecording()) {
+        ImGui::DragInt("Step interval", &_stepInterval, 1.0f, 1, 1000);
+        if (ImGui::Button("Record")) {
+            file::closePlayback();
+            fs::create_directories(file.parent_path());
+            file::startRecording(file, {}, uint32_t(_stepInterval));
+        }
+        if (Config::getState() == Config::State::IDLE) {
+            ImGui::SameLine();
+            ImGui::TextDisabled("(starts with the simulation)");
+        }
+    } else if (ImGui::Button("Stop recording"))
+        file::stopRecording();
+
+    //---------- Playback ----------//
+    ImGui::Separator();
+    file::Player* player = file::getPlayback();
+    if (player == nullptr) {
+        _playing = false;
+        if (ImGui::Button("Open recording") && file::openPlayback(file))
+            file::getPlayback()->seek(0);
+        return;
+    }
+
+    if (ImGui::Button(_playing ? "Pause" : "Play"))
+        _playing = !_playing;
+    ImGui::SameLine();
+    if (ImGui::Button("Close")) {
+        file::closePlayback();
+        return;
+    }
+
+    int frame = player->getFrame() < player->getNumFrames() ? int(player->getFrame()) : 0;
+    if (ImGui::SliderInt("Frame", &frame, 0, int(player->getNumFrames()) - 1))
+        player->seek(uint32_t(frame));
+    else if (_playing && !player->next())
+        _playing = false;
+    ImGui::Text("Time: %.3f s", player->getTime());
+}
+
+} // namespace atta::ui
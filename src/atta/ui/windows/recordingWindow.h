@@ -0,0 +1,22 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+#include <atta/ui/windows/window.h>
+
+namespace atta::ui {
+
+/// Record the simulation while it is running and play the recordings back while it is stopped
+class RecordingWindow : public Window<RecordingWindow> {
+  private:
+    RecordingWindow();
+    void renderImpl();
+
+    std::array<char, 256> _fileBuffer;
+    int _stepInterval;
+    bool _playing; ///< If the next frame of the playback is applied at each render
+
+    friend Window<RecordingWindow>;
+};
+
+} // namespace atta::ui
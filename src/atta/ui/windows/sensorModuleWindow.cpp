@@ -14,10 +14,13 @@ SensorModuleWindow::SensorModuleWindow() {
 void SensorModuleWindow::renderImpl() {
     bool showCameras = sensor::getShowCameras();
     bool showInfrareds = sensor::getShowInfrareds();
+    bool showLidars = sensor::getShowLidars();
     if (ImGui::Checkbox("Show cameras", &showCameras))
         sensor::setShowCameras(showCameras);
     if (ImGui::Checkbox("Show infrareds", &showInfrareds))
         sensor::setShowInfrareds(showInfrareds);
+    if (ImGui::Checkbox("Show lidars", &showLidars))
+        sensor::setShowLidars(showLidars);
 }
 
 } // namespace atta::ui
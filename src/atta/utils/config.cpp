@@ -16,6 +16,7 @@ void Config::initImpl() {
     _state = State::IDLE;
     _desiredStepSpeed = 1.0f;
     _realStepSpeed = 0.0f;
+    _interpolateTransforms = true;
 }
 
 Config::State Config::getState() { return getInstance()._state; }
@@ -26,5 +27,8 @@ float Config::getDesiredStepSpeed() { return getInstance()._desiredStepSpeed; }
 void Config::setDesiredStepSpeed(float desiredStepSpeed) { getInstance()._desiredStepSpeed = desiredStepSpeed; }
 float Config::getRealStepSpeed() { return getInstance()._realStepSpeed; }
 void Config::setRealStepSpeed(float realStepSpeed) { getInstance()._realStepSpeed = realStepSpeed; }
+StepScheduler& Config::getScheduler() { return getInstance()._scheduler; }
+bool Config::getInterpolateTransforms() { return getInstance()._interpolateTransforms; }
+void Config::setInterpolateTransforms(bool interpolateTransforms) { getInstance()._interpolateTransforms = interpolateTransforms; }
 
 } // namespace atta
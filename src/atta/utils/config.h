@@ -2,9 +2,14 @@
 // SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
 #pragma once
 
+#include <atta/utils/stepScheduler.h>
+
 namespace atta {
 
 class Atta;
+namespace component {
+class Checkpoint;
+}
 class Config final {
   public:
     enum class State { IDLE = 0, RUNNING, PAUSED };
@@ -20,6 +25,11 @@ class Config final {
     static void setDesiredStepSpeed(float desiredStepSpeed);
     static float getRealStepSpeed();
     static void setRealStepSpeed(float realStepSpeed);
+    /// Main loop timing (step/frame time histograms, interpolation factor)
+    static StepScheduler& getScheduler();
+    /// Interpolate the rendered transforms of physics bodies between the last two steps
+    static bool getInterpolateTransforms();
+    static void setInterpolateTransforms(bool interpolateTransforms);
 
   private:
     void initImpl();
@@ -43,7 +53,10 @@ class Config final {
      * This variable is updated by Atta::loop
      **/
     float _realStepSpeed;
+    StepScheduler _scheduler;
+    bool _interpolateTransforms;
     friend Atta;
+    friend component::Checkpoint;
 };
 
 } // namespace atta
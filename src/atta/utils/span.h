@@ -0,0 +1,39 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+namespace atta {
+
+// Non-owning view over contiguous memory (similar to C++20 std::span)
+// Used by the allocation-free APIs to read/write caller-provided or scratch memory
+template <typename T>
+class Span {
+  public:
+    Span() : _data(nullptr), _size(0) {}
+    Span(T* data, size_t size) : _data(data), _size(size) {}
+    Span(std::vector<std::remove_const_t<T>>& vec) : _data(vec.data()), _size(vec.size()) {}
+    template <size_t N>
+    Span(T (&arr)[N]) : _data(arr), _size(N) {}
+
+    T* data() const { return _data; }
+    size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    T& operator[](size_t i) const { return _data[i]; }
+    T* begin() const { return _data; }
+    T* end() const { return _data + _size; }
+
+    // Span with the first count elements
+    Span<T> first(size_t count) const { return Span<T>(_data, std::min(count, _size)); }
+    // Span starting at offset with count elements, clamped to the end of the span
+    Span<T> subspan(size_t offset, size_t count) const {
+        offset = std::min(offset, _size);
+        return Span<T>(_data + offset, std::min(count, _size - offset));
+    }
+
+  private:
+    T* _data;
+    size_t _size;
+};
+
+} // namespace atta
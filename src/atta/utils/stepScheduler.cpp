@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/utils/stepScheduler.h>
+#include <chrono>
+#include <thread>
+
+namespace atta {
+
+void StepScheduler::Histogram::add(float seconds) {
+    unsigned bin = seconds > 0.0f ? unsigned(seconds / BIN_WIDTH) : 0;
+    counts[std::min(bin, NUM_BINS - 1)]++;
+}
+
+uint32_t StepScheduler::Histogram::getTotal() const {
+    uint32_t total = 0;
+    for (uint32_t count : counts)
+        total += count;
+    return total;
+}
+
+StepScheduler::StepScheduler()
+    : _lastTime(-1.0), _accumulator(0.0), _nextFrame(0.0), _dt(0.0f), _stepSpeed(0.0f), _renderFPS(0.0f), _running(false), _maxStepsPerLoop(8), _alpha(1.0f),
+      _lastFrame(-1.0), _rtfWallTime(0.0), _rtfSimTime(0.0), _realTimeFactor(0.0f) {}
+
+double StepScheduler::getWallTime() {
+    using namespace std::chrono;
+    return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+StepScheduler::Plan StepScheduler::update(double now, bool running, float dt, float desiredStepSpeed, float renderFPS) {
+    Plan plan;
+    double elapsed = _lastTime < 0.0 ? 0.0 : std::min(now - _lastTime, MAX_LOOP_TIME);
+    _lastTime = now;
+    _dt = dt;
+    _stepSpeed = desiredStepSpeed;
+    _renderFPS = renderFPS;
+
+    //----- Simulation -----//
+    // The time before the simulation started/continued is not simulated
+    if (running && !_running) {
+        _accumulator = 0.0;
+        elapsed = 0.0;
+    }
+    _running = running;
+    if (running) {
+        if (desiredStepSpeed == 0.0f) {
+            // As fast as possible
+            plan.numSteps = 1;
+            _accumulator = 0.0;
+            _alpha = 1.0f;
+        } else {
+            _accumulator += elapsed * desiredStepSpeed;
+            plan.numSteps = unsigned(_accumulator / dt);
+            if (plan.numSteps > _maxStepsPerLoop) {
+                // Steps are slower than real time, drop the time that can not be simulated
+                plan.numSteps = _maxStepsPerLoop;
+                _accumulator = 0.0;
+            } else
+                _accumulator -= plan.numSteps * double(dt);
+            _alpha = std::min(float(_accumulator / dt), 1.0f);
+        }
+
+        // Real time factor
+        _rtfWallTime += elapsed;
+        _rtfSimTime += plan.numSteps * double(dt);
+        if (_rtfWallTime >= RTF_WINDOW) {
+            _realTimeFactor = float(_rtfSimTime / _rtfWallTime);
+            _rtfWallTime = _rtfSimTime = 0.0;
+        }
+    } else {
+        _alpha = 1.0f;
+        _realTimeFactor = 0.0f;
+        _rtfWallTime = _rtfSimTime = 0.0;
+    }
+
+    //----- Rendering -----//
+    if (renderFPS > 0.0f && now >= _nextFrame) {
+        plan.render = true;
+        // Keep the frame rate, unless the loop is too late
+        double period = 1.0 / renderFPS;
+        _nextFrame = now - _nextFrame < period ? _nextFrame + period : now + period;
+        if (_lastFrame >= 0.0)
+            _frameTimes.add(float(now - _lastFrame));
+        _lastFrame = now;
+    }
+    return plan;
+}
+
+void StepScheduler::reset(double now) {
+    _lastTime = now;
+    _accumulator = 0.0;
+    _alpha = 1.0f;
+    _rtfWallTime = _rtfSimTime = 0.0;
+}
+
+double StepScheduler::getTimeToNextEvent(double now) const {
+    double wait = _renderFPS > 0.0f ? std::min(_nextFrame - now, MAX_SLEEP) : MAX_SLEEP;
+    if (_running) {
+        if (_stepSpeed == 0.0f)
+            return 0.0;
+        wait = std::min(wait, (_dt - _accumulator) / _stepSpeed - (now - _lastTime));
+    }
+    return std::max(wait, 0.0);
+}
+
+void StepScheduler::sleep(double now) const {
+#ifndef ATTA_OS_WEB // The browser controls the main loop
+    // The OS may wake the thread late, the last millisecond is spent yielding
+    double wait = getTimeToNextEvent(now);
+    if (wait > 0.002)
+        std::this_thread::sleep_for(std::chrono::duration<double>(wait - 0.001));
+    while (getWallTime() < now + wait)
+        std::this_thread::yield();
+#endif
+}
+
+void StepScheduler::clearHistograms() {
+    _frameTimes.clear();
+    _stepTimes.clear();
+}
+
+} // namespace atta
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#pragma once
+
+namespace atta {
+
+/// Decide when the main loop steps the simulation and renders
+/** The simulation advances with a fixed timestep. The wall time that passed since the last loop, scaled by the desired
+ * step speed, is added to an accumulator that is consumed in steps of dt. Rendering happens at its own rate, and the
+ * remaining accumulator is the interpolation factor between the last two steps. When there is nothing to do, the loop
+ * sleeps until the next step or frame instead of spinning.
+ *
+ * The time is passed in seconds so the scheduler can be driven by a fake clock.
+ **/
+class StepScheduler final {
+  public:
+    /// Time histogram with bins of BIN_WIDTH seconds, the last bin also counts longer times
+    struct Histogram {
+        static constexpr unsigned NUM_BINS = 50;
+        static constexpr float BIN_WIDTH = 0.001f;
+        std::array<uint32_t, NUM_BINS> counts{};
+
+        void add(float seconds);
+        void clear() { counts.fill(0); }
+        uint32_t getTotal() const;
+    };
+
+    struct Plan {
+        unsigned numSteps = 0; ///< Simulation steps to run in this loop
+        bool render = false;   ///< If a frame should be rendered in this loop
+    };
+
+    StepScheduler();
+
+    static double getWallTime();
+
+    /// Plan the loop iteration
+    /** @param running If the simulation is running
+     *  @param desiredStepSpeed Simulated time per wall time, 0 steps once per loop (as fast as possible)
+     *  @param renderFPS Frames per second, 0 does not render
+     **/
+    Plan update(double now, bool running, float dt, float desiredStepSpeed, float renderFPS);
+    /// Restart the accumulator, the wall time before now is not simulated
+    void reset(double now);
+    /// Sleep until the next step or frame
+    void sleep(double now) const;
+    /// Time until the next step or frame
+    double getTimeToNextEvent(double now) const;
+
+    void addStepTime(float seconds) { _stepTimes.add(seconds); }
+
+    /// Fraction of dt between the last step and the current wall time, used to interpolate the rendered transforms
+    float getInterpolationAlpha() const { return _alpha; }
+    /// Simulated time over wall time in the last second
+    float getRealTimeFactor() const { return _realTimeFactor; }
+    const Histogram& getFrameTimes() const { return _frameTimes; }
+    const Histogram& getStepTimes() const { return _stepTimes; }
+    void clearHistograms();
+
+    /// Steps that a loop can run to catch up, the remaining wall time is dropped (the simulation becomes slower than desired)
+    unsigned getMaxStepsPerLoop() const { return _maxStepsPerLoop; }
+    void setMaxStepsPerLoop(unsigned maxStepsPerLoop) { _maxStepsPerLoop = maxStepsPerLoop; }
+
+  private:
+    static constexpr double MAX_SLEEP = 0.01;     ///< Keep handling events and files while idle
+    static constexpr double RTF_WINDOW = 1.0;     ///< Wall time used to compute the real time factor
+    static constexpr double MAX_LOOP_TIME = 0.25; ///< Longer loops (e.g. stopped in a debugger) are clamped
+
+    double _lastTime;    ///< Wall time of the last update
+    double _accumulator; ///< Wall time scaled by the step speed that was not simulated yet
+    double _nextFrame;   ///< Wall time of the next frame
+    float _dt;           ///< Last dt
+    float _stepSpeed;    ///< Last desired step speed
+    float _renderFPS;    ///< Last render frame rate
+    bool _running;       ///< If the simulation was running in the last update
+    unsigned _maxStepsPerLoop;
+    float _alpha;
+
+    double _lastFrame;   ///< Wall time of the last frame
+    double _rtfWallTime; ///< Wall time in the current real time factor window
+    double _rtfSimTime;  ///< Simulated time in the current real time factor window
+    float _realTimeFactor;
+    Histogram _frameTimes; ///< Time between frames
+    Histogram _stepTimes;  ///< Time spent in each step
+};
+
+} // namespace atta
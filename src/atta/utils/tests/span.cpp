@@ -0,0 +1,24 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/utils/span.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+
+namespace {
+TEST(Utils_Span, Subspan) {
+    int values[5] = {0, 1, 2, 3, 4};
+    Span<int> span(values, 5);
+
+    Span<int> middle = span.subspan(1, 3);
+    ASSERT_EQ(middle.size(), 3);
+    EXPECT_EQ(middle[0], 1);
+    EXPECT_EQ(middle[2], 3);
+
+    // Clamped to the end of the span
+    EXPECT_EQ(span.subspan(3, 10).size(), 2);
+    EXPECT_EQ(span.subspan(5, 1).size(), 0);
+    EXPECT_EQ(span.subspan(7, 1).size(), 0);
+    EXPECT_TRUE(span.subspan(7, 1).empty());
+}
+} // namespace
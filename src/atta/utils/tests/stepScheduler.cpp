@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: 2020-2026 Breno Cunha Queiroz
+#include <atta/utils/stepScheduler.h>
+#include <gtest/gtest.h>
+
+using namespace atta;
+
+namespace {
+
+constexpr float DT = 0.01f;
+
+TEST(Utils_StepScheduler, FixedTimestep) {
+    StepScheduler scheduler;
+    EXPECT_EQ(scheduler.update(0.0, true, DT, 1.0f, 0.0f).numSteps, 0);
+
+    // Loops faster than dt accumulate the time
+    EXPECT_EQ(scheduler.update(0.004, true, DT, 1.0f, 0.0f).numSteps, 0);
+    EXPECT_EQ(scheduler.update(0.008, true, DT, 1.0f, 0.0f).numSteps, 0);
+    EXPECT_NEAR(scheduler.getInterpolationAlpha(), 0.8f, 1e-4f);
+    EXPECT_EQ(scheduler.update(0.012, true, DT, 1.0f, 0.0f).numSteps, 1);
+    EXPECT_NEAR(scheduler.getInterpolationAlpha(), 0.2f, 1e-4f);
+
+    // Slow loops run many steps
+    EXPECT_EQ(scheduler.update(0.042, true, DT, 1.0f, 0.0f).numSteps, 3);
+
+    // Step speed scales the wall time
+    EXPECT_EQ(scheduler.update(0.052, true, DT, 2.0f, 0.0f).numSteps, 2);
+    EXPECT_EQ(scheduler.update(0.062, true, DT, 0.5f, 0.0f).numSteps, 0);
+
+    // As fast as possible
+    EXPECT_EQ(scheduler.update(0.063, true, DT, 0.0f, 0.0f).numSteps, 1);
+    EXPECT_EQ(scheduler.getTimeToNextEvent(0.063), 0.0);
+    EXPECT_EQ(scheduler.getInterpolationAlpha(), 1.0f);
+
+    // Stopped
+    EXPECT_EQ(scheduler.update(1.0, false, DT, 1.0f, 0.0f).numSteps, 0);
+    EXPECT_EQ(scheduler.getInterpolationAlpha(), 1.0f);
+}
+
+TEST(Utils_StepScheduler, CatchUpLimit) {
+    StepScheduler scheduler;
+    scheduler.setMaxStepsPerLoop(4);
+    scheduler.update(0.0, true, DT, 1.0f, 0.0f);
+    EXPECT_EQ(scheduler.update(0.1, true, DT, 1.0f, 0.0f).numSteps, 4);
+    // The time that could not be simulated was dropped
+    EXPECT_EQ(scheduler.update(0.105, true, DT, 1.0f, 0.0f).numSteps, 0);
+    EXPECT_EQ(scheduler.update(0.111, true, DT, 1.0f, 0.0f).numSteps, 1);
+
+    // Resuming does not simulate the paused time
+    scheduler.update(0.2, false, DT, 1.0f, 0.0f);
+    EXPECT_EQ(scheduler.update(5.0, true, DT, 1.0f, 0.0f).numSteps, 0);
+}
+
+TEST(Utils_StepScheduler, RenderRate) {
+    StepScheduler scheduler;
+    int numFrames = 0;
+    int numSteps = 0;
+    // One second of loops every millisecond, simulation at 100Hz and rendering at 30Hz
+    for (int i = 0; i <= 1000; i++) {
+        StepScheduler::Plan plan = scheduler.update(i * 0.001, true, DT, 1.0f, 30.0f);
+        numFrames += plan.render;
+        numSteps += plan.numSteps;
+    }
+    EXPECT_NEAR(numFrames, 30, 1);
+    EXPECT_NEAR(numSteps, 100, 1);
+    EXPECT_NEAR(scheduler.getRealTimeFactor(), 1.0f, 0.02f);
+    EXPECT_EQ(scheduler.getFrameTimes().getTotal(), uint32_t(numFrames - 1));
+
+    // Sleep until the next step
+    scheduler.update(2.0, true, DT, 1.0f, 0.0f);
+    scheduler.update(2.004, true, DT, 1.0f, 0.0f);
+    EXPECT_NEAR(scheduler.getTimeToNextEvent(2.004), 0.006, 1e-6);
+    EXPECT_NEAR(scheduler.getTimeToNextEvent(2.008), 0.002, 1e-6);
+}
+
+TEST(Utils_StepScheduler, Histogram) {
+    StepScheduler::Histogram histogram;
+    histogram.add(0.0005f);
+    histogram.add(0.0025f);
+    histogram.add(1.0f);
+    EXPECT_EQ(histogram.counts[0], 1);
+    EXPECT_EQ(histogram.counts[2], 1);
+    EXPECT_EQ(histogram.counts[StepScheduler::Histogram::NUM_BINS - 1], 1);
+    EXPECT_EQ(histogram.getTotal(), 3);
+    histogram.clear();
+    EXPECT_EQ(histogram.getTotal(), 0);
+}
+
+} // namespace
@@ -10,6 +10,8 @@ set(BUILD_CPU_DEMOS OFF CACHE INTERNAL "" FORCE)
 set(BUILD_EXTRAS OFF CACHE INTERNAL "" FORCE)
 set(INSTALL_LIBS OFF CACHE INTERNAL "" FORCE)
 set(INSTALL_CMAKE_FILES OFF CACHE INTERNAL "" FORCE)
+# Thread-safe build, needed by the multithreaded dynamics world
+set(BULLET2_MULTITHREADING ON CACHE INTERNAL "" FORCE)
 
 FetchContent_Declare(
     bullet3
@@ -27,6 +29,7 @@ atta_add_include_dirs(
 
 set(ATTA_BULLET_TARGETS "BulletDynamics;BulletCollision;LinearMath")
 atta_add_libs(${ATTA_BULLET_TARGETS})
+atta_add_definition(BT_THREADSAFE=1)
 
 atta_log(Success Extern "Bullet support (source)")
 set(ATTA_BULLET_SUPPORT TRUE)